@@ -415,6 +415,20 @@ public:
             const IColumn * nested_column = &column->getNestedColumn();
             const UInt8 * null_map = column->getNullMapData().data();
 
+            // Most of the nested functions only have a row by row implementation of the not null version
+            if (mem_utils::memoryIsZero(null_map + start_offset, batch_size))
+            {
+                this->nested_function->addBatchSinglePlace(
+                    start_offset,
+                    batch_size,
+                    this->nestedPlace(place),
+                    &nested_column,
+                    arena,
+                    if_argument_pos);
+                this->setFlag(place);
+                return;
+            }
+
             this->nested_function->addBatchSinglePlaceNotNull(
                 start_offset,
                 batch_size,
@@ -56,10 +56,45 @@ struct AggregateFunctionSumData
         Impl::add(sum, value);
     }
 
+    /// Adding to the boost Int256 is much slower than adding to Int128. The inputs of a Decimal256 sum are mostly
+    /// narrower, so they are summed in a local Int128, which is added to `sum` before it overflows and at the end.
+    template <typename Value>
+    static constexpr bool sum_in_int128 = std::is_same_v<T, Decimal256> && !std::is_same_v<Value, Decimal256>;
+
+    template <typename Value, bool has_null_map>
+    void NO_SANITIZE_UNDEFINED ALWAYS_INLINE
+    addManyInInt128(const Value * __restrict ptr, const UInt8 * __restrict null_map, size_t count)
+    {
+        Int128 local_sum = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if constexpr (has_null_map)
+            {
+                if (null_map[i])
+                    continue;
+            }
+            const auto value = static_cast<Int128>(ptr[i].value);
+            Int128 new_sum;
+            if (unlikely(__builtin_add_overflow(local_sum, value, &new_sum)))
+            {
+                Impl::add(sum, Decimal128(local_sum));
+                new_sum = value;
+            }
+            local_sum = new_sum;
+        }
+        Impl::add(sum, Decimal128(local_sum));
+    }
+
     /// Vectorized version
     template <typename Value>
     void NO_SANITIZE_UNDEFINED NO_INLINE addMany(const Value * __restrict ptr, size_t count)
     {
+        if constexpr (sum_in_int128<Value>)
+        {
+            addManyInInt128<Value, false>(ptr, nullptr, count);
+            return;
+        }
+
         const auto * end = ptr + count;
 
         if constexpr (std::is_floating_point_v<T>)
@@ -98,6 +133,12 @@ struct AggregateFunctionSumData
     void NO_SANITIZE_UNDEFINED NO_INLINE
     addManyNotNull(const Value * __restrict ptr, const UInt8 * __restrict null_map, size_t count)
     {
+        if constexpr (sum_in_int128<Value>)
+        {
+            addManyInInt128<Value, true>(ptr, null_map, count);
+            return;
+        }
+
         const auto * end = ptr + count;
 
         if constexpr (std::is_floating_point_v<T>)
@@ -0,0 +1,58 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AggregateFunctions/AggregateFunctionSum.h>
+#include <TestUtils/TiFlashTestBasic.h>
+
+#include <limits>
+#include <vector>
+
+namespace DB
+{
+namespace tests
+{
+TEST(AggregateFunctionSumDataTest, Decimal256SumOfDecimal128)
+try
+{
+    // Large enough to overflow the local Int128 sum in a few rows.
+    const Int128 big = static_cast<Int128>(1) << 125;
+    std::vector<Decimal128> values{big, big, -1, big, big, big, 7, -big};
+    std::vector<UInt8> null_map{0, 0, 0, 1, 0, 0, 1, 0};
+
+    Int256 expected_all = 0;
+    Int256 expected_not_null = 0;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        expected_all += static_cast<Int256>(values[i].value);
+        if (!null_map[i])
+            expected_not_null += static_cast<Int256>(values[i].value);
+    }
+
+    AggregateFunctionSumData<Decimal256> sum_all;
+    sum_all.addMany(values.data(), values.size());
+    ASSERT_EQ(sum_all.get().value, expected_all);
+
+    AggregateFunctionSumData<Decimal256> sum_not_null;
+    sum_not_null.addManyNotNull(values.data(), null_map.data(), values.size());
+    ASSERT_EQ(sum_not_null.get().value, expected_not_null);
+
+    std::vector<Decimal64> small_values{1, -2, 3, std::numeric_limits<Int64>::max()};
+    AggregateFunctionSumData<Decimal256> sum_small;
+    sum_small.addMany(small_values.data(), small_values.size());
+    ASSERT_EQ(sum_small.get().value, static_cast<Int256>(std::numeric_limits<Int64>::max()) + 2);
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
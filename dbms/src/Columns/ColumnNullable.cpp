@@ -20,6 +20,7 @@
 #include <Common/assert_cast.h>
 #include <Common/typeid_cast.h>
 #include <DataStreams/ColumnGathererStream.h>
+#include <common/mem_utils.h>
 #include <fmt/core.h>
 
 
@@ -74,20 +75,17 @@ void ColumnNullable::updateHashWithValues(
     String & sort_key_container) const
 {
     const auto & arr = getNullMapData();
-    size_t null_count = 0;
 
-    /// TODO: use an more efficient way to calc the sum.
-    for (const auto i : arr)
-    {
-        null_count += i;
-    }
-
-    if (null_count == 0)
+    if (mem_utils::memoryIsZero(arr.data(), arr.size()))
     {
         getNestedColumn().updateHashWithValues(hash_values, collator, sort_key_container);
     }
     else
     {
+        size_t null_count = 0;
+        for (const auto i : arr)
+            null_count += i;
+
         IColumn::HashValues original_values;
         original_values.reserve(null_count);
         for (size_t i = 0, n = arr.size(); i < n; ++i)
@@ -119,10 +117,17 @@ void ColumnNullable::updateWeakHash32(
                 hash.getData().size()),
             ErrorCodes::LOGICAL_ERROR);
 
+    const auto & null_map_data = getNullMapData();
+    // No need to keep the old hash values if there is no null
+    if (mem_utils::memoryIsZero(null_map_data.data(), s))
+    {
+        nested_column->updateWeakHash32(hash, collator, sort_key_container);
+        return;
+    }
+
     WeakHash32 old_hash = hash;
     nested_column->updateWeakHash32(hash, collator, sort_key_container);
 
-    const auto & null_map_data = getNullMapData();
     auto & hash_data = hash.getData();
     auto & old_hash_data = old_hash.getData();
 
@@ -283,6 +283,48 @@ void ColumnString::gather(ColumnGathererStream & gatherer)
 }
 
 
+void ColumnString::scatterStringsTo(ScatterColumns & columns, const Selector & selector) const
+{
+    const size_t num_rows = size();
+    if (num_rows != selector.size())
+        throw Exception(
+            fmt::format("Size of selector: {} doesn't match size of column: {}", selector.size(), num_rows),
+            ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH);
+
+    const size_t num_columns = columns.size();
+    std::vector<size_t> char_pos(num_columns, 0);
+    std::vector<size_t> offset_pos(num_columns, 0);
+    for (size_t i = 0; i < num_rows; ++i)
+    {
+        char_pos[selector[i]] += sizeAt(i);
+        ++offset_pos[selector[i]];
+    }
+
+    // Append the space for the selected rows, and start writing from the old ends
+    std::vector<ColumnString *> dsts(num_columns);
+    for (size_t i = 0; i < num_columns; ++i)
+    {
+        dsts[i] = static_cast<ColumnString *>(columns[i].get());
+        const size_t old_chars_size = dsts[i]->chars.size();
+        const size_t old_offsets_size = dsts[i]->offsets.size();
+        dsts[i]->chars.resize(old_chars_size + char_pos[i]);
+        dsts[i]->offsets.resize(old_offsets_size + offset_pos[i]);
+        char_pos[i] = old_chars_size;
+        offset_pos[i] = old_offsets_size;
+    }
+
+    for (size_t i = 0; i < num_rows; ++i)
+    {
+        const auto index = selector[i];
+        auto & dst = *dsts[index];
+        const size_t string_size = sizeAt(i);
+        // The bytes written over the end are overwritten by the next string or land in the padding of `chars`
+        memcpySmallAllowReadWriteOverflow15(&dst.chars[char_pos[index]], &chars[offsetAt(i)], string_size);
+        char_pos[index] += string_size;
+        dst.offsets[offset_pos[index]++] = char_pos[index];
+    }
+}
+
 void ColumnString::reserve(size_t n)
 {
     offsets.reserve(n);
@@ -326,14 +326,22 @@ public:
 
     MutableColumns scatter(ColumnIndex num_columns, const Selector & selector) const override
     {
-        return scatterImpl<ColumnString>(num_columns, selector);
+        ScatterColumns columns;
+        columns.reserve(num_columns);
+        for (ColumnIndex i = 0; i < num_columns; ++i)
+            columns.emplace_back(cloneEmpty());
+        scatterStringsTo(columns, selector);
+        return columns;
     }
 
     void scatterTo(ScatterColumns & columns, const Selector & selector) const override
     {
-        scatterToImpl<ColumnString>(columns, selector);
+        scatterStringsTo(columns, selector);
     }
 
+    /// Size the destinations by the selected bytes first, then copy the strings without growing the arrays row by row.
+    void scatterStringsTo(ScatterColumns & columns, const Selector & selector) const;
+
     void gather(ColumnGathererStream & gatherer_stream) override;
 
     void reserve(size_t n) override;
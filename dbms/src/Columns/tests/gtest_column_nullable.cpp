@@ -0,0 +1,51 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Columns/ColumnNullable.h>
+#include <Common/WeakHash.h>
+#include <TestUtils/FunctionTestUtils.h>
+#include <TestUtils/TiFlashTestBasic.h>
+
+namespace DB
+{
+namespace tests
+{
+TEST(ColumnNullableTest, UpdateWeakHash32)
+try
+{
+    const auto nested = createColumn<Int64>({1, 2, 3, 4}).column;
+    const auto no_null = createColumn<Nullable<Int64>>({1, 2, 3, 4}).column;
+    const auto with_null = createColumn<Nullable<Int64>>({1, {}, 3, {}}).column;
+    String sort_key_container;
+
+    WeakHash32 nested_hash(nested->size());
+    nested->updateWeakHash32(nested_hash, nullptr, sort_key_container);
+
+    // Without nulls, the hash is the same as the nested column
+    WeakHash32 no_null_hash(no_null->size());
+    no_null->updateWeakHash32(no_null_hash, nullptr, sort_key_container);
+    ASSERT_TRUE(no_null_hash.getData() == nested_hash.getData());
+
+    // The hash of the null rows is kept
+    WeakHash32 with_null_hash(with_null->size());
+    with_null->updateWeakHash32(with_null_hash, nullptr, sort_key_container);
+    ASSERT_EQ(with_null_hash.getData()[0], nested_hash.getData()[0]);
+    ASSERT_EQ(with_null_hash.getData()[1], WeakHash32::initial_hash);
+    ASSERT_EQ(with_null_hash.getData()[2], nested_hash.getData()[2]);
+    ASSERT_EQ(with_null_hash.getData()[3], WeakHash32::initial_hash);
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -124,6 +124,41 @@ try
 }
 CATCH
 
+TEST_F(TestColumnScatterTo, TestColumnStringOfVariousLengths)
+try
+{
+    auto col = ColumnString::create();
+    IColumn::Selector selector;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const String s(i % 7 == 0 ? 0 : (i * 13) % 100, static_cast<char>('a' + i % 26));
+        col->insertData(s.data(), s.size());
+        selector.push_back((i * 7) % scattered_num_column);
+    }
+
+    // Append to the non-empty destinations, the result must be the same as inserting the rows one by one
+    MutableColumns expected(scattered_num_column);
+    MutableColumns actual(scattered_num_column);
+    for (size_t i = 0; i < scattered_num_column; ++i)
+    {
+        expected[i] = ColumnString::create();
+        expected[i]->insertData("prefix", 6);
+        actual[i] = expected[i]->cloneResized(1);
+    }
+    for (size_t i = 0; i < col->size(); ++i)
+        expected[selector[i]]->insertFrom(*col, i);
+    col->scatterTo(actual, selector);
+
+    auto type = std::make_shared<DataTypeString>();
+    for (size_t i = 0; i < scattered_num_column; ++i)
+    {
+        ColumnWithTypeAndName expected_col(std::move(expected[i]), type, "");
+        ColumnWithTypeAndName actual_col(std::move(actual[i]), type, "");
+        compareColumn(expected_col, actual_col);
+    }
+}
+CATCH
+
 TEST_F(TestColumnScatterTo, TestColumnFixedString)
 try
 {
@@ -20,6 +20,7 @@
 
 #include <Common/Exception.h>
 #include <Common/MemoryTracker.h>
+#include <Common/ProfileEvents.h>
 #include <Common/formatReadable.h>
 #include <IO/WriteHelpers.h>
 #include <common/mremap.h>
@@ -37,6 +38,7 @@
 namespace DB
 {
 std::atomic_size_t allocator_mmap_counter;
+std::atomic_size_t allocator_huge_page_threshold{0};
 namespace ErrorCodes
 {
 extern const int BAD_ARGUMENTS;
@@ -46,6 +48,11 @@ extern const int CANNOT_MREMAP;
 } // namespace ErrorCodes
 } // namespace DB
 
+namespace ProfileEvents
+{
+extern const Event AllocatorHugePageAdvisedBytes;
+} // namespace ProfileEvents
+
 
 /** Many modern allocators (for example, tcmalloc) do not do a mremap for realloc,
   *  even in case of large enough chunks of memory.
@@ -60,6 +67,30 @@ extern const int CANNOT_MREMAP;
 static constexpr size_t MMAP_THRESHOLD = 64 * (1ULL << 30);
 static constexpr size_t MMAP_MIN_ALIGNMENT = 4096;
 static constexpr size_t MALLOC_MIN_ALIGNMENT = 8;
+static constexpr size_t HUGE_PAGE_SIZE = 2 * (1ULL << 20);
+
+/// The large hash tables of aggregation and join are accessed randomly, with 4 KiB pages they miss the TLB on almost
+/// every access. Advise the kernel to back them by transparent huge pages, which works when THP is enabled in
+/// "madvise" or "always" mode. Only the huge pages fully inside the buffer can be advised.
+static void adviseHugePages(void * buf, size_t size)
+{
+#if defined(MADV_HUGEPAGE)
+    const size_t threshold = DB::allocator_huge_page_threshold.load(std::memory_order_relaxed);
+    if (threshold == 0 || size < threshold)
+        return;
+
+    const auto addr = reinterpret_cast<uintptr_t>(buf);
+    const uintptr_t begin = (addr + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    const uintptr_t end = (addr + size) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    if (begin >= end)
+        return;
+    // It is only an advice, ignore the failure
+    if (0 == madvise(reinterpret_cast<void *>(begin), end - begin, MADV_HUGEPAGE))
+        ProfileEvents::increment(ProfileEvents::AllocatorHugePageAdvisedBytes, end - begin);
+#else
+    UNUSED(buf, size);
+#endif
+}
 
 
 template <bool clear_memory_>
@@ -117,6 +148,9 @@ void * Allocator<clear_memory_>::alloc(size_t size, size_t alignment)
         }
     }
 
+    if constexpr (clear_memory)
+        adviseHugePages(buf, size);
+
     return buf;
 }
 
@@ -163,6 +197,9 @@ void * Allocator<clear_memory_>::realloc(void * buf, size_t old_size, size_t new
 
         if (clear_memory && new_size > old_size)
             memset(reinterpret_cast<char *>(buf) + old_size, 0, new_size - old_size);
+
+        if constexpr (clear_memory)
+            adviseHugePages(buf, new_size);
     }
     else if (old_size >= MMAP_THRESHOLD && new_size >= MMAP_THRESHOLD)
     {
@@ -21,6 +21,9 @@
 namespace DB
 {
 extern std::atomic_size_t allocator_mmap_counter;
+/// The memory of hash tables (Allocator<true>) not smaller than this size is advised to be backed by transparent huge
+/// pages. 0 means disabled.
+extern std::atomic_size_t allocator_huge_page_threshold;
 }
 /** Responsible for allocating / freeing memory. Used, for example, in PODArray, Arena.
   * Also used in hash tables.
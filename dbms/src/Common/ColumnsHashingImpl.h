@@ -21,6 +21,8 @@
 #include <Functions/FunctionHelpers.h>
 #include <Interpreters/AggregationCommon.h>
 
+#include <optional>
+
 
 namespace DB
 {
@@ -139,6 +141,19 @@ public:
         return emplaceImpl(key_holder, data);
     }
 
+    /// Same as above, but use the hash value calculated by `getHash` in advance.
+    template <typename Data>
+    ALWAYS_INLINE inline EmplaceResult emplaceKey(
+        Data & data,
+        size_t row,
+        Arena & pool,
+        std::vector<String> & sort_key_containers,
+        size_t hash_value)
+    {
+        auto key_holder = static_cast<Derived &>(*this).getKeyHolder(row, &pool, sort_key_containers);
+        return emplaceImpl(key_holder, data, hash_value);
+    }
+
     template <typename Data>
     ALWAYS_INLINE inline FindResult findKey(
         Data & data,
@@ -158,7 +173,10 @@ public:
         std::vector<String> & sort_key_containers)
     {
         auto key_holder = static_cast<Derived &>(*this).getKeyHolder(row, &pool, sort_key_containers);
-        return data.hash(keyHolderGetKey(key_holder));
+        size_t hash_value = data.hash(keyHolderGetKey(key_holder));
+        /// The key is not inserted, release the memory of it in the pool if any.
+        keyHolderDiscardKey(key_holder);
+        return hash_value;
     }
 
 protected:
@@ -180,7 +198,10 @@ protected:
     }
 
     template <typename Data, typename KeyHolder>
-    ALWAYS_INLINE inline EmplaceResult emplaceImpl(KeyHolder & key_holder, Data & data)
+    ALWAYS_INLINE inline EmplaceResult emplaceImpl(
+        KeyHolder & key_holder,
+        Data & data,
+        std::optional<size_t> hash_value = std::nullopt)
     {
         if constexpr (Cache::consecutive_keys_optimization)
         {
@@ -195,7 +216,10 @@ protected:
 
         typename Data::LookupResult it;
         bool inserted = false;
-        data.emplace(key_holder, it, inserted);
+        if (hash_value)
+            data.emplace(key_holder, it, inserted, *hash_value);
+        else
+            data.emplace(key_holder, it, inserted);
 
         [[maybe_unused]] Mapped * cached = nullptr;
         if constexpr (has_mapped)
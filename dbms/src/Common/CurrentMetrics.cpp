@@ -49,6 +49,7 @@
     M(DT_DeltaIndexCacheSize)                   \
     M(RaftNumSnapshotsPendingApply)             \
     M(RaftNumPrehandlingSubTasks)               \
+    M(RaftNumWaitingPrehandleSubTasks)          \
     M(RaftNumParallelPrehandlingTasks)          \
     M(RateLimiterPendingWriteRequest)           \
     M(DT_SegmentReadTasks)                      \
@@ -62,6 +63,7 @@
     M(DT_SnapshotOfPlaceIndex)                  \
     M(DT_SnapshotOfBitmapFilter)                \
     M(DT_SnapshotOfDisaggReadNodeRead)          \
+    M(DT_DMFileReadAheadPendingPacks)           \
     M(IOLimiterPendingBgWriteReq)               \
     M(IOLimiterPendingFgWriteReq)               \
     M(IOLimiterPendingBgReadReq)                \
@@ -85,7 +87,8 @@
     M(ConnectionPoolSize)                       \
     M(MemoryTrackingQueryStorageTask)           \
     M(MemoryTrackingFetchPages)                 \
-    M(MemoryTrackingSharedColumnData)
+    M(MemoryTrackingSharedColumnData)           \
+    M(StartupPendingTables)
 
 namespace CurrentMetrics
 {
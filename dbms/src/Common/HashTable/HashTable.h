@@ -1068,6 +1068,10 @@ public:
         return const_cast<std::decay_t<decltype(*this)> *>(this)->find(x, hash_value);
     }
 
+    /// Prefetch the cell where the lookup of a key with `hash_value` starts, so that a batch of lookups can
+    /// overlap their cache misses.
+    void ALWAYS_INLINE prefetch(size_t hash_value) const { __builtin_prefetch(&buf[grower.place(hash_value)]); }
+
     std::enable_if_t<Grower::performs_linear_probing_with_single_step, bool> ALWAYS_INLINE erase(const Key & x)
     {
         return erase(x, hash(x));
@@ -285,6 +285,8 @@ public:
         impls[buck].emplace(key_holder, it, inserted, hash_value);
     }
 
+    void ALWAYS_INLINE prefetch(size_t hash_value) const { impls[getBucketFromHash(hash_value)].prefetch(hash_value); }
+
     LookupResult ALWAYS_INLINE find(Key x, size_t hash_value)
     {
         size_t buck = getBucketFromHash(hash_value);
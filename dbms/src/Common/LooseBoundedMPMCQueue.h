@@ -231,12 +231,14 @@ private:
 
     ALWAYS_INLINE T popBack()
     {
-        auto element = std::move(queue.back());
+        /// Move the data out instead of copying it, copying a shared_ptr costs atomic operations in the hot path
+        /// of exchanging packets.
+        T data = std::move(queue.back().data);
+        current_auxiliary_memory_usage -= queue.back().memory_usage;
         queue.pop_back();
-        current_auxiliary_memory_usage -= element.memory_usage;
         assert(!queue.empty() || current_auxiliary_memory_usage == 0);
         writer_head.notifyNext();
-        return element.data;
+        return data;
     }
 
     template <typename U>
@@ -270,7 +272,7 @@ private:
     {
         T data;
         Int64 memory_usage;
-        DataWithMemoryUsage(const T && data_, Int64 memory_usage_)
+        DataWithMemoryUsage(T && data_, Int64 memory_usage_)
             : data(std::move(data_))
             , memory_usage(memory_usage_)
         {}
@@ -368,6 +368,11 @@ void disableThreshold()
     MEMORY_TRACER_SUBMIT_THRESHOLD = 0;
 }
 
+void setSubmitThreshold(Int64 threshold)
+{
+    MEMORY_TRACER_SUBMIT_THRESHOLD = threshold;
+}
+
 void submitLocalDeltaMemory()
 {
     if (current_memory_tracker)
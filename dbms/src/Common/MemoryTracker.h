@@ -146,6 +146,9 @@ public:
     /// Reset the accumulated data.
     void reset();
 
+    /// Reset the peak to the current amount, so that the peak of the following period can be measured.
+    void resetPeak() { peak.store(amount.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
     /// Prints info about peak memory consumption into log.
     void logPeakMemoryUsage() const;
 };
@@ -180,6 +183,9 @@ void initStorageMemoryTracker(Int64 limit, Int64 larger_than_limit);
 namespace CurrentMemoryTracker
 {
 void disableThreshold();
+/// Set the bytes that a thread accumulates locally before submitting them to current_memory_tracker.
+/// A larger threshold reduces the contention on the shared trackers, at the cost of a less accurate amount.
+void setSubmitThreshold(Int64 threshold);
 void submitLocalDeltaMemory();
 Int64 getLocalDeltaMemory();
 void alloc(Int64 size);
@@ -1545,6 +1545,67 @@ void convertTimeZoneByOffset(UInt64 from_time, UInt64 & to_time, bool from_utc,
     convertTimeZoneImpl(from_time, to_time, time_zone_utc, time_zone_utc, from_utc, offset, throw_exception);
 }
 
+void convertTimeZoneByOffset(
+    const UInt64 * from_times,
+    UInt64 * to_times,
+    size_t size,
+    bool from_utc,
+    Int64 offset,
+    bool throw_exception)
+{
+    static const auto & time_zone_utc = DateLUT::instance("UTC");
+    constexpr UInt64 micro_second_bits = 24;
+    constexpr UInt64 hms_bits = 17;
+    constexpr time_t seconds_per_day = 86400;
+
+    // The start of the last day seen on both sides. UTC has no offset change, so the time in a day is plain arithmetic.
+    UInt64 from_ymd = std::numeric_limits<UInt64>::max();
+    time_t from_day_start = 0;
+    UInt64 to_ymd = 0;
+    time_t to_day_start = 0;
+    bool to_day_cached = false;
+    for (size_t i = 0; i < size; ++i)
+    {
+        const UInt64 from_time = from_times[i];
+        if (isZeroDate(from_time))
+        {
+            to_times[i] = from_time;
+            continue;
+        }
+
+        const UInt64 ymd = from_time >> (micro_second_bits + hms_bits);
+        if (ymd != from_ymd)
+        {
+            MyDateTime from_my_time(from_time);
+            from_day_start = time_zone_utc.makeDate(from_my_time.year, from_my_time.month, from_my_time.day);
+            from_ymd = ymd;
+        }
+        const auto hms = static_cast<time_t>((from_time >> micro_second_bits) & ((1 << hms_bits) - 1));
+        const time_t from_epoch = from_day_start + (hms >> 12) * 3600 + ((hms >> 6) & 63) * 60 + (hms & 63);
+        const time_t utc_epoch = from_utc ? from_epoch : from_epoch - offset;
+        const time_t to_epoch = from_utc ? from_epoch + offset : from_epoch - offset;
+
+        if (!to_day_cached || to_epoch < to_day_start || to_epoch >= to_day_start + seconds_per_day)
+        {
+            const auto & values = time_zone_utc.getValues(to_epoch);
+            to_day_cached = utc_epoch > 0 && to_epoch >= values.date && to_epoch < values.date + seconds_per_day;
+            to_day_start = values.date;
+            to_ymd = ((values.year * 13 + values.month) << 5) | values.day_of_month;
+        }
+        if (unlikely(!to_day_cached || utc_epoch <= 0))
+        {
+            // Out of the range of the date lut or before 1970, let the row by row version handle it.
+            convertTimeZoneByOffset(from_time, to_times[i], from_utc, offset, throw_exception);
+            continue;
+        }
+
+        const UInt64 seconds = to_epoch - to_day_start;
+        const UInt64 to_hms = (seconds / 3600) << 12 | (seconds / 60 % 60) << 6 | (seconds % 60);
+        to_times[i] = (to_ymd << hms_bits | to_hms) << micro_second_bits
+            | (from_time & ((1ULL << micro_second_bits) - 1));
+    }
+}
+
 MyDateTime convertUTC2TimeZone(time_t utc_ts, UInt32 micro_second, const DateLUTImpl & time_zone_to)
 {
     return MyDateTime(
@@ -231,6 +231,16 @@ void convertTimeZoneByOffset(
     Int64 offset,
     bool throw_exception = false);
 
+/// Same as calling convertTimeZoneByOffset for every row, but the rows of a block are mostly in a few days, so the
+/// start of the last seen day is cached instead of looking up the date lut for every field.
+void convertTimeZoneByOffset(
+    const UInt64 * from_times,
+    UInt64 * to_times,
+    size_t size,
+    bool from_utc,
+    Int64 offset,
+    bool throw_exception = false);
+
 MyDateTime convertUTC2TimeZone(time_t utc_ts, UInt32 micro_second, const DateLUTImpl & time_zone_to);
 
 MyDateTime convertUTC2TimeZoneByOffset(time_t utc_ts, UInt32 micro_second, Int64 offset);
@@ -0,0 +1,111 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/PerfEventCounters.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#endif
+
+namespace DB::PerfEventCounters
+{
+std::atomic<bool> enabled{false};
+
+#if defined(__linux__)
+namespace
+{
+constexpr size_t num_events = 4;
+
+/// The counters are opened as a group led by the cycles counter, so that they can be read by one syscall.
+class ThreadPerfEvents
+{
+public:
+    ThreadPerfEvents()
+    {
+        static constexpr std::array<UInt64, num_events> configs{
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES,
+        };
+        for (size_t i = 0; i < num_events; ++i)
+        {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = configs[i];
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // Count the current thread on any cpu
+            fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds[0], 0));
+            if (fds[i] < 0)
+            {
+                closeAll();
+                return;
+            }
+        }
+    }
+
+    ~ThreadPerfEvents() { closeAll(); }
+
+    bool read(PerfEventValues & values) const
+    {
+        if (fds[0] < 0)
+            return false;
+        // {nr, values[nr]}
+        UInt64 buf[1 + num_events];
+        if (::read(fds[0], buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf)) || buf[0] != num_events)
+            return false;
+        values.cycles = buf[1];
+        values.instructions = buf[2];
+        values.cache_misses = buf[3];
+        values.branch_misses = buf[4];
+        return true;
+    }
+
+private:
+    void closeAll()
+    {
+        for (auto & fd : fds)
+        {
+            if (fd >= 0)
+                close(fd);
+            fd = -1;
+        }
+    }
+
+    std::array<int, num_events> fds{-1, -1, -1, -1};
+};
+} // namespace
+
+bool read(PerfEventValues & values)
+{
+    thread_local ThreadPerfEvents thread_perf_events;
+    return thread_perf_events.read(values);
+}
+#else
+bool read(PerfEventValues &)
+{
+    return false;
+}
+#endif
+
+} // namespace DB::PerfEventCounters
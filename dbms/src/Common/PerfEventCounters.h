@@ -0,0 +1,61 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <common/types.h>
+
+#include <atomic>
+
+namespace DB
+{
+/// Hardware counters of a thread.
+struct PerfEventValues
+{
+    UInt64 cycles = 0;
+    UInt64 instructions = 0;
+    UInt64 cache_misses = 0;
+    UInt64 branch_misses = 0;
+
+    /// Add the counters increased from `begin` to `end`.
+    void addDiff(const PerfEventValues & begin, const PerfEventValues & end)
+    {
+        cycles += end.cycles - begin.cycles;
+        instructions += end.instructions - begin.instructions;
+        cache_misses += end.cache_misses - begin.cache_misses;
+        branch_misses += end.branch_misses - begin.branch_misses;
+    }
+
+    void merge(const PerfEventValues & other)
+    {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        cache_misses += other.cache_misses;
+        branch_misses += other.branch_misses;
+    }
+};
+
+/// Read the hardware counters of the current thread by perf_event_open(2).
+/// The counters are opened on the first read of each thread. They are not available if the platform is not Linux, or
+/// the kernel forbids it by `kernel.perf_event_paranoid`, or the node is a VM without PMU.
+namespace PerfEventCounters
+{
+/// Whether the operators collect the counters, it costs a syscall for each call of the operators.
+extern std::atomic<bool> enabled;
+
+/// Return false if the counters are not available on the current thread.
+bool read(PerfEventValues & values);
+} // namespace PerfEventCounters
+
+} // namespace DB
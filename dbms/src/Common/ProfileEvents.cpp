@@ -35,9 +35,16 @@
     M(UncompressedCacheWeightLost)             \
     M(MarkCacheHits)                           \
     M(MarkCacheMisses)                         \
+    M(DMStableResultCacheHits)                 \
+    M(DMStableResultCacheMisses)               \
+    M(DMBitmapFilterCacheHits)                 \
+    M(DMBitmapFilterCacheMisses)               \
+    M(DMFilePackCacheHits)                     \
+    M(DMFilePackCacheMisses)                   \
                                                \
     M(ExternalAggregationCompressedBytes)      \
     M(ExternalAggregationUncompressedBytes)    \
+    M(AllocatorHugePageAdvisedBytes)           \
                                                \
     M(ContextLock)                             \
     M(CreatedHTTPConnections)                  \
@@ -71,6 +78,8 @@
     M(PSMReadBytes)                            \
     M(PSMWriteFailed)                          \
     M(PSMReadFailed)                           \
+    M(PSMPageCacheHits)                        \
+    M(PSMPageCacheMisses)                      \
                                                \
     M(PSMVCCApplyOnCurrentBase)                \
     M(PSMVCCApplyOnCurrentDelta)               \
@@ -110,6 +119,8 @@
     M(DMSegmentMergeNS)                        \
     M(DMFlushDeltaCache)                       \
     M(DMFlushDeltaCacheNS)                     \
+    M(DMMemTableCompressedBytes)               \
+    M(DMMemTableDecompressedBytes)             \
     M(DMCleanReadRows)                         \
     M(DMSegmentIsEmptyFastPath)                \
     M(DMSegmentIsEmptySlowPath)                \
@@ -121,9 +132,18 @@
     M(DMFileFilterNoFilter)                    \
     M(DMFileFilterAftPKAndPackSet)             \
     M(DMFileFilterAftRoughSet)                 \
+    M(DMFileReadAheadRequest)                  \
+    M(DMFileReadAheadBytes)                    \
+    M(DMFileDropPageCacheBytes)                \
+    M(DMFileCircularScan)                      \
                                                \
     M(ChecksumDigestBytes)                     \
                                                \
+    M(CompressedBlocksStoredRaw)               \
+    M(QplHardwareDecompress)                   \
+    M(QplSoftwareDecompress)                   \
+    M(QplJobPoolExhausted)                     \
+                                               \
     M(RaftWaitIndexTimeout)                    \
                                                \
     M(S3WriteBytes)                            \
@@ -26,6 +26,7 @@ class Redact
 {
 public:
     static void setRedactLog(bool v);
+    static bool isRedactLog() { return REDACT_LOG.load(std::memory_order_relaxed); }
 
     static std::string handleToDebugString(int64_t handle);
     static std::string keyToDebugString(const char * key, size_t size);
@@ -0,0 +1,142 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/HashTable/Hash.h>
+#include <Common/LRUCache.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace DB
+{
+/// A cache with the same interface as LRUCache, but the entries are distributed to several LRUCache shards by the
+/// hash of keys. Each shard has its own mutex, so that the threads hitting different keys do not contend on one lock.
+/// Each shard evicts its entries when its weight exceeds max_weight / num_shards. An entry heavier than the weight of
+/// a shard is never cached, so a small cache is split into fewer shards to keep each shard at least `min_shard_weight`.
+template <
+    typename TKey,
+    typename TMapped,
+    typename HashFunction = std::hash<TKey>,
+    typename WeightFunction = TrivialWeightFunction<TKey, TMapped>>
+class ShardedLRUCache
+{
+public:
+    using Key = TKey;
+    using Mapped = TMapped;
+    using MappedPtr = std::shared_ptr<Mapped>;
+
+    static constexpr size_t default_num_shards = 16;
+    /// For the caches weighted by bytes
+    static constexpr size_t default_min_shard_bytes = 64 * 1024 * 1024;
+
+    explicit ShardedLRUCache(size_t max_weight_, size_t num_shards = default_num_shards, size_t min_shard_weight = 1)
+    {
+        RUNTIME_CHECK(num_shards > 0);
+        num_shards = std::clamp<size_t>(max_weight_ / std::max<size_t>(min_shard_weight, 1), 1, num_shards);
+        shards.reserve(num_shards);
+        const size_t shard_max_weight = std::max(static_cast<size_t>(1), max_weight_ / num_shards);
+        for (size_t i = 0; i < num_shards; ++i)
+            shards.emplace_back(std::make_unique<Shard>(*this, shard_max_weight));
+    }
+
+    virtual ~ShardedLRUCache() = default;
+
+    MappedPtr get(const Key & key) { return getShard(key).get(key); }
+
+    void set(const Key & key, const MappedPtr & mapped) { getShard(key).set(key, mapped); }
+
+    /// See `LRUCache::getOrSet`
+    template <typename LoadFunc>
+    std::pair<MappedPtr, bool> getOrSet(const Key & key, LoadFunc && load_func)
+    {
+        return getShard(key).getOrSet(key, std::forward<LoadFunc>(load_func));
+    }
+
+    void remove(const Key & key) { getShard(key).remove(key); }
+
+    void getStats(size_t & out_hits, size_t & out_misses) const
+    {
+        out_hits = 0;
+        out_misses = 0;
+        for (const auto & shard : shards)
+        {
+            size_t hits = 0, misses = 0;
+            shard->getStats(hits, misses);
+            out_hits += hits;
+            out_misses += misses;
+        }
+    }
+
+    size_t numShards() const { return shards.size(); }
+
+    /// The hits and misses of one shard, a shard with much more hits than others means the keys are skewed.
+    void getShardStats(size_t shard_index, size_t & out_hits, size_t & out_misses) const
+    {
+        shards[shard_index]->getStats(out_hits, out_misses);
+    }
+
+    size_t weight() const
+    {
+        size_t res = 0;
+        for (const auto & shard : shards)
+            res += shard->weight();
+        return res;
+    }
+
+    size_t count() const
+    {
+        size_t res = 0;
+        for (const auto & shard : shards)
+            res += shard->count();
+        return res;
+    }
+
+    void reset()
+    {
+        for (auto & shard : shards)
+            shard->reset();
+    }
+
+private:
+    class Shard : public LRUCache<TKey, TMapped, HashFunction, WeightFunction>
+    {
+    public:
+        Shard(ShardedLRUCache & owner_, size_t max_weight_)
+            : LRUCache<TKey, TMapped, HashFunction, WeightFunction>(max_weight_)
+            , owner(owner_)
+        {}
+
+    private:
+        void onRemoveOverflowWeightLoss(size_t weight_loss) override { owner.onRemoveOverflowWeightLoss(weight_loss); }
+
+        ShardedLRUCache & owner;
+    };
+
+    Shard & getShard(const Key & key)
+    {
+        // Mix the hash value, so that the shards are not correlated with the buckets of the hash table in each shard.
+        return *shards[intHash64(hash_function(key)) % shards.size()];
+    }
+
+    /// Override this method if you want to track how much weight was lost in removeOverflow method.
+    virtual void onRemoveOverflowWeightLoss(size_t /*weight_loss*/) {}
+
+    const HashFunction hash_function;
+    std::vector<std::unique_ptr<Shard>> shards;
+};
+
+} // namespace DB
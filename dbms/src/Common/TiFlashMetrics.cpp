@@ -58,6 +58,11 @@ TiFlashMetrics::TiFlashMetrics()
                                                       .Name("tiflash_storage_sync_replica_ru")
                                                       .Help("RU for synchronous replica of keyspace")
                                                       .Register(*registry);
+
+    registered_read_thread_numa_node_family = &prometheus::BuildCounter()
+                                                   .Name("tiflash_storage_read_thread_numa_node")
+                                                   .Help("The counter of storage read threads of each NUMA node")
+                                                   .Register(*registry);
 }
 
 void TiFlashMetrics::addReplicaSyncRU(UInt32 keyspace_id, UInt64 ru)
@@ -78,6 +83,12 @@ prometheus::Counter * TiFlashMetrics::getReplicaSyncRUCounter(UInt32 keyspace_id
         = &registered_keyspace_sync_replica_ru_family->Add({{"keyspace_id", std::to_string(keyspace_id)}});
 }
 
+prometheus::Counter & TiFlashMetrics::getReadThreadNumaNodeCounter(size_t numa_node, const std::string & type)
+{
+    // `Add` returns the existing counter if the labels are the same.
+    return registered_read_thread_numa_node_family->Add({{"numa_node", std::to_string(numa_node)}, {"type", type}});
+}
+
 void TiFlashMetrics::removeReplicaSyncRUCounter(UInt32 keyspace_id)
 {
     std::unique_lock lock(replica_sync_ru_mtx);
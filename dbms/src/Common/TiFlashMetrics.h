@@ -164,6 +164,7 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       F(type_passthrough_none_compression_remote, {"type", "passthrough_none_compression_remote"}),                                 \
       F(type_passthrough_lz4_compression, {"type", "passthrough_lz4_compression"}),                                                 \
       F(type_passthrough_zstd_compression, {"type", "passthrough_zstd_compression"}))                                               \
+    M(tiflash_exchange_partition_skew_count, "Total number of hash partition writers which detect skewed partitions", Counter)      \
     M(tiflash_sync_schema_applying, "Whether the schema is applying or not (holding lock)", Gauge)                                  \
     M(tiflash_schema_trigger_count,                                                                                                 \
       "Total number of each kinds of schema sync trigger",                                                                          \
@@ -189,6 +190,12 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       F(type_sync_schema_apply_duration, {{"type", "sync_schema_duration"}}, ExpBuckets{0.001, 2, 20}),                             \
       F(type_sync_table_schema_apply_duration, {{"type", "sync_table_schema_duration"}}, ExpBuckets{0.001, 2, 20}))                 \
     M(tiflash_raft_read_index_count, "Total number of raft read index", Counter)                                                    \
+    M(tiflash_raft_read_index_events_count,                                                                                         \
+      "Raft read index event counter",                                                                                              \
+      Counter,                                                                                                                      \
+      F(type_send, {{"type", "send"}}),                                                                                             \
+      F(type_coalesce, {{"type", "coalesce"}}),                                                                                     \
+      F(type_reuse_history, {{"type", "reuse_history"}}))                                                                           \
     M(tiflash_stale_read_count, "Total number of stale read", Counter)                                                              \
     M(tiflash_raft_read_index_duration_seconds,                                                                                     \
       "Bucketed histogram of raft read index duration",                                                                             \
@@ -284,7 +291,8 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       F(type_delta_merge_by_write, {{"type", "delta_merge_by_write"}}, ExpBuckets{0.001, 2, 20}),                                   \
       F(type_delta_merge_by_delete_range, {{"type", "delta_merge_by_delete_range"}}, ExpBuckets{0.001, 2, 20}),                     \
       F(type_flush, {{"type", "flush"}}, ExpBuckets{0.001, 2, 20}),                                                                 \
-      F(type_split, {{"type", "split"}}, ExpBuckets{0.001, 2, 20}))                                                                 \
+      F(type_split, {{"type", "split"}}, ExpBuckets{0.001, 2, 20}),                                                                 \
+      F(type_slowdown, {{"type", "slowdown"}}, ExpBuckets{0.001, 2, 20}))                                                           \
     M(tiflash_storage_page_gc_count,                                                                                                \
       "Total number of page's gc execution.",                                                                                       \
       Counter,                                                                                                                      \
@@ -334,6 +342,11 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       F(type_wait_in_group, {{"type", "wait_in_group"}}, ExpBuckets{0.00005, 1.8, 26}),                                             \
       F(type_wal, {{"type", "wal"}}, ExpBuckets{0.00005, 1.8, 26}),                                                                 \
       F(type_commit, {{"type", "commit"}}, ExpBuckets{0.00005, 1.8, 26}))                                                           \
+    M(tiflash_storage_page_write_group_size,                                                                                        \
+      "Bucketed histogram of the size of each write group committed to WAL together",                                               \
+      Histogram,                                                                                                                    \
+      F(type_writers, {{"type", "writers"}}, ExpBuckets{1, 2, 10}),                                                                 \
+      F(type_records, {{"type", "records"}}, ExpBuckets{1, 2, 20}))                                                                 \
     M(tiflash_storage_logical_throughput_bytes,                                                                                     \
       "The logical throughput of read tasks of storage in bytes",                                                                   \
       Histogram,                                                                                                                    \
@@ -484,7 +497,8 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       F(type_flush_log_gap, {{"type", "flush_log_gap"}}),                                                                           \
       F(type_flush_size, {{"type", "flush_size"}}),                                                                                 \
       F(type_flush_rowcount, {{"type", "flush_rowcount"}}),                                                                         \
-      F(type_flush_eager_gc, {{"type", "flush_eager_gc"}}))                                                                         \
+      F(type_flush_eager_gc, {{"type", "flush_eager_gc"}}),                                                                         \
+      F(type_parallel_decode, {{"type", "parallel_decode"}}))                                                                       \
     M(tiflash_raft_raft_frequent_events_count,                                                                                      \
       "Raft frequent event counter",                                                                                                \
       Counter,                                                                                                                      \
@@ -509,7 +523,9 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       "Raft handled bytes in global",                                                                                               \
       Counter,                                                                                                                      \
       F(type_write, {{"type", "write"}}),                                                                                           \
-      F(type_write_committed, {{"type", "write_committed"}}))                                                                       \
+      F(type_write_committed, {{"type", "write_committed"}}),                                                                       \
+      F(type_apply_snapshot_predecode, {{"type", "apply_snapshot_predecode"}}),                                                     \
+      F(type_ingest_sst_predecode, {{"type", "ingest_sst_predecode"}}))                                                             \
     M(tiflash_raft_write_flow_bytes,                                                                                                \
       "Bucketed histogram of bytes for each write",                                                                                 \
       Histogram,                                                                                                                    \
@@ -641,7 +657,9 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       Gauge,                                                                                                                        \
       F(type_total_size, {"type", "total_size"}),                                                                                   \
       F(type_valid_size, {"type", "valid_size"}),                                                                                   \
-      F(type_num_files, {"type", "num_files"}))                                                                                     \
+      F(type_num_files, {"type", "num_files"}),                                                                                     \
+      F(type_num_files_to_compact, {"type", "num_files_to_compact"}),                                                               \
+      F(type_size_to_compact, {"type", "size_to_compact"}))                                                                         \
     M(tiflash_storage_checkpoint_seconds,                                                                                           \
       "PageStorage checkpoint elapsed time",                                                                                        \
       Histogram, /* these command usually cost several seconds, increase the start bucket to 50ms */                                \
@@ -726,6 +744,19 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       F(type_cpu_queue, {{"type", "cpu_queue"}}, ExpBuckets{0.005, 2, 20}),                                                         \
       F(type_io_queue, {{"type", "io_queue"}}, ExpBuckets{0.005, 2, 20}),                                                           \
       F(type_await, {{"type", "await"}}, ExpBuckets{0.005, 2, 20}))                                                                 \
+    M(tiflash_pipeline_query_wait_seconds,                                                                                          \
+      "Bucketed histogram of the total time that the tasks of a pipeline query wait in the task queues in seconds",                 \
+      Histogram,                                                                                                                    \
+      F(type_cpu_queue, {{"type", "cpu_queue"}}, ExpBuckets{0.005, 2, 20}),                                                         \
+      F(type_io_queue, {{"type", "io_queue"}}, ExpBuckets{0.005, 2, 20}))                                                           \
+    M(tiflash_pipeline_query_cancel_release_seconds,                                                                                \
+      "Bucketed histogram of the time from cancelling a pipeline query to all of its tasks finished in seconds",                    \
+      Histogram,                                                                                                                    \
+      F(type_cancel, {{"type", "cancel"}}, ExpBuckets{0.001, 2, 20}))                                                               \
+    M(tiflash_join_build_lock_wait_seconds,                                                                                         \
+      "Bucketed histogram of the total time of the build threads of a join waiting for partition locks in seconds",                 \
+      Histogram,                                                                                                                    \
+      F(type_build, {{"type", "build"}}, ExpBuckets{0.0001, 2, 20}))                                                                \
     M(tiflash_pipeline_task_execute_max_time_seconds_per_round,                                                                     \
       "Bucketed histogram of pipeline task execute max time per round in seconds",                                                  \
       Histogram, /* these command usually cost several hundred milliseconds to several seconds, increase the start bucket to 5ms */ \
@@ -764,8 +795,12 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       F(type_dtfile_miss, {"type", "dtfile_miss"}),                                                                                 \
       F(type_dtfile_evict, {"type", "dtfile_evict"}),                                                                               \
       F(type_dtfile_full, {"type", "dtfile_full"}),                                                                                 \
+      F(type_dtfile_too_large, {"type", "dtfile_too_large"}),                                                                       \
+      F(type_dtfile_not_admitted, {"type", "dtfile_not_admitted"}),                                                                 \
       F(type_dtfile_download, {"type", "dtfile_download"}),                                                                         \
       F(type_dtfile_download_failed, {"type", "dtfile_download_failed"}),                                                           \
+      F(type_dmfile_meta_hit, {"type", "dmfile_meta_hit"}),                                                                         \
+      F(type_dmfile_meta_miss, {"type", "dmfile_meta_miss"}),                                                                       \
       F(type_page_hit, {"type", "page_hit"}),                                                                                       \
       F(type_page_miss, {"type", "page_miss"}),                                                                                     \
       F(type_page_evict, {"type", "page_evict"}),                                                                                   \
@@ -791,7 +826,12 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       "system calls duration in seconds",                                                                                           \
       Histogram,                                                                                                                    \
       F(type_fsync, {{"type", "fsync"}}, ExpBuckets{0.0001, 2, 20}))                                                                \
-    M(tiflash_storage_delta_index_cache, "", Counter, F(type_hit, {"type", "hit"}), F(type_miss, {"type", "miss"}))                 \
+    M(tiflash_storage_delta_index_cache,                                                                                            \
+      "",                                                                                                                           \
+      Counter,                                                                                                                      \
+      F(type_hit, {"type", "hit"}),                                                                                                 \
+      F(type_miss, {"type", "miss"}),                                                                                               \
+      F(type_reuse, {"type", "reuse"}))                                                                                             \
     M(tiflash_resource_group,                                                                                                       \
       "meta info of resource group",                                                                                                \
       Gauge,                                                                                                                        \
@@ -806,7 +846,8 @@ static_assert(RAFT_REGION_BIG_WRITE_THRES * 4 < RAFT_REGION_BIG_WRITE_MAX, "Inva
       F(type_gac_req_acquire_tokens, {"type", "gac_req_acquire_tokens"}),                                                           \
       F(type_gac_req_ru_consumption_delta, {"type", "gac_req_ru_consumption_delta"}),                                               \
       F(type_gac_resp_tokens, {"type", "gac_resp_tokens"}),                                                                         \
-      F(type_gac_resp_capacity, {"type", "gac_resp_capacity"}))                                                                     \
+      F(type_gac_resp_capacity, {"type", "gac_resp_capacity"}),                                                                     \
+      F(type_compute_token_wait_ms, {"type", "compute_token_wait_ms"}))                                                             \
     M(tiflash_storage_io_limiter_pending_count,                                                                                     \
       "I/O limiter pending count",                                                                                                  \
       Counter,                                                                                                                      \
@@ -1073,6 +1114,9 @@ public:
 
     void addReplicaSyncRU(UInt32 keyspace_id, UInt64 ru);
 
+    // The counter of the storage read threads bound to the `numa_node`-th NUMA node.
+    prometheus::Counter & getReadThreadNumaNodeCounter(size_t numa_node, const std::string & type);
+
 private:
     TiFlashMetrics();
 
@@ -1102,6 +1146,8 @@ private:
     std::mutex replica_sync_ru_mtx;
     std::unordered_map<KeyspaceID, prometheus::Counter *> registered_keyspace_sync_replica_ru;
 
+    prometheus::Family<prometheus::Counter> * registered_read_thread_numa_node_family;
+
 public:
 #define MAKE_METRIC_MEMBER_M(family_name, help, type, ...) \
     MetricFamily<prometheus::type> family_name             \
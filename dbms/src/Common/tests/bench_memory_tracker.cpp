@@ -0,0 +1,70 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/MemoryTracker.h>
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+/// Measure the scalability of memory tracking when many threads allocate through the same tracker chain.
+/// The arg is the submit threshold of the thread local delta, 0 submits every allocation to the trackers.
+
+namespace DB
+{
+namespace bench
+{
+namespace
+{
+// query tracker -> global root, shared by all the threads
+auto root_tracker = MemoryTracker::create();
+auto query_tracker = MemoryTracker::create(0, root_tracker.get());
+
+constexpr Int64 block_size = 64 * 1024;
+constexpr size_t blocks_per_iteration = 64;
+
+std::mutex submit_threshold_mutex;
+Int64 submit_threshold = -1;
+
+// The threshold is a plain global variable read by all the threads, so only the first thread of a run sets it.
+// The other threads read it after the loop starts, which waits for all the threads.
+void setSubmitThresholdOnce(Int64 threshold)
+{
+    std::lock_guard lock(submit_threshold_mutex);
+    if (submit_threshold == threshold)
+        return;
+    submit_threshold = threshold;
+    CurrentMemoryTracker::setSubmitThreshold(threshold);
+}
+} // namespace
+
+static void MemoryTrackerAllocFree(benchmark::State & state)
+{
+    setSubmitThresholdOnce(state.range(0));
+
+    current_memory_tracker = query_tracker.get();
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < blocks_per_iteration; ++i)
+            CurrentMemoryTracker::alloc(block_size);
+        for (size_t i = 0; i < blocks_per_iteration; ++i)
+            CurrentMemoryTracker::free(block_size);
+    }
+    CurrentMemoryTracker::submitLocalDeltaMemory();
+    current_memory_tracker = nullptr;
+    state.SetItemsProcessed(state.iterations() * blocks_per_iteration * 2);
+}
+BENCHMARK(MemoryTrackerAllocFree)->Arg(0)->Arg(1024 * 1024)->Arg(16 * 1024 * 1024)->ThreadRange(1, 128)->UseRealTime();
+
+} // namespace bench
+} // namespace DB
@@ -314,5 +314,32 @@ try
 }
 CATCH
 
+TEST_F(LooseBoundedMPMCQueueTest, MoveOnlyObject)
+try
+{
+    // The objects are moved in and out of the queue without copying
+    LooseBoundedMPMCQueue<std::unique_ptr<size_t>> queue(10);
+    for (size_t i = 0; i < 5; ++i)
+        ASSERT_EQ(queue.push(std::make_unique<size_t>(i)), MPMCQueueResult::OK);
+    auto obj = std::make_unique<size_t>(5);
+    ASSERT_EQ(queue.forcePush(std::move(obj)), MPMCQueueResult::OK);
+    for (size_t i = 0; i <= 5; ++i)
+    {
+        std::unique_ptr<size_t> res;
+        ASSERT_EQ(queue.pop(res), MPMCQueueResult::OK);
+        ASSERT_NE(res, nullptr);
+        ASSERT_EQ(*res, i);
+    }
+
+    auto shared = std::make_shared<size_t>(0);
+    LooseBoundedMPMCQueue<std::shared_ptr<size_t>> shared_queue(10);
+    ASSERT_EQ(shared_queue.push(shared), MPMCQueueResult::OK);
+    ASSERT_EQ(shared.use_count(), 2);
+    std::shared_ptr<size_t> res;
+    ASSERT_EQ(shared_queue.tryPop(res), MPMCQueueResult::OK);
+    ASSERT_EQ(shared.use_count(), 2);
+}
+CATCH
+
 } // namespace
 } // namespace DB::tests
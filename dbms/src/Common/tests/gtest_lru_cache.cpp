@@ -14,6 +14,7 @@
 
 #include <Common/LRUCache.h>
 #include <Common/Logger.h>
+#include <Common/ShardedLRUCache.h>
 #include <common/types.h>
 #include <gtest/gtest.h>
 
@@ -136,5 +137,71 @@ TEST(LRUCacheTest, WeightAfterRemove)
     ASSERT_EQ(cache.weight(), 0);
 }
 
+TEST(ShardedLRUCacheTest, Basic)
+{
+    ShardedLRUCache<Int32, Int32> cache(/*max_weight_*/ 1000, /*num_shards*/ 4);
+    ASSERT_EQ(cache.numShards(), 4);
+    for (Int32 i = 0; i < 100; ++i)
+        cache.set(i, std::make_shared<Int32>(i));
+    ASSERT_EQ(cache.count(), 100);
+    ASSERT_EQ(cache.weight(), 100);
+
+    for (Int32 i = 0; i < 100; ++i)
+    {
+        auto value = cache.get(i);
+        ASSERT_TRUE(value != nullptr);
+        ASSERT_EQ(*value, i);
+    }
+    ASSERT_EQ(cache.get(100), nullptr);
+    auto [value, loaded] = cache.getOrSet(100, [] { return std::make_shared<Int32>(100); });
+    ASSERT_TRUE(loaded);
+    ASSERT_EQ(*value, 100);
+
+    size_t hits = 0, misses = 0;
+    cache.getStats(hits, misses);
+    ASSERT_EQ(hits, 100);
+    ASSERT_EQ(misses, 2);
+    size_t shard_hits_sum = 0;
+    for (size_t i = 0; i < cache.numShards(); ++i)
+    {
+        size_t shard_hits = 0, shard_misses = 0;
+        cache.getShardStats(i, shard_hits, shard_misses);
+        // The keys are distributed to all the shards
+        ASSERT_GT(shard_hits, 0);
+        shard_hits_sum += shard_hits;
+    }
+    ASSERT_EQ(shard_hits_sum, hits);
+
+    cache.remove(100);
+    ASSERT_EQ(cache.count(), 100);
+    cache.reset();
+    ASSERT_EQ(cache.count(), 0);
+    ASSERT_EQ(cache.weight(), 0);
+}
+
+TEST(ShardedLRUCacheTest, EvictInShard)
+{
+    constexpr size_t num_shards = 4;
+    constexpr size_t cache_max_size = 40;
+    ShardedLRUCache<Int32, Int32> cache(cache_max_size, num_shards);
+    for (Int32 i = 0; i < 1000; ++i)
+        cache.set(i, std::make_shared<Int32>(i));
+    // Each shard keeps at most cache_max_size / num_shards entries
+    ASSERT_EQ(cache.count(), cache_max_size);
+    ASSERT_EQ(cache.weight(), cache_max_size);
+}
+
+TEST(ShardedLRUCacheTest, SmallCacheHasFewerShards)
+{
+    // Every shard keeps at least `min_shard_weight`
+    ShardedLRUCache<Int32, Int32> cache(/*max_weight_*/ 100, /*num_shards*/ 16, /*min_shard_weight*/ 30);
+    ASSERT_EQ(cache.numShards(), 3);
+    ShardedLRUCache<Int32, Int32> tiny_cache(/*max_weight_*/ 10, /*num_shards*/ 16, /*min_shard_weight*/ 30);
+    ASSERT_EQ(tiny_cache.numShards(), 1);
+    for (Int32 i = 0; i < 10; ++i)
+        tiny_cache.set(i, std::make_shared<Int32>(i));
+    ASSERT_EQ(tiny_cache.count(), 10);
+}
+
 } // namespace tests
 } // namespace DB
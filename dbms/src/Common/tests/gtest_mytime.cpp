@@ -666,5 +666,34 @@ catch (Exception & e)
     GTEST_FAIL();
 }
 
+TEST_F(TestMyTime, ConvertTimeZoneByOffsetBatch)
+try
+{
+    std::vector<UInt64> from_times{
+        0,
+        MyDateTime(2020, 2, 28, 23, 59, 59, 123456).toPackedUInt(),
+        MyDateTime(2020, 2, 28, 1, 0, 0, 0).toPackedUInt(),
+        MyDateTime(2020, 2, 29, 0, 0, 0, 0).toPackedUInt(),
+        MyDateTime(2020, 12, 31, 20, 30, 15, 1).toPackedUInt(),
+        MyDateTime(1970, 1, 1, 0, 0, 1, 0).toPackedUInt(),
+        MyDateTime(2020, 2, 28, 12, 0, 0, 0).toPackedUInt(),
+    };
+    for (Int64 offset : {0, 3600, -3600, 8 * 3600 + 1800, -12 * 3600})
+    {
+        for (bool from_utc : {true, false})
+        {
+            std::vector<UInt64> to_times(from_times.size());
+            convertTimeZoneByOffset(from_times.data(), to_times.data(), from_times.size(), from_utc, offset);
+            for (size_t i = 0; i < from_times.size(); ++i)
+            {
+                UInt64 expected = from_times[i];
+                convertTimeZoneByOffset(from_times[i], expected, from_utc, offset);
+                EXPECT_EQ(to_times[i], expected) << i << " " << offset << " " << from_utc;
+            }
+        }
+    }
+}
+CATCH
+
 } // namespace tests
 } // namespace DB
@@ -16,6 +16,7 @@
 
 #include <Common/Exception.h>
 #include <Common/MemoryTracker.h>
+#include <Core/NodeOperatorSpillContexts.h>
 #include <Core/QueryOperatorSpillContexts.h>
 
 namespace DB
@@ -52,6 +53,9 @@ public:
         trigger_threshold = static_cast<Int64>(memory_tracker->getLimit() * auto_memory_revoke_trigger_threshold);
         target_threshold = static_cast<Int64>(memory_tracker->getLimit() * auto_memory_revoke_target_threshold);
         force_trigger_threshold = static_cast<Int64>(memory_tracker->getLimit() * MAX_TRIGGER_THRESHOLD);
+        trigger_ratio = auto_memory_revoke_trigger_threshold;
+        target_ratio = auto_memory_revoke_target_threshold;
+        NodeOperatorSpillContexts::instance().registerQueryOperatorSpillContexts(query_operator_spill_contexts);
     }
 
     void triggerAutoSpill()
@@ -63,13 +67,36 @@ public:
                 current_memory_usage - target_threshold,
                 current_memory_usage > force_trigger_threshold);
         }
+        else
+        {
+            triggerNodeAutoSpill();
+        }
     }
 
 private:
+    /// The queries may exhaust the memory of the node before any of them reaches its own limit, check the memory
+    /// usage of all the queries against the node limit as well.
+    void triggerNodeAutoSpill()
+    {
+        if (unlikely(root_of_query_mem_trackers == nullptr))
+            return;
+        auto node_limit = root_of_query_mem_trackers->getLimit();
+        if (node_limit <= 0)
+            return;
+        auto node_memory_usage = root_of_query_mem_trackers->get();
+        if (node_memory_usage > static_cast<Int64>(node_limit * trigger_ratio))
+        {
+            NodeOperatorSpillContexts::instance().triggerAutoSpill(
+                node_memory_usage - static_cast<Int64>(node_limit * target_ratio));
+        }
+    }
+
     MemoryTrackerPtr memory_tracker;
     std::shared_ptr<QueryOperatorSpillContexts> query_operator_spill_contexts;
     Int64 trigger_threshold;
     Int64 target_threshold;
     Int64 force_trigger_threshold;
+    double trigger_ratio;
+    double target_ratio;
 };
 } // namespace DB
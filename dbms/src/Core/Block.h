@@ -51,6 +51,9 @@ private:
     // `segment_row_id_col` is a virtual column that represents the records' row id in the corresponding segment.
     // Only used for calculating MVCC-bitmap-filter.
     ColumnPtr segment_row_id_col;
+    // `mvcc_clean` means that the handles of the rows are distinct and none of the rows is deleted,
+    // e.g. the rows are read from the clean packs of a DMFile. It keeps true after rows are removed.
+    bool mvcc_clean = false;
 
 public:
     BlockInfo info;
@@ -162,6 +165,8 @@ public:
     UInt64 startOffset() const { return start_offset; }
     void setSegmentRowIdCol(ColumnPtr && col) { segment_row_id_col = col; }
     ColumnPtr segmentRowIdCol() const { return segment_row_id_col; }
+    void setMVCCClean(bool clean) { mvcc_clean = clean; }
+    bool isMVCCClean() const { return mvcc_clean; }
 
 private:
     void eraseImpl(size_t position);
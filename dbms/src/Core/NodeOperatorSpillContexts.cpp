@@ -0,0 +1,103 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Core/NodeOperatorSpillContexts.h>
+
+namespace DB
+{
+NodeOperatorSpillContexts & NodeOperatorSpillContexts::instance()
+{
+    static NodeOperatorSpillContexts node_operator_spill_contexts(/*auto_spill_check_min_interval_ms*/ 100);
+    return node_operator_spill_contexts;
+}
+
+void NodeOperatorSpillContexts::registerQueryOperatorSpillContexts(
+    const std::shared_ptr<QueryOperatorSpillContexts> & query_operator_spill_contexts)
+{
+    std::unique_lock lock(mutex);
+    /// Every MPP task of a query registers the same contexts, only keep one entry for each query. Prune the finished
+    /// queries here as well, otherwise they are only removed when the node memory usage exceeds the threshold.
+    for (auto it = query_operator_spill_contexts_list.begin(); it != query_operator_spill_contexts_list.end();)
+    {
+        auto registered = it->lock();
+        if (registered == query_operator_spill_contexts)
+            return;
+        if (registered)
+            ++it;
+        else
+            it = query_operator_spill_contexts_list.erase(it);
+    }
+    query_operator_spill_contexts_list.push_back(query_operator_spill_contexts);
+}
+
+Int64 NodeOperatorSpillContexts::triggerAutoSpill(Int64 expected_released_memories)
+{
+    std::unique_lock lock(mutex, std::try_to_lock);
+    /// use mutex to avoid concurrent check
+    if (!lock.owns_lock())
+        return expected_released_memories;
+
+    auto current_time = watch.elapsed();
+    if (first_check_done && current_time - last_checked_time_ns < auto_spill_check_min_interval_ns)
+        return expected_released_memories;
+    first_check_done = true;
+    last_checked_time_ns = current_time;
+
+    /// vector of <revocable_memories, query_operator_spill_contexts>
+    std::vector<std::pair<Int64, std::shared_ptr<QueryOperatorSpillContexts>>> revocable_memories;
+    revocable_memories.reserve(query_operator_spill_contexts_list.size());
+    for (auto it = query_operator_spill_contexts_list.begin(); it != query_operator_spill_contexts_list.end();)
+    {
+        if (auto query_operator_spill_contexts = it->lock(); query_operator_spill_contexts)
+        {
+            revocable_memories.emplace_back(
+                query_operator_spill_contexts->totalRevocableMemories(),
+                std::move(query_operator_spill_contexts));
+            ++it;
+        }
+        else
+        {
+            it = query_operator_spill_contexts_list.erase(it);
+        }
+    }
+    std::sort(revocable_memories.begin(), revocable_memories.end(), [](const auto & a, const auto & b) {
+        return a.first > b.first;
+    });
+
+    auto ret = expected_released_memories;
+    size_t triggered_queries = 0;
+    for (auto & [revocable_memory, query_operator_spill_contexts] : revocable_memories)
+    {
+        if (revocable_memory < OperatorSpillContext::MIN_SPILL_THRESHOLD)
+            break;
+        ret = query_operator_spill_contexts->triggerAutoSpill(ret, /*ignore_cooldown_time_check*/ true);
+        ++triggered_queries;
+        if (ret <= 0)
+            break;
+    }
+    /// The check runs every `auto_spill_check_min_interval_ns` while the memory usage stays above the threshold.
+    const bool log_info = last_logged_time_ns == 0 || current_time - last_logged_time_ns >= log_min_interval_ns;
+    if (log_info)
+        last_logged_time_ns = current_time;
+    LOG_IMPL(
+        log,
+        log_info ? Poco::Message::PRIO_INFORMATION : Poco::Message::PRIO_DEBUG,
+        "Node memory usage exceeded threshold, expected released memory: {}, marked {} memory of {} queries to be "
+        "spilled",
+        expected_released_memories,
+        expected_released_memories - ret,
+        triggered_queries);
+    return ret;
+}
+} // namespace DB
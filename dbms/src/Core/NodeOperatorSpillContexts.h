@@ -0,0 +1,68 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/Stopwatch.h>
+#include <Core/QueryOperatorSpillContexts.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace DB
+{
+/// The auto spill contexts of all the queries on this node. Each query spills when its own memory usage is near its
+/// limit, but many medium queries can exhaust the memory of the node without any of them reaching its own limit.
+/// When the memory usage of all the queries is near the node limit, the queries with the most revocable memory are
+/// asked to spill.
+class NodeOperatorSpillContexts
+{
+public:
+    explicit NodeOperatorSpillContexts(UInt64 auto_spill_check_min_interval_ms)
+        : auto_spill_check_min_interval_ns(auto_spill_check_min_interval_ms * 1000000ULL)
+        , log(Logger::get("NodeOperatorSpillContexts"))
+    {
+        watch.start();
+    }
+
+    static NodeOperatorSpillContexts & instance();
+
+    void registerQueryOperatorSpillContexts(
+        const std::shared_ptr<QueryOperatorSpillContexts> & query_operator_spill_contexts);
+
+    /// Return the memory that is expected to be released but not marked to be spilled.
+    Int64 triggerAutoSpill(Int64 expected_released_memories);
+
+    /// used for test
+    size_t getQueryOperatorSpillContextsCount() const
+    {
+        std::unique_lock lock(mutex);
+        return query_operator_spill_contexts_list.size();
+    }
+
+private:
+    /// Only hold weak references, the queries are not kept alive after they are finished.
+    std::list<std::weak_ptr<QueryOperatorSpillContexts>> query_operator_spill_contexts_list;
+    const UInt64 auto_spill_check_min_interval_ns;
+    UInt64 last_checked_time_ns = 0;
+    bool first_check_done = false;
+    static constexpr UInt64 log_min_interval_ns = 10ULL * 1000000000ULL;
+    UInt64 last_logged_time_ns = 0;
+    LoggerPtr log;
+    mutable std::mutex mutex;
+    Stopwatch watch;
+};
+
+} // namespace DB
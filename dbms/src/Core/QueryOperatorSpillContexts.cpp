@@ -82,4 +82,15 @@ Int64 QueryOperatorSpillContexts::triggerAutoSpill(Int64 expected_released_memor
     }
     return expected_released_memories;
 }
+
+Int64 QueryOperatorSpillContexts::totalRevocableMemories()
+{
+    std::unique_lock lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock())
+        return 0;
+    Int64 ret = 0;
+    for (const auto & task_operator_spill_contexts : task_operator_spill_contexts_list)
+        ret += task_operator_spill_contexts->totalRevocableMemories();
+    return ret;
+}
 } // namespace DB
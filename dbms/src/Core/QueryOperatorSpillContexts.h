@@ -32,6 +32,9 @@ public:
 
     Int64 triggerAutoSpill(Int64 expected_released_memories, bool ignore_cooldown_time_check = false);
 
+    /// Return 0 if another thread is checking the spill of this query.
+    Int64 totalRevocableMemories();
+
     void registerTaskOperatorSpillContexts(
         const std::shared_ptr<TaskOperatorSpillContexts> & task_operator_spill_contexts)
     {
@@ -15,6 +15,7 @@
 #include <Common/FmtUtils.h>
 #include <DataStreams/PartialSortingBlockInputStream.h>
 #include <Interpreters/sortBlock.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold.h>
 
 
 namespace DB
@@ -23,11 +24,15 @@ Block PartialSortingBlockInputStream::readImpl()
 {
     Block res = children.back()->read();
     sortBlock(res, description, limit);
+    if (topn_threshold)
+        topn_threshold->update(res, limit);
     return res;
 }
 
 void PartialSortingBlockInputStream::appendInfo(FmtBuffer & buffer) const
 {
     buffer.fmtAppend(": limit = {}", limit);
+    if (topn_threshold)
+        buffer.append(", push down threshold");
 }
 } // namespace DB
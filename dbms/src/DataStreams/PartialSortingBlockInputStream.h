@@ -16,6 +16,7 @@
 
 #include <Core/SortDescription.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold_fwd.h>
 
 namespace DB
 {
@@ -28,13 +29,17 @@ class PartialSortingBlockInputStream : public IProfilingBlockInputStream
 
 public:
     /// limit - if not 0, then you can sort each block not completely, but only `limit` first rows by order.
+    /// topn_threshold - if not nullptr, it is updated by every sorted block, so that the table scan below can skip
+    ///                  the data that can not make into the first `limit` rows.
     PartialSortingBlockInputStream(
         const BlockInputStreamPtr & input_,
         const SortDescription & description_,
         const String & req_id,
-        size_t limit_ = 0)
+        size_t limit_ = 0,
+        const DM::TopNThresholdPtr & topn_threshold_ = nullptr)
         : description(description_)
         , limit(limit_)
+        , topn_threshold(topn_threshold_)
         , log(Logger::get(req_id))
     {
         children.push_back(input_);
@@ -55,6 +60,7 @@ protected:
 private:
     SortDescription description;
     size_t limit;
+    DM::TopNThresholdPtr topn_threshold;
     LoggerPtr log;
 };
 
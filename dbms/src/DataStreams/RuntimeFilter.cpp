@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Columns/ColumnNullable.h>
 #include <DataStreams/RuntimeFilter.h>
 #include <Interpreters/Set.h>
 #include <Storages/DeltaMerge/FilterParser/FilterParser.h>
@@ -107,12 +108,48 @@ void RuntimeFilter::updateValues(const ColumnWithTypeAndName & values, const Log
         }
         break;
     case tipb::MIN_MAX:
+        updateMinMaxValues(values, log);
+        break;
     case tipb::BLOOM_FILTER:
         // todo
         break;
     }
 }
 
+void RuntimeFilter::updateMinMaxValues(const ColumnWithTypeAndName & values, const LoggerPtr & log)
+{
+    // The null values never match the join key, skip them.
+    ColumnPtr column = values.column;
+    if (const auto * nullable_column = checkAndGetColumn<ColumnNullable>(column.get()))
+    {
+        const auto & null_map = nullable_column->getNullMapData();
+        IColumn::Filter not_null_filter(null_map.size());
+        for (size_t i = 0; i < null_map.size(); ++i)
+            not_null_filter[i] = !null_map[i];
+        column = nullable_column->getNestedColumn().filter(not_null_filter, -1);
+    }
+    if (column->empty())
+        return;
+
+    Field block_min;
+    Field block_max;
+    column->getExtremes(block_min, block_max);
+    if (block_min.isNull() || block_max.isNull())
+    {
+        std::string tmp_err_msg
+            = fmt::format("The rf min max values are not supported for column type {}", values.type->getName());
+        updateStatus(RuntimeFilterStatus::FAILED, tmp_err_msg);
+        LOG_WARNING(log, "cancel runtime filter id:{}, reason: {} ", id, tmp_err_msg);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(min_max_mutex);
+    if (min_value.isNull() || block_min < min_value)
+        min_value = block_min;
+    if (max_value.isNull() || max_value < block_max)
+        max_value = block_max;
+}
+
 void RuntimeFilter::finalize(const LoggerPtr & log)
 {
     if (!updateStatus(RuntimeFilterStatus::READY))
@@ -126,6 +163,11 @@ void RuntimeFilter::finalize(const LoggerPtr & log)
         rf_values_info = fmt::format("number of IN values:{}", in_values_set->getTotalRowCount());
         break;
     case tipb::MIN_MAX:
+    {
+        std::lock_guard<std::mutex> lock(min_max_mutex);
+        rf_values_info = fmt::format("min value:{}, max value:{}", min_value.toString(), max_value.toString());
+        break;
+    }
     case tipb::BLOOM_FILTER:
         // TODO
         break;
@@ -220,6 +262,16 @@ DM::RSOperatorPtr RuntimeFilter::parseToRSOperator(DM::ColumnDefines & columns_t
             in_values_set->getUniqueSetElements(),
             timezone_info);
     case tipb::MIN_MAX:
+    {
+        std::lock_guard<std::mutex> lock(min_max_mutex);
+        return DM::FilterParser::parseRFMinMaxExpr(
+            rf_type,
+            target_expr,
+            columns_to_read,
+            min_value,
+            max_value,
+            timezone_info);
+    }
     case tipb::BLOOM_FILTER:
         // TODO
     default:
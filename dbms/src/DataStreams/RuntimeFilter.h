@@ -84,6 +84,8 @@ public:
 private:
     bool updateStatus(RuntimeFilterStatus status_, const std::string & reason = "");
 
+    void updateMinMaxValues(const ColumnWithTypeAndName & values, const LoggerPtr & log);
+
     tipb::Expr source_expr;
     tipb::Expr target_expr;
     const tipb::RuntimeFilterType rf_type;
@@ -99,7 +101,11 @@ private:
     // only used for In predicate
     // thread safe
     SetPtr in_values_set;
-    // todo min max
+    // only used for MinMax predicate, both are Null if no not-null value is inserted
+    // thread safe
+    std::mutex min_max_mutex;
+    Field min_value;
+    Field max_value;
 
     // used for await or signal
     std::mutex inner_mutex;
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/CurrentMetrics.h>
 #include <Common/FailPoint.h>
 #include <Common/Stopwatch.h>
 #include <Common/StringUtils/StringUtils.h>
@@ -33,6 +34,13 @@
 #include <common/logger_useful.h>
 #include <fmt/core.h>
 
+#include <ext/scope_guard.h>
+
+namespace CurrentMetrics
+{
+extern const Metric StartupPendingTables;
+} // namespace CurrentMetrics
+
 namespace DB
 {
 namespace ErrorCodes
@@ -101,6 +109,9 @@ void DatabaseOrdinary::loadTables(Context & context, ThreadPool * thread_pool, b
 
     AtomicStopwatch watch;
     std::atomic<size_t> tables_processed{0};
+    // Expose the number of tables that have not been loaded yet, so the progress of startup can be observed.
+    CurrentMetrics::add(CurrentMetrics::StartupPendingTables, total_tables);
+    SCOPE_EXIT({ CurrentMetrics::sub(CurrentMetrics::StartupPendingTables, total_tables - tables_processed.load()); });
 
     auto wait_group = thread_pool ? thread_pool->waitGroup() : nullptr;
 
@@ -112,6 +123,7 @@ void DatabaseOrdinary::loadTables(Context & context, ThreadPool * thread_pool, b
         {
             const String & table_file = *it;
 
+            CurrentMetrics::sub(CurrentMetrics::StartupPendingTables);
             /// Messages, so that it's not boring to wait for the server to load for a long time.
             if ((++tables_processed) % PRINT_MESSAGE_EACH_N_TABLES == 0
                 || watch.compareAndRestart(PRINT_MESSAGE_EACH_N_SECONDS))
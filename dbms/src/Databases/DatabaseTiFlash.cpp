@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/CurrentMetrics.h>
 #include <Common/FailPoint.h>
 #include <Common/Stopwatch.h>
 #include <Common/UniThreadPool.h>
@@ -35,6 +36,13 @@
 #include <TiDB/Schema/TiDB.h>
 #include <common/logger_useful.h>
 
+#include <ext/scope_guard.h>
+
+namespace CurrentMetrics
+{
+extern const Metric StartupPendingTables;
+} // namespace CurrentMetrics
+
 namespace DB
 {
 namespace ErrorCodes
@@ -131,6 +139,9 @@ void DatabaseTiFlash::loadTables(Context & context, ThreadPool * thread_pool, bo
 
     AtomicStopwatch watch;
     std::atomic<size_t> tables_processed{0};
+    // Expose the number of tables that have not been loaded yet, so the progress of startup can be observed.
+    CurrentMetrics::add(CurrentMetrics::StartupPendingTables, total_tables);
+    SCOPE_EXIT({ CurrentMetrics::sub(CurrentMetrics::StartupPendingTables, total_tables - tables_processed.load()); });
 
     auto wait_group = thread_pool ? thread_pool->waitGroup() : nullptr;
 
@@ -140,6 +151,7 @@ void DatabaseTiFlash::loadTables(Context & context, ThreadPool * thread_pool, bo
     auto task_function = [&](std::vector<String>::const_iterator begin, std::vector<String>::const_iterator end) {
         for (auto it = begin; it != end; ++it)
         {
+            CurrentMetrics::sub(CurrentMetrics::StartupPendingTables);
             /// Messages, so that it's not boring to wait for the server to load for a long time.
             if ((++tables_processed) % PRINT_MESSAGE_EACH_N_TABLES == 0
                 || watch.compareAndRestart(PRINT_MESSAGE_EACH_N_SECONDS))
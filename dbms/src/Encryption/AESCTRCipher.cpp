@@ -15,6 +15,7 @@
 #include <Common/Exception.h>
 #include <Common/TiFlashException.h>
 #include <Encryption/AESCTRCipher.h>
+#include <openssl/crypto.h>
 #include <openssl/err.h>
 #include <openssl/evp.h>
 
@@ -132,11 +133,77 @@ const EVP_CIPHER * getCipher(EncryptionMethod method)
     }
 }
 
+#if OPENSSL_VERSION_NUMBER >= 0x01010000f
+namespace
+{
+// The cipher context of a thread. Reads of an encrypted file call `Cipher` once per buffer with the
+// same key, so keep the context and its expanded key, and only reset the IV when the key is unchanged.
+// Creating the context and expanding the key for every small read costs more than the decryption.
+class ThreadCipherContext
+{
+public:
+    ~ThreadCipherContext()
+    {
+        if (ctx != nullptr)
+        {
+            FreeCipherContext(ctx);
+        }
+        OPENSSL_cleanse(key.data(), key.size());
+    }
+
+    EVP_CIPHER_CTX * prepare(const EVP_CIPHER * cipher_, const String & key_, const unsigned char * iv, bool is_encrypt)
+    {
+        if (ctx == nullptr)
+        {
+            InitCipherContext(ctx);
+            RUNTIME_CHECK_MSG(ctx != nullptr, "Failed to create cipher context.");
+        }
+
+        const int enc = is_encrypt ? 1 : 0;
+        int ret = 1;
+        if (cipher == cipher_ && enc == cached_enc && key == key_)
+        {
+            // Reset the IV and the position in the key stream only
+            ret = EVP_CipherInit_ex(ctx, nullptr, nullptr, nullptr, iv, enc);
+        }
+        else
+        {
+            cipher = nullptr;
+            ret = EVP_CipherInit_ex(
+                ctx,
+                cipher_,
+                nullptr,
+                reinterpret_cast<const unsigned char *>(key_.data()),
+                iv,
+                enc);
+            if (ret == 1)
+            {
+                cipher = cipher_;
+                OPENSSL_cleanse(key.data(), key.size());
+                key = key_;
+                cached_enc = enc;
+            }
+        }
+        RUNTIME_CHECK_MSG(ret == 1, "Failed to create cipher context.");
+        return ctx;
+    }
+
+private:
+    EVP_CIPHER_CTX * ctx = nullptr;
+    const EVP_CIPHER * cipher = nullptr;
+    String key;
+    int cached_enc = -1;
+};
+
+thread_local ThreadCipherContext thread_cipher_ctx;
+} // namespace
+#endif
+
 void OpenSSLCipher(
     uint64_t file_offset,
     char * data,
     size_t data_size,
-    String key,
+    const String & key,
     EncryptionMethod method,
     const unsigned char * iv,
     bool is_encrypt)
@@ -164,12 +231,42 @@ void OpenSSLCipher(
 
     int ret = 1;
     EVP_CIPHER_CTX * ctx = nullptr;
+#if OPENSSL_VERSION_NUMBER >= 0x01010000f
+    // A null IV means the zero IV of a new context, which can not be set by resetting the IV only
+    const bool use_thread_ctx = iv != nullptr;
+    if (use_thread_ctx)
+    {
+        ctx = thread_cipher_ctx.prepare(cipher, key, iv, is_encrypt);
+    }
+    else
+    {
+        InitCipherContext(ctx);
+    }
+    RUNTIME_CHECK_MSG(ctx != nullptr, "Failed to create cipher context.");
+    SCOPE_EXIT({
+        if (!use_thread_ctx)
+        {
+            FreeCipherContext(ctx);
+        }
+    });
+    if (!use_thread_ctx)
+    {
+        ret = EVP_CipherInit(
+            ctx,
+            cipher,
+            reinterpret_cast<const unsigned char *>(key.data()),
+            iv,
+            (is_encrypt ? 1 : 0));
+        RUNTIME_CHECK_MSG(ret == 1, "Failed to create cipher context.");
+    }
+#else
     InitCipherContext(ctx);
     RUNTIME_CHECK_MSG(ctx != nullptr, "Failed to create cipher context.");
     SCOPE_EXIT({ FreeCipherContext(ctx); });
 
     ret = EVP_CipherInit(ctx, cipher, reinterpret_cast<const unsigned char *>(key.data()), iv, (is_encrypt ? 1 : 0));
     RUNTIME_CHECK_MSG(ret == 1, "Failed to create cipher context.");
+#endif
 
     // Disable padding. After disabling padding, data size should always be
     // multiply of block size.
@@ -237,7 +334,7 @@ void GMSSLSM4Cipher(
     uint64_t file_offset,
     char * data,
     size_t data_size,
-    String key,
+    const String & key,
     unsigned char * iv,
     bool is_encrypt)
 {
@@ -301,7 +398,7 @@ void Cipher(
     uint64_t file_offset,
     char * data,
     size_t data_size,
-    String key,
+    const String & key,
     EncryptionMethod method,
     unsigned char * iv,
     bool is_encrypt)
@@ -45,7 +45,7 @@ void Cipher(
     uint64_t file_offset,
     char * data,
     size_t data_size,
-    String key,
+    const String & key,
     EncryptionMethod method,
     unsigned char * iv,
     bool is_encrypt);
@@ -0,0 +1,76 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/RandomData.h>
+#include <Encryption/AESCTRCipherStream.h>
+#include <benchmark/benchmark.h>
+
+/// Compare the throughput of reading an encrypted file with a plain one. A read of an encrypted file
+/// is a copy from the page cache followed by the decryption in place, which is what is measured here.
+/// The arg is the size of each read buffer.
+
+namespace DB
+{
+namespace bench
+{
+namespace
+{
+constexpr size_t file_size = 16 * 1024 * 1024;
+
+const String & fileData()
+{
+    static const String data = DB::random::randomString(file_size);
+    return data;
+}
+} // namespace
+
+static void ReadPlainFile(benchmark::State & state)
+{
+    const auto & file = fileData();
+    const size_t buffer_size = state.range(0);
+    String buffer(buffer_size, '\0');
+    for (auto _ : state)
+    {
+        for (size_t offset = 0; offset + buffer_size <= file_size; offset += buffer_size)
+        {
+            memcpy(buffer.data(), file.data() + offset, buffer_size);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * (file_size - file_size % buffer_size));
+}
+
+static void ReadEncryptedFile(benchmark::State & state)
+{
+    const auto & file = fileData();
+    const size_t buffer_size = state.range(0);
+    String buffer(buffer_size, '\0');
+    AESCTRCipherStream cipher_stream(EncryptionMethod::Aes256Ctr, String(32, 'k'), 0x1234, 0x5678);
+    for (auto _ : state)
+    {
+        for (size_t offset = 0; offset + buffer_size <= file_size; offset += buffer_size)
+        {
+            memcpy(buffer.data(), file.data() + offset, buffer_size);
+            cipher_stream.decrypt(offset, buffer.data(), buffer_size);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * (file_size - file_size % buffer_size));
+}
+
+BENCHMARK(ReadPlainFile)->Arg(4096)->Arg(64 * 1024)->Arg(1024 * 1024);
+BENCHMARK(ReadEncryptedFile)->Arg(4096)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+} // namespace bench
+} // namespace DB
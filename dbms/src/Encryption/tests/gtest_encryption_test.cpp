@@ -199,6 +199,53 @@ try
 }
 CATCH
 
+TEST(CipherTest, SwitchKeyInSameThread)
+try
+{
+    // The cipher context is reused by the calls in the same thread, make sure switching the
+    // key, the method and the direction between calls does not mix up the key stream.
+    const EncryptionMethod methods[] = {
+        EncryptionMethod::Aes128Ctr,
+        EncryptionMethod::Aes256Ctr,
+    };
+    String plaintext = DB::random::randomString(MAX_SIZE);
+    std::vector<std::tuple<EncryptionMethod, String, String>> ciphertexts;
+    for (const auto method : methods)
+    {
+        for (size_t i = 0; i < 2; ++i)
+        {
+            String key_str = DB::random::randomString(DB::Encryption::keySize(method));
+            String text = plaintext;
+            unsigned char iv[16];
+            memcpy(iv, test::IV_RANDOM, 16);
+            DB::Encryption::Cipher(0, text.data(), text.size(), key_str, method, iv, true);
+            ciphertexts.emplace_back(method, key_str, text);
+        }
+    }
+    for (size_t round = 0; round < 3; ++round)
+    {
+        for (const auto & [method, key_str, ciphertext] : ciphertexts)
+        {
+            // Decrypt from an offset in the middle of a block, the cipher stream derives the IV of the block.
+            const size_t offset = 16 * round + round;
+            String text = ciphertext.substr(offset);
+            std::string iv_str(reinterpret_cast<const char *>(test::IV_RANDOM), 16);
+            KeyManagerPtr key_manager = std::make_shared<MockKeyManager>(method, key_str, iv_str);
+            auto cipher_stream
+                = key_manager->newFile("encryption").createCipherStream(EncryptionPath("encryption", ""));
+            cipher_stream->decrypt(offset, text.data(), text.size());
+            ASSERT_EQ(plaintext.substr(offset), text);
+
+            text = plaintext;
+            unsigned char iv[16];
+            memcpy(iv, test::IV_RANDOM, 16);
+            DB::Encryption::Cipher(0, text.data(), text.size(), key_str, method, iv, true);
+            ASSERT_EQ(ciphertext, text);
+        }
+    }
+}
+CATCH
+
 TEST(EncryptionKeyTest, EncryptionKeyTest)
 try
 {
@@ -16,7 +16,9 @@
 #include <Common/TiFlashException.h>
 #include <Core/ColumnNumbers.h>
 #include <Flash/Coprocessor/AggregationInterpreterHelper.h>
+#include <Flash/Coprocessor/DAGCodec.h>
 #include <Flash/Coprocessor/DAGContext.h>
+#include <Flash/Coprocessor/DAGUtils.h>
 #include <Interpreters/Context.h>
 
 namespace DB::AggregationInterpreterHelper
@@ -67,6 +69,36 @@ bool isFinalAgg(const tipb::Aggregation & aggregation)
     return is_final_agg;
 }
 
+bool isCountOnly(const tipb::Aggregation & aggregation, const NamesAndTypes & input_columns)
+{
+    if (aggregation.group_by_size() != 0 || aggregation.agg_func_size() == 0)
+        return false;
+    for (const auto & expr : aggregation.agg_func())
+    {
+        if (expr.tp() != tipb::ExprType::Count || expr.has_distinct())
+            return false;
+        // The input of the aggregation must be the original rows rather than partial results.
+        if (expr.has_aggfuncmode() && expr.aggfuncmode() != tipb::AggFunctionMode::CompleteMode
+            && expr.aggfuncmode() != tipb::AggFunctionMode::Partial1Mode)
+            return false;
+        for (const auto & child : expr.children())
+        {
+            if (isLiteralExpr(child))
+                continue;
+            // `count(col)` is the number of rows if `col` is not nullable.
+            if (isColumnExpr(child))
+            {
+                auto column_index = decodeDAGInt64(child.val());
+                if (column_index >= 0 && column_index < static_cast<Int64>(input_columns.size())
+                    && !input_columns[column_index].type->isNullable())
+                    continue;
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
 bool isGroupByCollationSensitive(const Context & context)
 {
     // todo now we can tell if the aggregation is final stage or partial stage,
@@ -101,7 +133,7 @@ Aggregator::Params buildParams(
 
     bool has_collator = std::any_of(begin(collators), end(collators), [](const auto & p) { return p != nullptr; });
 
-    return Aggregator::Params(
+    Aggregator::Params params(
         before_agg_header,
         keys,
         aggregate_descriptions,
@@ -114,6 +146,8 @@ Aggregator::Params buildParams(
         spill_config,
         context.getSettingsRef().max_block_size,
         has_collator ? collators : TiDB::dummy_collators);
+    params.prefetch_batch_size = settings.agg_prefetch_batch_size;
+    return params;
 }
 
 void fillArgColumnNumbers(AggregateDescriptions & aggregate_descriptions, const Block & before_agg_header)
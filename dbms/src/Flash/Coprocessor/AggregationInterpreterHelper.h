@@ -16,6 +16,7 @@
 
 #include <Core/Block.h>
 #include <Core/Names.h>
+#include <Core/NamesAndTypes.h>
 #include <Interpreters/AggregateDescription.h>
 #include <Interpreters/Aggregator.h>
 #include <tipb/executor.pb.h>
@@ -33,6 +34,9 @@ bool isFinalAgg(const tipb::Aggregation & aggregation);
 
 bool isGroupByCollationSensitive(const Context & context);
 
+// Judge if the aggregation only needs the number of input rows, like `count(*)` without group by.
+bool isCountOnly(const tipb::Aggregation & aggregation, const NamesAndTypes & input_columns);
+
 Aggregator::Params buildParams(
     const Context & context,
     const Block & before_agg_header,
@@ -77,6 +77,9 @@ bool flashDecimalColToArrowColInternal(
         const auto * flash_col = checkAndGetColumn<ColumnDecimal<T>>(nested_col);
         const auto * type = checkAndGetDataType<DataTypeDecimal<T>>(data_type);
         UInt32 scale = type->getScale();
+        // Reuse the buffer of digits among the rows
+        std::vector<Int32> digits;
+        digits.reserve(std::max<UInt32>(type->getPrec(), scale));
         for (size_t i = start_index; i < end_index; i++)
         {
             if constexpr (is_nullable)
@@ -88,8 +91,7 @@ bool flashDecimalColToArrowColInternal(
                 }
             }
             const T & dec = flash_col->getElement(i);
-            std::vector<Int32> digits;
-            digits.reserve(type->getPrec());
+            digits.clear();
             decimalToVector<typename T::NativeType>(dec.value, digits, scale);
             TiDBDecimal ti_decimal(scale, digits, dec.value < 0);
             dag_column.append(ti_decimal);
@@ -136,6 +138,40 @@ void flashDecimalColToArrowCol(
             Errors::Coprocessor::Internal);
 }
 
+/// Return the null map of the rows starting from `start_index`, or nullptr if the column is not nullable.
+const UInt8 * getNullMapData(const IColumn * flash_col, size_t start_index)
+{
+    if (flash_col->isColumnNullable())
+        return static_cast<const ColumnNullable *>(flash_col)->getNullMapData().data() + start_index;
+    return nullptr;
+}
+
+/// Encode the values that are stored as 8 bytes in TiDB chunk column by column, the values that are not UInt64
+/// are converted into a buffer first.
+template <typename T, bool is_nullable>
+void flashFixed64ColToArrowCol(
+    TiDBColumn & dag_column,
+    const IColumn * flash_col_untyped,
+    const PaddedPODArray<T> & data,
+    size_t start_index,
+    size_t end_index)
+{
+    const UInt8 * null_map = is_nullable ? getNullMapData(flash_col_untyped, start_index) : nullptr;
+    const size_t size = end_index - start_index;
+    if constexpr (sizeof(T) == sizeof(UInt64))
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        dag_column.appendFixed64Batch(reinterpret_cast<const UInt64 *>(data.data() + start_index), null_map, size);
+    }
+    else
+    {
+        PaddedPODArray<UInt64> values(size);
+        for (size_t i = 0; i < size; ++i)
+            values[i] = static_cast<UInt64>(data[start_index + i]);
+        dag_column.appendFixed64Batch(values.data(), null_map, size);
+    }
+}
+
 template <typename T, bool is_nullable>
 bool flashIntegerColToArrowColInternal(
     TiDBColumn & dag_column,
@@ -146,22 +182,12 @@ bool flashIntegerColToArrowColInternal(
     const IColumn * nested_col = getNestedCol(flash_col_untyped);
     if (const auto * flash_col = checkAndGetColumn<ColumnVector<T>>(nested_col))
     {
-        constexpr bool is_unsigned = std::is_unsigned_v<T>;
-        for (size_t i = start_index; i < end_index; i++)
-        {
-            if constexpr (is_nullable)
-            {
-                if (flash_col_untyped->isNullAt(i))
-                {
-                    dag_column.appendNull();
-                    continue;
-                }
-            }
-            if constexpr (is_unsigned)
-                dag_column.append(static_cast<UInt64>(flash_col->getElement(i)));
-            else
-                dag_column.append(static_cast<UInt64>(flash_col->getElement(i)));
-        }
+        flashFixed64ColToArrowCol<T, is_nullable>(
+            dag_column,
+            flash_col_untyped,
+            flash_col->getData(),
+            start_index,
+            end_index);
         return true;
     }
     return false;
@@ -177,17 +203,29 @@ void flashDoubleColToArrowCol(
     const IColumn * nested_col = getNestedCol(flash_col_untyped);
     if (const auto * flash_col = checkAndGetColumn<ColumnVector<T>>(nested_col))
     {
-        for (size_t i = start_index; i < end_index; i++)
+        if constexpr (std::is_same_v<T, Float64>)
         {
-            if constexpr (is_nullable)
+            flashFixed64ColToArrowCol<T, is_nullable>(
+                dag_column,
+                flash_col_untyped,
+                flash_col->getData(),
+                start_index,
+                end_index);
+        }
+        else
+        {
+            for (size_t i = start_index; i < end_index; i++)
             {
-                if (flash_col_untyped->isNullAt(i))
+                if constexpr (is_nullable)
                 {
-                    dag_column.appendNull();
-                    continue;
+                    if (flash_col_untyped->isNullAt(i))
+                    {
+                        dag_column.appendNull();
+                        continue;
+                    }
                 }
+                dag_column.append(static_cast<T>(flash_col->getElement(i)));
             }
-            dag_column.append(static_cast<T>(flash_col->getElement(i)));
         }
         return;
     }
@@ -252,19 +290,17 @@ void flashDateOrDateTimeColToArrowCol(
     const IColumn * nested_col = getNestedCol(flash_col_untyped);
     using DateFieldType = DataTypeMyTimeBase::FieldType;
     const auto * flash_col = checkAndGetColumn<ColumnVector<DateFieldType>>(nested_col);
-    for (size_t i = start_index; i < end_index; i++)
+    const UInt8 * null_map = is_nullable ? getNullMapData(flash_col_untyped, start_index) : nullptr;
+    const size_t size = end_index - start_index;
+    PaddedPODArray<UInt64> values(size);
+    for (size_t i = 0; i < size; ++i)
     {
-        if constexpr (is_nullable)
-        {
-            if (flash_col_untyped->isNullAt(i))
-            {
-                dag_column.appendNull();
-                continue;
-            }
-        }
-        TiDBTime time = TiDBTime(flash_col->getElement(i), field_type);
-        dag_column.append(time);
+        // The values of null rows are ignored by `appendFixed64Batch`
+        if (null_map != nullptr && null_map[i])
+            continue;
+        values[i] = TiDBTime(flash_col->getElement(start_index + i), field_type).toChunkTime();
     }
+    dag_column.appendFixed64Batch(values.data(), null_map, size);
 }
 
 template <bool is_nullable>
@@ -90,6 +90,30 @@ Block DecodeHeader(ReadBuffer & istr, const Block & header, size_t & total_rows)
     return res;
 }
 
+void SkipHeader(
+    ReadBuffer & istr,
+    const std::vector<CodecUtils::DataTypeWithTypeName> & header_types,
+    size_t & total_rows)
+{
+    assert(!istr.eof());
+
+    size_t columns = 0;
+    {
+        readVarUInt(columns, istr);
+        readVarUInt(total_rows, istr);
+    }
+    CodecUtils::checkColumnSize(header_types.size(), columns);
+
+    String buf;
+    for (size_t i = 0; i < columns; ++i)
+    {
+        // The column name is ignored
+        readBinary(buf, istr);
+        readBinary(buf, istr);
+        CodecUtils::checkDataTypeName(i, header_types[i].name, buf);
+    }
+}
+
 static inline void decodeColumnsByBlock(ReadBuffer & istr, Block & res, size_t rows_to_read, size_t reserve_size)
 {
     if (!rows_to_read)
@@ -27,6 +27,9 @@ using CompressedCHBlockChunkWriteBuffer = CompressedWriteBuffer<false>;
 void EncodeHeader(WriteBuffer & ostr, const Block & header, size_t rows);
 void DecodeColumns(ReadBuffer & istr, Block & res, size_t rows_to_read, size_t reserve_size = 0);
 Block DecodeHeader(ReadBuffer & istr, const Block & header, size_t & rows);
+// Same as `DecodeHeader`, but only check the column types instead of building a block,
+// which is cheaper for decoding the chunks one by one into the same block.
+void SkipHeader(ReadBuffer & istr, const std::vector<CodecUtils::DataTypeWithTypeName> & header_types, size_t & rows);
 CompressionMethod ToInternalCompressionMethod(tipb::CompressionMode compression_mode);
 extern void WriteColumnData(
     const IDataType & type,
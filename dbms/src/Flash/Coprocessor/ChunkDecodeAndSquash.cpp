@@ -62,7 +62,10 @@ std::optional<Block> CHBlockChunkDecodeAndSquash::decodeAndSquashV1Impl(ReadBuff
     else
     {
         size_t rows{};
-        DecodeHeader(istr, codec.header, rows);
+        if (codec.header)
+            SkipHeader(istr, codec.header_datatypes, rows);
+        else
+            DecodeHeader(istr, codec.header, rows);
         DecodeColumns(istr, *accumulated_block, rows, 0);
     }
 
@@ -38,6 +38,7 @@
 #include <Operators/IOProfileInfo.h>
 #include <Operators/OperatorProfileInfo.h>
 #include <Parsers/makeDummyQuery.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold_fwd.h>
 #include <Storages/DeltaMerge/Remote/DisaggTaskId.h>
 #include <Storages/DeltaMerge/ScanContext_fwd.h>
 #include <TiDB/Schema/TiDB.h>
@@ -388,6 +389,11 @@ public:
     /// thus we need to pay attention to scan_context_map usage that time.
     std::unordered_map<String, DM::ScanContextPtr> scan_context_map;
 
+    /// executor_id of table scan, the running threshold of the TopN above it
+    std::unordered_map<String, DM::TopNThresholdPtr> topn_threshold_map;
+    /// executor_id of the table scans whose rows are only counted by the aggregation above
+    std::unordered_set<String> count_only_table_scans;
+
     RuntimeFilterMgr runtime_filter_mgr;
 
 private:
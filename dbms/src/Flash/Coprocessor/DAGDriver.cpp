@@ -233,6 +233,7 @@ try
         }
         if (need_send)
             streaming_writer->write(last_response);
+        streaming_writer->finish();
     }
 
     auto cpu_ru = query_executor->collectRequestUnit();
@@ -1378,6 +1378,8 @@ void DAGExpressionAnalyzer::appendRuntimeFilterProperties(RuntimeFilterPtr & run
         runtime_filter->setTimezoneInfo(context.getTimezoneInfo());
         break;
     case tipb::MIN_MAX:
+        runtime_filter->setTimezoneInfo(context.getTimezoneInfo());
+        break;
     case tipb::BLOOM_FILTER:
         // todo
         break;
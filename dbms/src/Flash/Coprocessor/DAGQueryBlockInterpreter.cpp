@@ -342,7 +342,7 @@ void DAGQueryBlockInterpreter::handleJoin(
         settings.max_bytes_before_external_join,
         build_spill_config,
         probe_spill_config,
-        RestoreConfig{settings.join_restore_concurrency, 0, 0},
+        RestoreConfig{settings.join_restore_concurrency, 0, 0, settings.join_max_restore_round},
         join_output_columns,
         [&](const OperatorSpillContextPtr & operator_spill_context) {
             if (context.getDAGContext() != nullptr)
@@ -358,6 +358,7 @@ void DAGQueryBlockInterpreter::handleJoin(
         match_helper_name,
         flag_mapped_entry_helper_name,
         settings.join_probe_cache_columns_threshold,
+        settings.join_probe_prefetch_batch_size,
         context.isTest());
 
     recordJoinExecuteInfo(tiflash_join.build_side_index, join_ptr);
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <Interpreters/TimezoneInfo.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold_fwd.h>
 #include <Storages/KVStore/Decode/DecodingStorageSchemaSnapshot.h>
 #include <google/protobuf/repeated_ptr_field.h>
 #include <tipb/expression.pb.h>
@@ -51,5 +52,10 @@ struct DAGQueryInfo
     const int rf_max_wait_time_ms;
 
     const TimezoneInfo & timezone_info;
+
+    // The running threshold of the TopN above the table scan, nullptr if the TopN is not pushed down.
+    DM::TopNThresholdPtr topn_threshold;
+    // Only the number of rows is needed by the aggregation above the table scan.
+    bool count_only = false;
 };
 } // namespace DB
@@ -287,8 +287,65 @@ String genErrMsgForLocalRead(
             table_id,
             logical_table_id);
 }
+
+/// The number of rows needed from the table scan if its parent is a Limit, e.g. `select * from t limit 10`.
+/// 0 means all the rows are needed.
+UInt64 getLimitHint(
+    const DAGContext & dag_context,
+    const TiDBTableScan & table_scan,
+    const FilterConditions & filter_conditions)
+{
+    // The filters may drop any number of rows
+    if (filter_conditions.hasValue() || !table_scan.getPushedDownFilters().empty())
+        return 0;
+
+    const auto & dag_request = dag_context.dag_request;
+    const auto & scan_executor_id = table_scan.getTableScanExecutorID();
+    UInt64 limit = 0;
+    if (dag_request.isTreeBased())
+    {
+        dag_request.traverse([&](const tipb::Executor & executor) {
+            if (executor.tp() == tipb::ExecType::TypeLimit && executor.limit().has_child()
+                && executor.limit().child().executor_id() == scan_executor_id)
+            {
+                limit = executor.limit().limit();
+                return false;
+            }
+            return true;
+        });
+    }
+    else
+    {
+        // The list based executors begin with the table scan, and each one is the parent of the one before it
+        const auto & executors = dag_request->executors();
+        for (int i = 0; i + 1 < executors.size(); ++i)
+        {
+            if (executors[i].executor_id() == scan_executor_id && executors[i + 1].tp() == tipb::ExecType::TypeLimit)
+            {
+                limit = executors[i + 1].limit().limit();
+                break;
+            }
+        }
+    }
+    return limit;
+}
 } // namespace
 
+/// A small limit over the table scan only needs a few blocks. More streams than the blocks needed would create and
+/// schedule the read tasks of more segments, and read ahead the blocks that are dropped by the limit.
+size_t DAGStorageInterpreter::getMaxStreamsByLimitHint(
+    const Context & context,
+    const TiDBTableScan & table_scan,
+    const FilterConditions & filter_conditions,
+    size_t max_streams)
+{
+    const UInt64 limit = getLimitHint(*context.getDAGContext(), table_scan, filter_conditions);
+    if (limit == 0)
+        return max_streams;
+    const UInt64 max_block_size = std::max<UInt64>(context.getSettingsRef().max_block_size, 1);
+    return std::min<size_t>(max_streams, (limit + max_block_size - 1) / max_block_size);
+}
+
 DAGStorageInterpreter::DAGStorageInterpreter(
     Context & context_,
     const TiDBTableScan & table_scan_,
@@ -297,7 +354,7 @@ DAGStorageInterpreter::DAGStorageInterpreter(
     : context(context_)
     , table_scan(table_scan_)
     , filter_conditions(filter_conditions_)
-    , max_streams(max_streams_)
+    , max_streams(getMaxStreamsByLimitHint(context_, table_scan_, filter_conditions_, max_streams_))
     , log(Logger::get(context.getDAGContext()->log ? context.getDAGContext()->log->identifier() : ""))
     , logical_table_id(table_scan.getLogicalTableID())
     , tmt(context.getTMTContext())
@@ -309,6 +366,8 @@ DAGStorageInterpreter::DAGStorageInterpreter(
             fmt::format("Dag Request does not have region to read for table: {}", logical_table_id),
             Errors::Coprocessor::BadRequest);
     }
+    if (max_streams < max_streams_)
+        LOG_DEBUG(log, "Reduce the read streams by the limit over the table scan, {} => {}", max_streams_, max_streams);
 }
 
 DAGStorageInterpreter::~DAGStorageInterpreter() = default;
@@ -745,12 +804,14 @@ CoprocessorReaderPtr DAGStorageInterpreter::buildCoprocessorReader(const std::ve
         ? pingcap::kv::labelFilterOnlyTiFlashWriteNode
         : pingcap::kv::labelFilterNoTiFlashWriteNode;
 
-    size_t concurrent_num = std::min<size_t>(context.getSettingsRef().max_threads, all_tasks.size());
-    size_t queue_size = context.getSettingsRef().remote_read_queue_size > 0
-        ? context.getSettingsRef().remote_read_queue_size.get()
-        : concurrent_num * 4;
-    bool enable_cop_stream = context.getSettingsRef().enable_cop_stream_for_remote_read;
-    UInt64 cop_timeout = context.getSettingsRef().cop_timeout_for_remote_read;
+    const auto & settings = context.getSettingsRef();
+    size_t concurrent_num = std::min<size_t>(
+        settings.remote_read_concurrency > 0 ? settings.remote_read_concurrency : settings.max_threads,
+        all_tasks.size());
+    size_t queue_size
+        = settings.remote_read_queue_size > 0 ? settings.remote_read_queue_size.get() : concurrent_num * 4;
+    bool enable_cop_stream = settings.enable_cop_stream_for_remote_read;
+    UInt64 cop_timeout = settings.cop_timeout_for_remote_read;
 
     auto coprocessor_reader = std::make_shared<CoprocessorReader>(
         schema,
@@ -773,8 +834,11 @@ void DAGStorageInterpreter::buildRemoteStreams(
     DAGPipeline & pipeline)
 {
     auto coprocessor_reader = buildCoprocessorReader(remote_requests);
-    size_t concurrent_num = coprocessor_reader->enableCopStream() ? context.getSettingsRef().max_threads.get()
-                                                                  : coprocessor_reader->getConcurrency();
+    // The responses are fetched by the threads of `coprocessor_reader`, no more than max_threads streams are
+    // needed to decode them.
+    size_t concurrent_num = coprocessor_reader->enableCopStream()
+        ? context.getSettingsRef().max_threads.get()
+        : std::min<size_t>(coprocessor_reader->getConcurrency(), context.getSettingsRef().max_threads);
     for (size_t i = 0; i < concurrent_num; ++i)
     {
         BlockInputStreamPtr input = std::make_shared<CoprocessorBlockInputStream>(
@@ -794,8 +858,11 @@ void DAGStorageInterpreter::buildRemoteExec(
     const std::vector<RemoteRequest> & remote_requests)
 {
     auto coprocessor_reader = buildCoprocessorReader(remote_requests);
-    size_t concurrent_num = coprocessor_reader->enableCopStream() ? context.getSettingsRef().max_threads.get()
-                                                                  : coprocessor_reader->getConcurrency();
+    // The responses are fetched by the threads of `coprocessor_reader`, no more than max_threads streams are
+    // needed to decode them.
+    size_t concurrent_num = coprocessor_reader->enableCopStream()
+        ? context.getSettingsRef().max_threads.get()
+        : std::min<size_t>(coprocessor_reader->getConcurrency(), context.getSettingsRef().max_threads);
     /// TODO: support reading data from write nodes
     for (size_t i = 0; i < concurrent_num; ++i)
         group_builder.addConcurrency(
@@ -922,6 +989,11 @@ std::unordered_map<TableID, SelectQueryInfo> DAGStorageInterpreter::generateSele
             table_scan.getRuntimeFilterIDs(),
             table_scan.getMaxWaitTimeMs(),
             context.getTimezoneInfo());
+        if (auto iter = dagContext().topn_threshold_map.find(table_scan.getTableScanExecutorID());
+            iter != dagContext().topn_threshold_map.end())
+            query_info.dag_query->topn_threshold = iter->second;
+        query_info.dag_query->count_only
+            = dagContext().count_only_table_scans.contains(table_scan.getTableScanExecutorID());
         query_info.req_id = fmt::format("{} table_id={}", log->identifier(), table_id);
         query_info.keep_order = table_scan.keepOrder();
         query_info.is_fast_scan = table_scan.isFastScan();
@@ -930,20 +1002,28 @@ std::unordered_map<TableID, SelectQueryInfo> DAGStorageInterpreter::generateSele
     RUNTIME_CHECK_MSG(mvcc_query_info->scan_context != nullptr, "Unexpected null scan_context");
     if (table_scan.isPartitionTableScan())
     {
-        for (const auto physical_table_id : table_scan.getPhysicalTableIDs())
-        {
-            SelectQueryInfo query_info = create_query_info(physical_table_id);
-            query_info.mvcc_query_info = std::make_unique<MvccQueryInfo>(
-                mvcc_query_info->resolve_locks,
-                mvcc_query_info->read_tso,
-                mvcc_query_info->scan_context);
-            ret.emplace(physical_table_id, std::move(query_info));
-        }
-        // Dispatch the regions_query_info to different physical table's query_info
+        // Dispatch the regions_query_info to different physical table's query_info.
+        // The partitions without any local region are pruned here, so that a table with
+        // thousands of partitions only builds the streams for the partitions to be read.
         for (auto & r : mvcc_query_info->regions_query_info)
         {
-            ret[r.physical_table_id].mvcc_query_info->regions_query_info.push_back(r);
+            auto iter = ret.find(r.physical_table_id);
+            if (iter == ret.end())
+            {
+                SelectQueryInfo query_info = create_query_info(r.physical_table_id);
+                query_info.mvcc_query_info = std::make_unique<MvccQueryInfo>(
+                    mvcc_query_info->resolve_locks,
+                    mvcc_query_info->read_tso,
+                    mvcc_query_info->scan_context);
+                iter = ret.emplace(r.physical_table_id, std::move(query_info)).first;
+            }
+            iter->second.mvcc_query_info->regions_query_info.push_back(r);
         }
+        LOG_DEBUG(
+            log,
+            "partitions to read from local, num_partitions={} num_pruned_partitions={}",
+            ret.size(),
+            table_scan.getPhysicalTableIDs().size() - ret.size());
     }
     else
     {
@@ -58,6 +58,13 @@ public:
 
     void execute(PipelineExecutorContext & exec_context, PipelineExecGroupBuilder & group_builder);
 
+    /// Reduce `max_streams` by the limit that is the direct parent of `table_scan`.
+    static size_t getMaxStreamsByLimitHint(
+        const Context & context,
+        const TiDBTableScan & table_scan,
+        const FilterConditions & filter_conditions,
+        size_t max_streams);
+
 private:
     struct StorageWithStructureLock
     {
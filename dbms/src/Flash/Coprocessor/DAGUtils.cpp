@@ -735,6 +735,37 @@ bool isScalarFunctionExpr(const tipb::Expr & expr)
     return expr.tp() == tipb::ExprType::ScalarFunc;
 }
 
+bool isExpensiveExpr(const tipb::Expr & expr)
+{
+    if (isScalarFunctionExpr(expr))
+    {
+        switch (expr.sig())
+        {
+        case tipb::ScalarFuncSig::LikeSig:
+        case tipb::ScalarFuncSig::IlikeSig:
+        case tipb::ScalarFuncSig::RegexpSig:
+        case tipb::ScalarFuncSig::RegexpUTF8Sig:
+        case tipb::ScalarFuncSig::RegexpLikeSig:
+        case tipb::ScalarFuncSig::RegexpInStrSig:
+        case tipb::ScalarFuncSig::RegexpReplaceSig:
+        case tipb::ScalarFuncSig::RegexpSubstrSig:
+        case tipb::ScalarFuncSig::JsonExtractSig:
+        case tipb::ScalarFuncSig::JsonUnquoteSig:
+        case tipb::ScalarFuncSig::JsonContainsPathSig:
+        case tipb::ScalarFuncSig::JsonKeysSig:
+        case tipb::ScalarFuncSig::JsonKeys2ArgsSig:
+        case tipb::ScalarFuncSig::JsonLengthSig:
+        case tipb::ScalarFuncSig::JsonDepthSig:
+            return true;
+        default:
+            break;
+        }
+    }
+    return std::any_of(expr.children().begin(), expr.children().end(), [](const auto & child) {
+        return isExpensiveExpr(child);
+    });
+}
+
 bool isFunctionExpr(const tipb::Expr & expr)
 {
     return isScalarFunctionExpr(expr) || isAggFunctionExpr(expr) || isWindowFunctionExpr(expr);
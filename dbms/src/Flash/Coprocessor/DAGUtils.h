@@ -46,6 +46,9 @@ String getJoinTypeName(const tipb::JoinType & tp);
 String getFieldTypeName(Int32 tp);
 String getJoinExecTypeName(const tipb::JoinExecType & tp);
 bool isColumnExpr(const tipb::Expr & expr);
+/// Whether the expression contains a function that is much more expensive than comparisons and arithmetic, like
+/// `like`, `regexp` and the json functions.
+bool isExpensiveExpr(const tipb::Expr & expr);
 String getColumnNameForColumnExpr(const tipb::Expr & expr, const std::vector<NameAndTypePair> & input_col);
 void getColumnIDsFromExpr(
     const tipb::Expr & expr,
@@ -180,7 +180,8 @@ void orderStreams(
     Int64 limit,
     bool enable_fine_grained_shuffle,
     const Context & context,
-    const LoggerPtr & log)
+    const LoggerPtr & log,
+    const DM::TopNThresholdPtr & topn_threshold)
 {
     const Settings & settings = context.getSettingsRef();
     String extra_info;
@@ -188,7 +189,12 @@ void orderStreams(
         extra_info = enableFineGrainedShuffleExtraInfo;
 
     pipeline.transform([&](auto & stream) {
-        stream = std::make_shared<PartialSortingBlockInputStream>(stream, order_descr, log->identifier(), limit);
+        stream = std::make_shared<PartialSortingBlockInputStream>(
+            stream,
+            order_descr,
+            log->identifier(),
+            limit,
+            topn_threshold);
         stream->setExtraInfo(extra_info);
     });
 
@@ -261,7 +267,8 @@ void executeLocalSort(
     std::optional<size_t> limit,
     bool for_fine_grained_executor,
     const Context & context,
-    const LoggerPtr & log)
+    const LoggerPtr & log,
+    const DM::TopNThresholdPtr & topn_threshold)
 {
     auto input_header = group_builder.getCurrentHeader();
     if (SortHelper::isSortByConstants(input_header, order_descr))
@@ -284,7 +291,8 @@ void executeLocalSort(
                 exec_context,
                 log->identifier(),
                 order_descr,
-                limit.value_or(0))); // 0 means that no limit in PartialSortTransformOp.
+                limit.value_or(0), // 0 means that no limit in PartialSortTransformOp.
+                topn_threshold));
         });
         const Settings & settings = context.getSettingsRef();
         size_t max_bytes_before_external_sort
@@ -322,7 +330,8 @@ void executeFinalSort(
     const SortDescription & order_descr,
     std::optional<size_t> limit,
     const Context & context,
-    const LoggerPtr & log)
+    const LoggerPtr & log,
+    const DM::TopNThresholdPtr & topn_threshold)
 {
     auto input_header = group_builder.getCurrentHeader();
     if (SortHelper::isSortByConstants(input_header, order_descr))
@@ -345,7 +354,8 @@ void executeFinalSort(
                 exec_context,
                 log->identifier(),
                 order_descr,
-                limit.value_or(0))); // 0 means that no limit in PartialSortTransformOp.
+                limit.value_or(0), // 0 means that no limit in PartialSortTransformOp.
+                topn_threshold));
         });
 
         const Settings & settings = context.getSettingsRef();
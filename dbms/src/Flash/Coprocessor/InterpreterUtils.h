@@ -21,6 +21,7 @@
 #include <Flash/Coprocessor/FilterConditions.h>
 #include <Flash/Pipeline/Exec/PipelineExecBuilder.h>
 #include <Interpreters/ExpressionActions.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold_fwd.h>
 
 namespace DB
 {
@@ -75,7 +76,8 @@ void orderStreams(
     Int64 limit,
     bool enable_fine_grained_shuffle,
     const Context & context,
-    const LoggerPtr & log);
+    const LoggerPtr & log,
+    const DM::TopNThresholdPtr & topn_threshold = nullptr);
 
 void executeLocalSort(
     PipelineExecutorContext & exec_context,
@@ -84,7 +86,8 @@ void executeLocalSort(
     std::optional<size_t> limit,
     bool for_fine_grained_executor,
     const Context & context,
-    const LoggerPtr & log);
+    const LoggerPtr & log,
+    const DM::TopNThresholdPtr & topn_threshold = nullptr);
 
 void executeFinalSort(
     PipelineExecutorContext & exec_context,
@@ -92,7 +95,8 @@ void executeFinalSort(
     const SortDescription & order_descr,
     std::optional<size_t> limit,
     const Context & context,
-    const LoggerPtr & log);
+    const LoggerPtr & log,
+    const DM::TopNThresholdPtr & topn_threshold = nullptr);
 
 void executeCreatingSets(DAGPipeline & pipeline, const Context & context, size_t max_streams, const LoggerPtr & log);
 
@@ -0,0 +1,79 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Coprocessor/StreamWriter.h>
+
+namespace DB
+{
+BatchCopStreamWriter::BatchCopStreamWriter(::grpc::ServerWriter<::coprocessor::BatchResponse> * writer_)
+    : writer(writer_)
+    , pending_responses(
+          CapacityLimits(max_pending_responses, max_pending_bytes),
+          [](const ::coprocessor::BatchResponse & resp) { return resp.data().size(); })
+    , thread_manager(newThreadManager())
+{
+    thread_manager->schedule(true, "BatchCopWriter", [this] { writeLoop(); });
+}
+
+BatchCopStreamWriter::~BatchCopStreamWriter()
+{
+    if (finished)
+        return;
+    // `finish` is not called if the query meets error, drop the pending responses.
+    pending_responses.cancel();
+    try
+    {
+        thread_manager->wait();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+    }
+}
+
+void BatchCopStreamWriter::writeLoop()
+{
+    ::coprocessor::BatchResponse resp;
+    while (pending_responses.pop(resp) == MPMCQueueResult::OK)
+    {
+        if (!writer->Write(resp))
+        {
+            pending_responses.cancelWith("Failed to write resp");
+            return;
+        }
+    }
+}
+
+void BatchCopStreamWriter::write(tipb::SelectResponse & response)
+{
+    ::coprocessor::BatchResponse resp;
+    if (!response.SerializeToString(resp.mutable_data()))
+        throw Exception(
+            "[StreamWriter]Fail to serialize response, response size: " + std::to_string(response.ByteSizeLong()));
+
+    GET_METRIC(tiflash_coprocessor_response_bytes, type_batch_cop).Increment(resp.ByteSizeLong());
+
+    if (pending_responses.push(std::move(resp)) != MPMCQueueResult::OK)
+        throw Exception(pending_responses.getCancelReason());
+}
+
+void BatchCopStreamWriter::finish()
+{
+    finished = true;
+    pending_responses.finish();
+    thread_manager->wait();
+    if (pending_responses.getStatus() == MPMCQueueStatus::CANCELLED)
+        throw Exception(pending_responses.getCancelReason());
+}
+} // namespace DB
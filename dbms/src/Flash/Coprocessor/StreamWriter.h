@@ -15,6 +15,8 @@
 #pragma once
 
 #include <Common/Exception.h>
+#include <Common/MPMCQueue.h>
+#include <Common/ThreadManager.h>
 #include <Common/TiFlashMetrics.h>
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -60,28 +62,29 @@ struct CopStreamWriter
     bool isWritable() const { throw Exception("Unsupport async write"); }
 };
 
+/// Write the responses of BatchCop to gRPC in a background thread, so that encoding the next response overlaps with
+/// the gRPC write of the previous one. The pending responses are bounded, `write` blocks when the limits are exceeded.
 struct BatchCopStreamWriter
 {
-    ::grpc::ServerWriter<::coprocessor::BatchResponse> * writer;
-    std::mutex write_mutex;
+    static constexpr Int64 max_pending_responses = 16;
+    static constexpr Int64 max_pending_bytes = 64 * 1024 * 1024;
 
-    explicit BatchCopStreamWriter(::grpc::ServerWriter<::coprocessor::BatchResponse> * writer_)
-        : writer(writer_)
-    {}
-    void write(tipb::SelectResponse & response)
-    {
-        ::coprocessor::BatchResponse resp;
-        if (!response.SerializeToString(resp.mutable_data()))
-            throw Exception(
-                "[StreamWriter]Fail to serialize response, response size: " + std::to_string(response.ByteSizeLong()));
+    ::grpc::ServerWriter<::coprocessor::BatchResponse> * writer;
 
-        GET_METRIC(tiflash_coprocessor_response_bytes, type_batch_cop).Increment(resp.ByteSizeLong());
+    explicit BatchCopStreamWriter(::grpc::ServerWriter<::coprocessor::BatchResponse> * writer_);
+    ~BatchCopStreamWriter();
 
-        std::lock_guard lk(write_mutex);
-        if (!writer->Write(resp))
-            throw Exception("Failed to write resp");
-    }
+    void write(tipb::SelectResponse & response);
+    /// Wait for all the pending responses to be written, throw if any of them fails.
+    void finish();
     bool isWritable() const { throw Exception("Unsupport async write"); }
+
+private:
+    void writeLoop();
+
+    MPMCQueue<::coprocessor::BatchResponse> pending_responses;
+    std::shared_ptr<ThreadManager> thread_manager;
+    bool finished = false;
 };
 
 using CopStreamWriterPtr = std::shared_ptr<CopStreamWriter>;
@@ -17,6 +17,8 @@
 #include <IO/Endian.h>
 #include <IO/Operators.h>
 
+#include <bit>
+
 namespace DB
 {
 namespace ErrorCodes
@@ -173,6 +175,42 @@ void TiDBColumn::append(DB::Float64 value)
     finishAppendFixed();
 }
 
+void TiDBColumn::appendFixed64Batch(const UInt64 * values, const UInt8 * null_map, size_t size)
+{
+    if unlikely (fixed_size != sizeof(UInt64))
+        throw Exception(
+            ErrorCodes::LOGICAL_ERROR,
+            "appendFixed64Batch is called on a column whose element length is {}",
+            static_cast<Int32>(fixed_size));
+    if (size == 0)
+        return;
+
+    // Set the null bitmap of all the rows at once, the new bytes are zero filled.
+    null_bitmap.resize((length + size + 7) / 8, 0);
+    size_t nulls = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        const bool not_null = null_map == nullptr || null_map[i] == 0;
+        const size_t row = length + i;
+        null_bitmap[row >> 3] |= static_cast<UInt8>(not_null) << (row & 7);
+        nulls += !not_null;
+    }
+
+    if (nulls == 0 && std::endian::native == std::endian::little)
+    {
+        data->write(reinterpret_cast<const char *>(values), size * sizeof(UInt64));
+    }
+    else
+    {
+        // The data of the null rows are filled with the default value
+        for (size_t i = 0; i < size; ++i)
+            encodeLittleEndian<UInt64>(null_map != nullptr && null_map[i] ? 0 : values[i], *data);
+    }
+    null_cnt += nulls;
+    current_data_size += (size - nulls) * sizeof(UInt64);
+    length += size;
+}
+
 void TiDBColumn::encodeColumn(WriteBuffer & ss)
 {
     encodeLittleEndian<UInt32>(length, ss);
@@ -41,6 +41,9 @@ public:
     void append(const TiDBDecimal & decimal);
     void append(const TiDBBit & bit);
     void append(const TiDBEnum & ti_enum);
+    /// Append `size` values of a column whose element length is 8 at once, the values are encoded as little endian
+    /// UInt64. The rows with `null_map[i] != 0` are appended as null, `null_map` can be nullptr if there is no null.
+    void appendFixed64Batch(const UInt64 * values, const UInt8 * null_map, size_t size);
     void encodeColumn(WriteBuffer & ss);
     void clear();
 
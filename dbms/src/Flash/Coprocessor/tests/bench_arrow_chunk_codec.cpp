@@ -0,0 +1,111 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Coprocessor/ArrowChunkCodec.h>
+#include <TestUtils/ColumnGenerator.h>
+#include <TiDB/Schema/TiDB.h>
+#include <benchmark/benchmark.h>
+
+/// Throughput of encoding the results that are returned to TiDB in the arrow chunk format.
+
+namespace DB
+{
+namespace tests
+{
+namespace
+{
+constexpr size_t block_rows = DEFAULT_BLOCK_SIZE;
+
+tipb::FieldType makeFieldType(Int32 tp, UInt32 flag, Int32 decimal = 0)
+{
+    tipb::FieldType field_type;
+    field_type.set_tp(tp);
+    field_type.set_flag(flag);
+    field_type.set_decimal(decimal);
+    return field_type;
+}
+
+void encodeBlock(benchmark::State & state, const std::vector<tipb::FieldType> & field_types, const Block & block)
+{
+    ArrowChunkCodec codec;
+    auto stream = codec.newCodecStream(field_types);
+    for (auto _ : state)
+    {
+        stream->encode(block, 0, block.rows());
+        benchmark::DoNotOptimize(stream->getString());
+        stream->clear();
+    }
+    state.SetItemsProcessed(state.iterations() * block.rows());
+}
+} // namespace
+
+static void ArrowChunkCodecEncodeInt(benchmark::State & state)
+{
+    std::vector<tipb::FieldType> field_types{
+        makeFieldType(TiDB::TypeLongLong, TiDB::ColumnFlagNotNull),
+        makeFieldType(TiDB::TypeLongLong, 0),
+        makeFieldType(TiDB::TypeLong, TiDB::ColumnFlagNotNull),
+    };
+    Block block{
+        ColumnGenerator::instance().generate({block_rows, "Int64", RANDOM, "c0"}),
+        ColumnGenerator::instance().generate({block_rows, "Nullable(Int64)", RANDOM, "c1"}),
+        ColumnGenerator::instance().generate({block_rows, "Int32", RANDOM, "c2"}),
+    };
+    encodeBlock(state, field_types, block);
+}
+BENCHMARK(ArrowChunkCodecEncodeInt);
+
+static void ArrowChunkCodecEncodeDouble(benchmark::State & state)
+{
+    std::vector<tipb::FieldType> field_types{
+        makeFieldType(TiDB::TypeDouble, TiDB::ColumnFlagNotNull),
+        makeFieldType(TiDB::TypeDouble, 0),
+    };
+    Block block{
+        ColumnGenerator::instance().generate({block_rows, "Float64", RANDOM, "c0"}),
+        ColumnGenerator::instance().generate({block_rows, "Nullable(Float64)", RANDOM, "c1"}),
+    };
+    encodeBlock(state, field_types, block);
+}
+BENCHMARK(ArrowChunkCodecEncodeDouble);
+
+static void ArrowChunkCodecEncodeDateTime(benchmark::State & state)
+{
+    std::vector<tipb::FieldType> field_types{
+        makeFieldType(TiDB::TypeDatetime, TiDB::ColumnFlagNotNull, 6),
+        makeFieldType(TiDB::TypeDatetime, 0, 6),
+    };
+    Block block{
+        ColumnGenerator::instance().generate({block_rows, "MyDateTime(6)", RANDOM, "c0"}),
+        ColumnGenerator::instance().generate({block_rows, "Nullable(MyDateTime(6))", RANDOM, "c1"}),
+    };
+    encodeBlock(state, field_types, block);
+}
+BENCHMARK(ArrowChunkCodecEncodeDateTime);
+
+static void ArrowChunkCodecEncodeDecimal(benchmark::State & state)
+{
+    std::vector<tipb::FieldType> field_types{
+        makeFieldType(TiDB::TypeNewDecimal, TiDB::ColumnFlagNotNull, 4),
+    };
+    field_types[0].set_flen(20);
+    Block block{
+        ColumnGenerator::instance().generate({block_rows, "Decimal(20,4)", RANDOM, "c0"}),
+    };
+    encodeBlock(state, field_types, block);
+}
+BENCHMARK(ArrowChunkCodecEncodeDecimal);
+
+} // namespace tests
+} // namespace DB
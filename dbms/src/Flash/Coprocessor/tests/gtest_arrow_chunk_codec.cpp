@@ -0,0 +1,101 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Coprocessor/ArrowChunkCodec.h>
+#include <Flash/Coprocessor/TiDBColumn.h>
+#include <TestUtils/FunctionTestUtils.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <TiDB/Schema/TiDB.h>
+#include <gtest/gtest.h>
+
+namespace DB
+{
+namespace tests
+{
+namespace
+{
+String encodeColumn(TiDBColumn & column)
+{
+    WriteBufferFromOwnString buf;
+    column.encodeColumn(buf);
+    return buf.releaseStr();
+}
+} // namespace
+
+TEST(ArrowChunkCodecTest, AppendFixed64Batch)
+try
+{
+    std::vector<UInt64> values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    std::vector<UInt8> null_map{0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0};
+    for (bool with_null : {false, true})
+    {
+        // Start from a row in the middle of a byte of the null bitmap
+        TiDBColumn expected(8);
+        TiDBColumn actual(8);
+        expected.append(static_cast<UInt64>(100));
+        expected.appendNull();
+        expected.append(static_cast<UInt64>(101));
+        actual.append(static_cast<UInt64>(100));
+        actual.appendNull();
+        actual.append(static_cast<UInt64>(101));
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (with_null && null_map[i])
+                expected.appendNull();
+            else
+                expected.append(values[i]);
+        }
+        actual.appendFixed64Batch(values.data(), with_null ? null_map.data() : nullptr, values.size());
+        ASSERT_EQ(encodeColumn(expected), encodeColumn(actual));
+    }
+}
+CATCH
+
+TEST(ArrowChunkCodecTest, EncodeAndDecode)
+try
+{
+    std::vector<tipb::FieldType> field_types(4);
+    field_types[0].set_tp(TiDB::TypeLong);
+    field_types[1].set_tp(TiDB::TypeLongLong);
+    field_types[1].set_flag(TiDB::ColumnFlagNotNull | TiDB::ColumnFlagUnsigned);
+    field_types[2].set_tp(TiDB::TypeDouble);
+    field_types[3].set_tp(TiDB::TypeTiny);
+    field_types[3].set_flag(TiDB::ColumnFlagNotNull);
+
+    Block block{
+        createColumn<Nullable<Int32>>({1, {}, -3, 4, {}, 6, 7, {}, 9}, "c0"),
+        createColumn<UInt64>({1, 2, 3, 4, 5, 6, 7, 8, std::numeric_limits<UInt64>::max()}, "c1"),
+        createColumn<Nullable<Float64>>({1.5, -2.5, {}, 4.0, 5.0, {}, 7.25, 8.0, 9.0}, "c2"),
+        createColumn<Int8>({-1, 2, -3, 4, -5, 6, -7, 8, -9}, "c3"),
+    };
+
+    DAGSchema schema;
+    for (size_t i = 0; i < field_types.size(); ++i)
+        schema.emplace_back(fmt::format("c{}", i), TiDB::fieldTypeToColumnInfo(field_types[i]));
+
+    ArrowChunkCodec codec;
+    auto stream = codec.newCodecStream(field_types);
+    // Encode the block in two parts, the second part starts from a row in the middle of the null bitmap
+    stream->encode(block, 0, 3);
+    stream->encode(block, 3, block.rows());
+    auto decoded = codec.decode(stream->getString(), schema);
+    ASSERT_EQ(decoded.rows(), block.rows());
+    for (size_t i = 0; i < block.columns(); ++i)
+        ASSERT_COLUMN_EQ(block.getByPosition(i).column, decoded.getByPosition(i).column);
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
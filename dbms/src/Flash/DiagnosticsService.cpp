@@ -184,6 +184,7 @@ grpc::Status searchLog(
         LOG_DEBUG(log, "start to search file {}", path);
         auto status = grpc::Status::OK;
         ReadLogFile(path, [&](std::istream & istr) {
+            SeekLogFileByTime(istr, start_time);
             LogIterator log_itr(start_time, end_time, levels, patterns, istr);
             status = searchLog(log, stream, log_itr);
         });
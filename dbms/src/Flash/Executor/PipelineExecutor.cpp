@@ -39,6 +39,9 @@ PipelineExecutor::PipelineExecutor(
           register_operator_spill_context,
           context.getDAGContext()->getResourceGroupName())
 {
+    exec_context.setCPUTimeWeight(context.getSettingsRef().pipeline_query_cpu_time_weight);
+    if (auto capacity = context.getSettingsRef().pipeline_task_timeline_capacity; capacity > 0)
+        exec_context.enableTaskTimeline(capacity);
     PhysicalPlan physical_plan{context, log->identifier()};
     physical_plan.build(context.getDAGContext()->dag_request());
     physical_plan.outputAndOptimize();
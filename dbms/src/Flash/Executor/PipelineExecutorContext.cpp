@@ -137,6 +137,12 @@ void PipelineExecutorContext::decActiveRefCount()
         // It is not expected for a query to be finished more than one time.
         RUNTIME_ASSERT(!is_finished);
         is_finished = true;
+        query_profile_info.reportMetrics();
+        if (auto cancel_ns = cancel_time_ns.load(std::memory_order_relaxed); cancel_ns > 0)
+            GET_METRIC(tiflash_pipeline_query_cancel_release_seconds, type_cancel)
+                .Observe((clock_gettime_ns(CLOCK_MONOTONIC) - cancel_ns) / 1'000'000'000.0);
+        if (task_timeline)
+            LOG_INFO(log, "task timeline: {}", task_timeline->toChromeTrace());
 
         if (!isWaitMode())
         {
@@ -152,6 +158,7 @@ void PipelineExecutorContext::cancel()
     bool origin_value = false;
     if (is_cancelled.compare_exchange_strong(origin_value, true, std::memory_order_release))
     {
+        cancel_time_ns.store(clock_gettime_ns(CLOCK_MONOTONIC), std::memory_order_relaxed);
         if likely (TaskScheduler::instance && !query_id.empty())
             TaskScheduler::instance->cancel(query_id, resource_group_name);
     }
@@ -16,11 +16,13 @@
 
 #include <Common/Logger.h>
 #include <Common/MemoryTracker.h>
+#include <Common/Stopwatch.h>
 #include <Core/AutoSpillTrigger.h>
 #include <Flash/Executor/ExecutionResult.h>
 #include <Flash/Executor/ResultHandler.h>
 #include <Flash/Executor/ResultQueue.h>
 #include <Flash/Pipeline/Schedule/Tasks/TaskProfileInfo.h>
+#include <Flash/Pipeline/Schedule/Tasks/TaskTimeline.h>
 
 #include <atomic>
 #include <exception>
@@ -173,6 +175,29 @@ public:
 
     const String & getResourceGroupName() const { return resource_group_name; }
 
+    // Used by the cpu task queue to share cpu time between queries.
+    // 0 means the tasks of the query are scheduled only by their own cpu time.
+    void setCPUTimeWeight(double cpu_time_weight_) { cpu_time_weight = cpu_time_weight_; }
+
+    // Unlike `query_profile_info`, which is merged when a task finishes, this is added after every round of execution.
+    ALWAYS_INLINE void addCPUExecuteTime(UInt64 value)
+    {
+        running_cpu_execute_time_ns.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    // Must be called before any task of the query is scheduled.
+    void enableTaskTimeline(size_t capacity) { task_timeline = std::make_unique<TaskTimeline>(capacity); }
+
+    // Return nullptr if the task timeline is not enabled.
+    ALWAYS_INLINE TaskTimeline * getTaskTimeline() const { return task_timeline.get(); }
+
+    ALWAYS_INLINE UInt64 getWeightedCPUExecuteTimeNs() const
+    {
+        if (cpu_time_weight <= 0)
+            return 0;
+        return static_cast<UInt64>(running_cpu_execute_time_ns.load(std::memory_order_relaxed) / cpu_time_weight);
+    }
+
 private:
     bool setExceptionPtr(const std::exception_ptr & exception_ptr_);
 
@@ -194,6 +219,8 @@ private:
     UInt32 active_ref_count{0};
 
     std::atomic_bool is_cancelled{false};
+    // The time when the query is cancelled, to report how long it takes to finish all the tasks after cancelled.
+    std::atomic_uint64_t cancel_time_ns{0};
 
     bool is_finished{false};
 
@@ -207,5 +234,10 @@ private:
     RegisterOperatorSpillContext register_operator_spill_context;
 
     const String resource_group_name;
+
+    double cpu_time_weight = 0;
+    std::atomic_uint64_t running_cpu_execute_time_ns{0};
+
+    TaskTimelinePtr task_timeline;
 };
 } // namespace DB
@@ -234,6 +234,34 @@ bool LogIterator::readDate(
     return true;
 }
 
+// Return the time in milliseconds of the log line, or -1 if the line does not start with a timestamp.
+static int64_t readLogLineTime(const std::string & line)
+{
+    int milli_second;
+    int timezone_hour, timezone_min;
+    int year, month, day, hour, minute, second;
+    if (!LogIterator::readDate(
+            line.size(),
+            line.data(),
+            year,
+            month,
+            day,
+            hour,
+            minute,
+            second,
+            milli_second,
+            timezone_hour,
+            timezone_min))
+        return -1;
+    std::tm time{};
+    time.tm_year = year - 1900;
+    time.tm_mon = month - 1;
+    time.tm_mday = day;
+    time.tm_hour = hour;
+    time.tm_min = minute;
+    time.tm_sec = second;
+    return fast_mktime(&time) * 1000 + milli_second;
+}
 
 std::optional<LogIterator::Error> LogIterator::readLog(LogEntry & entry)
 {
@@ -468,6 +496,52 @@ bool FilterFileByDatetime(
     }
 }
 
+void SeekLogFileByTime(std::istream & istr, int64_t start_time)
+{
+    // The logs written by concurrent threads may be slightly out of order, seek to a bit earlier than `start_time`.
+    static constexpr int64_t time_margin_ms = 1000;
+    // Stop the binary search when the range is small enough to be scanned directly.
+    static constexpr std::streamoff min_seek_range = 64 * 1024;
+    // The max lines to look for a timestamp after a position, the lines of a multi-line message have no timestamp.
+    static constexpr size_t max_probe_lines = 64;
+
+    if (start_time <= 0)
+        return;
+
+    const std::streamoff begin = istr.tellg();
+    if (begin < 0 || !istr.seekg(0, std::ios::end))
+    {
+        // Not seekable, e.g. the compressed log files.
+        istr.clear();
+        return;
+    }
+    std::streamoff lo = begin;
+    std::streamoff hi = istr.tellg();
+    const int64_t target_time = start_time - time_margin_ms;
+    std::string line;
+    // Find a position that the first log after it is earlier than `target_time`, as close to `target_time` as possible.
+    while (hi - lo > min_seek_range)
+    {
+        const std::streamoff mid = lo + (hi - lo) / 2;
+        istr.clear();
+        istr.seekg(mid);
+        // Skip the partial line
+        std::getline(istr, line);
+        int64_t time = -1;
+        for (size_t i = 0; i < max_probe_lines && time < 0 && std::getline(istr, line); ++i)
+            time = readLogLineTime(line);
+        if (time >= 0 && time < target_time)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    istr.clear();
+    istr.seekg(lo);
+    if (lo != begin)
+        std::getline(istr, line);
+}
+
 // if path ends with `.gz`, try to read by `Poco::InflatingInputStream`
 void ReadLogFile(const std::string & path, std::function<void(std::istream &)> && cb)
 {
@@ -138,6 +138,10 @@ private:
 
 void ReadLogFile(const std::string & path, std::function<void(std::istream &)> && cb);
 
+/// The logs in a file are in time order, seek the stream to skip the logs earlier than `start_time` by binary search
+/// instead of parsing them one by one. It is a no-op if the stream is not seekable.
+void SeekLogFileByTime(std::istream & istr, int64_t start_time);
+
 bool FilterFileByDatetime(
     const std::string & path,
     const std::vector<std::string> & ignore_log_file_prefixes,
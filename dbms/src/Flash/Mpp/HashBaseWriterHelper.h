@@ -49,6 +49,18 @@ void scatterColumns(
     uint32_t bucket_num,
     std::vector<std::vector<MutableColumnPtr>> & result_columns);
 
+/// Different from scatterColumns, the rows are appended to `scattered`, which is indexed by [col_id][part_id],
+/// so that the rows of several blocks can be coalesced into the same columns of each partition.
+void scatterColumnsTo(
+    const Block & block,
+    const std::vector<Int64> & partition_col_ids,
+    const TiDB::TiDBCollators & collators,
+    std::vector<String> & partition_key_containers,
+    uint32_t part_num,
+    WeakHash32 & hash,
+    IColumn::Selector & selector,
+    std::vector<IColumn::ScatterColumns> & scattered);
+
 void scatterColumnsForFineGrainedShuffle(
     const Block & block,
     const std::vector<Int64> & partition_col_ids,
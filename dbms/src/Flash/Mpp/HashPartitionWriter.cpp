@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/TiFlashException.h>
+#include <Common/TiFlashMetrics.h>
 #include <Flash/Coprocessor/CHBlockChunkCodec.h>
 #include <Flash/Coprocessor/CHBlockChunkCodecV1.h>
 #include <Flash/Coprocessor/DAGContext.h>
@@ -25,6 +26,10 @@ namespace DB
 constexpr ssize_t MAX_BATCH_SEND_MIN_LIMIT_MEM_SIZE
     = 1024 * 1024 * 64; // 64MB: 8192 Rows * 256 Byte/row * 32 partitions
 const char * HashPartitionWriterLabels[] = {"HashPartitionWriter", "HashPartitionWriter-V1"};
+// Only check the skew after enough rows are partitioned, so that a few hot rows at the beginning won't be reported.
+constexpr size_t SKEW_CHECK_MIN_ROWS = 1024 * 1024;
+// A partition is skewed if it receives more than `SKEW_RATIO` times the average rows of all partitions.
+constexpr size_t SKEW_RATIO = 4;
 
 template <class ExchangeWriterPtr>
 HashPartitionWriter<ExchangeWriterPtr>::HashPartitionWriter(
@@ -46,6 +51,7 @@ HashPartitionWriter<ExchangeWriterPtr>::HashPartitionWriter(
     rows_in_blocks = 0;
     partition_num = writer_->getPartitionNum();
     RUNTIME_CHECK(partition_num > 0);
+    rows_in_partitions.resize(partition_num, 0);
     RUNTIME_CHECK(dag_context.encode_type == tipb::EncodeType::TypeCHBlock);
 
     switch (data_codec_version)
@@ -158,43 +164,67 @@ void HashPartitionWriter<ExchangeWriterPtr>::partitionAndWriteBlocksV1()
     // All blocks are same, use one block's meta info as header
     Block dest_block_header = blocks.back().cloneEmpty();
     std::vector<String> partition_key_containers(collators.size());
-    std::vector<std::vector<MutableColumns>> dest_columns(partition_num);
-    size_t total_rows = 0;
 
+    // Coalesce the rows of all blocks into one set of columns for each partition, so that the packet of
+    // a partition is encoded from a few large columns instead of many small columns of the small blocks.
+    const size_t num_columns = dest_block_header.columns();
+    /// 1.1 is just a guess, same as IColumn::initializeScatterColumns
+    const size_t reserve_rows = rows_in_blocks * 1.1 / partition_num;
+    std::vector<IColumn::ScatterColumns> scattered(num_columns);
+    for (size_t col_id = 0; col_id < num_columns; ++col_id)
+    {
+        const auto & column = dest_block_header.getByPosition(col_id).column;
+        scattered[col_id].reserve(partition_num);
+        for (size_t part_id = 0; part_id < partition_num; ++part_id)
+        {
+            scattered[col_id].emplace_back(column->cloneEmpty());
+            scattered[col_id].back()->reserve(reserve_rows);
+        }
+    }
+
+    WeakHash32 hash(0);
+    IColumn::Selector selector;
     for (auto & block : blocks)
     {
         {
             // check schema
             assertBlockSchema(expected_types, block, HashPartitionWriterLabels[MPPDataPacketV1]);
         }
-        auto && dest_tbl_cols = HashBaseWriterHelper::createDestColumns(block, partition_num);
-        HashBaseWriterHelper::scatterColumns(
+        HashBaseWriterHelper::scatterColumnsTo(
             block,
             partition_col_ids,
             collators,
             partition_key_containers,
             partition_num,
-            dest_tbl_cols);
+            hash,
+            selector,
+            scattered);
         block.clear();
-
-        for (size_t part_id = 0; part_id < partition_num; ++part_id)
-        {
-            auto & columns = dest_tbl_cols[part_id];
-            if unlikely (!columns.front())
-                continue;
-            size_t expect_size = columns.front()->size();
-            total_rows += expect_size;
-            dest_columns[part_id].emplace_back(std::move(columns));
-        }
     }
     blocks.clear();
+
+    std::vector<MutableColumns> dest_columns(partition_num);
+    size_t total_rows = 0;
+    for (size_t part_id = 0; part_id < partition_num; ++part_id)
+    {
+        auto & columns = dest_columns[part_id];
+        columns.reserve(num_columns);
+        for (size_t col_id = 0; col_id < num_columns; ++col_id)
+            columns.emplace_back(std::move(scattered[col_id][part_id]));
+        size_t part_rows = columns.front()->size();
+        total_rows += part_rows;
+        updatePartitionRows(part_id, part_rows);
+    }
     RUNTIME_CHECK(rows_in_blocks, total_rows);
+    checkPartitionSkew();
 
     for (size_t part_id = 0; part_id < partition_num; ++part_id)
     {
+        std::vector<MutableColumns> part_columns;
+        part_columns.emplace_back(std::move(dest_columns[part_id]));
         writer->partitionWrite(
             dest_block_header,
-            std::move(dest_columns[part_id]),
+            std::move(part_columns),
             part_id,
             data_codec_version,
             compression_method);
@@ -235,6 +265,7 @@ void HashPartitionWriter<ExchangeWriterPtr>::partitionAndWriteBlocks()
             {
                 Block dest_block = header.cloneEmpty();
                 dest_block.setColumns(std::move(dest_tbl_cols[part_id]));
+                updatePartitionRows(part_id, dest_block.rows());
                 if (dest_block.rows() > 0)
                     partition_blocks[part_id].push_back(std::move(dest_block));
             }
@@ -242,6 +273,7 @@ void HashPartitionWriter<ExchangeWriterPtr>::partitionAndWriteBlocks()
         assert(blocks.empty());
         rows_in_blocks = 0;
     }
+    checkPartitionSkew();
 
     writePartitionBlocks(partition_blocks);
 }
@@ -260,6 +292,37 @@ void HashPartitionWriter<ExchangeWriterPtr>::writePartitionBlocks(std::vector<Bl
     }
 }
 
+template <class ExchangeWriterPtr>
+void HashPartitionWriter<ExchangeWriterPtr>::updatePartitionRows(size_t part_id, size_t rows)
+{
+    rows_in_partitions[part_id] += rows;
+    total_partitioned_rows += rows;
+}
+
+template <class ExchangeWriterPtr>
+void HashPartitionWriter<ExchangeWriterPtr>::checkPartitionSkew()
+{
+    if (skew_reported || partition_num <= 1 || total_partitioned_rows < SKEW_CHECK_MIN_ROWS)
+        return;
+
+    auto max_iter = std::max_element(rows_in_partitions.cbegin(), rows_in_partitions.cend());
+    // Compare `max * partition_num` with `total * SKEW_RATIO` to avoid losing precision of the average.
+    if (*max_iter * partition_num <= total_partitioned_rows * SKEW_RATIO)
+        return;
+
+    // Only report once for each writer, the rows of the skewed partition keep increasing anyway.
+    skew_reported = true;
+    GET_METRIC(tiflash_exchange_partition_skew_count).Increment();
+    LOG_WARNING(
+        dag_context.log,
+        "Hash partition is skewed, partition {} receives {} of {} rows, partition_num={}, "
+        "the partition keys may contain hot values",
+        std::distance(rows_in_partitions.cbegin(), max_iter),
+        *max_iter,
+        total_partitioned_rows,
+        partition_num);
+}
+
 template class HashPartitionWriter<SyncMPPTunnelSetWriterPtr>;
 template class HashPartitionWriter<AsyncMPPTunnelSetWriterPtr>;
 
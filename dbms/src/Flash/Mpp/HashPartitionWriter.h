@@ -49,6 +49,9 @@ private:
 
     void writePartitionBlocks(std::vector<Blocks> & partition_blocks);
 
+    void updatePartitionRows(size_t part_id, size_t rows);
+    void checkPartitionSkew();
+
 private:
     Int64 batch_send_min_limit;
     ExchangeWriterPtr writer;
@@ -62,6 +65,10 @@ private:
     DataTypes expected_types;
     MPPDataPacketVersion data_codec_version;
     CompressionMethod compression_method{};
+    // The rows sent to each partition, used to detect the skewed partition keys.
+    std::vector<size_t> rows_in_partitions;
+    size_t total_partitioned_rows = 0;
+    bool skew_reported = false;
 };
 
 } // namespace DB
@@ -206,11 +206,23 @@ void MPPTask::run()
 void MPPTask::registerTunnels(const mpp::DispatchTaskRequest & task_request)
 {
     auto tunnel_set_local = std::make_shared<MPPTunnelSet>(log->identifier());
+    tunnel_set_local->setMaxOverflowBytes(context->getSettingsRef().max_overflow_bytes_in_slow_tunnels);
     std::chrono::seconds timeout(task_request.timeout());
     const auto & exchange_sender = dag_context->dag_request.rootExecutor().exchange_sender();
     size_t tunnel_queue_memory_bound = getAverageThreshold(
         context->getSettingsRef().max_buffered_bytes_in_executor,
         exchange_sender.encoded_task_meta_size());
+    if (const size_t node_memory_bound = context->getSettingsRef().max_buffered_bytes_in_exchange_for_all_queries;
+        node_memory_bound > 0)
+    {
+        // Share the node level bound with the tunnels alive now, so that a node serving many concurrent
+        // queries won't run out of memory because of the data queued in the tunnels.
+        size_t fair_share = getAverageThreshold(
+            node_memory_bound,
+            MPPTunnel::getAliveTunnelNum() + exchange_sender.encoded_task_meta_size());
+        tunnel_queue_memory_bound
+            = tunnel_queue_memory_bound == 0 ? fair_share : std::min(tunnel_queue_memory_bound, fair_share);
+    }
     CapacityLimits queue_limit(
         std::max(5, context->getSettingsRef().max_threads * 5),
         tunnel_queue_memory_bound); // MPMCQueue can benefit from a slightly larger queue size
@@ -532,7 +544,9 @@ void MPPTask::runImpl()
             dag_context->tunnel_set->getExternalThreadCnt(),
             new_thread_count_of_mpp_receiver);
 
+        const auto schedule_start_time = Clock::now();
         scheduleOrWait();
+        mpp_task_statistics.setScheduleTimestamp(schedule_start_time, Clock::now());
 
         auto time_cost_in_schedule_ms = stopwatch.elapsedMilliseconds() - time_cost_in_preprocess_ms;
         LOG_INFO(
@@ -650,6 +664,7 @@ void MPPTask::runImpl()
     }
     mpp_task_statistics.end(status.load(), getErrString());
     mpp_task_statistics.logTracingJson();
+    mpp_task_statistics.recordResourceUsage();
 
     LOG_DEBUG(log, "task ends, time cost is {} ms.", stopwatch.elapsedMilliseconds());
     unregisterTask();
@@ -0,0 +1,48 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Mpp/MPPTaskResourceUsageHistory.h>
+
+namespace DB
+{
+MPPTaskResourceUsageHistory & MPPTaskResourceUsageHistory::instance()
+{
+    static MPPTaskResourceUsageHistory history;
+    return history;
+}
+
+void MPPTaskResourceUsageHistory::add(MPPTaskResourceUsage && usage)
+{
+    std::lock_guard lock(mu);
+    if (capacity == 0)
+        return;
+    while (records.size() >= capacity)
+        records.pop_front();
+    records.push_back(std::move(usage));
+}
+
+std::vector<MPPTaskResourceUsage> MPPTaskResourceUsageHistory::getAll() const
+{
+    std::lock_guard lock(mu);
+    return {records.begin(), records.end()};
+}
+
+void MPPTaskResourceUsageHistory::setCapacity(size_t capacity_)
+{
+    std::lock_guard lock(mu);
+    capacity = capacity_;
+    while (records.size() > capacity)
+        records.pop_front();
+}
+} // namespace DB
@@ -0,0 +1,74 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Flash/Executor/toRU.h>
+#include <common/types.h>
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace DB
+{
+/// The resource usage of a finished MPPTask, shown in `system.mpp_task_resource_usage`.
+struct MPPTaskResourceUsage
+{
+    UInt64 query_tso = 0;
+    Int64 task_id = 0;
+    String status;
+    Int64 task_start_timestamp = 0;
+    Int64 task_end_timestamp = 0;
+
+    RU cpu_ru = 0;
+    RU read_ru = 0;
+    Int64 memory_peak = 0;
+
+    Int64 local_input_bytes = 0;
+    Int64 remote_input_bytes = 0;
+    Int64 output_bytes = 0;
+
+    // Collected from the ScanContexts of the task
+    UInt64 user_read_bytes = 0;
+    UInt64 dmfile_read_time_ns = 0;
+    UInt64 disagg_read_cache_hit_bytes = 0;
+    UInt64 disagg_read_cache_miss_bytes = 0;
+};
+
+/// Keeps the resource usage of the latest finished MPPTasks. The number of records is bounded, the oldest records
+/// are dropped when it is full.
+class MPPTaskResourceUsageHistory
+{
+public:
+    static constexpr size_t default_capacity = 1000;
+
+    static MPPTaskResourceUsageHistory & instance();
+
+    explicit MPPTaskResourceUsageHistory(size_t capacity_ = default_capacity)
+        : capacity(capacity_)
+    {}
+
+    void add(MPPTaskResourceUsage && usage);
+
+    std::vector<MPPTaskResourceUsage> getAll() const;
+
+    void setCapacity(size_t capacity_);
+
+private:
+    mutable std::mutex mu;
+    size_t capacity;
+    std::deque<MPPTaskResourceUsage> records;
+};
+} // namespace DB
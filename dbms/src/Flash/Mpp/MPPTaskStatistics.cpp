@@ -15,8 +15,10 @@
 #include <Common/FmtUtils.h>
 #include <DataStreams/TiRemoteBlockInputStream.h>
 #include <Flash/Coprocessor/DAGContext.h>
+#include <Flash/Mpp/MPPTaskResourceUsageHistory.h>
 #include <Flash/Mpp/MPPTaskStatistics.h>
 #include <Flash/Mpp/getMPPTaskTracingLog.h>
+#include <Storages/DeltaMerge/ScanContext.h>
 #include <common/logger_useful.h>
 #include <fmt/format.h>
 #include <tipb/executor.pb.h>
@@ -112,6 +114,7 @@ void MPPTaskStatistics::logTracingJson()
         R"({{"query_tso":{},"task_id":{},"is_root":{},"sender_executor_id":"{}","executors":{},"host":"{}")"
         R"(,"task_init_timestamp":{},"task_start_timestamp":{},"task_end_timestamp":{})"
         R"(,"compile_start_timestamp":{},"compile_end_timestamp":{})"
+        R"(,"schedule_start_timestamp":{},"schedule_end_timestamp":{})"
         R"(,"read_wait_index_start_timestamp":{},"read_wait_index_end_timestamp":{})"
         R"(,"local_input_bytes":{},"remote_input_bytes":{},"output_bytes":{})"
         R"(,"status":"{}","error_message":"{}","cpu_ru":{},"read_ru":{},"memory_peak":{}}})",
@@ -126,6 +129,8 @@ void MPPTaskStatistics::logTracingJson()
         toNanoseconds(task_end_timestamp),
         toNanoseconds(compile_start_timestamp),
         toNanoseconds(compile_end_timestamp),
+        toNanoseconds(schedule_start_timestamp),
+        toNanoseconds(schedule_end_timestamp),
         toNanoseconds(read_wait_index_start_timestamp),
         toNanoseconds(read_wait_index_end_timestamp),
         local_input_bytes,
@@ -138,6 +143,35 @@ void MPPTaskStatistics::logTracingJson()
         memory_peak);
 }
 
+void MPPTaskStatistics::recordResourceUsage()
+{
+    MPPTaskResourceUsage usage;
+    usage.query_tso = id.gather_id.query_id.start_ts;
+    usage.task_id = id.task_id;
+    usage.status = String(magic_enum::enum_name(status));
+    usage.task_start_timestamp = toNanoseconds(task_start_timestamp);
+    usage.task_end_timestamp = toNanoseconds(task_end_timestamp);
+    usage.cpu_ru = cpu_ru;
+    usage.read_ru = read_ru;
+    usage.memory_peak = memory_peak;
+    usage.local_input_bytes = local_input_bytes;
+    usage.remote_input_bytes = remote_input_bytes;
+    usage.output_bytes = output_bytes;
+    if (dag_context)
+    {
+        for (const auto & [executor_id, scan_context] : dag_context->scan_context_map)
+        {
+            usage.user_read_bytes += scan_context->user_read_bytes.load(std::memory_order_relaxed);
+            usage.dmfile_read_time_ns += scan_context->total_dmfile_read_time_ns.load(std::memory_order_relaxed);
+            usage.disagg_read_cache_hit_bytes
+                += scan_context->disagg_read_cache_hit_size.load(std::memory_order_relaxed);
+            usage.disagg_read_cache_miss_bytes
+                += scan_context->disagg_read_cache_miss_size.load(std::memory_order_relaxed);
+        }
+    }
+    MPPTaskResourceUsageHistory::instance().add(std::move(usage));
+}
+
 void MPPTaskStatistics::setMemoryPeak(Int64 memory_peak_)
 {
     memory_peak = memory_peak_;
@@ -155,6 +189,12 @@ void MPPTaskStatistics::setCompileTimestamp(const Timestamp & start_timestamp, c
     compile_end_timestamp = end_timestamp;
 }
 
+void MPPTaskStatistics::setScheduleTimestamp(const Timestamp & start_timestamp, const Timestamp & end_timestamp)
+{
+    schedule_start_timestamp = start_timestamp;
+    schedule_end_timestamp = end_timestamp;
+}
+
 void MPPTaskStatistics::recordInputBytes(DAGContext & dag_context)
 {
     switch (dag_context.getExecutionMode())
@@ -49,12 +49,18 @@ public:
 
     void logTracingJson();
 
+    /// Add the resource usage of the finished task to `MPPTaskResourceUsageHistory`.
+    void recordResourceUsage();
+
     void setMemoryPeak(Int64 memory_peak_);
 
     void setRU(RU cpu_ru_, RU read_ru_);
 
     void setCompileTimestamp(const Timestamp & start_timestamp, const Timestamp & end_timestamp);
 
+    /// The time the task waits in the task scheduler before running.
+    void setScheduleTimestamp(const Timestamp & start_timestamp, const Timestamp & end_timestamp);
+
     tipb::SelectResponse genExecutionSummaryResponse();
 
     tipb::TiFlashExecutionInfo genTiFlashExecutionInfo();
@@ -76,6 +82,8 @@ private:
     Timestamp task_end_timestamp{Clock::duration::zero()};
     Timestamp compile_start_timestamp{Clock::duration::zero()};
     Timestamp compile_end_timestamp{Clock::duration::zero()};
+    Timestamp schedule_start_timestamp{Clock::duration::zero()};
+    Timestamp schedule_end_timestamp{Clock::duration::zero()};
     Timestamp read_wait_index_start_timestamp{Clock::duration::zero()};
     Timestamp read_wait_index_end_timestamp{Clock::duration::zero()};
     TaskStatus status;
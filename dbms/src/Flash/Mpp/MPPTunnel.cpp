@@ -33,6 +33,8 @@ extern const char random_tunnel_write_failpoint[];
 
 namespace
 {
+std::atomic<size_t> alive_tunnel_num{0};
+
 String tunnelSenderModeToString(TunnelSenderMode mode)
 {
     switch (mode)
@@ -108,11 +110,15 @@ MPPTunnel::MPPTunnel(
     else
         mode = TunnelSenderMode::SYNC_GRPC;
     GET_METRIC(tiflash_object_count, type_count_of_mpptunnel).Increment();
+    alive_tunnel_num.fetch_add(1, std::memory_order_relaxed);
 }
 
 MPPTunnel::~MPPTunnel()
 {
-    SCOPE_EXIT({ GET_METRIC(tiflash_object_count, type_count_of_mpptunnel).Decrement(); });
+    SCOPE_EXIT({
+        GET_METRIC(tiflash_object_count, type_count_of_mpptunnel).Decrement();
+        alive_tunnel_num.fetch_sub(1, std::memory_order_relaxed);
+    });
     try
     {
         close("", true);
@@ -125,6 +131,11 @@ MPPTunnel::~MPPTunnel()
     LOG_TRACE(log, "destructed tunnel obj!");
 }
 
+size_t MPPTunnel::getAliveTunnelNum()
+{
+    return alive_tunnel_num.load(std::memory_order_relaxed);
+}
+
 /// exit abnormally, such as being cancelled.
 void MPPTunnel::close(const String & reason, bool wait_sender_finish)
 {
@@ -413,6 +424,12 @@ bool MPPTunnel::isWritable() const
     }
 }
 
+bool MPPTunnel::isConnected() const
+{
+    std::unique_lock lk(mu);
+    return status == TunnelStatus::Connected;
+}
+
 std::string_view MPPTunnel::statusToString()
 {
     return magic_enum::enum_name(status);
@@ -445,7 +462,10 @@ void SyncTunnelSender::sendJob(PacketWriter * writer)
         while (send_queue.pop(res) == MPMCQueueResult::OK)
         {
             MPPTunnelMetric::subDataSizeMetric(*data_size_in_queue, res->getPacket().ByteSizeLong());
-            if (!writer->write(res->packet))
+            // Buffer the packet if there are more packets in the queue, so that grpc can send them with less
+            // HTTP/2 frames and syscalls. The last packet in the queue is always written without buffering.
+            bool ok = send_queue.size() > 0 ? writer->writeBuffered(res->packet) : writer->write(res->packet);
+            if (!ok)
             {
                 err_msg = "grpc writes failed.";
                 break;
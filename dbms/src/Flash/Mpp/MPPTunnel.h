@@ -466,6 +466,9 @@ public:
 
     ~MPPTunnel();
 
+    // The number of MPPTunnels alive on this node.
+    static size_t getAliveTunnelNum();
+
     const String & id() const { return tunnel_id; }
 
     // write a single packet to the tunnel's send queue, it will block if tunnel is not ready.
@@ -480,6 +483,11 @@ public:
     void forceWrite(TrackedMppDataPacketPtr && data);
     bool isWritable() const;
 
+    // Whether the tunnel is connected and the packets can be force written to it.
+    bool isConnected() const;
+    // The bytes of the packets which are queued in the tunnel and not sent yet.
+    Int64 getQueuedBytes() const { return data_size_in_queue.load(); }
+
     // finish the writing, and wait until the sender finishes.
     void writeDone();
 
@@ -70,10 +70,19 @@ void MPPTunnelSetBase<Tunnel>::forceWrite(tipb::SelectResponse & response, size_
 template <typename Tunnel>
 bool MPPTunnelSetBase<Tunnel>::isWritable() const
 {
+    Int64 overflow_bytes = 0;
     for (const auto & tunnel : tunnels)
     {
         if (!tunnel->isWritable())
-            return false;
+        {
+            // Keep writing to the fast consumers while a slow consumer is falling behind, until the bytes queued
+            // in the slow tunnels exceed `max_overflow_bytes`.
+            if (max_overflow_bytes <= 0 || !tunnel->isConnected())
+                return false;
+            overflow_bytes += tunnel->getQueuedBytes();
+            if (overflow_bytes > max_overflow_bytes)
+                return false;
+        }
     }
     return true;
 }
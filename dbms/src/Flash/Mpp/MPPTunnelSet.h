@@ -63,6 +63,8 @@ public:
 
     bool isWritable() const;
 
+    void setMaxOverflowBytes(Int64 max_overflow_bytes_) { max_overflow_bytes = max_overflow_bytes_; }
+
     bool isLocal(size_t index) const;
 
 private:
@@ -72,6 +74,8 @@ private:
 
     int external_thread_cnt = 0;
     size_t local_tunnel_cnt = 0;
+    // The max bytes queued in the tunnels which are not writable, before the whole set becomes not writable.
+    Int64 max_overflow_bytes = 0;
 };
 
 class MPPTunnelSet : public MPPTunnelSetBase<MPPTunnel>
@@ -131,8 +131,11 @@ static void broadcastOrPassThroughWriteImpl(
         checkPacketSize(remote_tracked_packet_bytes);
     }
 
-    // TODO avoid copy packet for broadcast.
-
+    // The local tunnels on this node share the same packet, because the packet is never modified after being
+    // pushed to a local tunnel, and the receivers only decode from it. So there is only one copy of the data
+    // in memory no matter how many local receivers there are.
+    // The remote tunnels still need their own copies, since the async grpc sender switches the memory tracker
+    // of the packet before writing it.
     if (local_tracked_packet == remote_tracked_packet)
     {
         // `TrackedMppDataPacket` in `TrackedMppDataPacketPtr` is mutable.
@@ -141,23 +144,23 @@ static void broadcastOrPassThroughWriteImpl(
         auto tracked_packet = std::move(local_tracked_packet);
         remote_tracked_packet = nullptr;
 
-        for (size_t i = 1; i < tunnel_cnt; ++i)
+        for (size_t i = 0, remote_cnt = 0; i < tunnel_cnt; ++i)
         {
-            writeToTunnel(tracked_packet->copy(), i);
+            if (isLocalTunnel(i))
+                writeToTunnel(TrackedMppDataPacketPtr(tracked_packet), i);
+            else if (++remote_cnt == remote_tunnel_cnt && local_tunnel_cnt == 0)
+                writeToTunnel(std::move(tracked_packet), i);
+            else
+                writeToTunnel(tracked_packet->copy(), i); // NOLINT
         }
-        writeToTunnel(std::move(tracked_packet), 0);
     }
     else
     {
-        for (size_t i = 0, local_cnt = 0, remote_cnt = 0; i < tunnel_cnt; ++i)
+        for (size_t i = 0, remote_cnt = 0; i < tunnel_cnt; ++i)
         {
             if (isLocalTunnel(i))
             {
-                local_cnt++;
-                if (local_cnt == local_tunnel_cnt)
-                    writeToTunnel(std::move(local_tracked_packet), i);
-                else
-                    writeToTunnel(local_tracked_packet->copy(), i); // NOLINT
+                writeToTunnel(TrackedMppDataPacketPtr(local_tracked_packet), i);
             }
             else
             {
@@ -168,6 +171,7 @@ static void broadcastOrPassThroughWriteImpl(
                     writeToTunnel(remote_tracked_packet->copy(), i); // NOLINT
             }
         }
+        local_tracked_packet = nullptr;
     }
 
     if constexpr (is_broadcast)
@@ -242,10 +246,46 @@ MPPTunnelSetWriterBase::MPPTunnelSetWriterBase(
     : mpp_tunnel_set(mpp_tunnel_set_)
     , result_field_types(result_field_types_)
     , log(Logger::get(req_id))
+    , compression_states(mpp_tunnel_set->getPartitionNum())
 {
     RUNTIME_CHECK(mpp_tunnel_set->getPartitionNum() > 0);
 }
 
+CompressionMethod MPPTunnelSetWriterBase::chooseCompressionMethod(int16_t partition_id, CompressionMethod method)
+{
+    if (method == CompressionMethod::NONE)
+        return method;
+    auto & state = compression_states[partition_id];
+    if (state.packets_to_skip > 0)
+    {
+        --state.packets_to_skip;
+        return CompressionMethod::NONE;
+    }
+    return method;
+}
+
+void MPPTunnelSetWriterBase::updateCompressionState(
+    int16_t partition_id,
+    CompressionMethod method,
+    size_t original_size,
+    size_t packet_bytes)
+{
+    if (method == CompressionMethod::NONE)
+        return;
+    auto & state = compression_states[partition_id];
+    // The compression doesn't pay off if it saves less than 10% of the bytes
+    if (packet_bytes * 10 > original_size * 9)
+    {
+        // Skip at most 64 packets
+        state.packets_to_skip = 1U << std::min(state.failed_probes, 6U);
+        ++state.failed_probes;
+    }
+    else
+    {
+        state.failed_probes = 0;
+    }
+}
+
 void MPPTunnelSetWriterBase::write(tipb::SelectResponse & response)
 {
     checkPacketSize(response.ByteSizeLong());
@@ -387,7 +427,8 @@ void MPPTunnelSetWriterBase::partitionWrite(
     assert(version > MPPDataPacketV0);
 
     bool is_local = mpp_tunnel_set->isLocal(partition_id);
-    compression_method = is_local ? CompressionMethod::NONE : compression_method;
+    compression_method
+        = is_local ? CompressionMethod::NONE : chooseCompressionMethod(partition_id, compression_method);
 
     size_t original_size = 0;
     auto tracked_packet
@@ -398,6 +439,7 @@ void MPPTunnelSetWriterBase::partitionWrite(
     auto packet_bytes = tracked_packet->getPacket().ByteSizeLong();
     checkPacketSize(packet_bytes);
     writeToTunnel(std::move(tracked_packet), partition_id);
+    updateCompressionState(partition_id, compression_method, original_size, packet_bytes);
     updatePartitionWriterMetrics(compression_method, original_size, packet_bytes, is_local);
 }
 
@@ -421,7 +463,8 @@ void MPPTunnelSetWriterBase::fineGrainedShuffleWrite(
             partition_id);
 
     bool is_local = mpp_tunnel_set->isLocal(partition_id);
-    compression_method = is_local ? CompressionMethod::NONE : compression_method;
+    compression_method
+        = is_local ? CompressionMethod::NONE : chooseCompressionMethod(partition_id, compression_method);
 
     size_t original_size = 0;
     auto tracked_packet = MPPTunnelSetHelper::ToFineGrainedPacket(
@@ -440,6 +483,7 @@ void MPPTunnelSetWriterBase::fineGrainedShuffleWrite(
     auto packet_bytes = tracked_packet->getPacket().ByteSizeLong();
     checkPacketSize(packet_bytes);
     writeToTunnel(std::move(tracked_packet), partition_id);
+    updateCompressionState(partition_id, compression_method, original_size, packet_bytes);
     updatePartitionWriterMetrics(compression_method, original_size, packet_bytes, is_local);
 }
 
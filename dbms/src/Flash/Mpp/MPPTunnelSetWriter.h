@@ -78,6 +78,24 @@ protected:
     MPPTunnelSetPtr mpp_tunnel_set;
     std::vector<tipb::FieldType> result_field_types;
     const LoggerPtr log;
+
+private:
+    // Choose the compression method of the next packet written to the remote tunnel `partition_id`.
+    CompressionMethod chooseCompressionMethod(int16_t partition_id, CompressionMethod method);
+    void updateCompressionState(
+        int16_t partition_id,
+        CompressionMethod method,
+        size_t original_size,
+        size_t packet_bytes);
+
+    // If compressing the data of a tunnel doesn't pay off, skip compressing its packets for a while and then
+    // probe again. The number of skipped packets is doubled every time the probe fails.
+    struct CompressionState
+    {
+        UInt32 packets_to_skip = 0;
+        UInt32 failed_probes = 0;
+    };
+    std::vector<CompressionState> compression_states;
 };
 
 class SyncMPPTunnelSetWriter : public MPPTunnelSetWriterBase
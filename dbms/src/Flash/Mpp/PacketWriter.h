@@ -34,6 +34,10 @@ public:
 
     // Write a packet and return false if any error occurs.
     virtual bool write(const mpp::MPPDataPacket & packet) = 0;
+
+    // Write a packet which is followed by more packets immediately, the writer can buffer it and send it
+    // together with the following packets. The buffered packets are sent by the next `write` at last.
+    virtual bool writeBuffered(const mpp::MPPDataPacket & packet) { return write(packet); }
 };
 
 class SyncPacketWriter : public PacketWriter
@@ -45,6 +49,11 @@ public:
 
     bool write(const mpp::MPPDataPacket & packet) override { return writer->Write(packet); }
 
+    bool writeBuffered(const mpp::MPPDataPacket & packet) override
+    {
+        return writer->Write(packet, grpc::WriteOptions().set_buffer_hint());
+    }
+
 private:
     ::grpc::ServerWriter<::mpp::MPPDataPacket> * writer;
 };
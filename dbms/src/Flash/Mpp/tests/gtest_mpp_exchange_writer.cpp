@@ -704,5 +704,48 @@ try
     }
 }
 CATCH
+
+TEST_F(TestMPPExchangeWriter, TestHashPartitionWriterDetectSkew)
+try
+{
+    const size_t block_rows = 8192;
+    const size_t block_num = SKEW_CHECK_MIN_ROWS / block_rows;
+    const uint16_t part_num = 4;
+
+    auto write_blocks = [&](const Block & block) {
+        auto checker = [](const TrackedMppDataPacketPtr &, uint16_t) {};
+        auto mock_writer = std::make_shared<MockExchangeWriter>(checker, part_num, *dag_context_ptr);
+        auto dag_writer = std::make_shared<HashPartitionWriter<std::shared_ptr<MockExchangeWriter>>>(
+            mock_writer,
+            part_col_ids,
+            part_col_collators,
+            0,
+            *dag_context_ptr,
+            DB::MPPDataPacketV1,
+            tipb::CompressionMode::NONE);
+        // Write twice as many rows as needed to make sure the skew is only reported once.
+        for (size_t i = 0; i < 2 * block_num; ++i)
+            dag_writer->write(block);
+        dag_writer->flush();
+    };
+
+    auto & skew_count = GET_METRIC(tiflash_exchange_partition_skew_count);
+    // The rows are distributed uniformly.
+    auto count_before = skew_count.Value();
+    write_blocks(prepareUniformBlock(block_rows));
+    ASSERT_EQ(skew_count.Value(), count_before);
+
+    // All rows go to the same partition.
+    Block skewed_block = prepareUniformBlock(block_rows);
+    for (auto & col : skewed_block)
+    {
+        auto const_col = col.type->createColumnConst(block_rows, Field(static_cast<Int64>(1)));
+        col.column = const_col->convertToFullColumnIfConst();
+    }
+    write_blocks(skewed_block);
+    ASSERT_EQ(skew_count.Value(), count_before + 1);
+}
+CATCH
+
 } // namespace tests
 } // namespace DB
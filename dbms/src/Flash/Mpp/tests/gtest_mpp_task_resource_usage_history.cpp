@@ -0,0 +1,57 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Mpp/MPPTaskResourceUsageHistory.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <gtest/gtest.h>
+
+
+namespace DB
+{
+namespace tests
+{
+class TestMPPTaskResourceUsageHistory : public testing::Test
+{
+};
+
+TEST_F(TestMPPTaskResourceUsageHistory, TestBounded)
+try
+{
+    size_t capacity = 5;
+    MPPTaskResourceUsageHistory history(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i)
+    {
+        MPPTaskResourceUsage usage;
+        usage.task_id = i;
+        history.add(std::move(usage));
+    }
+    auto records = history.getAll();
+    ASSERT_EQ(records.size(), capacity);
+    // The oldest records are dropped
+    for (size_t i = 0; i < capacity; ++i)
+        ASSERT_EQ(records[i].task_id, static_cast<Int64>(capacity + i));
+
+    history.setCapacity(2);
+    records = history.getAll();
+    ASSERT_EQ(records.size(), 2);
+    ASSERT_EQ(records.back().task_id, static_cast<Int64>(2 * capacity - 1));
+
+    history.setCapacity(0);
+    history.add(MPPTaskResourceUsage{});
+    ASSERT_TRUE(history.getAll().empty());
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -19,6 +19,7 @@
 #include <Flash/EstablishCall.h>
 #include <Flash/Mpp/GRPCReceiverContext.h>
 #include <Flash/Mpp/MPPTunnel.h>
+#include <Flash/Mpp/MPPTunnelSet.h>
 #include <Flash/Mpp/ReceivedMessageQueue.h>
 #include <TestUtils/TiFlashTestBasic.h>
 #include <gtest/gtest.h>
@@ -51,11 +52,20 @@ class MockPacketWriter : public PacketWriter
     bool write(const mpp::MPPDataPacket & packet) override
     {
         write_packet_vec.push_back(packet.data().empty() ? packet.error().msg() : packet.data());
+        buffered_vec.push_back(false);
+        return true;
+    }
+
+    bool writeBuffered(const mpp::MPPDataPacket & packet) override
+    {
+        write_packet_vec.push_back(packet.data().empty() ? packet.error().msg() : packet.data());
+        buffered_vec.push_back(true);
         return true;
     }
 
 public:
     std::vector<String> write_packet_vec;
+    std::vector<bool> buffered_vec;
 };
 
 class MockFailedWriter : public PacketWriter
@@ -367,6 +377,22 @@ try
 }
 CATCH
 
+TEST_F(TestMPPTunnel, AliveTunnelNum)
+try
+{
+    const size_t alive_num = MPPTunnel::getAliveTunnelNum();
+    {
+        auto sync_tunnel = constructRemoteSyncTunnel();
+        auto local_tunnel = constructLocalTunnel();
+        GTEST_ASSERT_EQ(MPPTunnel::getAliveTunnelNum(), alive_num + 2);
+        sync_tunnel->close("Canceled", false);
+        // A closed tunnel is still counted until it is destructed
+        GTEST_ASSERT_EQ(MPPTunnel::getAliveTunnelNum(), alive_num + 2);
+    }
+    GTEST_ASSERT_EQ(MPPTunnel::getAliveTunnelNum(), alive_num);
+}
+CATCH
+
 TEST_F(TestMPPTunnel, SyncWriteAfterUnconnectFinished)
 {
     try
@@ -432,6 +458,26 @@ try
 }
 CATCH
 
+TEST_F(TestMPPTunnel, SyncWriteBuffered)
+try
+{
+    auto mpp_tunnel_ptr = constructRemoteSyncTunnel();
+    std::unique_ptr<PacketWriter> writer_ptr = std::make_unique<MockPacketWriter>();
+    mpp_tunnel_ptr->connectSync(writer_ptr.get());
+    GTEST_ASSERT_EQ(getTunnelConnectedFlag(mpp_tunnel_ptr), true);
+    mpp_tunnel_ptr->write(newDataPacket("First"));
+    mpp_tunnel_ptr->write(newDataPacket("Second"));
+    mpp_tunnel_ptr->write(newDataPacket("Third"));
+    mpp_tunnel_ptr->writeDone();
+    GTEST_ASSERT_EQ(getTunnelFinishedFlag(mpp_tunnel_ptr), true);
+    auto * writer = dynamic_cast<MockPacketWriter *>(writer_ptr.get());
+    std::vector<String> expected_packets{"First", "Second", "Third"};
+    GTEST_ASSERT_EQ(writer->write_packet_vec, expected_packets);
+    // The last packet must not be buffered, otherwise it is delayed until the stream finishes
+    GTEST_ASSERT_EQ(writer->buffered_vec.back(), false);
+}
+CATCH
+
 TEST_F(TestMPPTunnel, SyncConsumerFinish)
 try
 {
@@ -838,6 +884,41 @@ TEST_F(TestMPPTunnel, LocalTunnelForceWrite)
     GTEST_ASSERT_EQ(receiver->getReceivedMsgs().back()->getPacket().data(), "First");
 }
 
+TEST_F(TestMPPTunnel, TunnelSetWritableWithSlowTunnel)
+try
+{
+    auto slow_tunnel = constructRemoteAsyncTunnel();
+    auto fast_tunnel = constructRemoteAsyncTunnel();
+    auto slow_call_data = std::make_unique<MockAsyncCallData>();
+    auto fast_call_data = std::make_unique<MockAsyncCallData>();
+    slow_tunnel->connectAsync(slow_call_data.get());
+    fast_tunnel->connectAsync(fast_call_data.get());
+
+    MPPTunnelSet tunnel_set("0");
+    tunnel_set.registerTunnel(MPPTaskId(1, 1, 1, 1, 1, 1, "", 1, ""), slow_tunnel);
+    tunnel_set.registerTunnel(MPPTaskId(1, 2, 1, 1, 1, 1, "", 1, ""), fast_tunnel);
+    ASSERT_TRUE(tunnel_set.isWritable());
+
+    // Fill the queue of the slow tunnel
+    while (slow_tunnel->isWritable())
+        tunnel_set.forceWrite(newDataPacket("First"), 0);
+    ASSERT_FALSE(tunnel_set.isWritable());
+
+    tunnel_set.setMaxOverflowBytes(slow_tunnel->getQueuedBytes());
+    ASSERT_TRUE(tunnel_set.isWritable());
+    tunnel_set.forceWrite(newDataPacket("First"), 1);
+    tunnel_set.setMaxOverflowBytes(slow_tunnel->getQueuedBytes() - 1);
+    ASSERT_FALSE(tunnel_set.isWritable());
+
+    std::thread slow_thread(&MockAsyncCallData::run, slow_call_data.get());
+    std::thread fast_thread(&MockAsyncCallData::run, fast_call_data.get());
+    tunnel_set.finishWrite();
+    slow_thread.join();
+    fast_thread.join();
+    GTEST_ASSERT_EQ(fast_call_data->write_packet_vec.size(), 1);
+}
+CATCH
+
 TEST_F(TestMPPTunnel, isWritableTimeout)
 try
 {
@@ -148,6 +148,11 @@ void Event::scheduleTasks()
         unfinished_tasks);
     if (!tasks.empty())
     {
+        if (!outputs.empty())
+        {
+            for (auto & task : tasks)
+                task->blocks_other_events = true;
+        }
         TaskScheduler::instance->submit(tasks);
         tasks.clear();
     }
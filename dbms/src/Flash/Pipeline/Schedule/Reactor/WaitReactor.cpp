@@ -14,11 +14,13 @@
 
 #include <Common/CPUAffinityManager.h>
 #include <Common/Exception.h>
+#include <Common/Stopwatch.h>
 #include <Common/TiFlashMetrics.h>
 #include <Common/setThreadName.h>
 #include <Flash/Pipeline/Schedule/Reactor/WaitReactor.h>
 #include <Flash/Pipeline/Schedule/TaskScheduler.h>
 #include <Flash/Pipeline/Schedule/Tasks/TaskHelper.h>
+#include <common/likely.h>
 #include <common/logger_useful.h>
 #include <errno.h>
 #include <sched.h>
@@ -37,21 +39,29 @@ bool WaitReactor::awaitAndCollectReadyTask(WaitingTask && task)
     assert(task.first);
     auto * task_ptr = task.second;
     auto status = task_ptr->await();
+    if (status != ExecTaskStatus::WAITING)
+    {
+        auto await_time_before = task_ptr->profile_info.getAwaitTimeNs();
+        task_ptr->profile_info.elapsedAwaitTime();
+        if (auto * timeline = task_ptr->getTaskTimeline(); unlikely(timeline))
+            timeline->add(
+                task_ptr,
+                TaskTimelineSpan::AWAIT,
+                clock_gettime_ns(),
+                task_ptr->profile_info.getAwaitTimeNs() - await_time_before);
+    }
     switch (status)
     {
     case ExecTaskStatus::WAITING:
         return false;
     case ExecTaskStatus::RUNNING:
-        task_ptr->profile_info.elapsedAwaitTime();
         cpu_tasks.push_back(std::move(task.first));
         return true;
     case ExecTaskStatus::IO_IN:
     case ExecTaskStatus::IO_OUT:
-        task_ptr->profile_info.elapsedAwaitTime();
         io_tasks.push_back(std::move(task.first));
         return true;
     case FINISH_STATUS:
-        task_ptr->profile_info.elapsedAwaitTime();
         task_ptr->startTraceMemory();
         task_ptr->finalize();
         task_ptr->endTraceMemory();
@@ -103,6 +103,18 @@ bool IOPriorityQueue::empty() const
     return cancel_task_queue.empty() && io_out_task_queue.empty() && io_in_task_queue.empty();
 }
 
+bool IOPriorityQueue::canKeepRunning(const TaskPtr & task)
+{
+    assert(task);
+    if unlikely (is_finished)
+        return false;
+
+    std::lock_guard lock(mu);
+    if unlikely (cancel_query_id_cache.contains(task->getQueryId()))
+        return false;
+    return cancel_task_queue.empty() && io_out_task_queue.empty() && io_in_task_queue.empty();
+}
+
 void IOPriorityQueue::finish()
 {
     {
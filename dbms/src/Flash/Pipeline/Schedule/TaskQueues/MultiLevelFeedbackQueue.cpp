@@ -21,10 +21,9 @@ namespace DB
 {
 namespace
 {
-void moveCancelledTasks(UnitQueue & unit_queue, std::deque<TaskPtr> & cancel_queue, const String & query_id)
+void moveCancelledTasks(std::list<TaskPtr> & normal_queue, std::deque<TaskPtr> & cancel_queue, const String & query_id)
 {
     assert(!query_id.empty());
-    auto & normal_queue = unit_queue.task_queue;
     for (auto it = normal_queue.begin(); it != normal_queue.end();)
     {
         if (query_id == (*it)->getQueryId())
@@ -44,20 +43,27 @@ void UnitQueue::take(TaskPtr & task)
 {
     assert(!task);
     assert(!empty());
-    task = std::move(task_queue.front());
-    task_queue.pop_front();
+    bool blocking_first
+        = ratio_of_blocking_to_others * other_consume_time_microsecond >= blocking_consume_time_microsecond;
+    auto & first_queue = blocking_first ? blocking_task_queue : task_queue;
+    auto & next_queue = blocking_first ? task_queue : blocking_task_queue;
+    if (!popTask(first_queue, task))
+        popTask(next_queue, task);
     assert(task);
 }
 
 bool UnitQueue::empty() const
 {
-    return task_queue.empty();
+    return blocking_task_queue.empty() && task_queue.empty();
 }
 
 void UnitQueue::submit(TaskPtr && task)
 {
     assert(task);
-    task_queue.push_back(std::move(task));
+    if (task->blocks_other_events)
+        blocking_task_queue.push_back(std::move(task));
+    else
+        task_queue.push_back(std::move(task));
 }
 
 double UnitQueue::normalizedTimeMicrosecond()
@@ -65,6 +71,16 @@ double UnitQueue::normalizedTimeMicrosecond()
     return accu_consume_time_microsecond / info.factor_for_normal;
 }
 
+void UnitQueue::updateStatistics(const TaskPtr & task, UInt64 inc_ns)
+{
+    auto inc_microsecond = inc_ns / 1000;
+    accu_consume_time_microsecond += inc_microsecond;
+    if (task->blocks_other_events)
+        blocking_consume_time_microsecond += inc_microsecond;
+    else
+        other_consume_time_microsecond += inc_microsecond;
+}
+
 template <typename TimeGetter>
 MultiLevelFeedbackQueue<TimeGetter>::~MultiLevelFeedbackQueue()
 {
@@ -233,7 +249,7 @@ template <typename TimeGetter>
 void MultiLevelFeedbackQueue<TimeGetter>::updateStatistics(const TaskPtr & task, ExecTaskStatus, UInt64 inc_ns)
 {
     assert(task);
-    level_queues[task->mlfq_level]->accu_consume_time_microsecond += (inc_ns / 1000);
+    level_queues[task->mlfq_level]->updateStatistics(task, inc_ns);
 }
 
 template <typename TimeGetter>
@@ -248,6 +264,26 @@ bool MultiLevelFeedbackQueue<TimeGetter>::empty() const
     return cancel_task_queue.empty();
 }
 
+template <typename TimeGetter>
+bool MultiLevelFeedbackQueue<TimeGetter>::canKeepRunning(const TaskPtr & task)
+{
+    assert(task);
+    if unlikely (is_finished)
+        return false;
+
+    // The level must still grow with the execution time even if the task is not submitted again.
+    computeQueueLevel(task);
+    std::lock_guard lock(mu);
+    if unlikely (cancel_query_id_cache.contains(task->getQueryId()))
+        return false;
+    for (const auto & queue : level_queues)
+    {
+        if (!queue->empty())
+            return false;
+    }
+    return cancel_task_queue.empty();
+}
+
 template <typename TimeGetter>
 void MultiLevelFeedbackQueue<TimeGetter>::finish()
 {
@@ -285,7 +321,10 @@ void MultiLevelFeedbackQueue<TimeGetter>::collectCancelledTasks(
     const String & query_id)
 {
     for (const auto & queue : level_queues)
-        moveCancelledTasks(*queue, cancel_queue, query_id);
+    {
+        moveCancelledTasks(queue->blocking_task_queue, cancel_queue, query_id);
+        moveCancelledTasks(queue->task_queue, cancel_queue, query_id);
+    }
 }
 
 template class MultiLevelFeedbackQueue<CPUTimeGetter>;
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/Stopwatch.h>
+#include <Common/TiFlashMetrics.h>
 #include <Flash/Executor/PipelineExecutorContext.h>
 #include <Flash/Executor/toRU.h>
 #include <Flash/Pipeline/Schedule/TaskQueues/IOPriorityQueue.h>
@@ -115,6 +117,8 @@ bool ResourceControlQueue<NestedTaskQueueType>::take(TaskPtr & task)
             continue;
 
         UInt64 wait_dura = LocalAdmissionController::DEFAULT_FETCH_GAC_INTERVAL_MS;
+        // The resource group that waits for tokens, empty if there is no task to schedule.
+        String waiting_resource_group;
         if (!resource_group_infos.empty())
         {
             const ResourceGroupInfo & group_info = resource_group_infos.top();
@@ -138,6 +142,7 @@ bool ResourceControlQueue<NestedTaskQueueType>::take(TaskPtr & task)
                 return true;
             }
             wait_dura = LocalAdmissionController::global_instance->estWaitDuraMS(group_info.name);
+            waiting_resource_group = group_info.name;
         }
 
         assert(!task);
@@ -145,7 +150,11 @@ bool ResourceControlQueue<NestedTaskQueueType>::take(TaskPtr & task)
         // 1. finish() is called.
         // 2. refill_token_callback is called by LAC.
         // 3. token refilled in trickle mode.
+        Stopwatch wait_watch;
         cv.wait_for(lock, std::chrono::milliseconds(wait_dura));
+        if (!waiting_resource_group.empty())
+            GET_RESOURCE_GROUP_METRIC(tiflash_resource_group, type_compute_token_wait_ms, waiting_resource_group)
+                .Increment(wait_watch.elapsedMilliseconds());
     }
 }
 
@@ -234,6 +243,30 @@ bool ResourceControlQueue<NestedTaskQueueType>::empty() const
     return true;
 }
 
+template <typename NestedTaskQueueType>
+bool ResourceControlQueue<NestedTaskQueueType>::canKeepRunning(const TaskPtr & task)
+{
+    assert(task);
+    {
+        std::lock_guard lock(mu);
+        if unlikely (is_finished || cancel_query_id_cache.contains(task->getQueryId()))
+            return false;
+
+        if (!cancel_task_queue.empty() || !error_task_queue.empty())
+            return false;
+
+        for (const auto & task_queue_iter : resource_group_task_queues)
+        {
+            if (!task_queue_iter.second->empty())
+                return false;
+        }
+    }
+
+    // The task must go back to the queue to wait for tokens if the RU of its resource group is exhausted.
+    auto priority = LocalAdmissionController::global_instance->getPriority(task->getResourceGroupName());
+    return priority.has_value() && !LocalAdmissionController::isRUExhausted(priority.value());
+}
+
 template <typename NestedTaskQueueType>
 void ResourceControlQueue<NestedTaskQueueType>::finish()
 {
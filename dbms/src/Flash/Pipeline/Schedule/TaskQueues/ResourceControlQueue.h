@@ -49,6 +49,8 @@ public:
 
     bool empty() const override;
 
+    bool canKeepRunning(const TaskPtr & task) override;
+
     void finish() override;
 
     void cancel(const String & query_id, const String & resource_group_name) override;
@@ -40,6 +40,11 @@ public:
 
     virtual bool empty() const = 0;
 
+    // Whether a task that has used up its time slice can go on running in the current thread
+    // instead of being submitted and taken again.
+    // Only true when no other task is waiting in the queue, so the scheduling order is kept.
+    virtual bool canKeepRunning(const TaskPtr & task) = 0;
+
     // After finish is called, the submitted task will be finalized directly and will not be taken.
     // And the tasks in the queue can still be taken normally.
     virtual void finish() = 0;
@@ -282,4 +282,146 @@ try
 }
 CATCH
 
+TEST_F(TestMLFQTaskQueue, keepRunning)
+try
+{
+    PipelineExecutorContext context1("id1", "", nullptr);
+    // To avoid the active ref count being returned to 0 in advance.
+    context1.incActiveRefCount();
+    SCOPE_EXIT({ context1.decActiveRefCount(); });
+
+    PipelineExecutorContext context2("id2", "", nullptr);
+    // To avoid the active ref count being returned to 0 in advance.
+    context2.incActiveRefCount();
+    SCOPE_EXIT({ context2.decActiveRefCount(); });
+
+    CPUMultiLevelFeedbackQueue queue;
+    TaskPtr task = std::make_unique<PlainTask>(context1);
+    // No other task is waiting.
+    ASSERT_TRUE(queue.canKeepRunning(task));
+
+    // The level still grows with the execution time.
+    auto value = queue.getUnitQueueInfo(0).time_slice;
+    queue.updateStatistics(task, ExecTaskStatus::RUNNING, value);
+    task->profile_info.addCPUExecuteTime(value);
+    ASSERT_TRUE(queue.canKeepRunning(task));
+    ASSERT_EQ(task->mlfq_level, 1);
+
+    // Another task is waiting.
+    queue.submit(std::make_unique<PlainTask>(context2));
+    ASSERT_FALSE(queue.canKeepRunning(task));
+    {
+        TaskPtr other;
+        queue.take(other);
+        FINALIZE_TASK(other);
+    }
+    ASSERT_TRUE(queue.canKeepRunning(task));
+
+    // The query is cancelled.
+    queue.cancel("id1", "");
+    ASSERT_FALSE(queue.canKeepRunning(task));
+    FINALIZE_TASK(task);
+
+    // The queue is finished.
+    task = std::make_unique<PlainTask>(context2);
+    queue.finish();
+    ASSERT_FALSE(queue.canKeepRunning(task));
+    FINALIZE_TASK(task);
+}
+CATCH
+
+TEST_F(TestMLFQTaskQueue, blockingFirst)
+try
+{
+    PipelineExecutorContext context;
+    // To avoid the active ref count being returned to 0 in advance.
+    context.incActiveRefCount();
+    SCOPE_EXIT({ context.decActiveRefCount(); });
+
+    CPUMultiLevelFeedbackQueue queue;
+    auto submit_task = [&](bool blocks_other_events) {
+        TaskPtr task = std::make_unique<PlainTask>(context);
+        task->blocks_other_events = blocks_other_events;
+        queue.submit(std::move(task));
+    };
+    auto take_task = [&]() {
+        TaskPtr task;
+        queue.take(task);
+        bool blocks_other_events = task->blocks_other_events;
+        queue.updateStatistics(task, ExecTaskStatus::RUNNING, 1000);
+        FINALIZE_TASK(task);
+        return blocks_other_events;
+    };
+
+    size_t task_num = 100;
+    for (size_t i = 0; i < task_num; ++i)
+    {
+        submit_task(false);
+        submit_task(true);
+    }
+    // The tasks blocking other events are taken first, until they have taken 3 times the execution time of the others.
+    ASSERT_TRUE(take_task());
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_FALSE(take_task());
+        for (size_t j = 0; j < UnitQueue::ratio_of_blocking_to_others; ++j)
+            ASSERT_TRUE(take_task());
+    }
+    size_t blocking_task_num = 1 + 3 * UnitQueue::ratio_of_blocking_to_others;
+    size_t other_task_num = 3;
+    while (!queue.empty())
+    {
+        if (take_task())
+            ++blocking_task_num;
+        else
+            ++other_task_num;
+    }
+    ASSERT_EQ(blocking_task_num, task_num);
+    ASSERT_EQ(other_task_num, task_num);
+    queue.finish();
+}
+CATCH
+
+TEST_F(TestMLFQTaskQueue, queryCPUTime)
+try
+{
+    PipelineExecutorContext large_context("large", "", nullptr);
+    // To avoid the active ref count being returned to 0 in advance.
+    large_context.incActiveRefCount();
+    SCOPE_EXIT({ large_context.decActiveRefCount(); });
+    large_context.setCPUTimeWeight(2);
+
+    PipelineExecutorContext small_context("small", "", nullptr);
+    // To avoid the active ref count being returned to 0 in advance.
+    small_context.incActiveRefCount();
+    SCOPE_EXIT({ small_context.decActiveRefCount(); });
+    small_context.setCPUTimeWeight(2);
+
+    CPUMultiLevelFeedbackQueue queue;
+    // The large query has used the time slice of level 0 twice, spread over many tasks.
+    {
+        TaskPtr task = std::make_unique<PlainTask>(large_context);
+        for (size_t i = 0; i < 10; ++i)
+            task->addCPUExecuteTime(queue.getUnitQueueInfo(0).time_slice * 2 / 10);
+        FINALIZE_TASK(task);
+    }
+
+    // A new task of the large query is demoted by the cpu time of its query, but a new task of the small query is not.
+    queue.submit(std::make_unique<PlainTask>(large_context));
+    queue.submit(std::make_unique<PlainTask>(small_context));
+    for (size_t i = 0; i < 2; ++i)
+    {
+        TaskPtr task;
+        queue.take(task);
+        if (task->getQueryId() == "large")
+            ASSERT_EQ(task->mlfq_level, 1);
+        else
+            ASSERT_EQ(task->mlfq_level, 0);
+        FINALIZE_TASK(task);
+    }
+    ASSERT_TRUE(queue.empty());
+    queue.finish();
+}
+CATCH
+
 } // namespace DB::tests
@@ -89,6 +89,15 @@ public:
 
     const PipelineExecutorContext & getQueryExecContext() { return exec_context; }
 
+    // Return nullptr if the task timeline of the query is not enabled.
+    ALWAYS_INLINE TaskTimeline * getTaskTimeline() const { return exec_context.getTaskTimeline(); }
+
+    ALWAYS_INLINE void addCPUExecuteTime(UInt64 value)
+    {
+        profile_info.addCPUExecuteTime(value);
+        exec_context.addCPUExecuteTime(value);
+    }
+
     void onErrorOccurred(const String & err_msg) { exec_context.onErrorOccurred(err_msg); }
 
 public:
@@ -112,6 +121,10 @@ public:
     // level of multi-level feedback queue.
     size_t mlfq_level{0};
 
+    // Whether other events are waiting for the event of this task to finish,
+    // such as the build side of a join.
+    bool blocks_other_events{false};
+
 private:
     PipelineExecutorContext & exec_context;
 
@@ -0,0 +1,84 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <Common/FmtUtils.h>
+#include <Flash/Pipeline/Schedule/Tasks/TaskTimeline.h>
+
+#include <magic_enum.hpp>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace DB
+{
+namespace
+{
+Int64 getThreadId()
+{
+#ifdef __linux__
+    static thread_local Int64 thread_id = syscall(SYS_gettid);
+    return thread_id;
+#else
+    return -1;
+#endif
+}
+} // namespace
+
+void TaskTimeline::add(const void * task, TaskTimelineSpan span, UInt64 end_ns, UInt64 duration_ns)
+{
+    Record record{
+        .task_id = reinterpret_cast<UInt64>(task),
+        .span = span,
+        .start_ns = end_ns > duration_ns ? end_ns - duration_ns : 0,
+        .duration_ns = duration_ns,
+        .thread_id = getThreadId(),
+    };
+    std::lock_guard lock(mu);
+    if (records.size() < capacity)
+    {
+        records.push_back(record);
+    }
+    else
+    {
+        records[next] = record;
+        next = (next + 1) % capacity;
+    }
+}
+
+String TaskTimeline::toChromeTrace() const
+{
+    FmtBuffer buffer;
+    buffer.append(R"({"traceEvents":[)");
+    std::lock_guard lock(mu);
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const auto & record = records[(next + i) % records.size()];
+        if (i > 0)
+            buffer.append(',');
+        // The unit of `ts` and `dur` is microsecond.
+        buffer.fmtAppend(
+            R"({{"name":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":0,"tid":{},"args":{{"thread":{}}}}})",
+            magic_enum::enum_name(record.span),
+            record.start_ns / 1000.0,
+            record.duration_ns / 1000.0,
+            record.task_id,
+            record.thread_id);
+    }
+    buffer.append("]}");
+    return buffer.toString();
+}
+} // namespace DB
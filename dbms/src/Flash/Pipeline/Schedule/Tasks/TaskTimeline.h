@@ -0,0 +1,73 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <Common/Exception.h>
+#include <Core/Types.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace DB
+{
+enum class TaskTimelineSpan
+{
+    CPU_QUEUE,
+    CPU_EXECUTE,
+    IO_QUEUE,
+    IO_EXECUTE,
+    AWAIT,
+};
+
+/// Records when the tasks of a query waited in the task queues, ran on the task thread pools and waited in the wait reactor,
+/// and which thread they were on.
+/// Only the latest `capacity` spans are kept.
+/// The spans can be dumped in the Chrome trace event format, which can be loaded by chrome://tracing and Perfetto.
+class TaskTimeline
+{
+public:
+    explicit TaskTimeline(size_t capacity_)
+        : capacity(capacity_)
+    {
+        RUNTIME_CHECK(capacity > 0);
+    }
+
+    // `end_ns` is got from `clock_gettime_ns()`.
+    void add(const void * task, TaskTimelineSpan span, UInt64 end_ns, UInt64 duration_ns);
+
+    // One track per task, the thread that ran the span is in its args.
+    String toChromeTrace() const;
+
+private:
+    struct Record
+    {
+        UInt64 task_id;
+        TaskTimelineSpan span;
+        UInt64 start_ns;
+        UInt64 duration_ns;
+        Int64 thread_id;
+    };
+
+    const size_t capacity;
+
+    mutable std::mutex mu;
+    // A ring buffer, `next` is the position of the oldest record once it is full.
+    std::vector<Record> records;
+    size_t next = 0;
+};
+using TaskTimelinePtr = std::unique_ptr<TaskTimeline>;
+} // namespace DB
@@ -0,0 +1,60 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <Flash/Pipeline/Schedule/Tasks/TaskTimeline.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <gtest/gtest.h>
+
+namespace DB::tests
+{
+class TestTaskTimeline : public ::testing::Test
+{
+};
+
+TEST_F(TestTaskTimeline, chromeTrace)
+try
+{
+    TaskTimeline timeline(2);
+    ASSERT_EQ(timeline.toChromeTrace(), R"({"traceEvents":[]})");
+
+    int task = 0;
+    timeline.add(&task, TaskTimelineSpan::CPU_QUEUE, 3000, 1000);
+    timeline.add(&task, TaskTimelineSpan::CPU_EXECUTE, 5000, 2000);
+    auto task_id = reinterpret_cast<UInt64>(&task);
+    auto trace = timeline.toChromeTrace();
+    ASSERT_NE(
+        trace.find(fmt::format(
+            R"({{"name":"CPU_QUEUE","ph":"X","ts":2.000,"dur":1.000,"pid":0,"tid":{},"args":)",
+            task_id)),
+        String::npos);
+    ASSERT_NE(
+        trace.find(fmt::format(
+            R"({{"name":"CPU_EXECUTE","ph":"X","ts":3.000,"dur":2.000,"pid":0,"tid":{},"args":)",
+            task_id)),
+        String::npos);
+
+    // Only the latest spans are kept, from the oldest to the newest.
+    timeline.add(&task, TaskTimelineSpan::AWAIT, 9000, 4000);
+    trace = timeline.toChromeTrace();
+    ASSERT_EQ(trace.find("CPU_QUEUE"), String::npos);
+    auto execute_pos = trace.find("CPU_EXECUTE");
+    auto await_pos = trace.find("AWAIT");
+    ASSERT_NE(execute_pos, String::npos);
+    ASSERT_NE(await_pos, String::npos);
+    ASSERT_LT(execute_pos, await_pos);
+}
+CATCH
+
+} // namespace DB::tests
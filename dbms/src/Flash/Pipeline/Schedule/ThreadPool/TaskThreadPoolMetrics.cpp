@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/Stopwatch.h>
 #include <Common/TiFlashMetrics.h>
 #include <Flash/Pipeline/Schedule/ThreadPool/TaskThreadPoolMetrics.h>
+#include <common/likely.h>
 
 #include <atomic>
 
@@ -128,10 +130,29 @@ void TaskThreadPoolMetrics<is_cpu>::decPendingTask()
 template <bool is_cpu>
 void TaskThreadPoolMetrics<is_cpu>::elapsedPendingTime(TaskPtr & task)
 {
+    auto * timeline = task->getTaskTimeline();
     if constexpr (is_cpu)
+    {
+        auto pending_time_before = task->profile_info.getCPUPendingTimeNs();
         task->profile_info.elapsedCPUPendingTime();
+        if unlikely (timeline)
+            timeline->add(
+                task.get(),
+                TaskTimelineSpan::CPU_QUEUE,
+                clock_gettime_ns(),
+                task->profile_info.getCPUPendingTimeNs() - pending_time_before);
+    }
     else
+    {
+        auto pending_time_before = task->profile_info.getIOPendingTimeNs();
         task->profile_info.elapsedIOPendingTime();
+        if unlikely (timeline)
+            timeline->add(
+                task.get(),
+                TaskTimelineSpan::IO_QUEUE,
+                clock_gettime_ns(),
+                task->profile_info.getIOPendingTimeNs() - pending_time_before);
+    }
 }
 
 template <bool is_cpu>
@@ -150,9 +171,16 @@ template <bool is_cpu>
 void TaskThreadPoolMetrics<is_cpu>::addExecuteTime(TaskPtr & task, UInt64 value)
 {
     if constexpr (is_cpu)
-        task->profile_info.addCPUExecuteTime(value);
+        task->addCPUExecuteTime(value);
     else
         task->profile_info.addIOExecuteTime(value);
+
+    if (auto * timeline = task->getTaskTimeline(); unlikely(timeline))
+        timeline->add(
+            task.get(),
+            is_cpu ? TaskTimelineSpan::CPU_EXECUTE : TaskTimelineSpan::IO_EXECUTE,
+            clock_gettime_ns(),
+            value);
 }
 
 template <bool is_cpu>
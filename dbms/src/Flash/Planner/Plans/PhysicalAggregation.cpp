@@ -28,6 +28,7 @@
 #include <Flash/Planner/Plans/PhysicalAggregation.h>
 #include <Flash/Planner/Plans/PhysicalAggregationBuild.h>
 #include <Flash/Planner/Plans/PhysicalAggregationConvergent.h>
+#include <Flash/Planner/Plans/PhysicalTableScan.h>
 #include <Interpreters/Context.h>
 #include <Operators/LocalAggregateTransform.h>
 
@@ -69,6 +70,10 @@ PhysicalPlanNodePtr PhysicalAggregation::build(
             collators);
     }
 
+    if (child->tp() == PlanType::TableScan && context.getSettingsRef().dt_enable_count_pushdown
+        && AggregationInterpreterHelper::isCountOnly(aggregation, child->getSchema()))
+        std::static_pointer_cast<PhysicalTableScan>(child)->pushDownCountOnly(context);
+
     auto expr_after_agg_actions = PhysicalPlanHelper::newActions(aggregated_columns);
     analyzer.reset(aggregated_columns);
     analyzer.appendCastAfterAgg(expr_after_agg_actions, aggregation);
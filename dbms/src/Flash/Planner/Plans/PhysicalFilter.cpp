@@ -34,10 +34,31 @@ PhysicalPlanNodePtr PhysicalFilter::build(
 {
     RUNTIME_CHECK(child);
 
+    /// Split the conditions into the cheap ones and the expensive ones. If there are both, filter by the cheap ones
+    /// first, so the expensive ones are only evaluated on the rows left.
+    google::protobuf::RepeatedPtrField<tipb::Expr> conditions;
+    google::protobuf::RepeatedPtrField<tipb::Expr> post_conditions;
+    for (const auto & condition : selection.conditions())
+        *(isExpensiveExpr(condition) ? post_conditions.Add() : conditions.Add()) = condition;
+    if (conditions.empty() || post_conditions.empty())
+    {
+        conditions = selection.conditions();
+        post_conditions.Clear();
+    }
+
     DAGExpressionAnalyzer analyzer{child->getSchema(), context};
     ExpressionActionsPtr before_filter_actions = PhysicalPlanHelper::newActions(child->getSampleBlock());
 
-    String filter_column_name = analyzer.buildFilterColumn(before_filter_actions, selection.conditions());
+    String filter_column_name = analyzer.buildFilterColumn(before_filter_actions, conditions);
+
+    String post_filter_column_name;
+    ExpressionActionsPtr before_post_filter_actions;
+    if (!post_conditions.empty())
+    {
+        DAGExpressionAnalyzer post_analyzer{child->getSchema(), context};
+        before_post_filter_actions = PhysicalPlanHelper::newActions(child->getSampleBlock());
+        post_filter_column_name = post_analyzer.buildFilterColumn(before_post_filter_actions, post_conditions);
+    }
 
     auto physical_filter = std::make_shared<PhysicalFilter>(
         executor_id,
@@ -46,7 +67,9 @@ PhysicalPlanNodePtr PhysicalFilter::build(
         log->identifier(),
         child,
         filter_column_name,
-        before_filter_actions);
+        before_filter_actions,
+        post_filter_column_name,
+        before_post_filter_actions);
 
     return physical_filter;
 }
@@ -58,6 +81,12 @@ void PhysicalFilter::buildBlockInputStreamImpl(DAGPipeline & pipeline, Context &
     pipeline.transform([&](auto & stream) {
         stream
             = std::make_shared<FilterBlockInputStream>(stream, before_filter_actions, filter_column, log->identifier());
+        if (hasPostFilter())
+            stream = std::make_shared<FilterBlockInputStream>(
+                stream,
+                before_post_filter_actions,
+                post_filter_column,
+                log->identifier());
     });
 }
 
@@ -76,13 +105,36 @@ void PhysicalFilter::buildPipelineExecGroupImpl(
             before_filter_actions,
             filter_column));
     });
+    if (hasPostFilter())
+    {
+        auto post_input_header = group_builder.getCurrentHeader();
+        group_builder.transform([&](auto & builder) {
+            builder.appendTransformOp(std::make_unique<FilterTransformOp>(
+                exec_context,
+                log->identifier(),
+                post_input_header,
+                before_post_filter_actions,
+                post_filter_column));
+        });
+    }
 }
 
 void PhysicalFilter::finalizeImpl(const Names & parent_require)
 {
     Names required_output = parent_require;
+    if (hasPostFilter())
+    {
+        Names post_required_output = parent_require;
+        post_required_output.emplace_back(post_filter_column);
+        before_post_filter_actions->finalize(post_required_output);
+        required_output = before_post_filter_actions->getRequiredColumns();
+    }
     required_output.emplace_back(filter_column);
     before_filter_actions->finalize(required_output);
+    if (hasPostFilter())
+        FinalizeHelper::prependProjectInputIfNeed(
+            before_post_filter_actions,
+            before_filter_actions->getSampleBlock().columns());
 
     child->finalize(before_filter_actions->getRequiredColumns());
     FinalizeHelper::prependProjectInputIfNeed(before_filter_actions, child->getSampleBlock().columns());
@@ -92,6 +144,6 @@ void PhysicalFilter::finalizeImpl(const Names & parent_require)
 
 const Block & PhysicalFilter::getSampleBlock() const
 {
-    return before_filter_actions->getSampleBlock();
+    return hasPostFilter() ? before_post_filter_actions->getSampleBlock() : before_filter_actions->getSampleBlock();
 }
 } // namespace DB
@@ -37,10 +37,14 @@ public:
         const String & req_id,
         const PhysicalPlanNodePtr & child_,
         const String & filter_column_,
-        const ExpressionActionsPtr & before_filter_actions_)
+        const ExpressionActionsPtr & before_filter_actions_,
+        const String & post_filter_column_ = "",
+        const ExpressionActionsPtr & before_post_filter_actions_ = nullptr)
         : PhysicalUnary(executor_id_, PlanType::Filter, schema_, fine_grained_shuffle_, req_id, child_)
         , filter_column(filter_column_)
         , before_filter_actions(before_filter_actions_)
+        , post_filter_column(post_filter_column_)
+        , before_post_filter_actions(before_post_filter_actions_)
     {}
 
     void finalizeImpl(const Names & parent_require) override;
@@ -56,8 +60,15 @@ private:
         Context & /*context*/,
         size_t /*concurrency*/) override;
 
+    bool hasPostFilter() const { return before_post_filter_actions != nullptr; }
+
 private:
     String filter_column;
     ExpressionActionsPtr before_filter_actions;
+
+    /// The expensive conditions are filtered in a second step, so they are only evaluated on the rows that pass the
+    /// cheap ones. Empty if all the conditions are filtered in the first step.
+    String post_filter_column;
+    ExpressionActionsPtr before_post_filter_actions;
 };
 } // namespace DB
@@ -178,7 +178,7 @@ PhysicalPlanNodePtr PhysicalJoin::build(
         max_bytes_before_external_join,
         build_spill_config,
         probe_spill_config,
-        RestoreConfig{settings.join_restore_concurrency, 0, 0},
+        RestoreConfig{settings.join_restore_concurrency, 0, 0, settings.join_max_restore_round},
         join_output_schema,
         [&](const OperatorSpillContextPtr & operator_spill_context) {
             if (context.getDAGContext() != nullptr)
@@ -194,6 +194,7 @@ PhysicalPlanNodePtr PhysicalJoin::build(
         match_helper_name,
         flag_mapped_entry_helper_name,
         settings.join_probe_cache_columns_threshold,
+        settings.join_probe_prefetch_batch_size,
         context.isTest(),
         runtime_filter_list);
 
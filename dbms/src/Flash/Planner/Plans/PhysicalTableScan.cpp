@@ -26,6 +26,7 @@
 #include <Interpreters/Context.h>
 #include <Interpreters/SharedContexts/Disagg.h>
 #include <Operators/ExpressionTransformOp.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold.h>
 
 namespace DB
 {
@@ -71,6 +72,30 @@ NamesWithAliases buildTableScanProjectionCols(
     }
     return schema_project_cols;
 }
+
+/// Whether the order of the values read from storage is the same as the order of the min-max index.
+/// Timestamp is excluded because it may be converted to the session timezone after read.
+bool isTopNPushDownSupported(const TiDB::ColumnInfo & column_info)
+{
+    if (column_info.id == ExtraTableIDColumnID || column_info.hasGeneratedColumnFlag())
+        return false;
+    switch (column_info.tp)
+    {
+    case TiDB::TypeTiny:
+    case TiDB::TypeShort:
+    case TiDB::TypeInt24:
+    case TiDB::TypeLong:
+    case TiDB::TypeLongLong:
+    case TiDB::TypeYear:
+    case TiDB::TypeFloat:
+    case TiDB::TypeDouble:
+    case TiDB::TypeDate:
+    case TiDB::TypeDatetime:
+        return true;
+    default:
+        return false;
+    }
+}
 } // namespace
 
 PhysicalTableScan::PhysicalTableScan(
@@ -211,4 +236,36 @@ const String & PhysicalTableScan::getFilterConditionsId() const
     RUNTIME_CHECK(hasFilterConditions());
     return filter_conditions.executor_id;
 }
+
+DM::TopNThresholdPtr PhysicalTableScan::pushDownTopN(const Context & context, const SortDescription & order_descr)
+{
+    // Only TopN on a single column is supported now.
+    if (order_descr.size() != 1 || context.getDAGContext() == nullptr
+        || context.getSharedContextDisagg()->isDisaggregatedComputeMode())
+        return nullptr;
+
+    const auto & desc = order_descr[0];
+    for (size_t i = 0; i < schema.size(); ++i)
+    {
+        if (schema[i].name != desc.column_name)
+            continue;
+        const auto & column_info = tidb_table_scan.getColumns()[i];
+        if (!isTopNPushDownSupported(column_info))
+            return nullptr;
+        auto topn_threshold = std::make_shared<DM::TopNThreshold>(column_info.id, desc.column_name, desc.direction < 0);
+        context.getDAGContext()->topn_threshold_map[tidb_table_scan.getTableScanExecutorID()] = topn_threshold;
+        return topn_threshold;
+    }
+    return nullptr;
+}
+
+void PhysicalTableScan::pushDownCountOnly(const Context & context)
+{
+    // The rows can not be counted without reading the data if any filter is applied.
+    if (hasFilterConditions() || !tidb_table_scan.getPushedDownFilters().empty()
+        || !tidb_table_scan.getRuntimeFilterIDs().empty() || context.getDAGContext() == nullptr
+        || context.getSharedContextDisagg()->isDisaggregatedComputeMode())
+        return;
+    context.getDAGContext()->count_only_table_scans.insert(tidb_table_scan.getTableScanExecutorID());
+}
 } // namespace DB
@@ -14,10 +14,12 @@
 
 #pragma once
 
+#include <Core/SortDescription.h>
 #include <Flash/Coprocessor/DAGStorageInterpreter.h>
 #include <Flash/Coprocessor/FilterConditions.h>
 #include <Flash/Coprocessor/TiDBTableScan.h>
 #include <Flash/Planner/Plans/PhysicalLeaf.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold_fwd.h>
 #include <tipb/executor.pb.h>
 
 namespace DB
@@ -48,6 +50,13 @@ public:
 
     const String & getFilterConditionsId() const;
 
+    /// Push down the running threshold of the TopN on this table scan to the storage.
+    /// Return nullptr if the TopN can not be pushed down.
+    DM::TopNThresholdPtr pushDownTopN(const Context & context, const SortDescription & order_descr);
+
+    /// Tell the storage that only the number of rows is needed by the aggregation above.
+    void pushDownCountOnly(const Context & context);
+
     void buildPipeline(PipelineBuilder & builder, Context & context, PipelineExecutorContext & exec_context) override;
 
 private:
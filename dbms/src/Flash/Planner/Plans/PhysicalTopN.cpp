@@ -20,6 +20,7 @@
 #include <Flash/Pipeline/Exec/PipelineExecBuilder.h>
 #include <Flash/Planner/FinalizeHelper.h>
 #include <Flash/Planner/PhysicalPlanHelper.h>
+#include <Flash/Planner/Plans/PhysicalTableScan.h>
 #include <Flash/Planner/Plans/PhysicalTopN.h>
 #include <Interpreters/Context.h>
 
@@ -46,6 +47,11 @@ PhysicalPlanNodePtr PhysicalTopN::build(
     auto order_columns = analyzer.buildOrderColumns(before_sort_actions, top_n.order_by());
     SortDescription order_descr = getSortDescription(order_columns, top_n.order_by());
 
+    // The packs of the table scan whose values can not make into the TopN are skipped by the running threshold.
+    DM::TopNThresholdPtr topn_threshold;
+    if (child->tp() == PlanType::TableScan && top_n.limit() > 0 && context.getSettingsRef().dt_enable_topn_pushdown)
+        topn_threshold = std::static_pointer_cast<PhysicalTableScan>(child)->pushDownTopN(context, order_descr);
+
     auto physical_top_n = std::make_shared<PhysicalTopN>(
         executor_id,
         child->getSchema(),
@@ -54,7 +60,8 @@ PhysicalPlanNodePtr PhysicalTopN::build(
         child,
         order_descr,
         before_sort_actions,
-        top_n.limit());
+        top_n.limit(),
+        topn_threshold);
     return physical_top_n;
 }
 
@@ -64,7 +71,7 @@ void PhysicalTopN::buildBlockInputStreamImpl(DAGPipeline & pipeline, Context & c
 
     executeExpression(pipeline, before_sort_actions, log, "before TopN");
 
-    orderStreams(pipeline, max_streams, order_descr, limit, false, context, log);
+    orderStreams(pipeline, max_streams, order_descr, limit, false, context, log, topn_threshold);
 }
 
 void PhysicalTopN::buildPipelineExecGroupImpl(
@@ -79,11 +86,11 @@ void PhysicalTopN::buildPipelineExecGroupImpl(
     // TODO find a suitable threshold is necessary; 10000 is just a value picked without much consideration.
     if (group_builder.concurrency() * limit <= 10000)
     {
-        executeLocalSort(exec_context, group_builder, order_descr, limit, false, context, log);
+        executeLocalSort(exec_context, group_builder, order_descr, limit, false, context, log, topn_threshold);
     }
     else
     {
-        executeFinalSort(exec_context, group_builder, order_descr, limit, context, log);
+        executeFinalSort(exec_context, group_builder, order_descr, limit, context, log, topn_threshold);
         if (is_restore_concurrency)
             restoreConcurrency(
                 exec_context,
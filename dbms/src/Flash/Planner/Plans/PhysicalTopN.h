@@ -17,6 +17,7 @@
 #include <Core/SortDescription.h>
 #include <Flash/Planner/Plans/PhysicalUnary.h>
 #include <Interpreters/ExpressionActions.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold_fwd.h>
 #include <tipb/executor.pb.h>
 
 namespace DB
@@ -39,11 +40,13 @@ public:
         const PhysicalPlanNodePtr & child_,
         const SortDescription & order_descr_,
         const ExpressionActionsPtr & before_sort_actions_,
-        size_t limit_)
+        size_t limit_,
+        const DM::TopNThresholdPtr & topn_threshold_ = nullptr)
         : PhysicalUnary(executor_id_, PlanType::TopN, schema_, fine_grained_shuffle_, req_id, child_)
         , order_descr(order_descr_)
         , before_sort_actions(before_sort_actions_)
         , limit(limit_)
+        , topn_threshold(topn_threshold_)
     {}
 
     void finalizeImpl(const Names & parent_require) override;
@@ -63,5 +66,7 @@ private:
     SortDescription order_descr;
     ExpressionActionsPtr before_sort_actions;
     size_t limit;
+    // Not nullptr if the TopN is pushed down to the table scan below.
+    DM::TopNThresholdPtr topn_threshold;
 };
 } // namespace DB
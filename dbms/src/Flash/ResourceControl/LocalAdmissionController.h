@@ -102,6 +102,9 @@ private:
     static constexpr int32_t MediumPriorityValue = 8;
     static constexpr int32_t HighPriorityValue = 16;
 
+    // Fetch tokens from GAC when the remaining tokens can only last for this many seconds.
+    static constexpr double TOKEN_PREFETCH_LOOKAHEAD_SEC = 1.0;
+
     // Minus 1 because uint64 max is used as special flag.
     static constexpr uint64_t MAX_VIRTUAL_TIME = (std::numeric_limits<uint64_t>::max() >> 4) - 1;
 
@@ -182,10 +185,17 @@ private:
             || user_priority == HighPriorityValue);
     }
 
+    // Besides the threshold of the bucket, tokens are also low if they are predicted to be used up in
+    // TOKEN_PREFETCH_LOOKAHEAD_SEC by the average consumption speed. So the tokens are fetched from GAC ahead of time
+    // and the tasks of this resource group are not blocked until the next fetch.
     bool lowToken() const
     {
         std::lock_guard lock(mu);
-        return !burstable && bucket->lowToken();
+        if (burstable)
+            return false;
+        if (bucket->lowToken())
+            return true;
+        return bucket_mode == normal_mode && bucket->peek() <= ru_consumption_speed * TOKEN_PREFETCH_LOOKAHEAD_SEC;
     }
 
     // Return how many tokens should acquire from GAC for the next n seconds.
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <Common/FmtUtils.h>
+#include <Common/PerfEventCounters.h>
 #include <common/types.h>
 
 namespace DB
@@ -29,6 +30,8 @@ struct BaseRuntimeStatistics
     size_t allocated_bytes = 0;
     size_t concurrency = 0;
     UInt64 execution_time_ns = 0;
+    // Sum of the hardware counters of all the operators, only collected in pipeline mode
+    PerfEventValues perf_events;
 
     void append(const BlockStreamProfileInfo &);
     void append(const OperatorProfileInfo &);
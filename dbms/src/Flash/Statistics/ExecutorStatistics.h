@@ -65,6 +65,15 @@ public:
             base.allocated_bytes,
             base.concurrency,
             base.execution_time_ns);
+        if (base.perf_events.cycles > 0)
+        {
+            fmt_buffer.fmtAppend(
+                R"(,"cycles":{},"instructions":{},"cache_misses":{},"branch_misses":{})",
+                base.perf_events.cycles,
+                base.perf_events.instructions,
+                base.perf_events.cache_misses,
+                base.perf_events.branch_misses);
+        }
         if constexpr (ExecutorImpl::has_extra_info)
         {
             fmt_buffer.append(",");
@@ -22,7 +22,8 @@ void JoinStatistics::appendExtraJson(FmtBuffer & fmt_buffer) const
     fmt_buffer.fmtAppend(
         R"("peak_build_bytes_usage":{},"build_side_child":"{}","is_spill_enabled":{},"is_spilled":{},)"
         R"("join_build_inbound_rows":{},"join_build_inbound_blocks":{},"join_build_inbound_bytes":{},)"
-        R"("join_build_inbound_allocated_bytes":{},"join_build_concurrency":{},"join_build_execution_time_ns":{})",
+        R"("join_build_inbound_allocated_bytes":{},"join_build_concurrency":{},"join_build_execution_time_ns":{},)"
+        R"("join_probe_inbound_rows":{})",
         peak_build_bytes_usage,
         build_side_child,
         is_spill_enabled,
@@ -32,7 +33,8 @@ void JoinStatistics::appendExtraJson(FmtBuffer & fmt_buffer) const
         join_build_base.bytes,
         join_build_base.allocated_bytes,
         join_build_base.concurrency,
-        join_build_base.execution_time_ns);
+        join_build_base.execution_time_ns,
+        join_probe_inbound_rows);
 }
 
 void JoinStatistics::collectExtraRuntimeDetail()
@@ -46,6 +48,7 @@ void JoinStatistics::collectExtraRuntimeDetail()
         build_side_child = join_execute_info.build_side_root_executor_id;
         is_spill_enabled = join_execute_info.join_profile_info->is_spill_enabled;
         is_spilled = join_execute_info.join_profile_info->is_spilled;
+        join_probe_inbound_rows = join_execute_info.join_profile_info->probe_rows;
         switch (dag_context.getExecutionMode())
         {
         case ExecutionMode::None:
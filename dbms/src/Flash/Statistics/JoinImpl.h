@@ -40,6 +40,7 @@ private:
     String build_side_child;
     bool is_spill_enabled = false;
     bool is_spilled = false;
+    size_t join_probe_inbound_rows = 0;
 
     BaseRuntimeStatistics join_build_base;
 
@@ -0,0 +1,232 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/MemoryTracker.h>
+#include <Flash/Pipeline/Schedule/TaskScheduler.h>
+#include <TestUtils/ColumnGenerator.h>
+#include <TestUtils/ExecutorTestUtils.h>
+#include <TestUtils/TiFlashTestBasic.h>
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+/// End-to-end benchmarks of the query engines, run the queries with mock sources through the stream engine or the
+/// pipeline engine. The args of each benchmark are {thread num, max_block_size, enable pipeline}, the thread num is
+/// used as the size of the task thread pools and as the concurrency of the query.
+/// Besides the time, each benchmark reports the peak memory usage of the queries as `peak_memory_bytes`.
+/// Use `bench_dbms --benchmark_filter=ExecutorBench --benchmark_format=json` to get results that can be
+/// compared between releases.
+
+namespace DB
+{
+namespace tests
+{
+namespace
+{
+constexpr size_t table_rows = 1'000'000;
+// The tpch-like tables, `orders` has one row for every 4 rows in `lineitem`.
+constexpr size_t orders_rows = table_rows / 4;
+constexpr UInt64 num_customers = 10'000;
+constexpr UInt64 num_days = 100;
+
+class ExecutorBenchRunner : public ExecutorTest
+{
+public:
+    void TestBody() override {}
+
+    void setUp(size_t thread_num, UInt64 max_block_size, bool enable_pipeline)
+    {
+        SetUp();
+        // `ExecutorTest::SetUp` creates a task scheduler of fixed size, replace it.
+        TaskScheduler::instance.reset();
+        TaskSchedulerConfig config{thread_num, thread_num};
+        TaskScheduler::instance = std::make_unique<TaskScheduler>(config);
+        enablePipeline(enable_pipeline);
+        context.context->setSetting("max_block_size", Field(max_block_size));
+    }
+
+    void tearDown() { TearDown(); }
+
+    MockDAGRequestContext & mockContext() { return context; }
+};
+
+ColumnsWithTypeAndName generateColumns(const MockColumnInfoVec & column_infos)
+{
+    ColumnsWithTypeAndName columns;
+    for (const auto & column_info : mockColumnInfosToTiDBColumnInfos(column_infos))
+    {
+        ColumnGeneratorOpts opts{
+            table_rows,
+            getDataTypeByColumnInfoForComputingLayer(column_info)->getName(),
+            RANDOM,
+            column_info.name};
+        columns.push_back(ColumnGenerator::instance().generate(opts));
+    }
+    return columns;
+}
+
+// Generate a column of `rows` values, the i-th value is `gen(i)`.
+template <typename Gen>
+ColumnWithTypeAndName generateInt64Column(const String & name, size_t rows, Gen && gen)
+{
+    std::vector<std::optional<Int64>> values(rows);
+    for (size_t i = 0; i < rows; ++i)
+        values[i] = static_cast<Int64>(gen(i));
+    return toNullableVec<Int64>(name, values);
+}
+} // namespace
+
+class ExecutorBench : public benchmark::Fixture
+{
+public:
+    void SetUp(const benchmark::State & state) override
+    {
+        ExecutorTest::SetUpTestCase();
+        thread_num = state.range(0);
+        runner = std::make_unique<ExecutorBenchRunner>();
+        runner->setUp(thread_num, state.range(1), state.range(2) != 0);
+
+        auto & context = runner->mockContext();
+        MockColumnInfoVec column_infos{{"k", TiDB::TP::TypeLongLong}, {"v", TiDB::TP::TypeLongLong}};
+        context.addMockTable("bench", "t1", column_infos, generateColumns(column_infos), thread_num);
+        context.addMockTable("bench", "t2", column_infos, generateColumns(column_infos), thread_num);
+        context.addExchangeReceiver("exchange", column_infos, generateColumns(column_infos));
+
+        // Use a fixed seed so that the data is the same in every run.
+        std::mt19937_64 rand_gen(0);
+        context.addMockTable(
+            "tpch",
+            "orders",
+            {{"orderkey", TiDB::TP::TypeLongLong},
+             {"custkey", TiDB::TP::TypeLongLong},
+             {"orderdate", TiDB::TP::TypeLongLong}},
+            {generateInt64Column("orderkey", orders_rows, [](size_t i) { return i; }),
+             generateInt64Column("custkey", orders_rows, [](size_t i) { return i % num_customers; }),
+             generateInt64Column("orderdate", orders_rows, [&](size_t) { return rand_gen() % num_days; })},
+            thread_num);
+        context.addMockTable(
+            "tpch",
+            "lineitem",
+            {{"orderkey", TiDB::TP::TypeLongLong},
+             {"price", TiDB::TP::TypeLongLong},
+             {"shipdate", TiDB::TP::TypeLongLong}},
+            {generateInt64Column("orderkey", table_rows, [&](size_t) { return rand_gen() % orders_rows; }),
+             generateInt64Column("price", table_rows, [&](size_t) { return rand_gen() % 100'000; }),
+             generateInt64Column("shipdate", table_rows, [&](size_t) { return rand_gen() % num_days; })},
+            thread_num);
+    }
+
+    void TearDown(const benchmark::State &) override
+    {
+        runner->tearDown();
+        runner.reset();
+    }
+
+    void run(benchmark::State & state, const std::shared_ptr<tipb::DAGRequest> & request)
+    {
+        // The memory of the queries executed with memory tracker is tracked by `root_of_query_mem_trackers`.
+        root_of_query_mem_trackers->resetPeak();
+        const auto baseline_memory = root_of_query_mem_trackers->get();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(runner->executeStreamsWithMemoryTracker(request, thread_num));
+        state.SetItemsProcessed(state.iterations() * table_rows);
+        state.counters["peak_memory_bytes"] = root_of_query_mem_trackers->getPeak() - baseline_memory;
+    }
+
+protected:
+    size_t thread_num = 0;
+    std::unique_ptr<ExecutorBenchRunner> runner;
+};
+
+BENCHMARK_DEFINE_F(ExecutorBench, ScanFilterAgg)
+(benchmark::State & state)
+try
+{
+    auto & context = runner->mockContext();
+    auto request = context.scan("bench", "t1")
+                       .filter(gt(col("v"), lit(Field(static_cast<Int64>(0)))))
+                       .aggregation({Sum(col("v"))}, {col("k")})
+                       .build(context);
+    run(state, request);
+}
+CATCH
+
+BENCHMARK_DEFINE_F(ExecutorBench, HashJoin)
+(benchmark::State & state)
+try
+{
+    auto & context = runner->mockContext();
+    auto request = context.scan("bench", "t1")
+                       .join(context.scan("bench", "t2"), tipb::JoinType::TypeInnerJoin, {col("k")})
+                       .aggregation({Count(lit(static_cast<UInt64>(1)))}, {})
+                       .build(context);
+    run(state, request);
+}
+CATCH
+
+BENCHMARK_DEFINE_F(ExecutorBench, ExchangeReceiverAgg)
+(benchmark::State & state)
+try
+{
+    auto & context = runner->mockContext();
+    auto request = context.receive("exchange").aggregation({Sum(col("v"))}, {col("k")}).build(context);
+    run(state, request);
+}
+CATCH
+
+BENCHMARK_DEFINE_F(ExecutorBench, Sort)
+(benchmark::State & state)
+try
+{
+    auto & context = runner->mockContext();
+    auto request = context.scan("bench", "t1").topN({{"k", false}, {"v", true}}, table_rows).build(context);
+    run(state, request);
+}
+CATCH
+
+/// The shape of tpch q3: filter both sides, join lineitem with orders, and aggregate by a column of orders.
+BENCHMARK_DEFINE_F(ExecutorBench, TpchQ3Like)
+(benchmark::State & state)
+try
+{
+    auto & context = runner->mockContext();
+    const auto date = Field(static_cast<Int64>(num_days / 2));
+    auto request = context.scan("tpch", "lineitem")
+                       .filter(gt(col("shipdate"), lit(date)))
+                       .join(
+                           context.scan("tpch", "orders").filter(lt(col("orderdate"), lit(date))),
+                           tipb::JoinType::TypeInnerJoin,
+                           {col("orderkey")})
+                       .aggregation({Sum(col("price"))}, {col("custkey")})
+                       .build(context);
+    run(state, request);
+}
+CATCH
+
+#define REGISTER_EXECUTOR_BENCH(NAME)                                   \
+    BENCHMARK_REGISTER_F(ExecutorBench, NAME)                           \
+        ->ArgsProduct({{1, 4, 16}, {1024, DEFAULT_BLOCK_SIZE}, {0, 1}}) \
+        ->Unit(benchmark::kMillisecond)                                 \
+        ->UseRealTime();
+
+REGISTER_EXECUTOR_BENCH(ScanFilterAgg)
+REGISTER_EXECUTOR_BENCH(HashJoin)
+REGISTER_EXECUTOR_BENCH(ExchangeReceiverAgg)
+REGISTER_EXECUTOR_BENCH(Sort)
+REGISTER_EXECUTOR_BENCH(TpchQ3Like)
+
+#undef REGISTER_EXECUTOR_BENCH
+
+} // namespace tests
+} // namespace DB
@@ -751,6 +751,39 @@ try
 }
 CATCH
 
+TEST_F(AggExecutorTestRunner, AggPrefetch)
+try
+{
+    std::vector<String> tables{"big_table_1", "big_table_2", "big_table_3", "big_table_4"};
+    for (const auto & table : tables)
+    {
+        auto request = context.scan("test_db", table).aggregation({Max(col("value"))}, {col("key")}).build(context);
+        context.context->setSetting("agg_prefetch_batch_size", Field(static_cast<UInt64>(0)));
+        auto expect = executeStreams(request, 1);
+        context.context->setSetting("group_by_two_level_threshold_bytes", Field(static_cast<UInt64>(0)));
+        // batch size 7 does not divide the block size, so the last batch of a block is a partial one
+        std::vector<UInt64> prefetch_batch_sizes{1, 7, 4096};
+        for (auto prefetch_batch_size : prefetch_batch_sizes)
+        {
+            context.context->setSetting("agg_prefetch_batch_size", Field(static_cast<UInt64>(prefetch_batch_size)));
+            // 0: use one level hash table
+            // 1: use two level hash table
+            std::vector<UInt64> two_level_thresholds{0, 1};
+            for (auto two_level_threshold : two_level_thresholds)
+            {
+                context.context->setSetting(
+                    "group_by_two_level_threshold",
+                    Field(static_cast<UInt64>(two_level_threshold)));
+                WRAP_FOR_AGG_PARTIAL_BLOCK_START
+                executeAndAssertColumnsEqual(request, expect);
+                WRAP_FOR_AGG_PARTIAL_BLOCK_END
+            }
+        }
+        context.context->setSetting("agg_prefetch_batch_size", Field(static_cast<UInt64>(0)));
+    }
+}
+CATCH
+
 TEST_F(AggExecutorTestRunner, SplitAggOutput)
 try
 {
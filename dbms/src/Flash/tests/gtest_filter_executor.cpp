@@ -271,6 +271,27 @@ try
 }
 CATCH
 
+TEST_F(FilterExecutorTestRunner, ExpensiveConditionsAfterCheapOnes)
+try
+{
+    // `like` is evaluated in a second filter step, the result must be the same whatever the order of the conditions.
+    auto like = makeASTFunction(
+        "like",
+        col("s2"),
+        lit(Field(String("b%"))),
+        lit(Field(static_cast<Int64>(static_cast<unsigned char>('\\')))));
+    auto cheap = eq(col("s1"), lit(Field(String("banana"))));
+    auto expect = ColumnsWithTypeAndName{toNullableVec<String>({"banana"}), toNullableVec<String>({"banana"})};
+
+    auto request = context.receive("exchange1").filter(And(cheap, like)).build(context);
+    executeAndAssertColumnsEqual(request, expect);
+    request = context.receive("exchange1").filter(And(like, cheap)).build(context);
+    executeAndAssertColumnsEqual(request, expect);
+    request = context.scan("test_db", "test_table").filter(And(like, cheap)).project({col("s2")}).build(context);
+    executeAndAssertColumnsEqual(request, {toNullableVec<String>({"banana"})});
+}
+CATCH
+
 TEST_F(FilterExecutorTestRunner, BigTable)
 try
 {
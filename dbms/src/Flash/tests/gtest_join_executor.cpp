@@ -155,6 +155,7 @@ try
     };
 
     std::vector<UInt64> probe_cache_column_threshold{2, 1000};
+    std::vector<UInt64> probe_prefetch_batch_sizes{0, 2};
     for (size_t i = 0; i < join_type_num; ++i)
     {
         for (size_t j = 0; j < simple_test_num; ++j)
@@ -170,13 +171,17 @@ try
 
             for (auto threshold : probe_cache_column_threshold)
             {
-                context.context->setSetting(
-                    "join_probe_cache_columns_threshold",
-                    Field(static_cast<UInt64>(threshold)));
-                executeAndAssertColumnsEqual(request, expected_cols[i * simple_test_num + j]);
-                ASSERT_COLUMNS_EQ_UR(
-                    genScalarCountResults(expected_cols[i * simple_test_num + j]),
-                    executeStreams(request_column_prune, 2));
+                for (auto batch_size : probe_prefetch_batch_sizes)
+                {
+                    context.context->setSetting(
+                        "join_probe_cache_columns_threshold",
+                        Field(static_cast<UInt64>(threshold)));
+                    context.context->setSetting("join_probe_prefetch_batch_size", Field(batch_size));
+                    executeAndAssertColumnsEqual(request, expected_cols[i * simple_test_num + j]);
+                    ASSERT_COLUMNS_EQ_UR(
+                        genScalarCountResults(expected_cols[i * simple_test_num + j]),
+                        executeStreams(request_column_prune, 2));
+                }
             }
         }
     }
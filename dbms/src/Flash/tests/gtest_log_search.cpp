@@ -15,9 +15,11 @@
 #include <Flash/LogSearch.h>
 #include <Poco/DeflatingStream.h>
 #include <common/types.h>
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include <ext/scope_guard.h>
+#include <limits>
 
 namespace DB
 {
@@ -249,5 +251,59 @@ TEST_F(LogSearchTest, SearchDir)
     }
 }
 
+TEST_F(LogSearchTest, SeekByTime)
+{
+    std::string log_file_path = "/tmp/LogSearch_Test_SeekByTime.log";
+    SCOPE_EXIT({
+        Poco::File f(log_file_path);
+        if (f.exists())
+            f.remove();
+    });
+
+    // One log per second, large enough to be seeked by binary search.
+    constexpr size_t num_logs = 10000;
+    {
+        std::ofstream ss(log_file_path, std::ios::binary);
+        ASSERT_TRUE(ss);
+        for (size_t i = 0; i < num_logs; ++i)
+        {
+            char time_buf[64];
+            snprintf(
+                time_buf,
+                sizeof(time_buf),
+                "[2020/04/23 %02zu:%02zu:%02zu.000 +08:00]",
+                i / 3600,
+                i / 60 % 60,
+                i % 60);
+            ss << time_buf << " [INFO] [\"log " << i << "\"]\n";
+        }
+    }
+
+    Int64 first_log_time = 0;
+    ReadLogFile(log_file_path, [&](std::istream & istream) {
+        LogIterator itr(0l, std::numeric_limits<Int64>::max(), {}, {}, istream);
+        auto log = itr.next();
+        ASSERT_TRUE(log.has_value());
+        first_log_time = log->time();
+    });
+
+    const size_t start_log = 6789;
+    const Int64 start_time = first_log_time + start_log * 1000;
+    ReadLogFile(log_file_path, [&](std::istream & istream) {
+        SeekLogFileByTime(istream, start_time);
+        // The logs before `start_time` are skipped, except a few in the last scanning range.
+        ASSERT_GT(istream.tellg(), 0);
+        LogIterator itr(start_time, std::numeric_limits<Int64>::max(), {}, {}, istream);
+        for (size_t i = start_log; i < num_logs; ++i)
+        {
+            auto log = itr.next();
+            ASSERT_TRUE(log.has_value());
+            ASSERT_EQ(log->time(), first_log_time + static_cast<Int64>(i) * 1000);
+            ASSERT_EQ(log->message(), fmt::format("[\"log {}\"]", i));
+        }
+        ASSERT_FALSE(itr.next().has_value());
+    });
+}
+
 } // namespace tests
 } // namespace DB
@@ -86,6 +86,35 @@ try
         testForExecutionSummary(request, expect);
     }
 
+    {
+        // with min max runtime filter [2, 4], table_scan_0 return 2 rows
+        mock::MockRuntimeFilter
+            rf(1, col("k1"), col("k1"), "exchange_receiver_1", "table_scan_0", tipb::RuntimeFilterType::MIN_MAX);
+        auto request
+            = context.scan("test_db", "left_table", std::vector<int>{1})
+                  .join(context.receive("right_exchange_table"), tipb::JoinType::TypeInnerJoin, {col("k1")}, rf)
+                  .build(context);
+        Expect expect{
+            {"table_scan_0", {2, enable_pipeline ? concurrency : 1}},
+            {"exchange_receiver_1", {4, concurrency}},
+            {"Join_2", {3, concurrency}}};
+        testForExecutionSummary(request, expect);
+    }
+
+    {
+        // test empty build side, with min max runtime filter, table_scan_0 return 0 rows
+        mock::MockRuntimeFilter
+            rf(1, col("k1"), col("k1"), "exchange_receiver_1", "table_scan_0", tipb::RuntimeFilterType::MIN_MAX);
+        auto request = context.scan("test_db", "left_table", std::vector<int>{1})
+                           .join(context.receive("right_empty_table"), tipb::JoinType::TypeInnerJoin, {col("k1")}, rf)
+                           .build(context);
+        Expect expect{
+            {"table_scan_0", {0, enable_pipeline ? concurrency : 1}},
+            {"exchange_receiver_1", {0, concurrency}},
+            {"Join_2", {0, concurrency}}};
+        testForExecutionSummary(request, expect);
+    }
+
     {
         // issue #45300
         // test empty build side, with runtime filter, table_scan_0 return 0 rows
@@ -0,0 +1,149 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Flash/Coprocessor/DAGContext.h>
+#include <Flash/Coprocessor/DAGStorageInterpreter.h>
+#include <Flash/Coprocessor/FilterConditions.h>
+#include <Flash/Coprocessor/TiDBTableScan.h>
+#include <Interpreters/Context.h>
+#include <TestUtils/ExecutorTestUtils.h>
+#include <TestUtils/mockExecutor.h>
+
+namespace DB
+{
+namespace tests
+{
+class ScanLimitHintTest : public DB::tests::ExecutorTest
+{
+public:
+    void initializeContext() override
+    {
+        ExecutorTest::initializeContext();
+        context.addMockTable({"test_db", "t"}, {{"a", TiDB::TP::TypeLongLong}, {"b", TiDB::TP::TypeString}});
+        context.context->getSettingsRef().max_block_size = max_block_size;
+    }
+
+    /// The max streams of the table scan in `request` computed by DAGStorageInterpreter.
+    size_t getMaxStreams(
+        const std::shared_ptr<tipb::DAGRequest> & request,
+        const FilterConditions & filter_conditions = {})
+    {
+        DAGContext dag_context(*request, "scan_limit_hint_test", max_streams);
+        context.context->setDAGContext(&dag_context);
+
+        // The executor ids of the list based request are generated by DAGContext.
+        const tipb::Executor * scan = nullptr;
+        if (dag_context.dag_request.isTreeBased())
+        {
+            dag_context.dag_request.traverse([&](const tipb::Executor & executor) {
+                if (executor.tp() == tipb::ExecType::TypeTableScan)
+                    scan = &executor;
+                return scan == nullptr;
+            });
+        }
+        else
+        {
+            scan = &request->executors(0);
+        }
+        RUNTIME_CHECK(scan != nullptr && scan->tp() == tipb::ExecType::TypeTableScan);
+
+        TiDBTableScan table_scan(scan, scan->executor_id(), dag_context);
+        auto result = DAGStorageInterpreter::getMaxStreamsByLimitHint(
+            *context.context,
+            table_scan,
+            filter_conditions,
+            max_streams);
+        context.context->setDAGContext(nullptr);
+        return result;
+    }
+
+    static void pushDownFilter(const std::shared_ptr<tipb::DAGRequest> & request, const tipb::Expr & condition)
+    {
+        auto * scan = request->has_root_executor() ? request->mutable_root_executor()->mutable_limit()->mutable_child()
+                                                   : request->mutable_executors(0);
+        *scan->mutable_tbl_scan()->add_pushed_down_filter_conditions() = condition;
+    }
+
+    static constexpr size_t max_block_size = 100;
+    static constexpr size_t max_streams = 10;
+    const std::vector<DAGRequestType> request_types{DAGRequestType::tree, DAGRequestType::list};
+};
+
+TEST_F(ScanLimitHintTest, LimitOverScan)
+try
+{
+    for (auto type : request_types)
+    {
+        // One block is enough for a small limit
+        auto request = context.scan("test_db", "t").limit(10).build(context, type);
+        ASSERT_EQ(getMaxStreams(request), 1);
+
+        // The number of max_block_size blocks needed by the limit
+        request = context.scan("test_db", "t").limit(301).build(context, type);
+        ASSERT_EQ(getMaxStreams(request), 4);
+
+        // Never more than the original max streams
+        request = context.scan("test_db", "t").limit(10000).build(context, type);
+        ASSERT_EQ(getMaxStreams(request), max_streams);
+
+        // No limit over the table scan
+        request = context.scan("test_db", "t").build(context, type);
+        ASSERT_EQ(getMaxStreams(request), max_streams);
+    }
+}
+CATCH
+
+TEST_F(ScanLimitHintTest, LimitOverSelection)
+try
+{
+    for (auto type : request_types)
+    {
+        // The selection may drop any number of rows, so the limit is not the parent of the table scan
+        auto request = context.scan("test_db", "t")
+                           .filter(eq(col("a"), lit(Field(static_cast<Int64>(1)))))
+                           .limit(10)
+                           .build(context, type);
+        ASSERT_EQ(getMaxStreams(request), max_streams);
+
+        // The limit is not the parent of the table scan
+        request = context.scan("test_db", "t").project({"a"}).limit(10).build(context, type);
+        ASSERT_EQ(getMaxStreams(request), max_streams);
+    }
+}
+CATCH
+
+TEST_F(ScanLimitHintTest, PushedDownFilters)
+try
+{
+    for (auto type : request_types)
+    {
+        auto filter_request = context.scan("test_db", "t")
+                                  .filter(eq(col("a"), lit(Field(static_cast<Int64>(1)))))
+                                  .build(context, DAGRequestType::tree);
+        const auto & conditions = filter_request->root_executor().selection().conditions();
+
+        // The filters pushed down to the table scan disable the limit hint
+        auto request = context.scan("test_db", "t").limit(10).build(context, type);
+        pushDownFilter(request, conditions[0]);
+        ASSERT_EQ(getMaxStreams(request), max_streams);
+
+        // So do the filter conditions of the table scan
+        request = context.scan("test_db", "t").limit(10).build(context, type);
+        ASSERT_EQ(getMaxStreams(request, FilterConditions("selection_0", conditions)), max_streams);
+    }
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
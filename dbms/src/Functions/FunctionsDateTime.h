@@ -2377,16 +2377,7 @@ public:
                     ErrorCodes::ILLEGAL_COLUMN);
 
             const auto offset = offset_col->getInt(0);
-            for (size_t i = 0; i < size; ++i)
-            {
-                UInt64 result_time = vec_from[i] + offset;
-                // todo maybe affected by daytime saving, need double check
-                if constexpr (convert_from_utc)
-                    convertTimeZoneByOffset(vec_from[i], result_time, true, offset);
-                else
-                    convertTimeZoneByOffset(vec_from[i], result_time, false, offset);
-                vec_to[i] = result_time;
-            }
+            convertTimeZoneByOffset(vec_from.data(), vec_to.data(), size, convert_from_utc, offset);
 
             block.getByPosition(result).column = std::move(col_to);
         }
@@ -854,7 +854,7 @@ public:
     //  - only pattern column is provided and it's a constant column
     //  - pattern and match type columns are provided and they are both constant columns
     template <bool need_subpattern, typename ExprT, typename MatchTypeT>
-    std::unique_ptr<Regexps::Regexp> memorize(
+    Regexps::Pool::Pointer memorize(
         const ExprT & pat_param,
         const MatchTypeT & match_type_param,
         TiDB::TiDBCollatorPtr collator,
@@ -870,10 +870,7 @@ public:
         String match_type = match_type_param.getString(0);
         final_pattern = FunctionsRegexp::addMatchTypeForPattern<need_subpattern>(final_pattern, match_type, collator);
 
-        if (flags == 0)
-            return std::make_unique<Regexps::Regexp>(final_pattern, FunctionsRegexp::getDefaultFlags());
-        else
-            return std::make_unique<Regexps::Regexp>(final_pattern, flags);
+        return Regexps::getCompiled(final_pattern, flags == 0 ? FunctionsRegexp::getDefaultFlags() : flags);
     }
 
     // Check if we can memorize the regexp
@@ -164,7 +164,7 @@ public:
         // Start to match
         if constexpr (canMemorize<PatT, MatchTypeT>())
         {
-            std::unique_ptr<Regexps::Regexp> regexp;
+            Regexps::Pool::Pointer regexp;
             if (col_size > 0)
             {
                 regexp = memorize<false>(pat_param, match_type_param, collator);
@@ -245,7 +245,7 @@ public:
         // Start to execute replace
         if (canMemorize<PatT, MatchTypeT>())
         {
-            std::unique_ptr<Regexps::Regexp> regexp;
+            Regexps::Pool::Pointer regexp;
             if (col_size > 0)
             {
                 regexp = memorize<false>(pat_param, match_type_param, collator, replace_default_flag);
@@ -221,7 +221,7 @@ public:
         // Start to execute substr
         if (canMemorize<PatT, MatchTypeT>())
         {
-            std::unique_ptr<Regexps::Regexp> regexp;
+            Regexps::Pool::Pointer regexp;
             if (col_size > 0)
             {
                 regexp = memorize<true>(pat_param, match_type_param, collator);
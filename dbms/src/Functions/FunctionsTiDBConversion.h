@@ -2357,8 +2357,10 @@ private:
         //  other type, its parameter should be the same
         DataTypePtr from_inner_type = removeNullable(from_type);
         DataTypePtr to_inner_type = removeNullable(to_type);
+        // Decimal is parametric, but equal decimal types have the same precision and scale, so every value of the
+        // source already fits the target. TiDB often adds such casts, e.g. for the arguments of sum and avg.
         return !(from_type->isNullable() ^ to_type->isNullable()) && from_inner_type->equals(*to_inner_type)
-            && !from_inner_type->isParametric() && !from_inner_type->isString();
+            && (!from_inner_type->isParametric() || from_inner_type->isDecimal()) && !from_inner_type->isString();
     }
 
     WrapperType prepare(const DataTypePtr & from_type, const DataTypePtr & to_type) const
@@ -17,6 +17,7 @@
 #include <Common/ProfileEvents.h>
 #include <Functions/ObjectPool.h>
 #include <Functions/likePatternToRegexp.h>
+#include <fmt/core.h>
 
 namespace DB
 {
@@ -50,6 +51,17 @@ inline Pool::Pointer get(const std::string & pattern, int flags)
         return new Regexp{createRegexp<like>(pattern, flags)};
     });
 }
+
+/// The compiled regexps of the regexp_xxx functions, so the blocks and the queries with the same pattern and
+/// flags do not compile it again.
+inline Pool::Pointer getCompiled(const std::string & pattern, int flags)
+{
+    static Pool known_regexps;
+
+    return known_regexps.get(fmt::format("{}/{}", flags, pattern), [&pattern, &flags] {
+        return new Regexp{pattern, flags};
+    });
+}
 } // namespace Regexps
 
 } // namespace DB
@@ -1369,6 +1369,22 @@ try
 }
 CATCH
 
+TEST_F(TestTidbConversion, castDecimalAsSameDecimal)
+try
+{
+    auto decimal_column = createColumn<Decimal64>(std::make_tuple(15, 4), {"1.2300", "-1.0056", "0.0000"});
+    ASSERT_COLUMN_EQ(
+        decimal_column,
+        executeFunction(func_name, {decimal_column, createCastTypeConstColumn("Decimal(15,4)")}));
+
+    auto nullable_decimal_column
+        = createColumn<Nullable<Decimal64>>(std::make_tuple(15, 4), {"1.2300", {}, "0.0000"});
+    ASSERT_COLUMN_EQ(
+        nullable_decimal_column,
+        executeFunction(func_name, {nullable_decimal_column, createCastTypeConstColumn("Nullable(Decimal(15,4))")}));
+}
+CATCH
+
 TEST_F(TestTidbConversion, castDecimalAsDecimalWithRound)
 try
 {
@@ -16,11 +16,19 @@
 
 #if USE_QPL
 #include <Common/Exception.h>
+#include <Common/ProfileEvents.h>
 #include <IO/CodecDeflateQpl.h>
 
 #include <cassert>
 #include <memory>
 
+namespace ProfileEvents
+{
+extern const Event QplHardwareDecompress;
+extern const Event QplSoftwareDecompress;
+extern const Event QplJobPoolExhausted;
+} // namespace ProfileEvents
+
 namespace DB
 {
 namespace QPL
@@ -28,8 +36,6 @@ namespace QPL
 static constexpr Int32 RET_ERROR = -1;
 
 CodecDeflateQpl::CodecDeflateQpl(qpl_path_t path)
-    : random_engine(std::random_device()())
-    , distribution(0, MAX_JOB_NUMBER - 1)
 {
     UInt32 job_size = 0;
     qpl_excute_path = (path == qpl_path_hardware) ? "Hardware" : "Software";
@@ -138,6 +144,9 @@ qpl_job * CodecDeflateQpl::acquireJob(UInt32 & job_id)
 {
     if (isJobPoolReady())
     {
+        // The engine is not thread safe, and sharing one between the reading threads makes them contend on it
+        thread_local std::mt19937 random_engine(std::random_device{}());
+        std::uniform_int_distribution<int> distribution(0, MAX_JOB_NUMBER - 1);
         UInt32 retry = 0;
         auto index = distribution(random_engine);
         while (!tryLockJob(index))
@@ -166,10 +175,10 @@ Int32 CodecDeflateQpl::doCompressData(const char * source, UInt32 source_size, c
     {
         if (!(job_ptr = acquireJob(job_id)))
         {
-            throw Exception(
-                std::string("DeflateQpl ") + qpl_excute_path
-                    + " codec failed.(Details: doCompressData->acquireJob fail, probably job pool exhausted)",
-                ErrorCodes::QPL_ACQUIRE_JOB_FAILED);
+            // All jobs are busy, it happens when the accelerator is saturated. Let the caller fall back to the
+            // software path without throwing and logging for every block.
+            ProfileEvents::increment(ProfileEvents::QplJobPoolExhausted);
+            return RET_ERROR;
         }
 
         job_ptr->op = qpl_op_compress;
@@ -213,10 +222,10 @@ Int32 CodecDeflateQpl::doDecompressData(const char * source, UInt32 source_size,
     {
         if (!(job_ptr = acquireJob(job_id)))
         {
-            throw Exception(
-                std::string("DeflateQpl ") + qpl_excute_path
-                    + " codec failed.(Details: doDeCompressData->acquireJob fail, probably job pool exhausted)",
-                ErrorCodes::QPL_ACQUIRE_JOB_FAILED);
+            // All jobs are busy, it happens when the accelerator is saturated. Let the caller fall back to the
+            // software path without throwing and logging for every block.
+            ProfileEvents::increment(ProfileEvents::QplJobPoolExhausted);
+            return RET_ERROR;
         }
 
         job_ptr->op = qpl_op_decompress;
@@ -265,9 +274,13 @@ Int32 QPL_decompress(const char * source, int inputSize, char * dest, int maxOut
     Int32 res = RET_ERROR;
     if (CodecDeflateQpl::getHardwareInstance().isJobPoolReady())
         res = CodecDeflateQpl::getHardwareInstance().doDecompressData(source, inputSize, dest, maxOutputSize);
-    if (res == RET_ERROR)
-        res = CodecDeflateQpl::getSoftwareInstance().doDecompressData(source, inputSize, dest, maxOutputSize);
-    return res;
+    if (res != RET_ERROR)
+    {
+        ProfileEvents::increment(ProfileEvents::QplHardwareDecompress);
+        return res;
+    }
+    ProfileEvents::increment(ProfileEvents::QplSoftwareDecompress);
+    return CodecDeflateQpl::getSoftwareInstance().doDecompressData(source, inputSize, dest, maxOutputSize);
 }
 
 } //namespace QPL
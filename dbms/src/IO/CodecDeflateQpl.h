@@ -73,8 +73,6 @@ private:
     /// Locks for accessing each job object pointers
     std::array<std::atomic_bool, MAX_JOB_NUMBER> job_ptr_locks;
     bool job_pool_ready;
-    std::mt19937 random_engine;
-    std::uniform_int_distribution<int> distribution;
 };
 
 Int32 QPL_compress(const char * source, int inputSize, char * dest, int maxOutputSize);
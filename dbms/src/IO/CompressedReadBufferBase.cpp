@@ -18,6 +18,7 @@
 #include <IO/BufferWithOwnMemory.h>
 #include <IO/CompressedReadBufferBase.h>
 #include <IO/CompressedStream.h>
+#include <IO/LightweightCompression.h>
 #include <IO/ReadBuffer.h>
 #include <IO/WriteHelpers.h>
 #include <city.h>
@@ -73,11 +74,13 @@ size_t CompressedReadBufferBase<has_checksum>::readCompressedData(
     if (method == static_cast<UInt8>(CompressionMethodByte::LZ4)
         || method == static_cast<UInt8>(CompressionMethodByte::QPL)
         || method == static_cast<UInt8>(CompressionMethodByte::ZSTD)
-        || method == static_cast<UInt8>(CompressionMethodByte::NONE))
+        || method == static_cast<UInt8>(CompressionMethodByte::NONE)
+        || method == static_cast<UInt8>(CompressionMethodByte::LIGHTWEIGHT))
 #else
     if (method == static_cast<UInt8>(CompressionMethodByte::LZ4)
         || method == static_cast<UInt8>(CompressionMethodByte::ZSTD)
-        || method == static_cast<UInt8>(CompressionMethodByte::NONE))
+        || method == static_cast<UInt8>(CompressionMethodByte::NONE)
+        || method == static_cast<UInt8>(CompressionMethodByte::LIGHTWEIGHT))
 #endif
     {
         size_compressed = unalignedLoad<UInt32>(&own_compressed_buffer[1]);
@@ -120,11 +123,10 @@ size_t CompressedReadBufferBase<has_checksum>::readCompressedData(
     }
 }
 
-template <bool has_checksum>
-void CompressedReadBufferBase<has_checksum>::decompress(
-    char * to,
-    size_t size_decompressed,
-    size_t size_compressed_without_checksum)
+namespace
+{
+/// Decompress a whole compressed block (without checksum) starting with the method byte.
+void decompressBlock(const char * compressed_buffer, size_t size_compressed, char * to, size_t size_decompressed)
 {
     UInt8 method = compressed_buffer[0]; /// See CompressedWriteBuffer.h
 
@@ -134,7 +136,7 @@ void CompressedReadBufferBase<has_checksum>::decompress(
                 LZ4_decompress_safe(
                     compressed_buffer + COMPRESSED_BLOCK_HEADER_SIZE,
                     to,
-                    size_compressed_without_checksum - COMPRESSED_BLOCK_HEADER_SIZE,
+                    size_compressed - COMPRESSED_BLOCK_HEADER_SIZE,
                     size_decompressed)
                 < 0))
             throw Exception("Cannot LZ4_decompress_safe", ErrorCodes::CANNOT_DECOMPRESS);
@@ -145,7 +147,7 @@ void CompressedReadBufferBase<has_checksum>::decompress(
             to,
             size_decompressed,
             compressed_buffer + COMPRESSED_BLOCK_HEADER_SIZE,
-            size_compressed_without_checksum - COMPRESSED_BLOCK_HEADER_SIZE);
+            size_compressed - COMPRESSED_BLOCK_HEADER_SIZE);
 
         if (ZSTD_isError(res))
             throw Exception(
@@ -158,7 +160,7 @@ void CompressedReadBufferBase<has_checksum>::decompress(
         if (unlikely(
                 QPL::QPL_decompress(
                     compressed_buffer + COMPRESSED_BLOCK_HEADER_SIZE,
-                    size_compressed_without_checksum - COMPRESSED_BLOCK_HEADER_SIZE,
+                    size_compressed - COMPRESSED_BLOCK_HEADER_SIZE,
                     to,
                     size_decompressed)
                 < 0))
@@ -169,9 +171,37 @@ void CompressedReadBufferBase<has_checksum>::decompress(
     {
         memcpy(to, &compressed_buffer[COMPRESSED_BLOCK_HEADER_SIZE], size_decompressed);
     }
+    else if (method == static_cast<UInt8>(CompressionMethodByte::LIGHTWEIGHT))
+    {
+        if (unlikely(size_compressed < LightweightCompression::HEADER_SIZE + COMPRESSED_BLOCK_HEADER_SIZE))
+            throw Exception("Too small size of lightweight compressed block", ErrorCodes::CANNOT_DECOMPRESS);
+        const auto header = LightweightCompression::readHeader(compressed_buffer);
+
+        // Decompress the nested block of residuals, then restore the values
+        const char * nested = compressed_buffer + LightweightCompression::HEADER_SIZE;
+        const size_t nested_compressed = unalignedLoad<UInt32>(nested + 1);
+        const size_t nested_decompressed = unalignedLoad<UInt32>(nested + 5);
+        if (unlikely(
+                nested[0] == static_cast<char>(CompressionMethodByte::LIGHTWEIGHT)
+                || nested_compressed != size_compressed - LightweightCompression::HEADER_SIZE))
+            throw Exception("Invalid nested block of lightweight compression", ErrorCodes::CANNOT_DECOMPRESS);
+        PODArray<char> residuals(nested_decompressed);
+        decompressBlock(nested, nested_compressed, residuals.data(), nested_decompressed);
+        LightweightCompression::decode(header, residuals.data(), residuals.size(), to, size_decompressed);
+    }
     else
         throw Exception("Unknown compression method: " + toString(method), ErrorCodes::UNKNOWN_COMPRESSION_METHOD);
 }
+} // namespace
+
+template <bool has_checksum>
+void CompressedReadBufferBase<has_checksum>::decompress(
+    char * to,
+    size_t size_decompressed,
+    size_t size_compressed_without_checksum)
+{
+    decompressBlock(compressed_buffer, size_compressed_without_checksum, to, size_decompressed);
+}
 
 
 /// 'compressed_in' could be initialized lazily, but before first call of 'readCompressedData'.
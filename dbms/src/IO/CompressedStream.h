@@ -59,6 +59,8 @@ enum class CompressionMethod
   *
   * 0x90 - ZSTD
   *
+  * 0x92 - Lightweight encodings of integers with a nested compressed block, see LightweightCompression.h
+  *
   * All sizes are little endian.
   */
 
@@ -67,6 +69,7 @@ enum class CompressionMethodByte : uint8_t
     NONE = 0x02,
     LZ4 = 0x82,
     ZSTD = 0x90,
+    LIGHTWEIGHT = 0x92,
 #if USE_QPL
     QPL = 0x88,
 #endif
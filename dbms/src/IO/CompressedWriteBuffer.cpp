@@ -12,9 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/ProfileEvents.h>
 #include <Common/config.h>
 #include <Core/Types.h>
 #include <IO/CompressedWriteBuffer.h>
+#include <IO/LightweightCompression.h>
 #include <city.h>
 #include <common/unaligned.h>
 #include <lz4.h>
@@ -27,6 +29,11 @@
 #include "CodecDeflateQpl.h"
 #endif
 
+namespace ProfileEvents
+{
+extern const Event CompressedBlocksStoredRaw;
+} // namespace ProfileEvents
+
 namespace DB
 {
 namespace ErrorCodes
@@ -35,6 +42,49 @@ extern const int CANNOT_COMPRESS;
 extern const int UNKNOWN_COMPRESSION_METHOD;
 } // namespace ErrorCodes
 
+template <typename Buffer>
+size_t CompressionEncode(
+    std::string_view source,
+    const CompressionSettings & compression_settings,
+    Buffer & compressed_buffer);
+
+namespace
+{
+/// Return 0 if the lightweight encodings are useless for `source`.
+template <typename Buffer>
+size_t lightweightEncode(
+    std::string_view source,
+    const CompressionSettings & compression_settings,
+    Buffer & compressed_buffer)
+{
+    LightweightCompression::Header header;
+    PODArray<char> residuals;
+    if (!LightweightCompression::encode(
+            source,
+            compression_settings.integer_width,
+            compression_settings.integer_signed,
+            header,
+            residuals))
+        return 0;
+
+    // The residuals are compressed by `method` as a nested block
+    PODArray<char> nested_buffer;
+    const size_t nested_size = CompressionEncode(
+        {residuals.data(), residuals.size()},
+        CompressionSettings(compression_settings.method, compression_settings.level),
+        nested_buffer);
+
+    const size_t compressed_size = LightweightCompression::HEADER_SIZE + nested_size;
+    compressed_buffer.resize(compressed_size);
+    compressed_buffer[0] = static_cast<UInt8>(CompressionMethodByte::LIGHTWEIGHT);
+    unalignedStore<UInt32>(&compressed_buffer[1], static_cast<UInt32>(compressed_size));
+    unalignedStore<UInt32>(&compressed_buffer[5], static_cast<UInt32>(source.size()));
+    LightweightCompression::writeHeader(header, &compressed_buffer[0]);
+    memcpy(&compressed_buffer[LightweightCompression::HEADER_SIZE], nested_buffer.data(), nested_size);
+    return compressed_size;
+}
+} // namespace
+
 template <typename Buffer>
 size_t CompressionEncode(
     std::string_view source,
@@ -46,6 +96,12 @@ size_t CompressionEncode(
     /** The format of compressed block - see CompressedStream.h
       */
 
+    if (compression_settings.integer_width > 0)
+    {
+        if (compressed_size = lightweightEncode(source, compression_settings, compressed_buffer); compressed_size > 0)
+            return compressed_size;
+    }
+
     switch (compression_settings.method)
     {
     case CompressionMethod::LZ4:
@@ -157,6 +213,13 @@ size_t CompressionEncode(
         throw Exception("Unknown compression method", ErrorCodes::UNKNOWN_COMPRESSION_METHOD);
     }
 
+    if (compression_settings.min_saved_ratio > 0 && compression_settings.method != CompressionMethod::NONE
+        && compressed_size > COMPRESSED_BLOCK_HEADER_SIZE + source.size() * (1 - compression_settings.min_saved_ratio))
+    {
+        ProfileEvents::increment(ProfileEvents::CompressedBlocksStoredRaw);
+        return CompressionEncode(source, CompressionSettings(CompressionMethod::NONE), compressed_buffer);
+    }
+
     return compressed_size;
 }
 
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <IO/CompressedStream.h>
+#include <common/types.h>
 
 
 namespace DB
@@ -25,6 +26,13 @@ struct CompressionSettings
 {
     CompressionMethod method;
     int level;
+    /// The width and signedness of the values if the data is an array of fixed-width integers.
+    /// Try lightweight encodings (see LightweightCompression.h) before `method` if it is not 0.
+    UInt8 integer_width = 0;
+    bool integer_signed = false;
+    /// Store a block uncompressed if `method` saves less than this ratio of its size, 0 means never. Decompressing
+    /// such a block costs more CPU than reading the few more bytes, e.g. the columns of random strings or hashes.
+    double min_saved_ratio = 0;
 
     CompressionSettings()
         : CompressionSettings(CompressionMethod::LZ4)
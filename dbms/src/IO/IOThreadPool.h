@@ -43,6 +43,9 @@ public:
         return *instance;
     }
 
+    /// Return nullptr if the pool is not initialized, e.g. in the tools which do not start the thread pools.
+    static ThreadPool * tryGet() { return instance.get(); }
+
     static void shutdown() noexcept { instance.reset(); }
 };
 
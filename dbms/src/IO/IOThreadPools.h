@@ -45,6 +45,10 @@ struct RNWritePageCacheTrait
 struct WNEstablishDisaggTaskTrait
 {
 };
+
+struct DMFileWriteTrait
+{
+};
 } // namespace io_pool_details
 
 // TODO: Move these out.
@@ -54,4 +58,5 @@ using RNRemoteReadTaskPool = IOThreadPool<io_pool_details::RemoteReadTaskTrait>;
 using RNPagePreparerPool = IOThreadPool<io_pool_details::RNPreparerTrait>;
 using RNWritePageCachePool = IOThreadPool<io_pool_details::RNWritePageCacheTrait>;
 using WNEstablishDisaggTaskPool = IOThreadPool<io_pool_details::WNEstablishDisaggTaskTrait>;
+using DMFileWritePool = IOThreadPool<io_pool_details::DMFileWriteTrait>;
 } // namespace DB
@@ -0,0 +1,298 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <Common/Exception.h>
+#include <IO/LightweightCompression.h>
+#include <common/likely.h>
+#include <common/unaligned.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace DB
+{
+namespace ErrorCodes
+{
+extern const int CANNOT_DECOMPRESS;
+} // namespace ErrorCodes
+
+namespace LightweightCompression
+{
+namespace
+{
+UInt8 residualWidth(UInt64 range)
+{
+    if (range == 0)
+        return 0;
+    if (range <= std::numeric_limits<UInt8>::max())
+        return 1;
+    if (range <= std::numeric_limits<UInt16>::max())
+        return 2;
+    if (range <= std::numeric_limits<UInt32>::max())
+        return 4;
+    return 8;
+}
+
+/// `U` is the unsigned type of values, `R` is the type of residuals, `void` means 0-byte residuals.
+/// FOR residuals: `value[i] - base`. Delta residuals: `value[i] - value[i - 1] - base` for i > 0.
+template <typename U, typename R>
+void writeResiduals(const char * data, size_t count, const Header & header, char * residuals)
+{
+    const U base = static_cast<U>(header.base);
+    if (header.mode == Mode::FOR)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            const U value = unalignedLoad<U>(data + i * sizeof(U));
+            unalignedStore<R>(residuals + i * sizeof(R), static_cast<R>(value - base));
+        }
+    }
+    else
+    {
+        U prev = unalignedLoad<U>(data);
+        for (size_t i = 1; i < count; ++i)
+        {
+            const U value = unalignedLoad<U>(data + i * sizeof(U));
+            unalignedStore<R>(residuals + (i - 1) * sizeof(R), static_cast<R>(value - prev - base));
+            prev = value;
+        }
+    }
+}
+
+template <typename U, typename R>
+void readResiduals(const char * residuals, size_t count, const Header & header, char * to)
+{
+    const U base = static_cast<U>(header.base);
+    if (header.mode == Mode::FOR)
+    {
+        // No dependency between rows, so that it can be vectorized by the compiler
+        for (size_t i = 0; i < count; ++i)
+        {
+            U residual = 0;
+            if constexpr (!std::is_void_v<R>)
+                residual = unalignedLoad<R>(residuals + i * sizeof(R));
+            unalignedStore<U>(to + i * sizeof(U), static_cast<U>(base + residual));
+        }
+    }
+    else
+    {
+        U value = static_cast<U>(header.first);
+        unalignedStore<U>(to, value);
+        for (size_t i = 1; i < count; ++i)
+        {
+            U residual = 0;
+            if constexpr (!std::is_void_v<R>)
+                residual = unalignedLoad<R>(residuals + (i - 1) * sizeof(R));
+            value += static_cast<U>(base + residual);
+            unalignedStore<U>(to + i * sizeof(U), value);
+        }
+    }
+}
+
+template <typename U>
+void writeResiduals(const char * data, size_t count, const Header & header, char * residuals)
+{
+    switch (header.residual_width)
+    {
+    case 1:
+        return writeResiduals<U, UInt8>(data, count, header, residuals);
+    case 2:
+        return writeResiduals<U, UInt16>(data, count, header, residuals);
+    case 4:
+        return writeResiduals<U, UInt32>(data, count, header, residuals);
+    default: // 0-byte residuals
+        return;
+    }
+}
+
+template <typename U>
+void readResiduals(const char * residuals, size_t count, const Header & header, char * to)
+{
+    switch (header.residual_width)
+    {
+    case 0:
+        return readResiduals<U, void>(residuals, count, header, to);
+    case 1:
+        return readResiduals<U, UInt8>(residuals, count, header, to);
+    case 2:
+        return readResiduals<U, UInt16>(residuals, count, header, to);
+    case 4:
+        return readResiduals<U, UInt32>(residuals, count, header, to);
+    default:
+        throw Exception(
+            ErrorCodes::CANNOT_DECOMPRESS,
+            "Invalid residual width {} of lightweight compression",
+            header.residual_width);
+    }
+}
+
+/// `S` is the type of values with the signedness of data type, the statistics are calculated with it.
+template <typename S>
+bool encodeImpl(std::string_view source, Header & header, PODArray<char> & residuals)
+{
+    using U = std::make_unsigned_t<S>;
+    using D = std::make_signed_t<S>;
+    const size_t count = source.size() / sizeof(S);
+    if (count == 0)
+        return false;
+
+    const char * data = source.data();
+    S min_value = unalignedLoad<S>(data);
+    S max_value = min_value;
+    D min_delta = std::numeric_limits<D>::max();
+    D max_delta = std::numeric_limits<D>::min();
+    U prev = static_cast<U>(min_value);
+    for (size_t i = 1; i < count; ++i)
+    {
+        const S value = unalignedLoad<S>(data + i * sizeof(S));
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+        const auto delta = static_cast<D>(static_cast<U>(value) - prev);
+        min_delta = std::min(min_delta, delta);
+        max_delta = std::max(max_delta, delta);
+        prev = static_cast<U>(value);
+    }
+
+    const UInt8 for_width = residualWidth(static_cast<U>(static_cast<U>(max_value) - static_cast<U>(min_value)));
+    const UInt8 delta_width = count > 1
+        ? residualWidth(static_cast<U>(static_cast<U>(max_delta) - static_cast<U>(min_delta)))
+        : for_width;
+    if (std::min(for_width, delta_width) >= sizeof(S))
+        return false;
+
+    header.value_width = sizeof(S);
+    if (delta_width < for_width)
+    {
+        header.mode = Mode::Delta;
+        header.residual_width = delta_width;
+        header.base = static_cast<U>(min_delta);
+        header.first = static_cast<U>(unalignedLoad<S>(data));
+    }
+    else
+    {
+        header.mode = Mode::FOR;
+        header.residual_width = for_width;
+        header.base = static_cast<U>(min_value);
+        header.first = 0;
+    }
+
+    const size_t residual_count = header.mode == Mode::FOR ? count : count - 1;
+    residuals.resize(residual_count * header.residual_width);
+    writeResiduals<U>(data, count, header, residuals.data());
+    return true;
+}
+} // namespace
+
+bool encode(
+    std::string_view source,
+    UInt8 value_width,
+    bool is_signed,
+    Header & header,
+    PODArray<char> & residuals)
+{
+    if (value_width == 0 || source.size() % value_width != 0)
+        return false;
+    switch (value_width)
+    {
+    case 1:
+        return is_signed ? encodeImpl<Int8>(source, header, residuals) : encodeImpl<UInt8>(source, header, residuals);
+    case 2:
+        return is_signed ? encodeImpl<Int16>(source, header, residuals)
+                         : encodeImpl<UInt16>(source, header, residuals);
+    case 4:
+        return is_signed ? encodeImpl<Int32>(source, header, residuals)
+                         : encodeImpl<UInt32>(source, header, residuals);
+    case 8:
+        return is_signed ? encodeImpl<Int64>(source, header, residuals)
+                         : encodeImpl<UInt64>(source, header, residuals);
+    default:
+        return false;
+    }
+}
+
+void writeHeader(const Header & header, char * block)
+{
+    char * pos = block + COMPRESSED_BLOCK_HEADER_SIZE;
+    unalignedStore<UInt8>(pos, static_cast<UInt8>(header.mode));
+    unalignedStore<UInt8>(pos + 1, header.value_width);
+    unalignedStore<UInt8>(pos + 2, header.residual_width);
+    unalignedStore<UInt64>(pos + 3, header.base);
+    unalignedStore<UInt64>(pos + 3 + sizeof(UInt64), header.first);
+}
+
+Header readHeader(const char * block)
+{
+    const char * pos = block + COMPRESSED_BLOCK_HEADER_SIZE;
+    Header header;
+    header.mode = static_cast<Mode>(unalignedLoad<UInt8>(pos));
+    header.value_width = unalignedLoad<UInt8>(pos + 1);
+    header.residual_width = unalignedLoad<UInt8>(pos + 2);
+    header.base = unalignedLoad<UInt64>(pos + 3);
+    header.first = unalignedLoad<UInt64>(pos + 3 + sizeof(UInt64));
+    return header;
+}
+
+void decode(const Header & header, const char * residuals, size_t residuals_size, char * to, size_t size_decompressed)
+{
+    if (unlikely(header.mode != Mode::FOR && header.mode != Mode::Delta))
+        throw Exception(
+            ErrorCodes::CANNOT_DECOMPRESS,
+            "Unknown mode {} of lightweight compression",
+            static_cast<UInt8>(header.mode));
+    if (unlikely(header.residual_width >= header.value_width))
+        throw Exception(
+            ErrorCodes::CANNOT_DECOMPRESS,
+            "Invalid residual width {} of lightweight compression for {}-byte values",
+            header.residual_width,
+            header.value_width);
+    if (unlikely(size_decompressed % header.value_width != 0))
+        throw Exception(
+            ErrorCodes::CANNOT_DECOMPRESS,
+            "Invalid decompressed size {} of lightweight compression for {}-byte values",
+            size_decompressed,
+            header.value_width);
+
+    const size_t count = size_decompressed / header.value_width;
+    if (count == 0)
+        return;
+    const size_t residual_count = header.mode == Mode::FOR ? count : count - 1;
+    if (unlikely(residual_count * header.residual_width != residuals_size))
+        throw Exception(
+            ErrorCodes::CANNOT_DECOMPRESS,
+            "Invalid residuals size {} of lightweight compression, expected {}",
+            residuals_size,
+            residual_count * header.residual_width);
+
+    switch (header.value_width)
+    {
+    case 1:
+        return readResiduals<UInt8>(residuals, count, header, to);
+    case 2:
+        return readResiduals<UInt16>(residuals, count, header, to);
+    case 4:
+        return readResiduals<UInt32>(residuals, count, header, to);
+    case 8:
+        return readResiduals<UInt64>(residuals, count, header, to);
+    default:
+        throw Exception(
+            ErrorCodes::CANNOT_DECOMPRESS,
+            "Invalid value width {} of lightweight compression",
+            header.value_width);
+    }
+}
+
+} // namespace LightweightCompression
+} // namespace DB
@@ -0,0 +1,78 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <Common/PODArray.h>
+#include <IO/CompressedStream.h>
+#include <common/types.h>
+
+#include <string_view>
+
+namespace DB
+{
+/** Lightweight encodings for the blocks of fixed-width integers, applied before the general compression.
+  *
+  * - FOR (frame of reference): store `value - min_value` with the minimal byte width.
+  * - Delta: store the first value and `delta - min_delta` of the adjacent values with the minimal byte width.
+  *   It fits the monotonic values like timestamps and auto increment ids.
+  * A block of equal values (or equal deltas) gets 0-byte residuals, which is a single run in run-length encoding.
+  *
+  * The block format is (see also CompressedStream.h):
+  *   [method byte: LIGHTWEIGHT][compressed size: UInt32][decompressed size: UInt32]
+  *   [mode: UInt8][value width: UInt8][residual width: UInt8][base: UInt64][first value: UInt64]
+  *   [a nested compressed block of the residuals]
+  */
+namespace LightweightCompression
+{
+enum class Mode : UInt8
+{
+    FOR = 1,
+    Delta = 2,
+};
+
+struct Header
+{
+    Mode mode = Mode::FOR;
+    // The width of the values, one of 1, 2, 4 and 8
+    UInt8 value_width = 0;
+    // The width of the residuals, one of 0, 1, 2 and 4, always less than `value_width`
+    UInt8 residual_width = 0;
+    // `min_value` for FOR and `min_delta` for Delta
+    UInt64 base = 0;
+    // The first value for Delta
+    UInt64 first = 0;
+};
+
+static constexpr size_t HEADER_SIZE = COMPRESSED_BLOCK_HEADER_SIZE + 3 * sizeof(UInt8) + 2 * sizeof(UInt64);
+
+/// Choose the encoding for `source`, which is an array of `value_width`-byte integers.
+/// Return false if the residuals are not narrower than the values, then the lightweight encodings are useless.
+bool encode(
+    std::string_view source,
+    UInt8 value_width,
+    bool is_signed,
+    Header & header,
+    PODArray<char> & residuals);
+
+/// Write or read the header after the common header of compressed block.
+void writeHeader(const Header & header, char * block);
+Header readHeader(const char * block);
+
+/// Restore the values from the residuals into `to`, which is `size_decompressed` bytes.
+void decode(const Header & header, const char * residuals, size_t residuals_size, char * to, size_t size_decompressed);
+
+} // namespace LightweightCompression
+} // namespace DB
@@ -0,0 +1,83 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <IO/CompressedReadBuffer.h>
+#include <IO/CompressedWriteBuffer.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
+#include <TestUtils/TiFlashTestBasic.h>
+
+#include <algorithm>
+#include <random>
+
+namespace DB
+{
+namespace tests
+{
+namespace
+{
+String compress(const String & data, const CompressionSettings & settings)
+{
+    WriteBufferFromOwnString out;
+    {
+        CompressedWriteBuffer<false> compressed(out, settings);
+        compressed.write(data.data(), data.size());
+        compressed.next();
+    }
+    return out.releaseStr();
+}
+
+String decompress(const String & data, size_t size)
+{
+    ReadBufferFromString in(data);
+    CompressedReadBuffer<false> compressed(in);
+    String res(size, '\0');
+    compressed.readStrict(res.data(), size);
+    EXPECT_TRUE(compressed.eof());
+    return res;
+}
+} // namespace
+
+TEST(CompressedWriteBufferTest, StoreIncompressibleBlockRaw)
+try
+{
+    // Random bytes can not be compressed
+    String random_data(4096, '\0');
+    std::mt19937 rng(42);
+    std::generate(random_data.begin(), random_data.end(), [&] { return static_cast<char>(rng()); });
+    const String repeated_data(4096, 'a');
+
+    for (auto method : {CompressionMethod::LZ4, CompressionMethod::ZSTD})
+    {
+        CompressionSettings settings(method);
+        auto data = compress(random_data, settings);
+        ASSERT_NE(static_cast<UInt8>(data[0]), static_cast<UInt8>(CompressionMethodByte::NONE));
+
+        settings.min_saved_ratio = 0.1;
+        data = compress(random_data, settings);
+        ASSERT_EQ(static_cast<UInt8>(data[0]), static_cast<UInt8>(CompressionMethodByte::NONE));
+        ASSERT_EQ(data.size(), COMPRESSED_BLOCK_HEADER_SIZE + random_data.size());
+        ASSERT_EQ(decompress(data, random_data.size()), random_data);
+
+        // The compressible data is still compressed by `method`
+        data = compress(repeated_data, settings);
+        ASSERT_NE(static_cast<UInt8>(data[0]), static_cast<UInt8>(CompressionMethodByte::NONE));
+        ASSERT_LT(data.size(), repeated_data.size() / 10);
+        ASSERT_EQ(decompress(data, repeated_data.size()), repeated_data);
+    }
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -0,0 +1,178 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <IO/CompressedReadBuffer.h>
+#include <IO/CompressedWriteBuffer.h>
+#include <IO/LightweightCompression.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
+#include <TestUtils/TiFlashTestBasic.h>
+
+#include <random>
+#include <vector>
+
+namespace DB
+{
+namespace tests
+{
+class LightweightCompressionTest : public ::testing::Test
+{
+protected:
+    template <typename T>
+    static String compress(const std::vector<T> & values, CompressionMethod method)
+    {
+        CompressionSettings settings(method);
+        settings.integer_width = sizeof(T);
+        settings.integer_signed = std::is_signed_v<T>;
+        WriteBufferFromOwnString out;
+        {
+            CompressedWriteBuffer<false> compressed(out, settings);
+            compressed.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+            compressed.next();
+        }
+        return out.releaseStr();
+    }
+
+    template <typename T>
+    static std::vector<T> decompress(const String & data, size_t count)
+    {
+        ReadBufferFromString in(data);
+        CompressedReadBuffer<false> compressed(in);
+        std::vector<T> values(count);
+        compressed.readStrict(reinterpret_cast<char *>(values.data()), count * sizeof(T));
+        EXPECT_TRUE(compressed.eof());
+        return values;
+    }
+
+    template <typename T>
+    static void checkRoundTrip(
+        const std::vector<T> & values,
+        std::optional<LightweightCompression::Mode> expected_mode,
+        UInt8 expected_residual_width = 0)
+    {
+        for (auto method : {CompressionMethod::LZ4, CompressionMethod::ZSTD, CompressionMethod::NONE})
+        {
+            auto data = compress(values, method);
+            ASSERT_FALSE(data.empty());
+            if (expected_mode)
+            {
+                ASSERT_EQ(static_cast<UInt8>(data[0]), static_cast<UInt8>(CompressionMethodByte::LIGHTWEIGHT));
+                auto header = LightweightCompression::readHeader(data.data());
+                ASSERT_EQ(header.mode, *expected_mode);
+                ASSERT_EQ(header.value_width, sizeof(T));
+                ASSERT_EQ(header.residual_width, expected_residual_width);
+            }
+            else
+            {
+                ASSERT_NE(static_cast<UInt8>(data[0]), static_cast<UInt8>(CompressionMethodByte::LIGHTWEIGHT));
+            }
+            ASSERT_EQ(decompress<T>(data, values.size()), values);
+        }
+    }
+};
+
+TEST_F(LightweightCompressionTest, FrameOfReference)
+try
+{
+    std::mt19937_64 rng(42);
+    {
+        // Small range integers
+        std::vector<Int64> values(8192);
+        for (auto & v : values)
+            v = 1000000 + static_cast<Int64>(rng() % 200);
+        checkRoundTrip(values, LightweightCompression::Mode::FOR, 1);
+    }
+    {
+        // Negative values
+        std::vector<Int32> values(1000);
+        for (auto & v : values)
+            v = -30000 + static_cast<Int32>(rng() % 60000);
+        checkRoundTrip(values, LightweightCompression::Mode::FOR, 2);
+    }
+    {
+        // All values are the same
+        std::vector<UInt8> values(100, 1);
+        checkRoundTrip(values, LightweightCompression::Mode::FOR, 0);
+    }
+    {
+        // Wide range integers can not be encoded
+        std::vector<UInt64> values(1000);
+        for (auto & v : values)
+            v = rng();
+        checkRoundTrip<UInt64>(values, std::nullopt);
+    }
+}
+CATCH
+
+TEST_F(LightweightCompressionTest, Delta)
+try
+{
+    {
+        // Monotonic timestamps
+        std::vector<UInt64> values(8192);
+        UInt64 ts = 1700000000000000ULL;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            ts += 1 + i % 7;
+            values[i] = ts;
+        }
+        checkRoundTrip(values, LightweightCompression::Mode::Delta, 1);
+    }
+    {
+        // Decreasing values
+        std::vector<Int64> values(1000);
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = 1'000'000'000'000LL - static_cast<Int64>(i) * 3;
+        checkRoundTrip(values, LightweightCompression::Mode::Delta, 0);
+    }
+    {
+        // Wrap around
+        std::vector<Int8> values{120, 121, 122, 123, 124, 125, 126, 127, -128, -127};
+        checkRoundTrip(values, LightweightCompression::Mode::Delta, 0);
+    }
+}
+CATCH
+
+TEST_F(LightweightCompressionTest, Disabled)
+try
+{
+    std::vector<Int64> values(100, 7);
+    WriteBufferFromOwnString out;
+    {
+        CompressedWriteBuffer<false> compressed(out, CompressionSettings(CompressionMethod::LZ4));
+        compressed.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(Int64));
+        compressed.next();
+    }
+    auto data = out.releaseStr();
+    ASSERT_EQ(static_cast<UInt8>(data[0]), static_cast<UInt8>(CompressionMethodByte::LZ4));
+    ASSERT_EQ(decompress<Int64>(data, values.size()), values);
+}
+CATCH
+
+TEST_F(LightweightCompressionTest, CorruptedHeader)
+try
+{
+    std::vector<UInt32> values(100);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = i;
+    auto data = compress(values, CompressionMethod::NONE);
+    // Make the residual width invalid
+    data[COMPRESSED_BLOCK_HEADER_SIZE + 2] = 4;
+    ASSERT_ANY_THROW(decompress<UInt32>(data, values.size()));
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -45,6 +45,13 @@ extern const char force_agg_on_partial_block[];
 extern const char random_fail_in_resize_callback[];
 } // namespace FailPoints
 
+namespace
+{
+/// The hash tables that can prefetch the bucket of a hash value.
+template <typename Data>
+concept HashTablePrefetchable = requires(const Data & data, size_t hash_value) { data.prefetch(hash_value); };
+} // namespace
+
 #define AggregationMethodName(NAME) AggregatedDataVariants::AggregationMethod_##NAME
 #define AggregationMethodNameTwoLevel(NAME) AggregatedDataVariants::AggregationMethod_##NAME##_two_level
 #define AggregationMethodType(NAME) AggregatedDataVariants::Type::NAME
@@ -670,10 +677,13 @@ std::optional<typename Method::EmplaceResult> Aggregator::emplaceKey(
     typename Method::State & state,
     size_t index,
     Arena & aggregates_pool,
-    std::vector<std::string> & sort_key_containers) const
+    std::vector<std::string> & sort_key_containers,
+    std::optional<size_t> hash_value) const
 {
     try
     {
+        if (hash_value)
+            return state.emplaceKey(method.data, index, aggregates_pool, sort_key_containers, *hash_value);
         return state.emplaceKey(method.data, index, aggregates_pool, sort_key_containers);
     }
     catch (ResizeException &)
@@ -749,11 +759,42 @@ ALWAYS_INLINE void Aggregator::executeImplBatch(
     std::unique_ptr<AggregateDataPtr[]> places(new AggregateDataPtr[agg_size]);
     std::optional<size_t> processed_rows;
 
-    for (size_t i = agg_process_info.start_row; i < agg_process_info.start_row + agg_size; ++i)
+    /// Hash a batch of rows and prefetch their buckets first, so that the cache misses of the hash table lookups in
+    /// the batch overlap with each other instead of stalling on every row.
+    size_t prefetch_batch_size = 0;
+    if constexpr (HashTablePrefetchable<typename Method::Data>)
+        prefetch_batch_size = params.prefetch_batch_size;
+    std::vector<size_t> batch_hash_values;
+    size_t batch_begin = agg_process_info.start_row;
+    size_t batch_end = agg_process_info.start_row;
+    const size_t end_row = agg_process_info.start_row + agg_size;
+
+    for (size_t i = agg_process_info.start_row; i < end_row; ++i)
     {
         AggregateDataPtr aggregate_data = nullptr;
 
-        auto emplace_result_holder = emplaceKey(method, state, i, *aggregates_pool, sort_key_containers);
+        std::optional<size_t> hash_value;
+        if constexpr (HashTablePrefetchable<typename Method::Data>)
+        {
+            if (prefetch_batch_size > 0)
+            {
+                if (i == batch_end)
+                {
+                    batch_begin = batch_end;
+                    batch_end = std::min(end_row, batch_begin + prefetch_batch_size);
+                    batch_hash_values.resize(batch_end - batch_begin);
+                    for (size_t row = batch_begin; row < batch_end; ++row)
+                    {
+                        size_t hash = state.getHash(method.data, row, *aggregates_pool, sort_key_containers);
+                        batch_hash_values[row - batch_begin] = hash;
+                        method.data.prefetch(hash);
+                    }
+                }
+                hash_value = batch_hash_values[i - batch_begin];
+            }
+        }
+
+        auto emplace_result_holder = emplaceKey(method, state, i, *aggregates_pool, sort_key_containers, hash_value);
         if unlikely (!emplace_result_holder.has_value())
         {
             LOG_INFO(log, "HashTable resize throw ResizeException since the data is already marked for spill");
@@ -1861,6 +1902,9 @@ void NO_INLINE Aggregator::mergeSingleLevelDataImpl(ManyAggregatedDataVariants &
     /// We merge all aggregation results to the first.
     for (size_t result_num = 1, size = non_empty_data.size(); result_num < size; ++result_num)
     {
+        if (is_cancelled())
+            return;
+
         AggregatedDataVariants & current = *non_empty_data[result_num];
 
         mergeDataImpl<Method>(
@@ -1942,6 +1986,23 @@ MergingBucketsPtr Aggregator::mergeAndConvertToBlocks(
         }
     }
 
+    /// The two level thresholds are checked by each thread on its own data during build, so it is possible that none of
+    /// the variants is converted while all of them together exceed the thresholds. Convert them here as well, otherwise
+    /// both the merge and the conversion to blocks run in one thread.
+    if (!has_at_least_one_two_level && max_threads > 1 && non_empty_data.front()->isConvertibleToTwoLevel())
+    {
+        size_t total_size = 0;
+        size_t total_bytes = 0;
+        for (const auto & variant : non_empty_data)
+        {
+            total_size += variant->size();
+            total_bytes += variant->bytesCount();
+        }
+        const size_t threshold_bytes = params.getGroupByTwoLevelThresholdBytes();
+        has_at_least_one_two_level = (group_by_two_level_threshold && total_size >= group_by_two_level_threshold)
+            || (threshold_bytes && total_bytes >= threshold_bytes);
+    }
+
     if (has_at_least_one_two_level)
         for (auto & variant : non_empty_data)
             if (!variant->isTwoLevel())
@@ -2488,6 +2549,8 @@ Block MergingBuckets::getDataForSingleLevel()
             throw Exception("Unknown aggregated data variant.", ErrorCodes::UNKNOWN_AGGREGATED_DATA_VARIANT);
         }
 #undef M
+        if unlikely (aggregator.is_cancelled())
+            return {};
         single_level_blocks = aggregator.prepareBlocksAndFillSingleLevel(*first, final);
     }
     ++current_bucket_num;
@@ -2507,6 +2570,9 @@ Block MergingBuckets::getDataForTwoLevel(size_t concurrency_index)
         return {};
     while (true)
     {
+        if unlikely (aggregator.is_cancelled())
+            return {};
+
         auto local_current_bucket_num = current_bucket_num.fetch_add(1);
         if (unlikely(local_current_bucket_num >= NUM_BUCKETS))
             return {};
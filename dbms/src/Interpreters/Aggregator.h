@@ -1047,6 +1047,10 @@ public:
         UInt64 max_block_size;
         TiDB::TiDBCollators collators;
 
+        /// The number of rows to hash and prefetch the hash table buckets in a batch before inserting them, 0 means
+        /// no prefetch.
+        size_t prefetch_batch_size = 0;
+
         Params(
             const Block & src_header_,
             const ColumnNumbers & keys_,
@@ -1292,7 +1296,8 @@ protected:
         typename Method::State & state,
         size_t index,
         Arena & aggregates_pool,
-        std::vector<std::string> & sort_key_containers) const;
+        std::vector<std::string> & sort_key_containers,
+        std::optional<size_t> hash_value = std::nullopt) const;
 
     /// For case when there are no keys (all aggregate into one row).
     static void executeWithoutKeyImpl(AggregatedDataWithoutKey & res, AggProcessInfo & agg_process_info, Arena * arena);
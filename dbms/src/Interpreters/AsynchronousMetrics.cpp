@@ -24,7 +24,10 @@
 #include <Interpreters/AsynchronousMetrics.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/SharedContexts/Disagg.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
 #include <Storages/DeltaMerge/DeltaMergeStore.h>
+#include <Storages/DeltaMerge/Index/BloomFilterIndex.h>
+#include <Storages/DeltaMerge/StableResultCache.h>
 #include <Storages/DeltaMerge/StoragePool.h>
 #include <Storages/KVStore/KVStore.h>
 #include <Storages/KVStore/TMTContext.h>
@@ -205,6 +208,30 @@ void AsynchronousMetrics::update()
         }
     }
 
+    {
+        if (auto bloom_filter_cache = context.getBloomFilterIndexCache())
+        {
+            set("BloomFilterIndexCacheBytes", bloom_filter_cache->weight());
+            set("BloomFilterIndexFiles", bloom_filter_cache->count());
+        }
+    }
+
+    {
+        if (auto stable_result_cache = context.getStableResultCache())
+        {
+            set("StableResultCacheBytes", stable_result_cache->weight());
+            set("StableResultCacheEntries", stable_result_cache->count());
+        }
+    }
+
+    {
+        if (auto bitmap_filter_cache = context.getBitmapFilterCache())
+        {
+            set("BitmapFilterCacheBytes", bitmap_filter_cache->weight());
+            set("BitmapFilterCacheEntries", bitmap_filter_cache->count());
+        }
+    }
+
     {
         if (auto uncompressed_cache = context.getUncompressedCache())
         {
@@ -308,6 +335,9 @@ void AsynchronousMetrics::update()
         set("LogNums", usage.total_log_file_num);
         set("LogDiskBytes", usage.total_log_disk_size);
         set("PagesInMem", usage.num_pages);
+        set("PageCacheBytes", usage.page_cache_bytes);
+        set("PageCacheHits", usage.page_cache_hits);
+        set("PageCacheMisses", usage.page_cache_misses);
     }
 
     if (context.getSharedContextDisagg()->isDisaggregatedStorageMode())
@@ -54,9 +54,13 @@
 #include <Server/RaftConfigParser.h>
 #include <Server/ServerInfo.h>
 #include <Storages/BackgroundProcessingPool.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
 #include <Storages/DeltaMerge/ColumnFile/ColumnFileSchema.h>
 #include <Storages/DeltaMerge/DeltaIndexManager.h>
+#include <Storages/DeltaMerge/File/DMFilePackCache.h>
+#include <Storages/DeltaMerge/Index/BloomFilterIndex.h>
 #include <Storages/DeltaMerge/Index/MinMaxIndex.h>
+#include <Storages/DeltaMerge/StableResultCache.h>
 #include <Storages/DeltaMerge/StoragePool.h>
 #include <Storages/IStorage.h>
 #include <Storages/KVStore/BackgroundService.h>
@@ -148,6 +152,10 @@ struct ContextShared
     mutable DBGInvoker dbg_invoker; /// Execute inner functions, debug only.
     mutable MarkCachePtr mark_cache; /// Cache of marks in compressed files.
     mutable DM::MinMaxIndexCachePtr minmax_index_cache; /// Cache of minmax index in compressed files.
+    mutable DM::BloomFilterIndexCachePtr bloom_filter_index_cache; /// Cache of bloom filter index in DTFiles.
+    mutable DM::StableResultCachePtr stable_result_cache; /// Cache of the blocks read from the stable of segments.
+    mutable DM::BitmapFilterCachePtr bitmap_filter_cache; /// Cache of the bitmap filters of segment snapshots.
+    mutable DM::DMFilePackCachePtr dmfile_pack_cache; /// Cache of the decoded columns of DTFile packs.
     mutable DM::DeltaIndexManagerPtr delta_index_manager; /// Manage the Delta Indies of Segments.
     ProcessList process_list; /// Executing queries at the moment.
     ViewDependencies view_dependencies; /// Current dependencies
@@ -1402,6 +1410,98 @@ void Context::dropMinMaxIndexCache() const
         shared->minmax_index_cache->reset();
 }
 
+void Context::setBloomFilterIndexCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->bloom_filter_index_cache)
+        throw Exception("Bloom filter index cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->bloom_filter_index_cache = std::make_shared<DM::BloomFilterIndexCache>(cache_size_in_bytes);
+}
+
+DM::BloomFilterIndexCachePtr Context::getBloomFilterIndexCache() const
+{
+    auto lock = getLock();
+    return shared->bloom_filter_index_cache;
+}
+
+void Context::dropBloomFilterIndexCache() const
+{
+    auto lock = getLock();
+    if (shared->bloom_filter_index_cache)
+        shared->bloom_filter_index_cache->reset();
+}
+
+void Context::setStableResultCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->stable_result_cache)
+        throw Exception("Stable result cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->stable_result_cache = std::make_shared<DM::StableResultCache>(cache_size_in_bytes);
+}
+
+DM::StableResultCachePtr Context::getStableResultCache() const
+{
+    auto lock = getLock();
+    return shared->stable_result_cache;
+}
+
+void Context::dropStableResultCache() const
+{
+    auto lock = getLock();
+    if (shared->stable_result_cache)
+        shared->stable_result_cache->reset();
+}
+
+void Context::setBitmapFilterCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->bitmap_filter_cache)
+        throw Exception("Bitmap filter cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->bitmap_filter_cache = std::make_shared<DM::BitmapFilterCache>(cache_size_in_bytes);
+}
+
+DM::BitmapFilterCachePtr Context::getBitmapFilterCache() const
+{
+    auto lock = getLock();
+    return shared->bitmap_filter_cache;
+}
+
+void Context::dropBitmapFilterCache() const
+{
+    auto lock = getLock();
+    if (shared->bitmap_filter_cache)
+        shared->bitmap_filter_cache->reset();
+}
+
+void Context::setDMFilePackCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->dmfile_pack_cache)
+        throw Exception("DMFile pack cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->dmfile_pack_cache = std::make_shared<DM::DMFilePackCache>(cache_size_in_bytes);
+}
+
+DM::DMFilePackCachePtr Context::getDMFilePackCache() const
+{
+    auto lock = getLock();
+    return shared->dmfile_pack_cache;
+}
+
+void Context::dropDMFilePackCache() const
+{
+    auto lock = getLock();
+    if (shared->dmfile_pack_cache)
+        shared->dmfile_pack_cache->reset();
+}
+
 bool Context::isDeltaIndexLimited() const
 {
     // Don't need to use a lock here, as delta_index_manager should be set at starting up.
@@ -1776,7 +1876,13 @@ void Context::initializeWriteNodePageStorageIfNeed(const PathPool & path_pool)
         RUNTIME_CHECK(shared->ps_write == nullptr);
         try
         {
+            const auto & settings = getSettingsRef();
             PageStorageConfig config;
+            config.blob_compression_method_raft_data = settings.kvstore_page_compression_method;
+            // The pages of delta, stable and segment metadata are all the normal pages in the universal PageStorage
+            config.blob_page_cache_size = settings.dt_page_cache_size_log + settings.dt_page_cache_size_data
+                + settings.dt_page_cache_size_meta;
+            config.blob_page_cache_size_raft_data = settings.kvstore_page_cache_size;
             shared->ps_write = UniversalPageStorageService::create( //
                 *this,
                 "uni_write",
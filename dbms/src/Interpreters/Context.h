@@ -107,6 +107,10 @@ enum class PageStorageRunMode : UInt8;
 namespace DM
 {
 class MinMaxIndexCache;
+class BloomFilterIndexCache;
+class StableResultCache;
+class BitmapFilterCache;
+class DMFilePackCache;
 class DeltaIndexManager;
 class GlobalStoragePool;
 class SharedBlockSchemas;
@@ -394,6 +398,22 @@ public:
     std::shared_ptr<DM::MinMaxIndexCache> getMinMaxIndexCache() const;
     void dropMinMaxIndexCache() const;
 
+    void setBloomFilterIndexCache(size_t cache_size_in_bytes);
+    std::shared_ptr<DM::BloomFilterIndexCache> getBloomFilterIndexCache() const;
+    void dropBloomFilterIndexCache() const;
+
+    void setStableResultCache(size_t cache_size_in_bytes);
+    std::shared_ptr<DM::StableResultCache> getStableResultCache() const;
+    void dropStableResultCache() const;
+
+    void setBitmapFilterCache(size_t cache_size_in_bytes);
+    std::shared_ptr<DM::BitmapFilterCache> getBitmapFilterCache() const;
+    void dropBitmapFilterCache() const;
+
+    void setDMFilePackCache(size_t cache_size_in_bytes);
+    std::shared_ptr<DM::DMFilePackCache> getDMFilePackCache() const;
+    void dropDMFilePackCache() const;
+
     bool isDeltaIndexLimited() const;
     void setDeltaIndexManager(size_t cache_size_in_bytes);
     std::shared_ptr<DM::DeltaIndexManager> getDeltaIndexManager() const;
@@ -16,6 +16,7 @@
 #include <Columns/ColumnsCommon.h>
 #include <Common/ColumnsHashing.h>
 #include <Common/FailPoint.h>
+#include <Common/TiFlashMetrics.h>
 #include <Common/typeid_cast.h>
 #include <Core/AutoSpillTrigger.h>
 #include <Core/ColumnNumbers.h>
@@ -127,6 +128,7 @@ Join::Join(
     const String & match_helper_name_,
     const String & flag_mapped_entry_helper_name_,
     size_t probe_cache_column_threshold_,
+    size_t probe_prefetch_batch_size_,
     bool is_test_,
     const std::vector<RuntimeFilterPtr> & runtime_filter_list_)
     : restore_config(restore_config_)
@@ -151,6 +153,7 @@ Join::Join(
           shallow_copy_cross_probe_threshold_ > 0 ? shallow_copy_cross_probe_threshold_
                                                   : std::max(1, max_block_size / 10))
     , probe_cache_column_threshold(probe_cache_column_threshold_)
+    , probe_prefetch_batch_size(probe_prefetch_batch_size_)
     , output_columns(output_columns_)
     , is_test(is_test_)
     , log(Logger::get(
@@ -185,7 +188,7 @@ Join::Join(
         probe_spill_config,
         max_bytes_before_external_join,
         log);
-    size_t max_restore_round = 4;
+    size_t max_restore_round = restore_config.max_restore_round;
 #ifdef DBMS_PUBLIC_GTEST
     max_restore_round = MAX_RESTORE_ROUND_IN_GTEST;
 #endif
@@ -367,7 +370,11 @@ std::shared_ptr<Join> Join::createRestoreJoin(size_t max_bytes_before_external_j
             fmt::format("{}_{}_build", join_req_id, restore_config.restore_round + 1)),
         hash_join_spill_context->createProbeSpillConfig(
             fmt::format("{}_{}_probe", join_req_id, restore_config.restore_round + 1)),
-        RestoreConfig{restore_config.join_restore_concurrency, restore_config.restore_round + 1, restore_partition_id},
+        RestoreConfig{
+            restore_config.join_restore_concurrency,
+            restore_config.restore_round + 1,
+            restore_partition_id,
+            restore_config.max_restore_round},
         output_columns,
         register_operator_spill_context,
         auto_spill_trigger,
@@ -378,6 +385,7 @@ std::shared_ptr<Join> Join::createRestoreJoin(size_t max_bytes_before_external_j
         match_helper_name,
         flag_mapped_entry_helper_name,
         probe_cache_column_threshold,
+        probe_prefetch_batch_size,
         is_test);
     /// init output names after finalize, the restored join don't need to finalize
     ret->output_columns_after_finalize = output_columns_after_finalize;
@@ -1440,7 +1448,8 @@ Block Join::joinBlockHash(ProbeProcessInfo & probe_process_info) const
         isEnableSpill(),
         hash_join_spill_context->isSpilled(),
         build_concurrency,
-        restore_config.restore_round};
+        restore_config.restore_round,
+        probe_prefetch_batch_size};
     probe_process_info.prepareForHashProbe(
         key_names_left,
         non_equal_conditions.left_filter_column,
@@ -1766,7 +1775,8 @@ Block Join::joinBlockSemi(ProbeProcessInfo & probe_process_info) const
         isEnableSpill(),
         hash_join_spill_context->isSpilled(),
         build_concurrency,
-        restore_config.restore_round};
+        restore_config.restore_round,
+        probe_prefetch_batch_size};
 
     probe_process_info.prepareForHashProbe(
         key_names_left,
@@ -2003,7 +2013,16 @@ void Join::finalizeBuild()
         build_finished = true;
         build_cv.notify_all();
     }
-    LOG_INFO(log, "build finalize with {} entries from {} rows.", getTotalRowCount(), getTotalBuildInputRows());
+    UInt64 lock_wait_ns = 0;
+    for (const auto & partition : partitions)
+        lock_wait_ns += partition->getLockWaitNs();
+    GET_METRIC(tiflash_join_build_lock_wait_seconds, type_build).Observe(lock_wait_ns / 1'000'000'000.0);
+    LOG_INFO(
+        log,
+        "build finalize with {} entries from {} rows, partition lock wait {:.3f}ms.",
+        getTotalRowCount(),
+        getTotalBuildInputRows(),
+        lock_wait_ns / 1'000'000.0);
 }
 
 void Join::workAfterBuildFinish(size_t stream_index)
@@ -2119,6 +2138,31 @@ void Join::finalizeCrossJoinBuild()
         blocks.push_back(merged_block);
         original_blocks.push_back(merged_block);
     }
+    else if (original_blocks.size() > 1)
+    {
+        /// each right block is a tile of the cross probe, and the other conditions are evaluated on the tile, squash
+        /// the small right blocks into blocks of about max_block_size rows, so that the tiles are not too small
+        Blocks squashed_blocks;
+        Blocks pending_blocks;
+        size_t pending_rows = 0;
+        for (auto & block : original_blocks)
+        {
+            if (pending_rows > 0 && pending_rows + block.rows() > max_block_size)
+            {
+                squashed_blocks.push_back(vstackBlocks(std::move(pending_blocks)));
+                pending_blocks.clear();
+                pending_rows = 0;
+            }
+            pending_rows += block.rows();
+            pending_blocks.push_back(std::move(block));
+        }
+        if (!pending_blocks.empty())
+            squashed_blocks.push_back(vstackBlocks(std::move(pending_blocks)));
+        blocks.clear();
+        original_blocks = std::move(squashed_blocks);
+        for (const auto & block : original_blocks)
+            blocks.push_back(block);
+    }
     /// since shallow_copy_probe_threshold is at least 1, if strictness is any, it will never use SHALLOW_COPY_RIGHT_BLOCK
     cross_probe_mode = right_rows_to_be_added_when_matched_for_cross_join > shallow_copy_cross_probe_threshold
         ? CrossProbeMode::SHALLOW_COPY_RIGHT_BLOCK
@@ -2131,11 +2175,20 @@ void Join::finalizeProfileInfo()
     profile_info->is_spill_enabled = isEnableSpill();
     profile_info->is_spilled = isSpilled();
     profile_info->peak_build_bytes_usage = getPeakBuildBytesUsage();
+    profile_info->build_rows = total_input_build_rows;
+    profile_info->probe_rows = total_input_probe_rows;
 }
 
 void Join::workAfterProbeFinish(size_t stream_index)
 {
     finalizeProfileInfo();
+    /// The optimizer should choose the smaller side to build, log it so that a bad estimation can be found out.
+    if (profile_info->probe_rows > 0 && profile_info->build_rows > 2 * profile_info->probe_rows)
+        LOG_INFO(
+            log,
+            "The build side has more rows than the probe side, build rows: {}, probe rows: {}",
+            profile_info->build_rows,
+            profile_info->probe_rows);
 
     if (isEnableSpill())
     {
@@ -2242,6 +2295,10 @@ Block Join::joinBlock(ProbeProcessInfo & probe_process_info, bool dry_run) const
     }
     std::shared_lock lock(rwlock);
 
+    /// A probe block may be joined in several rounds, only count it in the first round.
+    if (!probe_process_info.prepare_for_probe_done)
+        total_input_probe_rows.fetch_add(probe_process_info.block.rows(), std::memory_order_relaxed);
+
     Block block{};
 
     using enum ASTTableJoin::Kind;
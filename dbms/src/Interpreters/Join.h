@@ -42,6 +42,9 @@ struct JoinProfileInfo
     UInt64 peak_build_bytes_usage = 0;
     bool is_spill_enabled = false;
     bool is_spilled = false;
+    /// The rows of the build side and the probe side, compare them to see if the smaller side is used to build.
+    UInt64 build_rows = 0;
+    UInt64 probe_rows = 0;
 };
 using JoinProfileInfoPtr = std::shared_ptr<JoinProfileInfo>;
 
@@ -102,6 +105,8 @@ struct RestoreConfig
     Int64 join_restore_concurrency;
     size_t restore_round;
     size_t restore_partition_id;
+    // Spilling is disabled in the restore join of this round, so that restoring always terminates.
+    size_t max_restore_round;
 };
 
 /** Data structure for implementation of JOIN.
@@ -181,6 +186,7 @@ public:
         const String & match_helper_name_,
         const String & flag_mapped_entry_helper_name_,
         size_t probe_cache_column_threshold_,
+        size_t probe_prefetch_batch_size_,
         bool is_test,
         const std::vector<RuntimeFilterPtr> & runtime_filter_list_ = dummy_runtime_filter_list);
 
@@ -404,6 +410,7 @@ private:
     size_t right_rows_to_be_added_when_matched_for_cross_join = 0;
     size_t shallow_copy_cross_probe_threshold;
     size_t probe_cache_column_threshold;
+    size_t probe_prefetch_batch_size;
 
     JoinMapMethod join_map_method = JoinMapMethod::EMPTY;
 
@@ -431,6 +438,7 @@ private:
     const LoggerPtr log;
 
     std::atomic<size_t> total_input_build_rows{0};
+    mutable std::atomic<size_t> total_input_probe_rows{0};
 
     /** Protect state for concurrent use in insertFromBlock and joinBlock.
       * Note that these methods could be called simultaneously only while use of StorageJoin,
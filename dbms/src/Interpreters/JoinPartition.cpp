@@ -15,6 +15,7 @@
 #include <Common/Arena.h>
 #include <Common/ColumnsHashing.h>
 #include <Common/FailPoint.h>
+#include <Common/Stopwatch.h>
 #include <Interpreters/JoinPartition.h>
 #include <Interpreters/NullAwareSemiJoinHelper.h>
 #include <Interpreters/ProbeProcessInfo.h>
@@ -326,7 +327,14 @@ void JoinPartition::insertBlockForProbe(Block && block)
 }
 std::unique_lock<std::mutex> JoinPartition::lockPartition()
 {
-    return std::unique_lock(partition_mutex);
+    std::unique_lock lock(partition_mutex, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        Stopwatch watch;
+        lock.lock();
+        lock_wait_ns.fetch_add(watch.elapsed(), std::memory_order_relaxed);
+    }
+    return lock;
 }
 std::unique_lock<std::mutex> JoinPartition::tryLockPartition()
 {
@@ -1506,10 +1514,40 @@ void NO_INLINE probeBlockImplTypeCase(
     }
 
     const auto & build_hash_data = probe_process_info.hash_join_data->hash_data->getData();
+    /// When the rows are dispatched by the hash value of the hash table, hash the keys of a batch of rows and
+    /// prefetch their cells before looking them up, so that the cache misses of the lookups in a large hash table
+    /// overlap. The hash values are kept to avoid hashing the keys again.
+    const size_t prefetch_batch_size = join_build_info.is_spilled || need_virtual_dispatch_for_probe_block
+        ? 0
+        : join_build_info.probe_prefetch_batch_size;
+    std::vector<size_t> batch_hash_values;
+    size_t batch_begin = probe_process_info.start_row;
+    size_t batch_end = probe_process_info.start_row;
+    auto hash_and_prefetch_batch = [&]() {
+        batch_begin = batch_end;
+        batch_end = std::min(rows, batch_begin + prefetch_batch_size);
+        batch_hash_values.assign(batch_end - batch_begin, 0);
+        for (size_t row = batch_begin; row < batch_end; ++row)
+        {
+            if (has_null_map && (*null_map)[row])
+                continue;
+            auto key_holder = key_getter.getKeyHolder(row, &pool, sort_key_containers);
+            SCOPE_EXIT(keyHolderDiscardKey(key_holder));
+            auto key = keyHolderGetKey(key_holder);
+            if (ZeroTraits::check(key))
+                continue;
+            size_t hash_value = all_maps[probe_process_info.partition_index]->hash(key);
+            batch_hash_values[row - batch_begin] = hash_value;
+            all_maps[hash_value % segment_size]->prefetch(hash_value);
+        }
+    };
     size_t i;
     bool block_full = false;
     for (i = probe_process_info.start_row; i < rows; ++i)
     {
+        if (prefetch_batch_size > 0 && i == batch_end)
+            hash_and_prefetch_batch();
+
         if (has_null_map && (*null_map)[i])
         {
             if constexpr (row_flagged_map)
@@ -1538,7 +1576,8 @@ void NO_INLINE probeBlockImplTypeCase(
             bool zero_flag = ZeroTraits::check(key);
             if (!zero_flag)
             {
-                hash_value = all_maps[probe_process_info.partition_index]->hash(key);
+                hash_value = prefetch_batch_size > 0 ? batch_hash_values[i - batch_begin]
+                                                     : all_maps[probe_process_info.partition_index]->hash(key);
             }
 
             size_t segment_index = 0;
@@ -140,6 +140,8 @@ public:
     }
     std::unique_lock<std::mutex> lockPartition();
     std::unique_lock<std::mutex> tryLockPartition();
+    /// The total time blocked in `lockPartition` waiting for other threads to release the partition.
+    UInt64 getLockWaitNs() const { return lock_wait_ns.load(std::memory_order_relaxed); }
     /// use lock as the argument to force the caller acquire the lock before call them
     void releaseBuildPartitionBlocks(std::unique_lock<std::mutex> &);
     void releaseProbePartitionBlocks(std::unique_lock<std::mutex> &);
@@ -264,6 +266,7 @@ private:
     /// only update this field when spill is enabled. todo support this field in non-spill mode
     /// all writes to it is protected by lock
     std::atomic<size_t> block_data_memory_usage{0};
+    std::atomic<UInt64> lock_wait_ns{0};
     std::atomic<size_t> hash_table_pool_memory_usage{0};
     const LoggerPtr log;
 };
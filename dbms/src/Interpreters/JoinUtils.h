@@ -106,6 +106,8 @@ struct JoinBuildInfo
     bool is_spilled;
     size_t build_concurrency;
     size_t restore_round;
+    // The number of rows to hash and prefetch the hash table cells for in a batch in probe, 0 means disable prefetch
+    size_t probe_prefetch_batch_size;
     bool needVirtualDispatchForProbeBlock() const
     {
         return enable_fine_grained_shuffle || (enable_spill && !is_spilled);
@@ -31,6 +31,8 @@
 #include <Parsers/ASTLiteral.h>
 #include <TiDB/Decode/TypeMapping.h>
 
+#include <limits>
+
 
 namespace DB
 {
@@ -170,6 +172,8 @@ bool Set::insertFromBlock(const Block & block, bool fill_set_elements)
 #undef M
     }
 
+    updateDenseBitmap(*key_columns[0], rows, null_map);
+
     if (fill_set_elements)
     {
         for (size_t i = 0; i < rows; ++i)
@@ -429,12 +433,153 @@ void NO_INLINE Set::executeImplCase(
 }
 
 
+namespace
+{
+/// The bitmap costs at most as much memory as the cells of the hash set, or 8KiB for the small sets.
+constexpr UInt64 dense_bitmap_bits_per_key = 64;
+constexpr UInt64 dense_bitmap_min_bits = 65536;
+
+template <typename T>
+const T * getRawKeys(const IColumn & key_column)
+{
+    return reinterpret_cast<const T *>(key_column.getRawData().data);
+}
+
+template <typename T, bool has_null_map>
+void executeDenseBitmapImpl(
+    const T * keys,
+    UInt64 min_key,
+    const std::vector<UInt64> & bitmap,
+    ColumnUInt8::Container & vec_res,
+    bool negative,
+    size_t rows,
+    ConstNullMapPtr null_map)
+{
+    const UInt64 num_bits = bitmap.size() * 64;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        const UInt64 offset = static_cast<UInt64>(keys[i]) - min_key;
+        bool found = offset < num_bits && ((bitmap[offset / 64] >> (offset % 64)) & 1);
+        if constexpr (has_null_map)
+            found = found && !(*null_map)[i];
+        vec_res[i] = negative ^ found;
+    }
+}
+
+template <typename T>
+void executeDenseBitmapDispatch(
+    const T * keys,
+    UInt64 min_key,
+    const std::vector<UInt64> & bitmap,
+    ColumnUInt8::Container & vec_res,
+    bool negative,
+    size_t rows,
+    ConstNullMapPtr null_map)
+{
+    if (null_map)
+        executeDenseBitmapImpl<T, true>(keys, min_key, bitmap, vec_res, negative, rows, null_map);
+    else
+        executeDenseBitmapImpl<T, false>(keys, min_key, bitmap, vec_res, negative, rows, null_map);
+}
+} // namespace
+
+void Set::updateDenseBitmap(const IColumn & key_column, size_t rows, ConstNullMapPtr null_map)
+{
+    if (dense_bitmap_disabled)
+        return;
+
+    const size_t key_size = keys_size == 1 && key_column.isNumeric() ? key_column.sizeOfValueIfFixed() : 0;
+    bool added = false;
+    if (key_size == sizeof(UInt32))
+        added = addToDenseBitmap(getRawKeys<UInt32>(key_column), rows, null_map);
+    else if (key_size == sizeof(UInt64))
+        added = addToDenseBitmap(getRawKeys<UInt64>(key_column), rows, null_map);
+
+    if (!added)
+    {
+        dense_bitmap_disabled = true;
+        std::vector<UInt64>().swap(dense_bitmap);
+    }
+}
+
+template <typename T>
+bool Set::addToDenseBitmap(const T * keys, size_t rows, ConstNullMapPtr null_map)
+{
+    UInt64 min_key = std::numeric_limits<UInt64>::max();
+    UInt64 max_key = 0;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (null_map && (*null_map)[i])
+            continue;
+        min_key = std::min<UInt64>(min_key, keys[i]);
+        max_key = std::max<UInt64>(max_key, keys[i]);
+    }
+    // All keys are null
+    if (min_key > max_key)
+        return true;
+
+    if (dense_bitmap.empty())
+    {
+        const UInt64 max_bits = std::max(dense_bitmap_min_bits, getTotalRowCount() * dense_bitmap_bits_per_key);
+        if (max_key - min_key >= max_bits)
+            return false;
+        dense_min_key = min_key;
+        dense_bitmap.assign((max_key - min_key) / 64 + 1, 0);
+    }
+    else if (min_key < dense_min_key || max_key - dense_min_key >= dense_bitmap.size() * 64)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (null_map && (*null_map)[i])
+            continue;
+        const UInt64 offset = static_cast<UInt64>(keys[i]) - dense_min_key;
+        dense_bitmap[offset / 64] |= static_cast<UInt64>(1) << (offset % 64);
+    }
+    return true;
+}
+
+void Set::executeDenseBitmap(
+    const IColumn & key_column,
+    ColumnUInt8::Container & vec_res,
+    bool negative,
+    ConstNullMapPtr null_map) const
+{
+    const size_t rows = key_column.size();
+    if (key_column.sizeOfValueIfFixed() == sizeof(UInt32))
+        executeDenseBitmapDispatch(
+            getRawKeys<UInt32>(key_column),
+            dense_min_key,
+            dense_bitmap,
+            vec_res,
+            negative,
+            rows,
+            null_map);
+    else
+        executeDenseBitmapDispatch(
+            getRawKeys<UInt64>(key_column),
+            dense_min_key,
+            dense_bitmap,
+            vec_res,
+            negative,
+            rows,
+            null_map);
+}
+
 void Set::executeOrdinary(
     const ColumnRawPtrs & key_columns,
     ColumnUInt8::Container & vec_res,
     bool negative,
     ConstNullMapPtr null_map) const
 {
+    if (!dense_bitmap.empty())
+    {
+        executeDenseBitmap(*key_columns[0], vec_res, negative, null_map);
+        return;
+    }
+
     size_t rows = key_columns[0]->size();
 
     switch (data.type)
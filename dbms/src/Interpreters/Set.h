@@ -133,6 +133,26 @@ private:
 
     bool contains_null_value = false;
 
+    /** A bitmap of the keys when the set has one integer key of 4 or 8 bytes in a small range,
+      *  e.g. `a in (1, 2, ..., 1000)`. Probing it is a range check and a bit test instead of a hash table lookup.
+      * The keys are compared by their unsigned bits like the hash set does. The range is taken from the first
+      *  non-empty block, and the bitmap is disabled if the keys of later blocks fall out of it.
+      */
+    UInt64 dense_min_key = 0;
+    std::vector<UInt64> dense_bitmap;
+    bool dense_bitmap_disabled = false;
+
+    void updateDenseBitmap(const IColumn & key_column, size_t rows, ConstNullMapPtr null_map);
+
+    template <typename T>
+    bool addToDenseBitmap(const T * keys, size_t rows, ConstNullMapPtr null_map);
+
+    void executeDenseBitmap(
+        const IColumn & key_column,
+        ColumnUInt8::Container & vec_res,
+        bool negative,
+        ConstNullMapPtr null_map) const;
+
     /// If in the left part columns contains the same types as the elements of the set.
     void executeOrdinary(
         const ColumnRawPtrs & key_columns,
@@ -165,13 +165,18 @@ struct Settings
     M(SettingUInt64, dt_segment_force_merge_delta_size, 1073741824, "Delta size before force merge into stable. 1 GB by default.")                                                                                                      \
     M(SettingUInt64, dt_segment_stop_write_delta_rows, 268435456, "Delta rows before stop new writes.")                                                                                                                                 \
     M(SettingUInt64, dt_segment_stop_write_delta_size, 2147483648, "Delta size before stop new writes. 2 GB by default.")                                                                                                               \
+    M(SettingUInt64, dt_segment_slowdown_write_delta_rows, 0, "Delta rows before slowing down new writes and raising the priority of the background merge delta. 0 means disable, which is the default.")                               \
+    M(SettingUInt64, dt_segment_slowdown_write_delta_size, 0, "Delta size before slowing down new writes and raising the priority of the background merge delta. 0 means disable, which is the default.")                               \
+    M(SettingUInt64, dt_segment_slowdown_write_max_ms, 50, "The max time in milliseconds that a write is slowed down before delta reaches the threshold of force merge. It grows with the delta size.")                                 \
     M(SettingUInt64, dt_segment_delta_cache_limit_rows, 4096, "Max rows of cache in segment delta in DeltaTree Engine.")                                                                                                                \
     M(SettingUInt64, dt_segment_delta_cache_limit_size, 4194304, "Max size of cache in segment delta in DeltaTree Engine. 4 MB by default.")                                                                                            \
+    M(SettingBool, dt_compress_sealed_mem_table_files, false, "Compress the data of the column files in the MemTableSet by LZ4 once they are full, to reduce the memory usage of write-hot tables.")                                    \
     M(SettingUInt64, dt_segment_delta_small_pack_rows, 2048, "Deprecated. Reserved for backward compatibility. Use dt_segment_delta_small_column_file_rows instead")                                                                    \
     M(SettingUInt64, dt_segment_delta_small_pack_size, 8388608, "Deprecated. Reserved for backward compatibility. Use dt_segment_delta_small_column_file_size instead")                                                                 \
     M(SettingUInt64, dt_segment_delta_small_column_file_rows, 2048, "Determine whether a column file in delta is small or not. 8MB by default.")                                                                                        \
     M(SettingUInt64, dt_segment_delta_small_column_file_size, 8388608, "Determine whether a column file in delta is small or not. 8MB by default.")                                                                                     \
     M(SettingUInt64, dt_segment_stable_pack_rows, DEFAULT_MERGE_BLOCK_SIZE, "Expected stable pack rows in DeltaTree Engine.")                                                                                                           \
+    M(SettingUInt64, dt_adaptive_segment_min_reads, 0, "Adapt the stable pack rows and the segment size to the read pattern of a segment after it has been read at least this many times. 0 means disable.")                            \
     M(SettingFloat, dt_segment_wait_duration_factor, 1, "The factor of wait duration in a write stall.")                                                                                                                                \
     M(SettingUInt64, dt_bg_gc_check_interval, 60, "Background gc thread check interval, the unit is second.")                                                                                                                           \
     M(SettingInt64, dt_bg_gc_max_segments_to_check_every_round, 100, "Max segments to check in every gc round, value less than or equal to 0 means gc no segments.")                                                                    \
@@ -180,6 +185,8 @@ struct Settings
     M(SettingFloat, dt_bg_gc_delta_delete_ratio_to_trigger_gc, 0.3, "Trigger segment's gc when the ratio of delta delete range to stable exceeds this ratio.")                                                                          \
     M(SettingUInt64, dt_insert_max_rows, 0, "Max rows of insert blocks when write into DeltaTree Engine. By default 0 means no limit.")                                                                                                 \
     M(SettingBool, dt_enable_rough_set_filter, true, "Whether to parse where expression as Rough Set Index filter or not.")                                                                                                             \
+    M(SettingBool, dt_enable_topn_pushdown, true, "Push down the running threshold of a TopN on a column of the table scan, so that the packs which can not make into the TopN are skipped.")                                           \
+    M(SettingBool, dt_enable_count_pushdown, false, "Count the rows of the table scan by the pack stats without reading the data, if only the number of rows is needed by the aggregation above.")                                      \
     M(SettingBool, dt_raw_filter_range, true, "[unused] Do range filter or not when read data in raw mode in DeltaTree Engine.")                                                                                                        \
     M(SettingBool, dt_read_delta_only, false, "Only read delta data in DeltaTree Engine.")                                                                                                                                              \
     M(SettingBool, dt_read_stable_only, false, "Only read stable data in DeltaTree Engine.")                                                                                                                                            \
@@ -219,14 +226,32 @@ struct Settings
     M(SettingDouble, dt_page_gc_threshold, 0.5, "Max valid rate of deciding to do a GC in PageStorage")                                                                                                                                 \
     M(SettingDouble, dt_page_gc_threshold_raft_data, 0.05, "Max valid rate of deciding to do a GC for BlobFile storing PageData in PageStorage")                                                                                        \
     M(SettingBool, dt_enable_read_thread, true, "Enable storage read thread or not")                                                                                                                                                    \
+    M(SettingUInt64, dt_min_rows_per_read_stream, 0, "Limit the read concurrency of a table scan so that each stream reads at least this number of rows estimated by the segment snapshots. 0 means no limit.")                         \
     M(SettingUInt64, dt_max_sharing_column_bytes_for_all, 2048 * Constant::MB, "Memory limitation for data sharing of all requests. 0 means disable data sharing")                                                                      \
     M(SettingUInt64, dt_max_sharing_column_count, 5, "ColumnPtr object limitation for data sharing of each DMFileReader::Stream. 0 means disable data sharing")                                                                         \
+    M(SettingBool, dt_enable_circular_scan, true, "Let a read of a DTFile that does not need the packs in order start from the position of a concurrent read of the same DTFile and wrap around, so that they can share the packs read. Only works when data sharing is enabled") \
+    M(SettingUInt64, dt_read_ahead_packs, 0, "The number of packs to read ahead for each column of DTFiles in normal mode. 0 means disable read ahead.")                                                                                \
+    M(SettingUInt64, dt_read_ahead_packs_fast_scan, 0, "The number of packs to read ahead for each column of DTFiles in fast mode and bitmap filter mode. 0 means disable read ahead.")                                                 \
+    M(SettingBool, dt_scan_drop_page_cache, false, "Drop the page cache of the DTFile data read by the query, so that a one-off large scan does not evict the hot data of other queries and writes from the page cache.")               \
+    M(SettingUInt64, dt_decoded_pack_cache_max_read_packs, 16, "The reads of more packs of a DTFile than it bypass the decoded pack cache, so that large scans do not evict the hot packs.")                                            \
     M(SettingBool, dt_enable_bitmap_filter, true, "Use bitmap filter to read data or not")                                                                                                                                              \
     M(SettingDouble, dt_read_thread_count_scale, 1.0, "Number of read thread = number of logical cpu cores * dt_read_thread_count_scale.  Only has meaning at server startup.")                                                         \
     M(SettingDouble, dt_filecache_max_downloading_count_scale, 1.0, "Max downloading task count of FileCache = io thread count * dt_filecache_max_downloading_count_scale.")                                                            \
     M(SettingUInt64, dt_filecache_min_age_seconds, 1800, "Files of the same priority can only be evicted from files that were not accessed within `dt_filecache_min_age_seconds` seconds.")                                             \
+    M(SettingUInt64, dt_filecache_max_file_size, 0, "The files larger than this size are not downloaded to FileCache and are always read from S3 by range, so that a few large files can not evict the others. 0 means no limit.")      \
+    M(SettingBool, dt_filecache_admit_data_on_second_miss, false, "If true, the data files are downloaded to FileCache only when they are read again after the first miss, so that a large scan can not evict the hot files.")          \
     M(SettingUInt64, dt_small_file_size_threshold, 128 * 1024, "for dmfile, when the file size less than dt_small_file_size_threshold, it will be merged. If dt_small_file_size_threshold = 0, dmfile will just do as v2")              \
     M(SettingUInt64, dt_merged_file_max_size, 16 * 1024 * 1024, "Small files are merged into one or more files not larger than dt_merged_file_max_size")                                                                                \
+    M(SettingBool, dt_enable_bloom_filter_index, false, "Build bloom filter index for string columns when writing DTFile. Only take effects for DTFile format v3.")                                                                     \
+    M(SettingUInt64, dt_bloom_filter_index_bits_per_key, 10, "The number of bits for each key in the bloom filter index.")                                                                                                              \
+    M(SettingUInt64, dt_bloom_filter_index_ngram_size, 3, "The length of ngram in the bloom filter index used for LIKE. 0 means do not build ngram bloom filter.")                                                                      \
+    M(SettingUInt64, dt_bloom_filter_index_max_dictionary_size, 16, "Keep the distinct values of the packs with at most this number of distinct values in the bloom filter index, so that =, IN and LIKE can be evaluated once per distinct value. 0 means disable.") \
+    M(SettingBool, dt_enable_lightweight_compression, false, "Try the lightweight encodings (FOR and delta) for integer columns when writing DTFile. Old versions can not read these DTFiles.")                                         \
+    M(SettingUInt64, dt_dmfile_write_concurrency, 4, "The max number of threads to compress and write the columns of one DTFile concurrently. 1 means writing the columns one by one.")                                                 \
+    M(SettingUInt64, raft_snapshot_parallel_prehandle_threshold, 1073741824, "Prehandle a raft snapshot by multiple threads over its key ranges if the approximate size of its SST files exceeds this value. 1GB by default.")          \
+    M(SettingUInt64, dt_stable_result_cache_max_entry_size, 64 * 1024 * 1024, "Max bytes of the stable result of one segment to be cached, only for fast mode. 0 means do not use the cache.")                                          \
+    M(SettingUInt64, dt_late_materialization_sample_rows, 65536, "The number of rows sampled by late materialization before deciding whether to fall back to read all columns at once. 0 means never fall back.")                       \
+    M(SettingDouble, dt_late_materialization_max_passed_ratio, 0.8, "Fall back to read all columns at once when the ratio of sampled rows passing the pushed down filter is not less than this value.")                                 \
     M(SettingUInt64, dt_fetch_pages_packet_limit_size, 512 * 1024, "Response packet bytes limit of FetchDisaggPages, 0 means one page per packet")                                                                                      \
     M(SettingUInt64, dt_write_page_cache_limit_size, 2 * 1024 * 1024, "Limit size per write batch when compute node writing to PageStorage cache")                                                                                      \
     M(SettingDouble, io_thread_count_scale, 5.0, "Number of thread of IOThreadPool = number of logical cpu cores * io_thread_count_scale.  Only has meaning at server startup.")                                                        \
@@ -240,13 +265,28 @@ struct Settings
     M(SettingChecksumAlgorithm, dt_checksum_algorithm, ChecksumAlgo::XXH3, "Checksum algorithm for delta tree stable storage")                                                                                                          \
     M(SettingCompressionMethod, dt_compression_method, CompressionMethod::LZ4, "The method of data compression when writing.")                                                                                                          \
     M(SettingInt64, dt_compression_level, 1, "The compression level.")                                                                                                                                                                  \
+    M(SettingDouble, dt_compression_min_saved_ratio, 0, "Store a compressed block of DTFile uncompressed if the compression saves less than this ratio of its size, so that reading it needs no decompression. 0 means never.")         \
+    M(SettingCompressionMethod, dt_page_compression_method_log, CompressionMethod::NONE, "The method of compressing the page data in the PageStorage of delta layer. Pages with fields are not compressed.")                            \
+    M(SettingCompressionMethod, dt_page_compression_method_data, CompressionMethod::NONE, "The method of compressing the page data in the PageStorage of stable layer.")                                                                \
+    M(SettingCompressionMethod, dt_page_compression_method_meta, CompressionMethod::NONE, "The method of compressing the page data in the PageStorage of segment metadata.")                                                            \
+    M(SettingCompressionMethod, kvstore_page_compression_method, CompressionMethod::NONE, "The method of compressing the region and raft log pages in the PageStorage of KVStore.")                                                     \
+    M(SettingUInt64, dt_page_cache_size_log, 0, "The max bytes of the memory cache of the page data in the PageStorage of delta layer. 0 means disable the cache. Only take effect on restart.")                                        \
+    M(SettingUInt64, dt_page_cache_size_data, 0, "The max bytes of the memory cache of the page data in the PageStorage of stable layer. 0 means disable the cache. Only take effect on restart.")                                      \
+    M(SettingUInt64, dt_page_cache_size_meta, 0, "The max bytes of the memory cache of the page data in the PageStorage of segment metadata. 0 means disable the cache. Only take effect on restart.")                                  \
+    M(SettingUInt64, kvstore_page_cache_size, 0, "The max bytes of the memory cache of the region and raft log pages in the PageStorage of KVStore. 0 means disable the cache. Only take effect on restart.")                           \
+    M(SettingUInt64, kvstore_restore_concurrency, 8, "The number of threads to deserialize the regions when restoring KVStore. 1 means restore serially.")                                                                              \
+    M(SettingDouble, kvstore_persist_delta_ratio, 0, "Persist the changes of a region since its last full persistence instead of the whole region until the changes exceed this ratio of the region size. 0 means always persist the whole region.") \
+    M(SettingUInt64, raft_decode_concurrency, 1, "The max number of threads to decode the rows of one raft write command. 1 means decode by the applying thread only.")                                                                 \
+    M(SettingUInt64, raft_decode_min_rows_per_thread, 8192, "Decode the rows of one raft write command by multiple threads when every thread can get at least this many rows.")                                                         \
     M(SettingBool, dt_enable_ingest_check, true, "Check for illegal ranges when ingesting SST files.")                                                                                                                                  \
     \
     M(SettingInt64, remote_checkpoint_interval_seconds, 30, "The interval of uploading checkpoint to the remote store. Unit is second.")                                                                                                \
     M(SettingBool, remote_checkpoint_only_upload_manifest, true, "Only upload manifest data when uploading checkpoint")                                                                                                                 \
+    M(SettingUInt64, remote_checkpoint_dump_concurrency, 4, "The number of threads to read the page data when dumping the checkpoint data files.")                                                                                      \
     M(SettingInt64, remote_gc_method, 1, "The method of running GC task on the remote store. 1 - lifecycle, 2 - scan.")                                                                                                                 \
     M(SettingInt64, remote_gc_interval_seconds, 3600, "The interval of running GC task on the remote store. Unit is second.")                                                                                                           \
     M(SettingInt64, remote_gc_verify_consistency, 0, "Verify the consistenct of valid locks when doing GC")                                                                                                                             \
+    M(SettingUInt64, remote_gc_lock_full_scan_rounds, 1, "List all the lock files to clean the unused locks once every this number of GC rounds. In the other rounds, only the locks removed from the manifests are cleaned.")          \
     M(SettingInt64, remote_gc_min_age_seconds, 3600, "The file will NOT be compacted when the time difference between the last modification is less than this threshold")                                                               \
     M(SettingDouble, remote_gc_ratio, 0.5, "The files with valid rate less than this threshold will be compacted")                                                                                                                      \
     M(SettingInt64, remote_gc_small_size, 128 * 1024, "The files with total size less than this threshold will be compacted")                                                                                                           \
@@ -254,6 +294,7 @@ struct Settings
     \
     M(SettingInt64, fap_wait_checkpoint_timeout_seconds, 80, "The max time wait for a usable checkpoint for FAP")                                                                                                                       \
     M(SettingUInt64, fap_handle_concurrency, 25, "The number of threads for handling FAP tasks")                                                                                                                                        \
+    M(SettingUInt64, fap_restore_segment_concurrency, 8, "The number of threads for restoring the segments of one FAP task from the checkpoint")                                                                                        \
     \
     M(SettingUInt64, max_rows_in_set, 0, "Maximum size of the set (in number of elements) resulting from the execution of the IN section.")                                                                                             \
     M(SettingUInt64, rf_max_in_value_set, 1024, "Maximum size of the set (in number of elements) resulting from the execution of the RF IN Predicate.")                                                                                 \
@@ -275,6 +316,9 @@ struct Settings
     M(SettingMemoryLimit, max_memory_usage_for_all_queries, 0.80, "Maximum memory usage for processing all concurrently running queries on the server. Can either be an UInt64 (means memory limit in bytes), "                         \
                         "or be a float-point number (means memory limit in percent of total RAM, from 0.0 to 1.0). 0 or 0.0 means unlimited.")                                                                                          \
     M(SettingUInt64, bytes_that_rss_larger_than_limit, 1073741824, "How many bytes RSS(Resident Set Size) can be larger than limit(max_memory_usage_for_all_queries). Default: 1GB ")                                                   \
+    M(SettingUInt64, memory_tracker_submit_threshold, 1048576, "The bytes allocated or freed by a thread that are accumulated locally before being submitted to the memory trackers. Only has meaning at server startup.")              \
+    M(SettingUInt64, hash_table_huge_page_threshold, 0, "The hash tables not smaller than this size are advised to use transparent huge pages. 0 means disabled. Only has meaning at server startup.")                                  \
+    M(SettingBool, enable_operator_perf_events, false, "Collect the hardware counters like cycles and cache misses of each operator in pipeline mode. Linux only. Only has meaning at server startup.")                                 \
                                                                                                                                                                                                                                         \
     M(SettingUInt64, max_network_bandwidth, 0, "The maximum speed of data exchange over the network in bytes per second for a query. Zero means unlimited.")                                                                            \
     M(SettingUInt64, max_network_bytes, 0, "The maximum number of bytes (compressed) to receive or transmit over the network for execution of the query.")                                                                              \
@@ -301,6 +345,7 @@ struct Settings
     M(SettingUInt64, manual_compact_more_until_ms, 60000, "Continuously compact more segments until reaching specified elapsed time. If 0 is specified, only one segment will be compacted each round.")                                \
     M(SettingUInt64, max_bytes_before_external_join, 0, "max bytes used by join before spill, 0 as the default value, 0 means no limit")                                                                                                \
     M(SettingInt64, join_restore_concurrency, 0, "join restore concurrency, negative value means restore join serially, 0 means TiFlash choose restore concurrency automatically, 0 as the default value")                              \
+    M(SettingUInt64, join_max_restore_round, 4, "The max rounds of recursively spilling and restoring a hash join partition, the restore join of the last round does not spill")                                                        \
     M(SettingUInt64, max_cached_data_bytes_in_spiller, 1024ULL * 1024 * 20, "Max cached data bytes in spiller before spilling, 20 MB as the default value, 0 means no limit")                                                           \
     M(SettingUInt64, max_spilled_rows_per_file, 200000, "Max spilled data rows per spill file, 200000 as the default value, 0 means no limit.")                                                                                         \
     M(SettingUInt64, max_spilled_bytes_per_file, 0, "Max spilled data bytes per spill file, 0 as the default value, 0 means no limit.")                                                                                                 \
@@ -310,20 +355,27 @@ struct Settings
     M(SettingUInt64, pipeline_io_task_thread_pool_size, 0, "The size of io task thread pool. 0 means using number_of_logical_cpu_cores.")                                                                                               \
     M(SettingTaskQueueType, pipeline_cpu_task_thread_pool_queue_type, TaskQueueType::DEFAULT, "The task queue of cpu task thread pool")                                                                                                 \
     M(SettingTaskQueueType, pipeline_io_task_thread_pool_queue_type, TaskQueueType::DEFAULT, "The task queue of io task thread pool")                                                                                                   \
+    M(SettingDouble, pipeline_query_cpu_time_weight, 0.0, "Share cpu time between queries in the cpu task thread pool. A task is scheduled as if it had used the cpu time of its query divided by this weight, 0 means disabled")       \
+    M(SettingUInt64, pipeline_task_timeline_capacity, 0, "The max number of spans kept in the task timeline of a query, which is logged in the Chrome trace format when the query finishes, 0 means disabled")                          \
     M(SettingUInt64, local_tunnel_version, 2, "1: not refined, 2: refined")                                                                                                                                                             \
     M(SettingBool, force_push_down_all_filters_to_scan, false, "Push down all filters to scan, only used for test")                                                                                                                     \
     M(SettingUInt64, async_recv_version, 2, "1: reactor mode, 2: no additional threads")                                                                                                                                                \
     M(SettingUInt64, recv_queue_size, 0, "size of ExchangeReceiver queue, 0 means the size is set to data_source_mpp_task_num * 50")                                                                                                    \
     M(SettingUInt64, shallow_copy_cross_probe_threshold, 0, "minimum right rows to use shallow copy probe mode for cross join, default is max(1, max_block_size/10)")                                                                   \
     M(SettingInt64, max_buffered_bytes_in_executor, 100LL * 1024 * 1024, "The max buffered size in each executor, 0 mean unlimited, use 100MB as the default value")                                                                    \
+    M(SettingUInt64, max_buffered_bytes_in_exchange_for_all_queries, 0, "The max buffered bytes in the send queues of all MPP tunnels on this node, shared fairly by the tunnels, 0 mean unlimited")                                    \
+    M(SettingInt64, max_overflow_bytes_in_slow_tunnels, 0, "The max bytes that can be queued in the slow tunnels of an exchange sender beyond their limits, so that the other tunnels are not blocked, 0 mean disabled")                \
     M(SettingUInt64, ddl_sync_interval_seconds, 60, "The interval of background DDL sync schema in seconds")                                                                                                                            \
     M(SettingUInt64, ddl_restart_wait_seconds, 180, "The wait time for sync schema in seconds when restart")                                                                                                                            \
     M(SettingDouble, auto_memory_revoke_trigger_threshold, 0.0, "Trigger auto memory revocation when the memory usage is above this percentage.")                                                                                       \
+    M(SettingUInt64, remote_read_concurrency, 0, "The number of coprocessor requests sent concurrently for remote read, 0 means max_threads. Fetching is IO bound, so it can be larger than max_threads.")                              \
     M(SettingUInt64, remote_read_queue_size, 0, "size of remote read queue, 0 means it is determined automatically")                                                                                                                    \
     M(SettingBool, enable_cop_stream_for_remote_read, false, "Enable cop stream for remote read")                                                                                                                                        \
     M(SettingUInt64, cop_timeout_for_remote_read, 60, "cop timeout seconds for remote read")                                                                                                                                            \
     M(SettingUInt64, auto_spill_check_min_interval_ms, 10, "The minimum interval in millisecond between two successive auto spill check, default value is 100, 0 means no limit")                                                        \
     M(SettingUInt64, join_probe_cache_columns_threshold, 1000, "The threshold that a join key will cache its output columns during probe stage, 0 means never cache")
+    M(SettingUInt64, join_probe_prefetch_batch_size, 0, "The number of rows hash join probe hashes and prefetches in a batch, 0 means no prefetch")                 \
+    M(SettingUInt64, agg_prefetch_batch_size, 0, "The number of rows aggregation hashes and prefetches in a batch, 0 means no prefetch")                            \
 
 
 // clang-format on
@@ -698,15 +698,17 @@ public:
             return CompressionMethod::LZ4HC;
         if (lower_str == "zstd")
             return CompressionMethod::ZSTD;
+        if (lower_str == "none")
+            return CompressionMethod::NONE;
 #if USE_QPL
         if (lower_str == "qpl")
             return CompressionMethod::QPL;
         throw Exception(
-            "Unknown compression method: '" + s + "', must be one of 'lz4', 'lz4hc', 'zstd', 'qpl'",
+            "Unknown compression method: '" + s + "', must be one of 'lz4', 'lz4hc', 'zstd', 'qpl', 'none'",
             ErrorCodes::UNKNOWN_COMPRESSION_METHOD);
 #else
         throw Exception(
-            "Unknown compression method: '" + s + "', must be one of 'lz4', 'lz4hc', 'zstd'",
+            "Unknown compression method: '" + s + "', must be one of 'lz4', 'lz4hc', 'zstd', 'none'",
             ErrorCodes::UNKNOWN_COMPRESSION_METHOD);
 #endif
     }
@@ -714,12 +716,11 @@ public:
     String toString() const
     {
 #if USE_QPL
-        const char * strings[] = {nullptr, "lz4", "lz4hc", "zstd", "qpl"};
-        auto compression_method_last = CompressionMethod::QPL;
+        const char * strings[] = {nullptr, "lz4", "lz4hc", "zstd", "qpl", "none"};
 #else
-        const char * strings[] = {nullptr, "lz4", "lz4hc", "zstd"};
-        auto compression_method_last = CompressionMethod::ZSTD;
+        const char * strings[] = {nullptr, "lz4", "lz4hc", "zstd", "none"};
 #endif
+        auto compression_method_last = CompressionMethod::NONE;
 
         if (value < CompressionMethod::LZ4 || value > compression_method_last)
             throw Exception("Unknown compression method", ErrorCodes::UNKNOWN_COMPRESSION_METHOD);
@@ -15,6 +15,7 @@
 #include <Interpreters/Context.h>
 #include <Interpreters/SharedContexts/Disagg.h>
 #include <Storages/DeltaMerge/Remote/DataStore/DataStoreS3.h>
+#include <Storages/DeltaMerge/Remote/RNDMFileCache.h>
 #include <Storages/DeltaMerge/Remote/RNDeltaIndexCache.h>
 #include <Storages/DeltaMerge/Remote/RNLocalPageCache.h>
 #include <Storages/DeltaMerge/Remote/WNDisaggSnapshotManager.h>
@@ -83,6 +84,21 @@ void SharedContextDisagg::initReadNodeDeltaIndexCache(size_t max_size)
     }
 }
 
+void SharedContextDisagg::initReadNodeDMFileCache(size_t max_count)
+{
+    RUNTIME_CHECK(rn_dmfile_cache == nullptr);
+
+    if (max_count > 0)
+    {
+        LOG_INFO(Logger::get(), "Initialize Read Node DMFile cache, max_count={}", max_count);
+        rn_dmfile_cache = std::make_shared<DM::Remote::RNDMFileCache>(max_count);
+    }
+    else
+    {
+        LOG_INFO(Logger::get(), "Skipped initialize Read Node DMFile cache");
+    }
+}
+
 void SharedContextDisagg::initWriteNodeSnapManager()
 {
     RUNTIME_CHECK(wn_snapshot_manager == nullptr);
@@ -19,6 +19,7 @@
 #include <Interpreters/Context_fwd.h>
 #include <Interpreters/SharedContexts/Disagg_fwd.h>
 #include <Storages/DeltaMerge/Remote/DataStore/DataStore_fwd.h>
+#include <Storages/DeltaMerge/Remote/RNDMFileCache_fwd.h>
 #include <Storages/DeltaMerge/Remote/RNDeltaIndexCache_fwd.h>
 #include <Storages/DeltaMerge/Remote/RNLocalPageCache_fwd.h>
 #include <Storages/DeltaMerge/Remote/WNDisaggSnapshotManager_fwd.h>
@@ -69,6 +70,10 @@ struct SharedContextDisagg : private boost::noncopyable
     /// It is a cache for the delta index, stores in the memory.
     DB::DM::Remote::RNDeltaIndexCachePtr rn_delta_index_cache;
 
+    /// Only for read node.
+    /// It is a cache for the DMFiles restored from the remote data store, stores in the memory.
+    DB::DM::Remote::RNDMFileCachePtr rn_dmfile_cache;
+
     static SharedContextDisaggPtr create(Context & global_context_)
     {
         return std::make_shared<SharedContextDisagg>(global_context_);
@@ -85,6 +90,9 @@ struct SharedContextDisagg : private boost::noncopyable
     /// **many** of delta index will be maintained.
     void initReadNodeDeltaIndexCache(size_t max_size);
 
+    /// Note that the unit of max_count is quantity, not byte size. 0 means the cache is disabled.
+    void initReadNodeDMFileCache(size_t max_count);
+
     void initWriteNodeSnapManager();
 
     void initRemoteDataStore(const FileProviderPtr & file_provider, bool s3_enabled);
@@ -70,6 +70,48 @@ ALWAYS_INLINE static inline bool NeedCollation(const IColumn * column, const Sor
     return true;
 }
 
+/// Comparing strings with a generic collator decodes both of them in every comparison, which is done O(n log n) times.
+/// Such columns are replaced by the sort keys of the collator, which are built once per row and compared as binary.
+ALWAYS_INLINE static inline bool NeedSortKey(const SortColumnDescription & description)
+{
+    return description.collator && !description.collator->isPaddingBinary()
+        && description.collator->getCollatorType() != TiDB::ITiDBCollator::CollatorType::BINARY;
+}
+
+static ColumnPtr buildSortKeyColumn(const IColumn & column, const TiDB::ITiDBCollator & collator)
+{
+    if (const auto * nullable_column = typeid_cast<const ColumnNullable *>(&column))
+        return ColumnNullable::create(
+            buildSortKeyColumn(nullable_column->getNestedColumn(), collator),
+            nullable_column->getNullMapColumnPtr());
+
+    const auto & string_column = typeid_cast<const ColumnString &>(column);
+    size_t size = string_column.size();
+    auto sort_key_column = ColumnString::create();
+    sort_key_column->reserve(size);
+    std::string container;
+    for (size_t i = 0; i < size; ++i)
+    {
+        auto str = string_column.getDataAt(i);
+        auto sort_key = collator.sortKey(str.data, str.size, container);
+        sort_key_column->insertData(sort_key.data, sort_key.size);
+    }
+    return sort_key_column;
+}
+
+/// Replace the columns that need sort keys in `columns_with_sort_desc`, the sort key columns are kept in `holder`.
+static void replaceWithSortKeyColumns(ColumnsWithSortDescriptions & columns_with_sort_desc, Columns & holder)
+{
+    for (auto & [column, description] : columns_with_sort_desc)
+    {
+        if (!NeedSortKey(description) || !NeedCollation(column, description))
+            continue;
+        holder.push_back(buildSortKeyColumn(*column, *description.collator));
+        column = holder.back().get();
+        description.collator = nullptr;
+    }
+}
+
 #define APPLY_FOR_TYPE(M) \
     M(UInt64)             \
     M(Int64)              \
@@ -411,8 +453,17 @@ void sortBlock(Block & block, const SortDescription & description, size_t limit)
             ? block.getByName(description[0].column_name).column.get()
             : block.safeGetByPosition(description[0].column_number).column.get();
 
+        ColumnPtr sort_key_column;
+        if (NeedSortKey(description[0]) && NeedCollation(column, description[0]))
+        {
+            sort_key_column = buildSortKeyColumn(*column, *description[0].collator);
+            column = sort_key_column.get();
+        }
+
         IColumn::Permutation perm;
-        if (NeedCollation(column, description[0]))
+        if (sort_key_column)
+            column->getPermutation(reverse, limit, description[0].nulls_direction, perm);
+        else if (NeedCollation(column, description[0]))
             column->getPermutation(*description[0].collator, reverse, limit, description[0].nulls_direction, perm);
         else
             column->getPermutation(reverse, limit, description[0].nulls_direction, perm);
@@ -432,6 +483,8 @@ void sortBlock(Block & block, const SortDescription & description, size_t limit)
             limit = 0;
 
         ColumnsWithSortDescriptions columns_with_sort_desc = getColumnsWithSortDescription(block, description);
+        Columns sort_key_columns;
+        replaceWithSortKeyColumns(columns_with_sort_desc, sort_key_columns);
         const auto collator_desc = FastSortDesc{columns_with_sort_desc};
         if (collator_desc.can_use_fast_path)
         {
@@ -143,5 +143,38 @@ try
 }
 CATCH
 
+TEST_F(BlockSort, GenericCollation)
+try
+{
+    const auto * collator = TiDB::ITiDBCollator::getCollator(TiDB::ITiDBCollator::UTF8MB4_UNICODE_CI);
+    /// In case insensitive order: NULL, "ab", "aC", "BB", "Bc "
+    const ColumnsWithTypeAndName ori_col
+        = {toVec<Int64>(col_name[0], ColumnWithInt64{3, 0, 2, 1, 4}),
+           toVec<String>(col_name[1], ColumnWithString{"BB", "", "aC", "ab", "Bc "}),
+           toNullableVec<String>(col_name[2], {"BB", {}, "aC", "ab", "Bc "}),
+           toVec<Int64>(col_name[3], ColumnWithInt64{0, 0, 0, 0, 0})};
+    for (size_t sort_col_index : {1, 2})
+    {
+        for (bool multi_columns : {false, true})
+        {
+            for (int direction : {-1, 1})
+            {
+                Block block(ori_col);
+                SortDescription description;
+                if (multi_columns)
+                    description.emplace_back(ori_col[3].name, direction, 0, nullptr);
+                description.emplace_back(ori_col[sort_col_index].name, direction, -1, collator);
+                sortBlock(block, description, 0);
+                const auto * col_0 = typeid_cast<const ColumnInt64 *>(block.getByPosition(0).column.get());
+                ASSERT_TRUE(col_0);
+                ASSERT_EQ(col_0->size(), 5);
+                for (size_t i = 0; i < col_0->size(); ++i)
+                    ASSERT_EQ(col_0->getElement(i), direction > 0 ? i : 4 - i);
+            }
+        }
+    }
+}
+CATCH
+
 } // namespace tests
 } // namespace DB
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/Logger.h>
+#include <Core/NodeOperatorSpillContexts.h>
 #include <Core/QueryOperatorSpillContexts.h>
 #include <Encryption/FileProvider.h>
 #include <Encryption/MockKeyManager.h>
@@ -178,5 +179,56 @@ try
     sort_spill_context_3->finishOneSpill();
 }
 CATCH
+
+TEST_F(TestQueryOperatorSpillContexts, TestNodeTriggerSpill)
+try
+{
+    auto sort_spill_context_1 = std::make_shared<SortSpillContext>(*spill_config_ptr, 0, logger);
+    auto sort_spill_context_2 = std::make_shared<SortSpillContext>(*spill_config_ptr, 0, logger);
+    auto task_operator_spill_contexts_1 = std::make_shared<TaskOperatorSpillContexts>();
+    auto task_operator_spill_contexts_2 = std::make_shared<TaskOperatorSpillContexts>();
+    task_operator_spill_contexts_1->registerOperatorSpillContext(sort_spill_context_1);
+    task_operator_spill_contexts_2->registerOperatorSpillContext(sort_spill_context_2);
+    auto query_operator_spill_contexts_1 = std::make_shared<QueryOperatorSpillContexts>(
+        MPPQueryId(0, 0, 0, 0, /*resource_group_name=*/"", 0, ""),
+        0);
+    auto query_operator_spill_contexts_2 = std::make_shared<QueryOperatorSpillContexts>(
+        MPPQueryId(0, 0, 0, 0, /*resource_group_name=*/"", 0, ""),
+        0);
+    query_operator_spill_contexts_1->registerTaskOperatorSpillContexts(task_operator_spill_contexts_1);
+    query_operator_spill_contexts_2->registerTaskOperatorSpillContexts(task_operator_spill_contexts_2);
+
+    NodeOperatorSpillContexts node_operator_spill_contexts(0);
+    node_operator_spill_contexts.registerQueryOperatorSpillContexts(query_operator_spill_contexts_1);
+    node_operator_spill_contexts.registerQueryOperatorSpillContexts(query_operator_spill_contexts_2);
+    /// each query is registered only once even if it has many tasks
+    node_operator_spill_contexts.registerQueryOperatorSpillContexts(query_operator_spill_contexts_1);
+    ASSERT_EQ(node_operator_spill_contexts.getQueryOperatorSpillContextsCount(), 2);
+
+    /// only the query with more revocable memory is asked to spill
+    sort_spill_context_1->updateRevocableMemory(OperatorSpillContext::MIN_SPILL_THRESHOLD * 2);
+    sort_spill_context_2->updateRevocableMemory(OperatorSpillContext::MIN_SPILL_THRESHOLD * 3);
+    ASSERT_EQ(query_operator_spill_contexts_2->totalRevocableMemories(), OperatorSpillContext::MIN_SPILL_THRESHOLD * 3);
+    ASSERT_EQ(node_operator_spill_contexts.triggerAutoSpill(OperatorSpillContext::MIN_SPILL_THRESHOLD * 2), 0);
+    ASSERT_FALSE(sort_spill_context_1->updateRevocableMemory(OperatorSpillContext::MIN_SPILL_THRESHOLD * 2));
+    ASSERT_TRUE(sort_spill_context_2->updateRevocableMemory(OperatorSpillContext::MIN_SPILL_THRESHOLD * 3));
+    sort_spill_context_2->finishOneSpill();
+
+    /// the finished queries are removed
+    query_operator_spill_contexts_2.reset();
+    ASSERT_EQ(node_operator_spill_contexts.triggerAutoSpill(OperatorSpillContext::MIN_SPILL_THRESHOLD), 0);
+    ASSERT_EQ(node_operator_spill_contexts.getQueryOperatorSpillContextsCount(), 1);
+    ASSERT_TRUE(sort_spill_context_1->updateRevocableMemory(OperatorSpillContext::MIN_SPILL_THRESHOLD * 2));
+    sort_spill_context_1->finishOneSpill();
+
+    /// the finished queries are also removed when registering new queries
+    query_operator_spill_contexts_1.reset();
+    auto query_operator_spill_contexts_3 = std::make_shared<QueryOperatorSpillContexts>(
+        MPPQueryId(0, 0, 0, 0, /*resource_group_name=*/"", 0, ""),
+        0);
+    node_operator_spill_contexts.registerQueryOperatorSpillContexts(query_operator_spill_contexts_3);
+    ASSERT_EQ(node_operator_spill_contexts.getQueryOperatorSpillContextsCount(), 1);
+}
+CATCH
 } // namespace tests
 } // namespace DB
@@ -0,0 +1,97 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Columns/ColumnsNumber.h>
+#include <Common/typeid_cast.h>
+#include <Interpreters/Set.h>
+#include <TestUtils/FunctionTestUtils.h>
+#include <TestUtils/TiFlashTestBasic.h>
+
+#include <set>
+
+namespace DB
+{
+namespace tests
+{
+class SetTest : public ::testing::Test
+{
+protected:
+    static Block createBlock(const std::vector<std::optional<Int64>> & keys)
+    {
+        return Block{createColumn<Nullable<Int64>>(keys, "k")};
+    }
+
+    static SetPtr createSet(const std::vector<std::vector<std::optional<Int64>>> & blocks)
+    {
+        auto set = std::make_shared<Set>(SizeLimits());
+        set->setHeader(createBlock({}));
+        for (const auto & keys : blocks)
+            set->insertFromBlock(createBlock(keys), false);
+        return set;
+    }
+
+    static void checkExecute(const SetPtr & set, const std::set<Int64> & expected_keys)
+    {
+        std::vector<std::optional<Int64>> probe{std::nullopt};
+        for (Int64 k = -100; k < 200'000; k += 7)
+            probe.push_back(k);
+        for (auto k : expected_keys)
+            probe.push_back(k);
+
+        for (bool negative : {false, true})
+        {
+            auto res = set->execute(createBlock(probe), negative);
+            const auto & data = typeid_cast<const ColumnUInt8 &>(*res).getData();
+            ASSERT_EQ(data.size(), probe.size());
+            for (size_t i = 0; i < probe.size(); ++i)
+            {
+                bool found = probe[i].has_value() && expected_keys.contains(*probe[i]);
+                ASSERT_EQ(data[i], negative ^ found) << "key=" << (probe[i] ? std::to_string(*probe[i]) : "null");
+            }
+        }
+    }
+};
+
+TEST_F(SetTest, DenseIntegerKeys)
+try
+{
+    std::vector<std::optional<Int64>> dense_keys{std::nullopt};
+    std::set<Int64> expected;
+    for (Int64 k = 10; k < 1000; k += 3)
+    {
+        dense_keys.push_back(k);
+        expected.insert(k);
+    }
+
+    // Probed by the bitmap
+    checkExecute(createSet({dense_keys}), expected);
+
+    // A later block within the range keeps the bitmap
+    expected.insert(11);
+    checkExecute(createSet({dense_keys, {11, std::nullopt}}), expected);
+
+    // A later block out of the range falls back to the hash set
+    expected.insert(150'000);
+    checkExecute(createSet({dense_keys, {11, 150'000}}), expected);
+
+    // Sparse keys are probed by the hash set
+    checkExecute(createSet({{1, 100'000, 199'998}}), {1, 100'000, 199'998});
+
+    // Negative keys are not dense as unsigned bits, but still correct
+    checkExecute(createSet({{-9, 0, 9}}), {-9, 0, 9});
+}
+CATCH
+
+} // namespace tests
+} // namespace DB
@@ -16,6 +16,12 @@
 
 namespace DB
 {
+namespace
+{
+/// Only check the reduction of the aggregation with enough rows, a small one costs little anyway.
+constexpr size_t low_reduction_min_rows = 1'000'000;
+} // namespace
+
 void AggregateContext::initBuild(
     const Aggregator::Params & params,
     size_t max_threads_,
@@ -132,9 +138,11 @@ void AggregateContext::initConvergentPrefix()
     double elapsed_seconds = build_watch->elapsedSeconds();
     size_t total_src_rows = 0;
     size_t total_src_bytes = 0;
+    size_t total_groups = 0;
     for (size_t i = 0; i < max_threads; ++i)
     {
         size_t rows = many_data[i]->size();
+        total_groups += rows;
         LOG_TRACE(
             log,
             "Aggregated. {} to {} rows (from {:.3f} MiB) in {:.3f} sec. ({:.3f} rows/sec., {:.3f} MiB/sec.)",
@@ -157,6 +165,16 @@ void AggregateContext::initConvergentPrefix()
         total_src_rows / elapsed_seconds,
         total_src_bytes / elapsed_seconds / 1048576.0);
 
+    /// The hash table hardly reduces the rows when the group by keys are nearly unique, such an aggregation would be
+    /// better to be done in one phase, log it so that the plan can be checked.
+    if (keys_size && total_src_rows >= low_reduction_min_rows && total_groups * 10 >= total_src_rows * 9)
+        LOG_INFO(
+            log,
+            "Aggregation has a low reduction, {} groups from {} rows in {} threads",
+            total_groups,
+            total_src_rows,
+            max_threads);
+
     if (total_src_rows == 0 && keys_size == 0 && !empty_result_for_aggregation_by_empty_set)
     {
         auto & agg_process_info = threads_data[0]->agg_process_info;
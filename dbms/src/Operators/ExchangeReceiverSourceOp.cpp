@@ -89,6 +89,16 @@ OperatorStatus ExchangeReceiverSourceOp::readImpl(Block & block)
             block = popFromBlockQueue();
             return OperatorStatus::HAS_OUTPUT;
         }
+        else if (await_status == OperatorStatus::WAITING)
+        {
+            // The receive queue is drained, output the rows squashed so far instead of going back to wait,
+            // otherwise the task will be woken up again for every small packet before the squash is done.
+            if (auto partial_block = decoder_ptr->flush(); partial_block && partial_block->rows() > 0)
+            {
+                block = std::move(*partial_block);
+                return OperatorStatus::HAS_OUTPUT;
+            }
+        }
         return await_status;
     }
 }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <Common/PerfEventCounters.h>
 #include <Common/Stopwatch.h>
 #include <Core/Block.h>
 #include <Flash/Coprocessor/RemoteExecutionSummary.h>
@@ -35,7 +36,18 @@ struct OperatorProfileInfo
     // execution time is the total time spent on current Operator
     UInt64 execution_time = 0;
 
-    ALWAYS_INLINE void anchor() { total_stopwatch.start(); }
+    // The hardware counters of the calls of current Operator, only collected if PerfEventCounters::enabled
+    const bool collect_perf_events = PerfEventCounters::enabled.load(std::memory_order_relaxed);
+    PerfEventValues perf_events;
+    PerfEventValues perf_events_anchor;
+    bool perf_events_anchored = false;
+
+    ALWAYS_INLINE void anchor()
+    {
+        total_stopwatch.start();
+        if (unlikely(collect_perf_events))
+            perf_events_anchored = PerfEventCounters::read(perf_events_anchor);
+    }
 
     ALWAYS_INLINE void updateInfoFromBlock(const Block & block)
     {
@@ -54,7 +66,18 @@ struct OperatorProfileInfo
         anchor();
     }
 
-    ALWAYS_INLINE void update() { execution_time += total_stopwatch.elapsedFromLastTime(); }
+    ALWAYS_INLINE void update()
+    {
+        execution_time += total_stopwatch.elapsedFromLastTime();
+        // Only count the calls anchored on the same thread, the time of waiting is not measured by the counters.
+        if (unlikely(perf_events_anchored))
+        {
+            PerfEventValues now;
+            if (PerfEventCounters::read(now))
+                perf_events.addDiff(perf_events_anchor, now);
+            perf_events_anchored = false;
+        }
+    }
 
     ALWAYS_INLINE void update(const Block & block)
     {
@@ -14,12 +14,15 @@
 
 #include <Interpreters/sortBlock.h>
 #include <Operators/PartialSortTransformOp.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold.h>
 
 namespace DB
 {
 OperatorStatus PartialSortTransformOp::transformImpl(Block & block)
 {
     sortBlock(block, order_desc, limit);
+    if (topn_threshold)
+        topn_threshold->update(block, limit);
     return OperatorStatus::HAS_OUTPUT;
 }
 } // namespace DB
@@ -18,6 +18,7 @@
 #include <Core/Spiller.h>
 #include <DataStreams/IBlockInputStream.h>
 #include <Operators/Operator.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold_fwd.h>
 
 namespace DB
 {
@@ -28,10 +29,12 @@ public:
         PipelineExecutorContext & exec_context_,
         const String & req_id_,
         const SortDescription & order_desc_,
-        size_t limit_)
+        size_t limit_,
+        const DM::TopNThresholdPtr & topn_threshold_ = nullptr)
         : TransformOp(exec_context_, req_id_)
         , order_desc(order_desc_)
         , limit(limit_)
+        , topn_threshold(topn_threshold_)
     {}
 
     String getName() const override { return "PartialSortTransformOp"; }
@@ -45,5 +48,7 @@ private:
     SortDescription order_desc;
     // 0 means no limit.
     size_t limit;
+    // Updated by every sorted block if not nullptr, see `PartialSortingBlockInputStream`.
+    DM::TopNThresholdPtr topn_threshold;
 };
 } // namespace DB
@@ -18,6 +18,7 @@
 #include <Common/StringUtils/StringUtils.h>
 #include <Common/TiFlashMetrics.h>
 #include <Common/TiFlashSecurity.h>
+#include <Common/config.h>
 #include <Common/setThreadName.h>
 #include <Interpreters/AsynchronousMetrics.h>
 #include <Interpreters/Context.h>
@@ -29,6 +30,7 @@
 #include <Poco/Net/HTTPServerRequest.h>
 #include <Poco/Net/HTTPServerResponse.h>
 #include <Poco/Net/SecureServerSocket.h>
+#include <Poco/TemporaryFile.h>
 #include <Server/CertificateReloader.h>
 #include <Server/MetricsPrometheus.h>
 #include <Storages/PathCapacityMetrics.h>
@@ -40,6 +42,10 @@
 #include <prometheus/gauge.h>
 #include <prometheus/text_serializer.h>
 
+#if USE_JEMALLOC
+#include <jemalloc/jemalloc.h>
+#endif
+
 namespace DB
 {
 namespace
@@ -125,6 +131,38 @@ private:
     std::vector<std::weak_ptr<prometheus::Collectable>> collectables;
 };
 
+#if USE_JEMALLOC
+/// Dump the jemalloc heap profile, which can be analyzed by `jeprof`. The profiling must be enabled when the process
+/// starts, e.g. `MALLOC_CONF=prof:true,prof_active:true,lg_prof_sample:19`, so that the sampling overhead is only paid
+/// by the nodes that need it.
+class HeapProfileHandler : public Poco::Net::HTTPRequestHandler
+{
+public:
+    void handleRequest(Poco::Net::HTTPServerRequest &, Poco::Net::HTTPServerResponse & response) override
+    {
+        bool active = false;
+        size_t sz = sizeof(active);
+        if (je_mallctl("prof.active", &active, &sz, nullptr, 0) != 0 || !active)
+        {
+            response.setStatusAndReason(Poco::Net::HTTPResponse::HTTP_SERVICE_UNAVAILABLE);
+            response.send() << "jemalloc heap profiling is not active, start the process with MALLOC_CONF=prof:true\n";
+            return;
+        }
+
+        Poco::TemporaryFile dump_file;
+        const String path = dump_file.path();
+        const char * path_ptr = path.c_str();
+        if (int ret = je_mallctl("prof.dump", nullptr, nullptr, &path_ptr, sizeof(path_ptr)); ret != 0)
+        {
+            response.setStatusAndReason(Poco::Net::HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+            response.send() << fmt::format("failed to dump the heap profile, ret={}\n", ret);
+            return;
+        }
+        response.sendFile(path, "application/octet-stream");
+    }
+};
+#endif
+
 class MetricHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory
 {
 public:
@@ -144,6 +182,12 @@ public:
             {
                 return new MetricHandler(collectables);
             }
+#if USE_JEMALLOC
+            if (uri == "/debug/pprof/heap")
+            {
+                return new HeapProfileHandler();
+            }
+#endif
         }
         return nullptr;
     }
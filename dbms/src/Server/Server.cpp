@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <AggregateFunctions/registerAggregateFunctions.h>
+#include <Common/Allocator.h>
 #include <Common/CPUAffinityManager.h>
 #include <Common/ComputeLabelHolder.h>
 #include <Common/Config/ConfigReloader.h>
@@ -21,6 +22,8 @@
 #include <Common/Exception.h>
 #include <Common/FailPoint.h>
 #include <Common/Macros.h>
+#include <Common/MemoryTracker.h>
+#include <Common/PerfEventCounters.h>
 #include <Common/RedactHelpers.h>
 #include <Common/StringUtils/StringUtils.h>
 #include <Common/ThreadManager.h>
@@ -804,6 +807,12 @@ void initThreadPool(Poco::Util::LayeredConfiguration & config)
             /*queue_size*/ default_num_threads * 2);
     }
 
+    // The columns of DTFiles written by the background tasks are compressed and written in this pool.
+    DMFileWritePool::initialize(
+        /*max_threads*/ default_num_threads,
+        /*max_free_threads*/ default_num_threads / 2,
+        /*queue_size*/ default_num_threads * 2);
+
     if (disaggregated_mode == DisaggregatedMode::Storage)
     {
         WNEstablishDisaggTaskPool::initialize(
@@ -861,6 +870,16 @@ void adjustThreadPoolSize(const Settings & settings, size_t logical_cores)
         WNEstablishDisaggTaskPool::instance->setMaxFreeThreads(max_cpu_thread_count / 2);
         WNEstablishDisaggTaskPool::instance->setQueueSize(max_cpu_thread_count * 2);
     }
+
+    if (DMFileWritePool::instance)
+    {
+        // Writing DTFiles is done by the background tasks, share the quota of the background pool.
+        size_t max_write_thread_count
+            = settings.background_pool_size ? settings.background_pool_size.get() : logical_cores;
+        DMFileWritePool::instance->setMaxThreads(max_write_thread_count);
+        DMFileWritePool::instance->setMaxFreeThreads(max_write_thread_count / 2);
+        DMFileWritePool::instance->setQueueSize(max_write_thread_count * 2);
+    }
 }
 
 void syncSchemaWithTiDB(
@@ -1295,6 +1314,9 @@ int Server::main(const std::vector<std::string> & /*args*/)
     initStorageMemoryTracker(
         settings.max_memory_usage_for_all_queries.getActualBytes(server_info.memory_info.capacity),
         settings.bytes_that_rss_larger_than_limit);
+    CurrentMemoryTracker::setSubmitThreshold(settings.memory_tracker_submit_threshold);
+    allocator_huge_page_threshold.store(settings.hash_table_huge_page_threshold, std::memory_order_relaxed);
+    PerfEventCounters::enabled.store(settings.enable_operator_perf_events, std::memory_order_relaxed);
 
     /// PageStorage run mode has been determined above
     if (!global_context->getSharedContextDisagg()->isDisaggregatedComputeMode())
@@ -1424,6 +1446,26 @@ int Server::main(const std::vector<std::string> & /*args*/)
     if (minmax_index_cache_size)
         global_context->setMinMaxIndexCache(minmax_index_cache_size);
 
+    /// Size of cache for bloom filter index, used by DeltaMerge engine.
+    size_t bloom_filter_index_cache_size = config().getUInt64("bloom_filter_index_cache_size", mark_cache_size);
+    if (bloom_filter_index_cache_size)
+        global_context->setBloomFilterIndexCache(bloom_filter_index_cache_size);
+
+    /// Size of cache for the blocks read from the stable of segments in fast mode. Disabled by default.
+    size_t stable_result_cache_size = config().getUInt64("stable_result_cache_size", 0);
+    if (stable_result_cache_size)
+        global_context->setStableResultCache(stable_result_cache_size);
+
+    /// Size of cache for the bitmap filters built by ReadMode::Bitmap. Disabled by default.
+    size_t bitmap_filter_cache_size = config().getUInt64("bitmap_filter_cache_size", 0);
+    if (bitmap_filter_cache_size)
+        global_context->setBitmapFilterCache(bitmap_filter_cache_size);
+
+    /// Size of cache for the decoded columns of DTFile packs. Disabled by default.
+    size_t dmfile_pack_cache_size = config().getUInt64("dmfile_pack_cache_size", 0);
+    if (dmfile_pack_cache_size)
+        global_context->setDMFilePackCache(dmfile_pack_cache_size);
+
     /// Size of max memory usage of DeltaIndex, used by DeltaMerge engine.
     /// - In non-disaggregated mode, its default value is 0, means unlimited, and it
     ///   controls the number of total bytes keep in the memory.
@@ -1443,6 +1485,11 @@ int Server::main(const std::vector<std::string> & /*args*/)
         // In disaggregated compute node, we will not use DeltaIndexManager to cache the delta index.
         // Instead, we use RNDeltaIndexCache.
         global_context->getSharedContextDisagg()->initReadNodeDeltaIndexCache(n);
+
+        // Cache the DMFiles restored from S3, so that their meta are not read and parsed again by every query.
+        size_t dmfile_cache_count = config().getUInt64("dmfile_cache_count", 10000);
+        LOG_INFO(log, "dmfile_cache_count={}", dmfile_cache_count);
+        global_context->getSharedContextDisagg()->initReadNodeDMFileCache(dmfile_cache_count);
     }
     else
     {
@@ -196,6 +196,15 @@ BackgroundProcessingPool::TaskHandle BackgroundProcessingPool::tryPopTask(pcg64
                 std::chrono::microseconds(
                     min_time - current_time
                     + std::uniform_int_distribution<uint64_t>(0, sleep_seconds_random_part * 1000000)(rng)));
+            // Woken up before the task is ready. Usually it is because another task is added or
+            // woken by `TaskInfo::wake` (e.g. a delta flush) and becomes ready earlier. Choose again
+            // instead of running this task ahead of its time and leaving the urgent one waiting.
+            if (Poco::Timestamp() < min_time)
+            {
+                task->concurrent_executors -= 1;
+                task = nullptr;
+                continue;
+            }
         }
         // here task != nullptr and is ready for execution
         return task;
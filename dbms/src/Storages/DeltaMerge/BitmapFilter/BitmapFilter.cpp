@@ -12,16 +12,75 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/TargetSpecific.h>
 #include <Storages/DeltaMerge/BitmapFilter/BitmapFilter.h>
 #include <Storages/DeltaMerge/DeltaMergeHelpers.h>
 #include <Storages/DeltaMerge/Segment.h>
 
+#include <bit>
+
 namespace DB::DM
 {
+namespace
+{
+constexpr UInt32 BITS_PER_WORD = 64;
+constexpr UInt64 ALL_ONES = ~static_cast<UInt64>(0);
+
+inline bool testBit(const UInt64 * words, UInt32 pos)
+{
+    return (words[pos / BITS_PER_WORD] >> (pos % BITS_PER_WORD)) & 1;
+}
+
+// Return the position of the first bit equal to `value` since `pos`, or `total_rows` if not found.
+UInt32 findNextBit(const PaddedPODArray<UInt64> & words, UInt32 total_rows, UInt32 pos, bool value)
+{
+    size_t i = pos / BITS_PER_WORD;
+    UInt64 w = (value ? words[i] : ~words[i]) & (ALL_ONES << (pos % BITS_PER_WORD));
+    while (w == 0)
+    {
+        if (++i == words.size())
+            return total_rows;
+        w = value ? words[i] : ~words[i];
+    }
+    return std::min(static_cast<UInt32>(i * BITS_PER_WORD + std::countr_zero(w)), total_rows);
+}
+
+TIFLASH_DECLARE_MULTITARGET_FUNCTION(
+    void,
+    copyBitsToBytes,
+    (words, start, limit, dst),
+    (const UInt64 * __restrict words, UInt32 start, UInt32 limit, UInt8 * __restrict dst),
+    {
+        for (UInt32 i = 0; i < limit; ++i)
+        {
+            const UInt32 pos = start + i;
+            dst[i] = (words[pos / BITS_PER_WORD] >> (pos % BITS_PER_WORD)) & 1;
+        }
+    })
+
+TIFLASH_DECLARE_MULTITARGET_FUNCTION(
+    void,
+    andBitsToBytes,
+    (words, start, limit, dst),
+    (const UInt64 * __restrict words, UInt32 start, UInt32 limit, UInt8 * __restrict dst),
+    {
+        for (UInt32 i = 0; i < limit; ++i)
+        {
+            const UInt32 pos = start + i;
+            dst[i] = dst[i] & ((words[pos / BITS_PER_WORD] >> (pos % BITS_PER_WORD)) & 1);
+        }
+    })
+} // namespace
+
 BitmapFilter::BitmapFilter(UInt32 size_, bool default_value)
-    : filter(size_, default_value)
+    : total_rows(size_)
+    , words((size_ + BITS_PER_WORD - 1) / BITS_PER_WORD, default_value ? ALL_ONES : 0)
     , all_match(default_value)
-{}
+{
+    // Keep the bits beyond `total_rows` unset so that `count` can simply add up the words.
+    if (default_value && total_rows % BITS_PER_WORD != 0)
+        words.back() = (static_cast<UInt64>(1) << (total_rows % BITS_PER_WORD)) - 1;
+}
 
 void BitmapFilter::set(BlockInputStreamPtr & stream)
 {
@@ -50,6 +109,7 @@ void BitmapFilter::set(const ColumnPtr & col, const FilterPtr & f)
 
 void BitmapFilter::set(const UInt32 * data, UInt32 size, const FilterPtr & f)
 {
+    checkMutable();
     if (size == 0)
     {
         return;
@@ -59,7 +119,7 @@ void BitmapFilter::set(const UInt32 * data, UInt32 size, const FilterPtr & f)
         for (UInt32 i = 0; i < size; i++)
         {
             UInt32 row_id = *(data + i);
-            filter[row_id] = true;
+            words[row_id / BITS_PER_WORD] |= static_cast<UInt64>(1) << (row_id % BITS_PER_WORD);
         }
     }
     else
@@ -68,63 +128,190 @@ void BitmapFilter::set(const UInt32 * data, UInt32 size, const FilterPtr & f)
         for (UInt32 i = 0; i < size; i++)
         {
             UInt32 row_id = *(data + i);
-            filter[row_id] = (*f)[i];
+            const UInt64 mask = static_cast<UInt64>(1) << (row_id % BITS_PER_WORD);
+            if ((*f)[i])
+                words[row_id / BITS_PER_WORD] |= mask;
+            else
+                words[row_id / BITS_PER_WORD] &= ~mask;
         }
     }
 }
 
 void BitmapFilter::set(UInt32 start, UInt32 limit)
 {
-    RUNTIME_CHECK(start + limit <= filter.size(), start, limit, filter.size());
-    std::fill(filter.begin() + start, filter.begin() + start + limit, true);
+    checkMutable();
+    RUNTIME_CHECK(start + limit <= total_rows, start, limit, total_rows);
+    if (limit == 0)
+        return;
+    const UInt32 end = start + limit;
+    const size_t first = start / BITS_PER_WORD;
+    const size_t last = (end - 1) / BITS_PER_WORD;
+    const UInt64 head_mask = ALL_ONES << (start % BITS_PER_WORD);
+    const UInt64 tail_mask = ALL_ONES >> (BITS_PER_WORD - 1 - (end - 1) % BITS_PER_WORD);
+    if (first == last)
+    {
+        words[first] |= head_mask & tail_mask;
+        return;
+    }
+    words[first] |= head_mask;
+    std::fill(words.begin() + first + 1, words.begin() + last, ALL_ONES);
+    words[last] |= tail_mask;
 }
 
 bool BitmapFilter::get(IColumn::Filter & f, UInt32 start, UInt32 limit) const
 {
-    RUNTIME_CHECK(start + limit <= filter.size(), start, limit, filter.size());
-    auto begin = filter.cbegin() + start;
-    auto end = filter.cbegin() + start + limit;
-    if (all_match || std::find(begin, end, false) == end)
+    RUNTIME_CHECK(start + limit <= total_rows, start, limit, total_rows);
+    if (all_match || isAllSet(start, limit))
     {
         return true;
     }
-    else
+
+    if (!run_encoded)
     {
-        std::copy(begin, end, f.begin());
+        copyBitsToBytes(words.data(), start, limit, f.data());
         return false;
     }
+
+    const UInt32 end = start + limit;
+    std::fill(f.begin(), f.begin() + limit, 0);
+    for (auto itr = findRun(start); itr != runs.cend() && itr->begin < end; ++itr)
+    {
+        const UInt32 run_begin = std::max(itr->begin, start);
+        const UInt32 run_end = std::min(itr->end, end);
+        std::fill(f.begin() + (run_begin - start), f.begin() + (run_end - start), 1);
+    }
+    return false;
 }
 
 void BitmapFilter::rangeAnd(IColumn::Filter & f, UInt32 start, UInt32 limit) const
 {
-    RUNTIME_CHECK(start + limit <= filter.size() && f.size() == limit);
-    auto begin = filter.cbegin() + start;
-    if (!all_match)
+    RUNTIME_CHECK(start + limit <= total_rows && f.size() == limit);
+    if (all_match)
     {
-        std::transform(f.begin(), f.end(), begin, f.begin(), [](const UInt8 a, const bool b) { return a != 0 && b; });
+        return;
+    }
+
+    if (!run_encoded)
+    {
+        andBitsToBytes(words.data(), start, limit, f.data());
+        return;
     }
+
+    // Only the rows between the runs need to be cleared.
+    const UInt32 end = start + limit;
+    UInt32 pos = start;
+    for (auto itr = findRun(start); itr != runs.cend() && itr->begin < end; ++itr)
+    {
+        if (itr->begin > pos)
+            std::fill(f.begin() + (pos - start), f.begin() + (itr->begin - start), 0);
+        pos = std::min(itr->end, end);
+    }
+    std::fill(f.begin() + (pos - start), f.end(), 0);
 }
 
 void BitmapFilter::runOptimize()
 {
-    all_match = std::find(filter.begin(), filter.end(), false) == filter.end();
+    if (run_encoded)
+    {
+        return;
+    }
+    all_match = count() == total_rows;
+
+    // A run starts at a set bit whose previous bit is unset.
+    size_t num_runs = 0;
+    UInt64 carry = 0;
+    for (const auto w : words)
+    {
+        num_runs += std::popcount(w & ~((w << 1) | carry));
+        carry = w >> (BITS_PER_WORD - 1);
+    }
+    if (num_runs * sizeof(Run) >= words.size() * sizeof(UInt64))
+    {
+        return;
+    }
+
+    runs.reserve(num_runs);
+    for (UInt32 pos = findNextBit(words, total_rows, 0, true); pos < total_rows;)
+    {
+        const UInt32 run_end = findNextBit(words, total_rows, pos, false);
+        runs.push_back(Run{.begin = pos, .end = run_end});
+        pos = run_end < total_rows ? findNextBit(words, total_rows, run_end, true) : total_rows;
+    }
+    PaddedPODArray<UInt64>().swap(words);
+    run_encoded = true;
 }
 
 String BitmapFilter::toDebugString() const
 {
-    String s(filter.size(), '1');
-    for (UInt32 i = 0; i < filter.size(); i++)
+    String s(total_rows, '0');
+    if (run_encoded)
     {
-        if (!filter[i])
+        for (const auto & run : runs)
+            std::fill(s.begin() + run.begin, s.begin() + run.end, '1');
+    }
+    else
+    {
+        for (UInt32 i = 0; i < total_rows; i++)
         {
-            s[i] = '0';
+            if (testBit(words.data(), i))
+                s[i] = '1';
         }
     }
-    return fmt::format("{}", s);
+    return s;
 }
 
 size_t BitmapFilter::count() const
 {
-    return std::count(filter.cbegin(), filter.cend(), true);
+    size_t n = 0;
+    if (run_encoded)
+    {
+        for (const auto & run : runs)
+            n += run.end - run.begin;
+    }
+    else
+    {
+        for (const auto w : words)
+            n += std::popcount(w);
+    }
+    return n;
+}
+
+void BitmapFilter::checkMutable() const
+{
+    RUNTIME_CHECK_MSG(!run_encoded, "BitmapFilter can not be modified after it is run encoded");
+}
+
+bool BitmapFilter::isAllSet(UInt32 start, UInt32 limit) const
+{
+    if (limit == 0)
+    {
+        return true;
+    }
+    if (run_encoded)
+    {
+        auto itr = findRun(start);
+        return itr != runs.cend() && itr->begin <= start && itr->end >= start + limit;
+    }
+
+    const UInt32 end = start + limit;
+    const size_t first = start / BITS_PER_WORD;
+    const size_t last = (end - 1) / BITS_PER_WORD;
+    const UInt64 head_mask = ALL_ONES << (start % BITS_PER_WORD);
+    const UInt64 tail_mask = ALL_ONES >> (BITS_PER_WORD - 1 - (end - 1) % BITS_PER_WORD);
+    if (first == last)
+    {
+        const UInt64 mask = head_mask & tail_mask;
+        return (words[first] & mask) == mask;
+    }
+    if ((words[first] & head_mask) != head_mask || (words[last] & tail_mask) != tail_mask)
+    {
+        return false;
+    }
+    return std::all_of(words.begin() + first + 1, words.begin() + last, [](UInt64 w) { return w == ALL_ONES; });
+}
+
+std::vector<BitmapFilter::Run>::const_iterator BitmapFilter::findRun(UInt32 start) const
+{
+    return std::partition_point(runs.cbegin(), runs.cend(), [start](const Run & run) { return run.end <= start; });
 }
-} // namespace DB::DM
\ No newline at end of file
+} // namespace DB::DM
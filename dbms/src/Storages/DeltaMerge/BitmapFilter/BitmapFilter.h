@@ -15,11 +15,15 @@
 #pragma once
 
 #include <Columns/IColumn.h>
+#include <Common/PODArray.h>
 #include <DataStreams/IBlockInputStream.h>
 
 namespace DB::DM
 {
 
+/// The rows of a segment that are visible to a read. The bitmap is built by `set` and then
+/// `runOptimize()` is called, which may convert it to a list of runs of selected rows when
+/// that is smaller. The filter is read only after `runOptimize()`.
 class BitmapFilter
 {
 public:
@@ -38,9 +42,29 @@ public:
 
     String toDebugString() const;
     size_t count() const;
+    size_t bytes() const { return words.capacity() * sizeof(UInt64) + runs.capacity() * sizeof(Run); }
+    // Whether the filter is stored as runs of selected rows, only for test.
+    bool isRunEncoded() const { return run_encoded; }
 
 private:
-    std::vector<bool> filter;
+    // The selected rows in [begin, end).
+    struct Run
+    {
+        UInt32 begin;
+        UInt32 end;
+    };
+
+    void checkMutable() const;
+    bool isAllSet(UInt32 start, UInt32 limit) const;
+    // Return the first run that ends after `start`.
+    std::vector<Run>::const_iterator findRun(UInt32 start) const;
+
+    UInt32 total_rows;
+    // One bit for each row. Cleared after the filter is converted to `runs`.
+    PaddedPODArray<UInt64> words;
+    // The sorted and non-adjacent runs of selected rows, only valid if `run_encoded` is true.
+    std::vector<Run> runs;
+    bool run_encoded = false;
     bool all_match;
 };
 
@@ -0,0 +1,81 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/FmtUtils.h>
+#include <Common/RedactHelpers.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
+#include <Storages/DeltaMerge/DMContext.h>
+#include <Storages/DeltaMerge/File/DMFile.h>
+#include <Storages/DeltaMerge/Segment.h>
+
+namespace DB::DM
+{
+namespace
+{
+void appendColumnFiles(const ColumnFileSetSnapshotPtr & snap, FmtBuffer & fmt_buf)
+{
+    // The in-memory column files are only appended, the rows tell the data in the snapshot.
+    fmt_buf.joinStr(
+        snap->getColumnFiles().cbegin(),
+        snap->getColumnFiles().cend(),
+        [](const auto & cf, FmtBuffer & fb) {
+            fb.fmtAppend("{}:{}:{}", cf->getId(), cf->getRows(), cf->getDeletes());
+        },
+        ",");
+}
+} // namespace
+
+std::optional<String> BitmapFilterCache::buildKey(
+    const DMContext & dm_context,
+    UInt64 segment_id,
+    UInt64 segment_epoch,
+    const SegmentSnapshotPtr & segment_snap,
+    const RowKeyRanges & read_ranges,
+    const RSOperatorPtr & filter)
+{
+    // The values in the filter are replaced by "?" when redact log is enabled,
+    // the debug string can not tell different filters apart.
+    if (filter && Redact::isRedactLog())
+        return std::nullopt;
+
+    FmtBuffer fmt_buf;
+    fmt_buf.fmtAppend(
+        "{}/{}/{}/{}/{}/",
+        dm_context.keyspace_id,
+        dm_context.physical_table_id,
+        segment_id,
+        segment_epoch,
+        segment_snap->stable->getId());
+    fmt_buf.joinStr(
+        segment_snap->stable->getDMFiles().cbegin(),
+        segment_snap->stable->getDMFiles().cend(),
+        [](const auto & file, FmtBuffer & fb) { fb.fmtAppend("{}:{}", file->path(), file->pageId()); },
+        ",");
+    fmt_buf.append("/");
+    appendColumnFiles(segment_snap->delta->getMemTableSetSnapshot(), fmt_buf);
+    fmt_buf.append("/");
+    appendColumnFiles(segment_snap->delta->getPersistedFileSetSnapshot(), fmt_buf);
+    fmt_buf.append("/");
+    fmt_buf.joinStr(
+        read_ranges.cbegin(),
+        read_ranges.cend(),
+        [](const auto & range, FmtBuffer & fb) { fb.append(range.toString()); },
+        ",");
+    fmt_buf.append("/");
+    if (filter)
+        fmt_buf.append(filter->toDebugString());
+    return fmt_buf.toString();
+}
+
+} // namespace DB::DM
@@ -0,0 +1,85 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilter.h>
+#include <Storages/DeltaMerge/Filter/RSOperator.h>
+#include <Storages/DeltaMerge/RowKeyRange.h>
+
+#include <optional>
+
+namespace DB
+{
+namespace DM
+{
+struct DMContext;
+struct SegmentSnapshot;
+using SegmentSnapshotPtr = std::shared_ptr<SegmentSnapshot>;
+
+/// A bitmap filter built by `ReadMode::Bitmap` with the MVCC filter of `build_version`.
+/// The bitmap only changes when there are rows whose versions are in (build_version, max_version],
+/// so it can be reused by the reads with `max_version` in [build_version, valid_until_version).
+struct CachedBitmapFilter
+{
+    BitmapFilterPtr bitmap_filter;
+    UInt64 build_version = 0;
+    // The min version of the rows which are invisible for `build_version`, exclusive.
+    UInt64 valid_until_version = 0;
+
+    bool isValidFor(UInt64 max_version) const
+    {
+        return build_version <= max_version && max_version < valid_until_version;
+    }
+};
+using CachedBitmapFilterPtr = std::shared_ptr<CachedBitmapFilter>;
+
+struct BitmapFilterWeightFunction
+{
+    size_t operator()(const String & key, const CachedBitmapFilter & cached) const
+    {
+        return cached.bitmap_filter->bytes() + key.size() + sizeof(CachedBitmapFilter) + sizeof(BitmapFilter)
+            + sizeof(std::list<String>);
+    }
+};
+
+/// Share the bitmap filters of the same segment snapshot between the concurrent reads, which usually
+/// read the segment with close `start_ts`.
+class BitmapFilterCache : public LRUCache<String, CachedBitmapFilter, std::hash<String>, BitmapFilterWeightFunction>
+{
+private:
+    using Base = LRUCache<String, CachedBitmapFilter, std::hash<String>, BitmapFilterWeightFunction>;
+
+public:
+    explicit BitmapFilterCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes)
+    {}
+
+    /// Return the cache key of the bitmap filter of `segment_snap` with the given arguments.
+    /// The key does not contain the read version, see `CachedBitmapFilter::isValidFor`.
+    /// Return std::nullopt if the bitmap filter is not cacheable.
+    static std::optional<String> buildKey(
+        const DMContext & dm_context,
+        UInt64 segment_id,
+        UInt64 segment_epoch,
+        const SegmentSnapshotPtr & segment_snap,
+        const RowKeyRanges & read_ranges,
+        const RSOperatorPtr & filter);
+};
+
+using BitmapFilterCachePtr = std::shared_ptr<BitmapFilterCache>;
+
+} // namespace DM
+} // namespace DB
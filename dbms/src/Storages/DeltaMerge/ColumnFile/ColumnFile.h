@@ -40,6 +40,8 @@ class ColumnFileBig;
 class ColumnFilePersisted;
 class ColumnFileReader;
 using ColumnFileReaderPtr = std::shared_ptr<ColumnFileReader>;
+class RSOperator;
+using RSOperatorPtr = std::shared_ptr<RSOperator>;
 
 static std::atomic_uint64_t MAX_COLUMN_FILE_ID{0};
 
@@ -85,6 +87,13 @@ public:
 
         std::mutex mutex;
         Block block;
+
+        // Only used by ColumnFileInMemory. Once a sealed ColumnFileInMemory is compressed, `block` only keeps the
+        // header and the data of each column is kept here, in the format of `serializeColumn`.
+        std::vector<String> compressed_columns;
+        size_t compressed_rows = 0;
+
+        bool isCompressed() const { return !compressed_columns.empty(); }
     };
     using CachePtr = std::shared_ptr<Cache>;
     using ColIdToOffset = std::unordered_map<ColId, size_t>;
@@ -120,6 +129,10 @@ public:
 
     bool isSame(ColumnFile * other) const { return id == other->id; }
 
+    /// Return false if there is no row in this column file can match the rough set filter.
+    /// Only ColumnFileInMemory and ColumnFileTiny may have the indexes to check it.
+    virtual bool mayMatch(const RSOperatorPtr & /*filter*/) const { return true; }
+
     ColumnFileInMemory * tryToInMemoryFile();
     ColumnFileTiny * tryToTinyFile();
     ColumnFileDeleteRange * tryToDeleteRange();
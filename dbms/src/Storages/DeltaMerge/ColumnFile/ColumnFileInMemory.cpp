@@ -12,16 +12,45 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/Exception.h>
+#include <Common/ProfileEvents.h>
+#include <IO/WriteBufferFromString.h>
 #include <Storages/DeltaMerge/ColumnFile/ColumnFileInMemory.h>
+#include <Storages/DeltaMerge/ColumnFile/ColumnFilePersisted.h>
 #include <Storages/DeltaMerge/ColumnFile/ColumnFileTiny.h>
 #include <Storages/DeltaMerge/DMContext.h>
 #include <Storages/DeltaMerge/convertColumnTypeHelpers.h>
 
+namespace ProfileEvents
+{
+extern const Event DMMemTableCompressedBytes;
+extern const Event DMMemTableDecompressedBytes;
+} // namespace ProfileEvents
 
 namespace DB
 {
 namespace DM
 {
+ColumnPtr ColumnFileInMemory::readCacheColumn(size_t col_offset) const
+{
+    const auto & col = cache->block.getByPosition(col_offset);
+    auto col_data = col.type->createColumn();
+    if (cache->isCompressed())
+    {
+        const auto & data = cache->compressed_columns[col_offset];
+        deserializeColumn(*col_data, col.type, std::string_view(data.data(), data.size()), cache->compressed_rows);
+        ProfileEvents::increment(ProfileEvents::DMMemTableDecompressedBytes, data.size());
+        if (cache->compressed_rows == rows)
+            return col_data;
+        // The snapshot may only see the first `rows` rows.
+        auto res = col.type->createColumn();
+        res->insertRangeFrom(*col_data, 0, rows);
+        return res;
+    }
+    col_data->insertRangeFrom(*col.column, 0, rows);
+    return col_data;
+}
+
 void ColumnFileInMemory::fillColumns(const ColumnDefines & col_defs, size_t col_count, Columns & result) const
 {
     if (result.size() >= col_count)
@@ -41,8 +70,7 @@ void ColumnFileInMemory::fillColumns(const ColumnDefines & col_defs, size_t col_
             auto col_offset = it->second;
             // Copy data from cache
             const auto & type = getDataType(cd.id);
-            auto col_data = type->createColumn();
-            col_data->insertRangeFrom(*(cache->block.getByPosition(col_offset).column), 0, rows);
+            auto col_data = readCacheColumn(col_offset);
             // Cast if need
             auto col_converted = convertColumnByColumnDefineIfNeed(type, std::move(col_data), cd);
             read_cols.push_back(std::move(col_converted));
@@ -91,6 +119,9 @@ bool ColumnFileInMemory::append(
         mutable_cache_col->insertRangeFrom(*col, offset, limit);
     }
 
+    auto append_indexes = ColumnFileIndexes::build(data, offset, limit);
+    indexes = indexes ? indexes->merge(*append_indexes) : append_indexes;
+
     rows += limit;
     bytes += data_bytes;
     return true;
@@ -101,12 +132,50 @@ Block ColumnFileInMemory::readDataForFlush() const
     std::scoped_lock lock(cache->mutex);
 
     auto & cache_block = cache->block;
-    MutableColumns columns = cache_block.cloneEmptyColumns();
+    Columns columns;
+    columns.reserve(cache_block.columns());
     for (size_t i = 0; i < cache_block.columns(); ++i)
-        columns[i]->insertRangeFrom(*cache_block.getByPosition(i).column, 0, rows);
+        columns.push_back(readCacheColumn(i));
     return cache_block.cloneWithColumns(std::move(columns));
 }
 
+void ColumnFileInMemory::compress()
+{
+    RUNTIME_CHECK(disable_append);
+
+    std::scoped_lock lock(cache->mutex);
+    auto & cache_block = cache->block;
+    if (cache->isCompressed() || cache_block.rows() == 0)
+        return;
+
+    std::vector<String> compressed_columns;
+    compressed_columns.reserve(cache_block.columns());
+    size_t compressed_bytes = 0;
+    for (const auto & col : cache_block)
+    {
+        String buf;
+        {
+            auto wb = WriteBufferFromString(buf);
+            serializeColumn(
+                wb,
+                *col.column,
+                col.type,
+                0,
+                cache_block.rows(),
+                CompressionMethod::LZ4,
+                CompressionSettings::getDefaultLevel(CompressionMethod::LZ4));
+        }
+        compressed_bytes += buf.size();
+        compressed_columns.push_back(std::move(buf));
+    }
+    ProfileEvents::increment(ProfileEvents::DMMemTableCompressedBytes, compressed_bytes);
+
+    cache->compressed_rows = cache_block.rows();
+    cache->compressed_columns = std::move(compressed_columns);
+    // Release the uncompressed data, only keep the header.
+    cache_block = cache_block.cloneEmpty();
+}
+
 
 ColumnPtr ColumnFileInMemoryReader::getPKColumn()
 {
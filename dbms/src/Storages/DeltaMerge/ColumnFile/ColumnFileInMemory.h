@@ -15,6 +15,7 @@
 #pragma once
 
 #include <Storages/DeltaMerge/ColumnFile/ColumnFile.h>
+#include <Storages/DeltaMerge/ColumnFile/ColumnFileIndexes.h>
 #include <Storages/DeltaMerge/ColumnFile/ColumnFileSchema.h>
 #include <Storages/DeltaMerge/Remote/Serializer_fwd.h>
 
@@ -43,9 +44,16 @@ private:
     // The cache data in memory.
     CachePtr cache;
 
+    // The indexes of the first `rows` rows in cache, updated with appending.
+    ColumnFileIndexesPtr indexes;
+
 private:
     void fillColumns(const ColumnDefines & col_defs, size_t col_count, Columns & result) const;
 
+    /// Return the first `rows` rows of the column at `col_offset` in cache, decompress it if the cache is compressed.
+    /// The caller must hold the lock of cache.
+    ColumnPtr readCacheColumn(size_t col_offset) const;
+
     const DataTypePtr & getDataType(ColId column_id) const { return schema->getDataType(column_id); }
 
 public:
@@ -55,6 +63,8 @@ public:
     {
         rows = cache->block.rows();
         bytes = cache->block.bytes();
+        if (rows > 0)
+            indexes = ColumnFileIndexes::build(cache->block, 0, rows);
     }
 
     // For deserializing a ColumnFileInMemory object without schema and data in deserializeCFInMemory.
@@ -74,6 +84,9 @@ public:
 
     ColumnFileInMemoryPtr clone() { return std::make_shared<ColumnFileInMemory>(*this); }
 
+    const ColumnFileIndexesPtr & getIndexes() const { return indexes; }
+    bool mayMatch(const RSOperatorPtr & filter) const override { return !indexes || indexes->mayMatch(filter); }
+
     ColumnFileReaderPtr getReader(
         const DMContext & context,
         const IColumnFileDataProviderPtr & data_provider,
@@ -86,6 +99,10 @@ public:
 
     Block readDataForFlush() const;
 
+    /// Compress the data in cache by LZ4 to reduce the memory usage. The data is decompressed when it is read.
+    /// Only a column file that is not appendable can be compressed, and it is a no-op if it is already compressed.
+    void compress();
+
     bool mayBeFlushedFrom(ColumnFile *) const override { return false; }
 
     String toString() const override
@@ -0,0 +1,69 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Columns/ColumnsNumber.h>
+#include <Common/typeid_cast.h>
+#include <DataTypes/DataTypeNullable.h>
+#include <Storages/DeltaMerge/ColumnFile/ColumnFileIndexes.h>
+
+namespace DB::DM
+{
+ColumnFileIndexesPtr ColumnFileIndexes::build(const Block & block, size_t offset, size_t limit)
+{
+    const ColumnVector<UInt8> * del_mark = nullptr;
+    for (const auto & col : block)
+    {
+        if (col.column_id == TAG_COLUMN_ID)
+            del_mark = typeid_cast<const ColumnVector<UInt8> *>(col.column.get());
+    }
+
+    auto indexes = std::make_shared<ColumnFileIndexes>();
+    for (const auto & col : block)
+    {
+        // The same as the columns which have minmax index in DMFile, except the handle column of the
+        // common handle tables. Its values are the encoded keys, whose byte-wise order is not the order
+        // used by the filters, so it is not indexed.
+        auto type = removeNullable(col.type);
+        if (!type->isInteger() && !type->isDateOrDateTime())
+            continue;
+
+        auto minmax = std::make_shared<MinMaxIndex>(*col.type);
+        minmax->addPack(*col.column, del_mark, offset, limit);
+        indexes->param.indexes.emplace(col.column_id, RSIndex(col.type, minmax));
+    }
+    return indexes;
+}
+
+ColumnFileIndexesPtr ColumnFileIndexes::merge(const ColumnFileIndexes & other) const
+{
+    auto indexes = std::make_shared<ColumnFileIndexes>();
+    for (const auto & [col_id, rs_index] : param.indexes)
+    {
+        auto iter = other.param.indexes.find(col_id);
+        if (iter == other.param.indexes.end())
+            continue;
+        auto minmax = MinMaxIndex::merge(*rs_index.type, *rs_index.minmax, *iter->second.minmax);
+        indexes->param.indexes.emplace(col_id, RSIndex(rs_index.type, minmax));
+    }
+    return indexes;
+}
+
+bool ColumnFileIndexes::mayMatch(const RSOperatorPtr & filter) const
+{
+    if (!filter || param.indexes.empty())
+        return true;
+    return filter->roughCheck(0, 1, param)[0] != RSResult::None;
+}
+
+} // namespace DB::DM
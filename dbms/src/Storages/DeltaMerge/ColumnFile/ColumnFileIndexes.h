@@ -0,0 +1,52 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Core/Block.h>
+#include <Storages/DeltaMerge/Filter/RSOperator.h>
+
+namespace DB
+{
+namespace DM
+{
+class ColumnFileIndexes;
+using ColumnFileIndexesPtr = std::shared_ptr<const ColumnFileIndexes>;
+
+/// The minmax indexes of the rows in a ColumnFileInMemory or ColumnFileTiny, each column has only one pack.
+/// They are used to skip the whole column file when reading the delta layer with a rough set filter.
+///
+/// The indexes are only kept in memory. They are updated when appending data to a ColumnFileInMemory,
+/// and are passed to the ColumnFileTiny flushed from it or written by minor compaction. A ColumnFileTiny
+/// restored from disk does not have indexes and is always read.
+class ColumnFileIndexes
+{
+public:
+    /// Build the indexes for the rows [offset, offset + limit) in the block.
+    static ColumnFileIndexesPtr build(const Block & block, size_t offset, size_t limit);
+
+    /// Return the indexes which cover the rows of both `this` and `other`.
+    ColumnFileIndexesPtr merge(const ColumnFileIndexes & other) const;
+
+    /// Return false if there is no row that can match the filter.
+    bool mayMatch(const RSOperatorPtr & filter) const;
+
+    size_t size() const { return param.indexes.size(); }
+
+private:
+    RSCheckParam param;
+};
+
+} // namespace DM
+} // namespace DB
@@ -16,6 +16,7 @@
 
 #include <Storages/DeltaMerge/ColumnFile/ColumnFileSetSnapshot.h>
 #include <Storages/DeltaMerge/DMContext.h>
+#include <Storages/DeltaMerge/Filter/RSOperator.h>
 #include <Storages/DeltaMerge/ScanContext.h>
 #include <Storages/DeltaMerge/SkippableBlockInputStream.h>
 
@@ -95,19 +96,25 @@ private:
     ColumnFileSetReader reader;
     ColumnFiles & column_files;
     size_t column_files_count;
+    // The column files which can not match the filter are skipped.
+    RSOperatorPtr filter;
 
     ColumnFileReaderPtr cur_column_file_reader = {};
     size_t next_file_index = 0;
+    // The rows of the column files skipped by `filter` since last `popFilteredRows`.
+    size_t filtered_rows = 0;
 
 public:
     ColumnFileSetInputStream(
         const DMContext & context_,
         const ColumnFileSetSnapshotPtr & delta_snap_,
         const ColumnDefinesPtr & col_defs_,
-        const RowKeyRange & segment_range_)
+        const RowKeyRange & segment_range_,
+        const RSOperatorPtr & filter_ = EMPTY_RS_OPERATOR)
         : reader(context_, delta_snap_, col_defs_, segment_range_)
         , column_files(reader.snapshot->getColumnFiles())
         , column_files_count(column_files.size())
+        , filter(filter_)
     {}
 
     String getName() const override { return "ColumnFileSet"; }
@@ -119,19 +126,8 @@ public:
     {
         while (cur_column_file_reader || next_file_index < column_files_count)
         {
-            if (!cur_column_file_reader)
-            {
-                if (column_files[next_file_index]->isDeleteRange())
-                {
-                    ++next_file_index;
-                    continue;
-                }
-                else
-                {
-                    cur_column_file_reader = reader.column_file_readers[next_file_index];
-                    ++next_file_index;
-                }
-            }
+            if (!cur_column_file_reader && !nextColumnFileReader())
+                continue;
             size_t skipped_rows = cur_column_file_reader->skipNextBlock();
             if (skipped_rows > 0)
                 return skipped_rows;
@@ -145,19 +141,8 @@ public:
     {
         while (cur_column_file_reader || next_file_index < column_files_count)
         {
-            if (!cur_column_file_reader)
-            {
-                if (column_files[next_file_index]->isDeleteRange())
-                {
-                    ++next_file_index;
-                    continue;
-                }
-                else
-                {
-                    cur_column_file_reader = reader.column_file_readers[next_file_index];
-                    ++next_file_index;
-                }
-            }
+            if (!cur_column_file_reader && !nextColumnFileReader())
+                continue;
             Block block = cur_column_file_reader->readNextBlock();
             if (block)
                 return block;
@@ -167,10 +152,34 @@ public:
         return {};
     }
 
+    /// Return the rows of column files skipped by the filter, which are before the next block.
+    size_t popFilteredRows() { return std::exchange(filtered_rows, 0); }
+
     Block readWithFilter(const IColumn::Filter &) override
     {
         throw Exception("Not implemented", ErrorCodes::NOT_IMPLEMENTED);
     }
+
+private:
+    // Move to the next column file, return false if it is skipped.
+    bool nextColumnFileReader()
+    {
+        const auto & column_file = column_files[next_file_index];
+        if (column_file->isDeleteRange())
+        {
+            ++next_file_index;
+            return false;
+        }
+        if (filter && !column_file->mayMatch(filter))
+        {
+            filtered_rows += column_file->getRows();
+            ++next_file_index;
+            return false;
+        }
+        cur_column_file_reader = reader.column_file_readers[next_file_index];
+        ++next_file_index;
+        return true;
+    }
 };
 } // namespace DM
 } // namespace DB
@@ -290,7 +290,8 @@ ColumnFileTinyPtr ColumnFileTiny::writeColumnFile(
     auto schema = getSharedBlockSchemas(context)->getOrCreate(block);
 
     auto bytes = block.bytes(offset, limit);
-    return std::make_shared<ColumnFileTiny>(schema, limit, bytes, page_id, context, cache);
+    auto indexes = ColumnFileIndexes::build(block, offset, limit);
+    return std::make_shared<ColumnFileTiny>(schema, limit, bytes, page_id, context, cache, indexes);
 }
 
 PageIdU64 ColumnFileTiny::writeColumnFileData(
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <Storages/DeltaMerge/ColumnFile/ColumnFile.h>
+#include <Storages/DeltaMerge/ColumnFile/ColumnFileIndexes.h>
 #include <Storages/DeltaMerge/ColumnFile/ColumnFilePersisted.h>
 #include <Storages/DeltaMerge/ColumnFile/ColumnFileSchema.h>
 #include <Storages/DeltaMerge/DMContext.h>
@@ -62,6 +63,9 @@ private:
     /// Currently this field is unused.
     CachePtr cache;
 
+    /// The indexes of data, only available when it is written or flushed by this process.
+    ColumnFileIndexesPtr indexes;
+
 private:
     /// Read a block of columns in `column_defines` from cache / disk,
     /// if `pack->schema` is not match with `column_defines`, take good care of ddl cast
@@ -87,7 +91,8 @@ public:
         UInt64 bytes_,
         PageIdU64 data_page_id_,
         const DMContext & dm_context,
-        const CachePtr & cache_ = nullptr)
+        const CachePtr & cache_ = nullptr,
+        const ColumnFileIndexesPtr & indexes_ = nullptr)
         : schema(schema_)
         , rows(rows_)
         , bytes(bytes_)
@@ -95,6 +100,7 @@ public:
         , keyspace_id(dm_context.keyspace_id)
         , file_provider(dm_context.global_context.getFileProvider())
         , cache(cache_)
+        , indexes(indexes_)
     {}
 
     Type getType() const override { return Type::TINY_FILE; }
@@ -105,6 +111,8 @@ public:
     auto getCache() const { return cache; }
     void clearCache() { cache = {}; }
 
+    bool mayMatch(const RSOperatorPtr & filter) const override { return !indexes || indexes->mayMatch(filter); }
+
     /// The schema of this pack. Could be empty, i.e. a DeleteRange does not have a schema.
     ColumnFileSchemaPtr getSchema() const { return schema; }
 
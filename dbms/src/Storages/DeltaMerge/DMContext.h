@@ -71,12 +71,17 @@ struct DMContext : private boost::noncopyable
     const size_t delta_cache_limit_rows;
     // The size threshold of cache in delta.
     const size_t delta_cache_limit_bytes;
+    // Whether to compress the cache of the full column files in MemTableSet.
+    const bool compress_sealed_mem_table_files;
     // Determine whether a column file is small or not in rows.
     const size_t delta_small_column_file_rows;
     // Determine whether a column file is small or not in bytes.
     const size_t delta_small_column_file_bytes;
     // The expected stable pack rows.
     const size_t stable_pack_rows;
+    // Adapt the stable pack rows and the segment size to the read pattern of a segment after it has been
+    // read at least this many times. 0 means disable.
+    const size_t adaptive_segment_min_reads;
 
     // The number of points to check for calculating region split.
     const size_t region_split_check_points = 128;
@@ -86,6 +91,12 @@ struct DMContext : private boost::noncopyable
     const bool read_stable_only;
     const bool enable_relevant_place;
     const bool enable_skippable_place;
+    // The max bytes of the cached stable result of one segment, 0 means disable the stable result cache.
+    const size_t stable_result_cache_max_entry_bytes;
+    // The number of rows sampled by late materialization before deciding whether to fall back.
+    const size_t late_materialization_sample_rows;
+    // Fall back from late materialization if the ratio of rows passing the filter is not less than this value.
+    const double late_materialization_max_passed_ratio;
 
     String tracing_id;
 
@@ -177,14 +188,19 @@ private:
         , delta_limit_bytes(settings.dt_segment_delta_limit_size)
         , delta_cache_limit_rows(settings.dt_segment_delta_cache_limit_rows)
         , delta_cache_limit_bytes(settings.dt_segment_delta_cache_limit_size)
+        , compress_sealed_mem_table_files(settings.dt_compress_sealed_mem_table_files)
         , delta_small_column_file_rows(settings.dt_segment_delta_small_column_file_rows)
         , delta_small_column_file_bytes(settings.dt_segment_delta_small_column_file_size)
         , stable_pack_rows(settings.dt_segment_stable_pack_rows)
+        , adaptive_segment_min_reads(settings.dt_adaptive_segment_min_reads)
         , enable_logical_split(settings.dt_enable_logical_split)
         , read_delta_only(settings.dt_read_delta_only)
         , read_stable_only(settings.dt_read_stable_only)
         , enable_relevant_place(settings.dt_enable_relevant_place)
         , enable_skippable_place(settings.dt_enable_skippable_place)
+        , stable_result_cache_max_entry_bytes(settings.dt_stable_result_cache_max_entry_size)
+        , late_materialization_sample_rows(settings.dt_late_materialization_sample_rows)
+        , late_materialization_max_passed_ratio(settings.dt_late_materialization_max_passed_ratio)
         , tracing_id(tracing_id_)
         , scan_context(scan_context_ ? scan_context_ : std::make_shared<ScanContext>())
     {}
@@ -98,7 +98,7 @@ protected:
                     columns_to_read,
                     task->read_snapshot,
                     task->ranges,
-                    filter,
+                    filter ? filter->withTopNThreshold() : filter,
                     max_version,
                     block_size);
                 LOG_TRACE(log, "Start to read segment, segment={}", cur_segment->simpleInfo());
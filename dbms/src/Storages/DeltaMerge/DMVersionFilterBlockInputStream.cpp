@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/TargetSpecific.h>
 #include <Storages/DeltaMerge/DMVersionFilterBlockInputStream.h>
 
 namespace ProfileEvents
@@ -23,6 +24,95 @@ namespace DB
 {
 namespace DM
 {
+namespace
+{
+TIFLASH_DECLARE_MULTITARGET_FUNCTION(
+    void,
+    compareAdjacentHandles,
+    (handles, limit, not_equal),
+    (const Int64 * __restrict handles, size_t limit, UInt8 * __restrict not_equal),
+    {
+        for (size_t i = 0; i < limit; ++i)
+            not_equal[i] = handles[i] != handles[i + 1];
+    })
+
+TIFLASH_DECLARE_MULTITARGET_FUNCTION(
+    bool,
+    allVersionsVisible,
+    (versions, limit, version_limit),
+    (const UInt64 * __restrict versions, size_t limit, UInt64 version_limit),
+    {
+        UInt64 max_version = 0;
+        for (size_t i = 0; i < limit; ++i)
+            max_version = std::max(max_version, versions[i]);
+        return max_version <= version_limit;
+    })
+
+/// filter[i] = !deleted && cur_version <= version_limit && (cur_handle != next_handle || next_version > version_limit)
+TIFLASH_DECLARE_MULTITARGET_FUNCTION(
+    void,
+    filterMVCCRows,
+    (not_equal, versions, deletes, version_limit, limit, filter),
+    (const UInt8 * __restrict not_equal,
+     const UInt64 * __restrict versions,
+     const UInt8 * __restrict deletes,
+     UInt64 version_limit,
+     size_t limit,
+     UInt8 * __restrict filter),
+    {
+        for (size_t i = 0; i < limit; ++i)
+        {
+            filter[i] = (deletes[i] == 0) & (versions[i] <= version_limit)
+                & (not_equal[i] | (versions[i + 1] > version_limit));
+        }
+    })
+
+/// filter[i] = cur_version >= version_limit || ((cur_handle != next_handle || next_version > version_limit) && !deleted)
+/// effective[i] = filter[i] && cur_handle != next_handle
+/// not_clean[i] = filter[i] && (cur_handle == next_handle || deleted)
+/// is_deleted[i] = filter[i] && deleted
+TIFLASH_DECLARE_MULTITARGET_FUNCTION(
+    void,
+    filterCompactRows,
+    (not_equal, versions, deletes, version_limit, limit, filter, effective, not_clean, is_deleted),
+    (const UInt8 * __restrict not_equal,
+     const UInt64 * __restrict versions,
+     const UInt8 * __restrict deletes,
+     UInt64 version_limit,
+     size_t limit,
+     UInt8 * __restrict filter,
+     UInt8 * __restrict effective,
+     UInt8 * __restrict not_clean,
+     UInt8 * __restrict is_deleted),
+    {
+        for (size_t i = 0; i < limit; ++i)
+        {
+            const UInt8 deleted = deletes[i] != 0;
+            const UInt8 selected = (versions[i] >= version_limit)
+                | ((not_equal[i] | (versions[i + 1] > version_limit)) & (deleted ^ 1));
+            filter[i] = selected;
+            effective[i] = selected & not_equal[i];
+            not_clean[i] = selected & ((not_equal[i] ^ 1) | deleted);
+            is_deleted[i] = selected & deleted;
+        }
+    })
+} // namespace
+
+template <int MODE>
+void DMVersionFilterBlockInputStream<MODE>::fillHandleNotEqual(size_t limit)
+{
+    handle_not_equal.resize(limit);
+    if (rowkey_column->int_data != nullptr)
+    {
+        compareAdjacentHandles(rowkey_column->int_data->data(), limit, handle_not_equal.data());
+    }
+    else
+    {
+        for (size_t i = 0; i < limit; ++i)
+            handle_not_equal[i] = compare(rowkey_column->getRowKeyValue(i), rowkey_column->getRowKeyValue(i + 1)) != 0;
+    }
+}
+
 template <int MODE>
 void DMVersionFilterBlockInputStream<MODE>::readPrefix()
 {
@@ -80,248 +170,72 @@ Block DMVersionFilterBlockInputStream<MODE>::read(FilterPtr & res_filter, bool r
 
         filter.resize(rows);
 
-        const size_t batch_rows = (rows - 1) / UNROLL_BATCH * UNROLL_BATCH;
-
-        // The following is trying to unroll the filtering operations,
-        // so that optimizer could use vectorized optimization.
-        // The original logic can be seen in #checkWithNextIndex().
+        // The filters of the rows except the last one only depend on the current block,
+        // they are computed by the kernels above which can be vectorized.
+        const size_t batch_rows = rows - 1;
+        const auto * version_data = version_col_data->data();
+        const auto * delete_data = delete_col_data->data();
 
         if constexpr (MODE == DM_VERSION_FILTER_MODE_MVCC)
         {
-            /// filter[i] = !deleted && cur_version <= version_limit && (cur_handle != next_handle || next_version > version_limit)
+            if (track_min_invisible_version)
             {
-                UInt8 * filter_pos = filter.data();
-                auto * version_pos = const_cast<UInt64 *>(version_col_data->data()) + 1;
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*filter_pos) = (*version_pos) > version_limit;
-
-                    ++filter_pos;
-                    ++version_pos;
-                }
-            }
-
-            {
-                UInt8 * filter_pos = filter.data();
-                size_t handle_pos = 0;
-                size_t next_handle_pos = handle_pos + 1;
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*filter_pos) |= compare(
-                                         rowkey_column->getRowKeyValue(handle_pos),
-                                         rowkey_column->getRowKeyValue(next_handle_pos))
-                        != 0;
-                    ++filter_pos;
-                    ++handle_pos;
-                    ++next_handle_pos;
-                }
+                for (const auto version : *version_col_data)
+                    min_invisible_version = std::min(
+                        min_invisible_version,
+                        version > version_limit ? version : std::numeric_limits<UInt64>::max());
             }
 
+            /// filter[i] = !deleted && cur_version <= version_limit && (cur_handle != next_handle || next_version > version_limit)
+            if (cur_raw_block.isMVCCClean() && allVersionsVisible(version_data, batch_rows, version_limit))
             {
-                UInt8 * filter_pos = filter.data();
-                auto * version_pos = const_cast<UInt64 *>(version_col_data->data());
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*filter_pos) &= (*version_pos) <= version_limit;
-
-                    ++filter_pos;
-                    ++version_pos;
-                }
+                // The handles are distinct and no row is deleted, all of the visible rows are selected.
+                memset(filter.data(), 1, batch_rows);
             }
-
+            else
             {
-                UInt8 * filter_pos = filter.data();
-                auto * delete_pos = const_cast<UInt8 *>(delete_col_data->data());
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*filter_pos) &= !(*delete_pos);
-
-                    ++filter_pos;
-                    ++delete_pos;
-                }
+                fillHandleNotEqual(batch_rows);
+                filterMVCCRows(
+                    handle_not_equal.data(),
+                    version_data,
+                    delete_data,
+                    version_limit,
+                    batch_rows,
+                    filter.data());
             }
         }
         else if constexpr (MODE == DM_VERSION_FILTER_MODE_COMPACT)
         {
             /// filter[i] = cur_version >= version_limit || ((cur_handle != next_handle || next_version > version_limit) && !deleted);
-
-            {
-                UInt8 * filter_pos = filter.data();
-                size_t handle_pos = 0;
-                size_t next_handle_pos = handle_pos + 1;
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*filter_pos) = compare(
-                                        rowkey_column->getRowKeyValue(handle_pos),
-                                        rowkey_column->getRowKeyValue(next_handle_pos))
-                        != 0;
-                    ++filter_pos;
-                    ++handle_pos;
-                    ++next_handle_pos;
-                }
-            }
-
-            {
-                UInt8 * filter_pos = filter.data();
-                auto * version_pos = const_cast<UInt64 *>(version_col_data->data());
-                auto * next_version_pos = version_pos + 1;
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*filter_pos) |= (*next_version_pos) > version_limit;
-
-                    ++filter_pos;
-                    ++next_version_pos;
-                }
-            }
-
-            {
-                UInt8 * filter_pos = filter.data();
-                auto * delete_pos = const_cast<UInt8 *>(delete_col_data->data());
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*filter_pos) &= !(*delete_pos);
-
-                    ++filter_pos;
-                    ++delete_pos;
-                }
-            }
-
-            {
-                UInt8 * filter_pos = filter.data();
-                auto * version_pos = const_cast<UInt64 *>(version_col_data->data());
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*filter_pos) |= (*version_pos) >= version_limit;
-
-                    ++filter_pos;
-                    ++version_pos;
-                }
-            }
-
-            // Let's set effective.
             effective.resize(rows);
-
-            {
-                UInt8 * effective_pos = effective.data();
-                size_t handle_pos = 0;
-                size_t next_handle_pos = handle_pos + 1;
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*effective_pos) = compare(
-                                           rowkey_column->getRowKeyValue(handle_pos),
-                                           rowkey_column->getRowKeyValue(next_handle_pos))
-                        != 0;
-                    ++effective_pos;
-                    ++handle_pos;
-                    ++next_handle_pos;
-                }
-            }
-
-            {
-                UInt8 * effective_pos = effective.data();
-                UInt8 * filter_pos = filter.data();
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*effective_pos) &= (*filter_pos);
-
-                    ++effective_pos;
-                    ++filter_pos;
-                }
-            }
-
-            // Let's set not_clean.
             not_clean.resize(rows);
-
-            {
-                UInt8 * not_clean_pos = not_clean.data();
-                size_t handle_pos = 0;
-                size_t next_handle_pos = handle_pos + 1;
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*not_clean_pos) = compare(
-                                           rowkey_column->getRowKeyValue(handle_pos),
-                                           rowkey_column->getRowKeyValue(next_handle_pos))
-                        == 0;
-                    ++not_clean_pos;
-                    ++handle_pos;
-                    ++next_handle_pos;
-                }
-            }
-
-            {
-                UInt8 * not_clean_pos = not_clean.data();
-                auto * delete_pos = const_cast<UInt8 *>(delete_col_data->data());
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*not_clean_pos) |= (*delete_pos);
-
-                    ++not_clean_pos;
-                    ++delete_pos;
-                }
-            }
-
-            {
-                UInt8 * not_clean_pos = not_clean.data();
-                UInt8 * filter_pos = filter.data();
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*not_clean_pos) &= (*filter_pos);
-
-                    ++not_clean_pos;
-                    ++filter_pos;
-                }
-            }
-
-            // Let's set is_delete.
             is_deleted.resize(rows);
-            {
-                UInt8 * is_deleted_pos = is_deleted.data();
-                auto * delete_pos = const_cast<UInt8 *>(delete_col_data->data());
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*is_deleted_pos) = (*delete_pos);
-                    ++is_deleted_pos;
-                    ++delete_pos;
-                }
-            }
 
-            {
-                UInt8 * is_deleted_pos = is_deleted.data();
-                UInt8 * filter_pos = filter.data();
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    (*is_deleted_pos) &= (*filter_pos);
-                    ++is_deleted_pos;
-                    ++filter_pos;
-                }
-            }
+            fillHandleNotEqual(batch_rows);
+            filterCompactRows(
+                handle_not_equal.data(),
+                version_data,
+                delete_data,
+                version_limit,
+                batch_rows,
+                filter.data(),
+                effective.data(),
+                not_clean.data(),
+                is_deleted.data());
 
             // Let's calculate gc_hint_version
             gc_hint_version = std::numeric_limits<UInt64>::max();
+            for (size_t i = 0; i < batch_rows; ++i)
             {
-                UInt8 * filter_pos = filter.data();
-                size_t handle_pos = 0;
-                size_t next_handle_pos = handle_pos + 1;
-                auto * version_pos = const_cast<UInt64 *>(version_col_data->data());
-                auto * delete_pos = const_cast<UInt8 *>(delete_col_data->data());
-                for (size_t i = 0; i < batch_rows; ++i)
-                {
-                    if (*filter_pos)
-                        gc_hint_version = std::min(
-                            gc_hint_version,
-                            calculateRowGcHintVersion(
-                                rowkey_column->getRowKeyValue(handle_pos),
-                                *version_pos,
-                                rowkey_column->getRowKeyValue(next_handle_pos),
-                                true,
-                                *delete_pos));
-
-                    ++filter_pos;
-                    ++handle_pos;
-                    ++next_handle_pos;
-                    ++version_pos;
-                    ++delete_pos;
-                }
+                if (filter[i])
+                    gc_hint_version = std::min(
+                        gc_hint_version,
+                        calculateRowGcHintVersion(
+                            rowkey_column->getRowKeyValue(i),
+                            version_data[i],
+                            rowkey_column->getRowKeyValue(i + 1),
+                            true,
+                            delete_data[i]));
             }
         }
         else
@@ -329,9 +243,6 @@ Block DMVersionFilterBlockInputStream<MODE>::read(FilterPtr & res_filter, bool r
             throw Exception("Unsupported mode");
         }
 
-        for (size_t i = batch_rows; i < rows - 1; ++i)
-            checkWithNextIndex(i);
-
         {
             // Now let's handle the last row of current block.
             auto cur_handle = rowkey_column->getRowKeyValue(rows - 1);
@@ -38,7 +38,6 @@ static constexpr int DM_VERSION_FILTER_MODE_COMPACT = 1;
 template <int MODE>
 class DMVersionFilterBlockInputStream : public IBlockInputStream
 {
-    static constexpr size_t UNROLL_BATCH = 64;
     static_assert(MODE == DM_VERSION_FILTER_MODE_MVCC || MODE == DM_VERSION_FILTER_MODE_COMPACT);
 
     constexpr static const char * MVCC_FILTER_NAME = "mode=MVCC";
@@ -105,41 +104,14 @@ public:
     size_t getDeletedRows() const { return deleted_rows; }
     UInt64 getGCHintVersion() const { return gc_hint_version; }
 
+    /// Track the min version of the rows which are newer than `version_limit`. Only for MVCC mode.
+    /// The output does not change for any `version_limit` less than this version.
+    void enableTrackMinInvisibleVersion() { track_min_invisible_version = true; }
+    UInt64 getMinInvisibleVersion() const { return min_invisible_version; }
+
 private:
-    inline void checkWithNextIndex(size_t i)
-    {
-#define cur_handle rowkey_column->getRowKeyValue(i)
-#define next_handle rowkey_column->getRowKeyValue(i + 1)
-#define cur_version (*version_col_data)[i]
-#define next_version (*version_col_data)[i + 1]
-#define deleted (*delete_col_data)[i]
-        if constexpr (MODE == DM_VERSION_FILTER_MODE_MVCC)
-        {
-            filter[i] = !deleted && cur_version <= version_limit
-                && (compare(cur_handle, next_handle) != 0 || next_version > version_limit);
-        }
-        else if constexpr (MODE == DM_VERSION_FILTER_MODE_COMPACT)
-        {
-            filter[i] = cur_version >= version_limit
-                || ((compare(cur_handle, next_handle) != 0 || next_version > version_limit) && !deleted);
-            not_clean[i] = filter[i] && (compare(cur_handle, next_handle) == 0 || deleted);
-            is_deleted[i] = filter[i] && deleted;
-            effective[i] = filter[i] && (compare(cur_handle, next_handle) != 0);
-            if (filter[i])
-                gc_hint_version = std::min(
-                    gc_hint_version,
-                    calculateRowGcHintVersion(cur_handle, cur_version, next_handle, true, deleted));
-        }
-        else
-        {
-            throw Exception("Unsupported mode");
-        }
-#undef cur_handle
-#undef next_handle
-#undef cur_version
-#undef next_version
-#undef deleted
-    }
+    /// handle_not_equal[i] = handle[i] != handle[i + 1], for i in [0, limit)
+    void fillHandleNotEqual(size_t limit);
 
     bool initNextBlock()
     {
@@ -237,6 +209,8 @@ private:
     size_t delete_col_pos;
 
     IColumn::Filter filter{};
+    // handle_not_equal = handle not equals with next
+    IColumn::Filter handle_not_equal{};
     // effective = selected & handle not equals with next
     IColumn::Filter effective{};
     // not_clean = selected & (handle equals with next || deleted)
@@ -250,6 +224,9 @@ private:
     // Then the block's gc_hint_version is the minimum value of all pk's gc_hint_version
     UInt64 gc_hint_version = std::numeric_limits<UInt64>::max();
 
+    bool track_min_invisible_version = false;
+    UInt64 min_invisible_version = std::numeric_limits<UInt64>::max();
+
     // auxiliary variable for the calculation of gc_hint_version
     bool is_first_oldest_version = true;
     bool is_second_oldest_version = false;
@@ -225,17 +225,39 @@ bool SSTFilesToDTFilesOutputStream<ChildStream>::finalizeDTFileStream()
 
     dt_stream.reset();
 
+    // Report the progress of decoding the SST files, so that the throughput of big snapshots
+    // can be observed before the whole prehandling is done.
+    const auto process_keys = child->getProcessKeys();
+    const auto process_bytes = process_keys.total_bytes();
+    switch (job_type)
+    {
+    case FileConvertJobType::ApplySnapshot:
+        GET_METRIC(tiflash_raft_throughput_bytes, type_apply_snapshot_predecode)
+            .Increment(process_bytes - reported_process_bytes);
+        break;
+    case FileConvertJobType::IngestSST:
+        GET_METRIC(tiflash_raft_throughput_bytes, type_ingest_sst_predecode)
+            .Increment(process_bytes - reported_process_bytes);
+        break;
+    }
+    reported_process_bytes = process_bytes;
+
+    const auto elapsed_seconds = watch.elapsedSeconds();
     LOG_INFO(
         log,
         "Finished writing DTFile from snapshot data, region={} file_idx={} file_rows={} file_bytes={} data_range={} "
-        "file_bytes_on_disk={} file={}",
+        "file_bytes_on_disk={} file={} split_id={} processed_keys={} processed_bytes={} throughput={:.2f}MB/s",
         child->getRegion()->toString(true),
         ingest_files.size() - 1,
         committed_rows_this_dt_file,
         committed_bytes_this_dt_file,
         ingest_files_range.back().has_value() ? ingest_files_range.back()->toDebugString() : "(null)",
         bytes_written,
-        dt_file->path());
+        dt_file->path(),
+        child->getSplitId(),
+        process_keys.total(),
+        process_bytes,
+        elapsed_seconds > 0 ? process_bytes / elapsed_seconds / 1024 / 1024 : 0.0);
 
     return true;
 }
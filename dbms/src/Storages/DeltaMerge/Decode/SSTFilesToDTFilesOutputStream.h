@@ -143,6 +143,8 @@ private:
     size_t total_committed_rows = 0;
     size_t total_committed_bytes = 0;
     size_t total_bytes_on_disk = 0;
+    // The bytes of SST files processed when the progress is reported last time.
+    size_t reported_process_bytes = 0;
 
     Stopwatch watch;
 };
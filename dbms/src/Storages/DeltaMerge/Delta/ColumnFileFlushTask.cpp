@@ -35,7 +35,7 @@ ColumnFileFlushTask::ColumnFileFlushTask(
     , flush_version{flush_version_}
 {}
 
-DeltaIndex::Updates ColumnFileFlushTask::prepare(WriteBatches & wbs)
+DeltaIndex::Updates ColumnFileFlushTask::prepare(WriteBatches & wbs, size_t placed_rows)
 {
     DeltaIndex::Updates delta_index_updates;
     /// Write prepared data to disk.
@@ -44,10 +44,18 @@ DeltaIndex::Updates ColumnFileFlushTask::prepare(WriteBatches & wbs)
         if (!task.block_data)
             continue;
 
-        IColumn::Permutation perm;
-        task.sorted = sortBlockByPk(getExtraHandleColumnDefine(context.is_common_handle), task.block_data, perm);
-        if (task.sorted)
-            delta_index_updates.emplace_back(task.deletes_offset, task.rows_offset, perm);
+        // The placed rows of a partially placed ColumnFile can not be remapped after sorting, because they
+        // would no longer be a prefix of the delta. Keep its order, otherwise the delta index has to remove
+        // all the inserts start from this ColumnFile and place them again.
+        const bool partially_placed
+            = task.rows_offset < placed_rows && placed_rows < task.rows_offset + task.block_data.rows();
+        if (!partially_placed)
+        {
+            IColumn::Permutation perm;
+            task.sorted = sortBlockByPk(getExtraHandleColumnDefine(context.is_common_handle), task.block_data, perm);
+            if (task.sorted)
+                delta_index_updates.emplace_back(task.deletes_offset, task.rows_offset, perm);
+        }
 
         task.data_page = ColumnFileTiny::writeColumnFileData(context, task.block_data, 0, task.block_data.rows(), wbs);
     }
@@ -75,7 +83,10 @@ bool ColumnFileFlushTask::commit(ColumnFilePersistedSetPtr & persisted_file_set,
                 m_file->getRows(),
                 m_file->getBytes(),
                 task.data_page,
-                context);
+                context,
+                /*cache*/ nullptr,
+                // Sorting does not change the min max values
+                m_file->getIndexes());
         }
         else if (auto * t_file = task.column_file->tryToTinyFile(); t_file)
         {
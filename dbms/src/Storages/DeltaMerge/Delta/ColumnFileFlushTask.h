@@ -83,8 +83,10 @@ public:
     size_t getFlushBytes() const { return flush_bytes; }
     size_t getFlushDeletes() const { return flush_deletes; }
 
-    // Persist data in ColumnFileInMemory
-    DeltaIndex::Updates prepare(WriteBatches & wbs);
+    // Persist data in ColumnFileInMemory.
+    // `placed_rows` is the rows placed by the current delta index, the ColumnFileInMemory which is partially
+    // placed is not sorted, so that the placed rows can be kept in the delta index after flush.
+    DeltaIndex::Updates prepare(WriteBatches & wbs, size_t placed_rows);
 
     // Add the flushed column file to ColumnFilePersistedSet and remove the corresponding column file from MemTableSet
     // Needs extra synchronization on the DeltaValueSpace
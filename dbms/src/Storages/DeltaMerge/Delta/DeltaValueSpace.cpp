@@ -291,6 +291,7 @@ bool DeltaValueSpace::appendColumnFile(DMContext & /*context*/, const ColumnFile
         return false;
 
     mem_table_set->appendColumnFile(column_file);
+    ++mem_table_version;
     return true;
 }
 
@@ -301,6 +302,7 @@ bool DeltaValueSpace::appendToCache(DMContext & context, const Block & block, si
         return false;
 
     mem_table_set->appendToCache(context, block, offset, limit);
+    ++mem_table_version;
     return true;
 }
 
@@ -311,6 +313,7 @@ bool DeltaValueSpace::appendDeleteRange(DMContext & /*context*/, const RowKeyRan
         return false;
 
     mem_table_set->appendDeleteRange(delete_range);
+    ++mem_table_version;
     return true;
 }
 
@@ -325,6 +328,7 @@ bool DeltaValueSpace::ingestColumnFiles(
         return false;
 
     mem_table_set->ingestColumnFiles(range, column_files, clear_data_in_range);
+    ++mem_table_version;
     return true;
 }
 
@@ -354,6 +358,7 @@ bool DeltaValueSpace::flush(DMContext & context)
     ColumnFileFlushTaskPtr flush_task;
     WriteBatches wbs(*context.storage_pool, context.getWriteLimiter());
     DeltaIndexPtr cur_delta_index;
+    UInt64 flushing_mem_table_version = 0;
     {
         /// Prepare data which will be written to disk.
         std::scoped_lock lock(mutex);
@@ -368,17 +373,19 @@ bool DeltaValueSpace::flush(DMContext & context)
             persisted_file_set->getDeletes(),
             persisted_file_set->getCurrentFlushVersion());
         cur_delta_index = delta_index;
+        flushing_mem_table_version = mem_table_version;
     }
 
     // No update, return successfully.
     if (!flush_task)
     {
+        flushed_mem_table_version = flushing_mem_table_version;
         LOG_DEBUG(log, "Flush cancel because nothing to flush, delta={}", simpleInfo());
         return true;
     }
 
     /// Write prepared data to disk.
-    auto delta_index_updates = flush_task->prepare(wbs);
+    auto delta_index_updates = flush_task->prepare(wbs, cur_delta_index->getPlacedStatus().first);
     DeltaIndexPtr new_delta_index;
     if (!delta_index_updates.empty())
     {
@@ -418,6 +425,8 @@ bool DeltaValueSpace::flush(DMContext & context)
             // This is useful in disaggregated mode which will invalidate the delta index cache in RN.
             delta_index_epoch = std::chrono::steady_clock::now().time_since_epoch().count();
         }
+        // Only one flush can run at the same time, so the version never goes back.
+        flushed_mem_table_version = flushing_mem_table_version;
 
         LOG_DEBUG(
             log,
@@ -87,6 +87,11 @@ private:
     /// So we only allow one flush task running at any time to aviod waste resource.
     std::atomic_bool is_flushing = false;
 
+    /// Increased on every change of `mem_table_set`. All the changes with a version not greater than
+    /// `flushed_mem_table_version` have been flushed, so a flush requested before them can be skipped.
+    std::atomic<UInt64> mem_table_version = 1;
+    std::atomic<UInt64> flushed_mem_table_version = 0;
+
     std::atomic<size_t> last_try_flush_rows = 0;
     std::atomic<size_t> last_try_flush_bytes = 0;
     std::atomic<size_t> last_try_compact_column_files = 0;
@@ -223,6 +228,10 @@ public:
 
     bool isFlushing() const { return is_flushing; }
 
+    UInt64 getMemTableVersion() const { return mem_table_version; }
+    /// Whether all the changes of `mem_table_set` until `version` have been flushed.
+    bool isFlushedUntil(UInt64 version) const { return flushed_mem_table_version >= version; }
+
     bool isUpdating() const { return is_updating; }
 
     bool tryLockUpdating()
@@ -488,13 +497,21 @@ private:
     size_t read_rows = 0;
 
 public:
+    /// The column files that can not match `filter` are skipped. Note that only the streams that do not rely on
+    /// the delta index (e.g. reading with bitmap filter, or in fast mode) can skip the rows of delta.
     DeltaValueInputStream(
         const DMContext & context_,
         const DeltaSnapshotPtr & delta_snap_,
         const ColumnDefinesPtr & col_defs_,
-        const RowKeyRange & segment_range_)
-        : mem_table_input_stream(context_, delta_snap_->getMemTableSetSnapshot(), col_defs_, segment_range_)
-        , persisted_files_input_stream(context_, delta_snap_->getPersistedFileSetSnapshot(), col_defs_, segment_range_)
+        const RowKeyRange & segment_range_,
+        const RSOperatorPtr & filter_ = EMPTY_RS_OPERATOR)
+        : mem_table_input_stream(context_, delta_snap_->getMemTableSetSnapshot(), col_defs_, segment_range_, filter_)
+        , persisted_files_input_stream(
+              context_,
+              delta_snap_->getPersistedFileSetSnapshot(),
+              col_defs_,
+              segment_range_,
+              filter_)
     {}
 
     String getName() const override { return "DeltaValue"; }
@@ -511,22 +528,14 @@ public:
         if (persisted_files_done)
         {
             skipped_rows = mem_table_input_stream.skipNextBlock();
-            read_rows += skipped_rows;
-            return skipped_rows;
-        }
-
-        if (skipped_rows = persisted_files_input_stream.skipNextBlock(); skipped_rows > 0)
-        {
-            read_rows += skipped_rows;
-            return skipped_rows;
         }
-        else
+        else if (skipped_rows = persisted_files_input_stream.skipNextBlock(); skipped_rows == 0)
         {
             persisted_files_done = true;
             skipped_rows = mem_table_input_stream.skipNextBlock();
-            read_rows += skipped_rows;
-            return skipped_rows;
         }
+        read_rows += popFilteredRows() + skipped_rows;
+        return skipped_rows;
     }
 
     Block readWithFilter(const IColumn::Filter & filter) override
@@ -545,11 +554,18 @@ public:
     Block read() override
     {
         auto block = doRead();
+        read_rows += popFilteredRows();
         block.setStartOffset(read_rows);
         read_rows += block.rows();
         return block;
     }
 
+private:
+    size_t popFilteredRows()
+    {
+        return persisted_files_input_stream.popFilteredRows() + mem_table_input_stream.popFilteredRows();
+    }
+
     // Read block from old to new.
     Block doRead()
     {
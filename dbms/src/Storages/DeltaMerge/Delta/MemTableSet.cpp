@@ -194,6 +194,16 @@ void MemTableSet::appendToCache(DMContext & context, const Block & block, size_t
 
     if (!success)
     {
+        // The last column file is full or sealed, compress it to reduce the memory usage before it is flushed.
+        if (context.compress_sealed_mem_table_files && !column_files.empty())
+        {
+            if (auto * m_file = column_files.back()->tryToInMemoryFile(); m_file)
+            {
+                m_file->disableAppend();
+                m_file->compress();
+            }
+        }
+
         auto schema = getSharedBlockSchemas(context)->getOrCreate(block);
 
         // Create a new column file.
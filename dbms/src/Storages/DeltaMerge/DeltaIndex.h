@@ -208,12 +208,46 @@ public:
 
     DeltaIndexPtr tryClone(size_t /*rows*/, size_t deletes) { return tryCloneInner(deletes); }
 
+    /// Clone the index for the delta after some ColumnFileInMemory are flushed and sorted.
+    /// The flushed index only replaces the index of the delta itself, and flush never removes any delete ranges,
+    /// so all placed deletes are still visible to later snapshots. Instead of rebuilding the whole index, keep
+    /// the placed deletes and remap the inserts which go shuffled.
     DeltaIndexPtr cloneWithUpdates(const Updates & updates)
     {
         if (unlikely(updates.empty()))
             throw Exception("Unexpected empty updates");
 
-        return tryCloneInner(updates.front().delete_ranges_offset, &updates);
+        return tryCloneInner(std::numeric_limits<size_t>::max(), &updates);
+    }
+
+    /// Clone the index of an older delta index epoch for a newer one of the same segment, only used in disaggregated
+    /// read node. Flush only sorts the rows after the persisted rows of the older epoch, so the inserts of the first
+    /// `persisted_rows` rows are kept, and the inserts after them are removed and should be placed again.
+    /// If the index has placed more deletes than `persisted_deletes`, an empty index is returned.
+    DeltaIndexPtr cloneForNewEpoch(
+        size_t persisted_rows,
+        size_t persisted_deletes,
+        const Remote::RNDeltaIndexCache::CacheKey & new_rn_cache_key)
+    {
+        DeltaTreePtr delta_tree_copy;
+        size_t placed_rows_copy = 0;
+        size_t placed_deletes_copy = 0;
+        {
+            std::scoped_lock lock(mutex);
+            if (placed_deletes > persisted_deletes)
+                return std::make_shared<DeltaIndex>(new_rn_cache_key);
+            delta_tree_copy = delta_tree;
+            placed_rows_copy = placed_rows;
+            placed_deletes_copy = placed_deletes;
+        }
+
+        auto new_delta_tree = std::make_shared<DefaultDeltaTree>(*delta_tree_copy);
+        if (placed_rows_copy > persisted_rows)
+        {
+            new_delta_tree->removeInsertsStartFrom(persisted_rows);
+            placed_rows_copy = persisted_rows;
+        }
+        return std::make_shared<DeltaIndex>(new_delta_tree, placed_rows_copy, placed_deletes_copy, new_rn_cache_key);
     }
 
     const std::optional<Remote::RNDeltaIndexCache::CacheKey> & getRNCacheKey() const { return rn_cache_key; }
@@ -535,6 +535,24 @@ private:
     {
         auto output_offset = output_columns.at(0)->size();
 
+        if (output_offset && !cur_stable_block_pos && use_stable_rows >= cur_stable_block_rows)
+        {
+            // The whole stable block is going to be output. Instead of copying it into the rows already
+            // written by delta, return those rows first, so that the stable block can be forwarded without
+            // copying in the next round. Otherwise once the output is misaligned with the stable blocks,
+            // every following stable block would be copied.
+            auto [final_offset, final_limit] = RowKeyFilter::getPosRangeOfSorted(
+                rowkey_range,
+                cur_stable_block_columns[0],
+                0,
+                cur_stable_block_rows);
+            if (!final_offset && final_limit == cur_stable_block_rows)
+            {
+                output_write_limit = 0;
+                return;
+            }
+        }
+
         size_t copy_rows = std::min(output_write_limit, use_stable_rows);
         copy_rows = std::min(copy_rows, cur_stable_block_rows - cur_stable_block_pos);
         auto offset = cur_stable_block_pos;
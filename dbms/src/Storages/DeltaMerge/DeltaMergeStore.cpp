@@ -129,7 +129,10 @@ std::pair<bool, bool> DeltaMergeStore::MergeDeltaTaskPool::tryAddTask(
         // reserve some task space for light tasks
         if (max_task_num > 1 && heavy_tasks.size() >= static_cast<size_t>(max_task_num * 0.9))
             return std::make_pair(false, is_heavy);
-        heavy_tasks.push(task);
+        if (task.urgent)
+            heavy_tasks.push_front(task);
+        else
+            heavy_tasks.push_back(task);
         break;
     case TaskType::Compact:
     case TaskType::Flush:
@@ -139,7 +142,7 @@ std::pair<bool, bool> DeltaMergeStore::MergeDeltaTaskPool::tryAddTask(
         // reserve some task space for heavy tasks
         if (max_task_num > 1 && light_tasks.size() >= static_cast<size_t>(max_task_num * 0.9))
             return std::make_pair(false, is_heavy);
-        light_tasks.push(task);
+        light_tasks.push_back(task);
         break;
     default:
         throw Exception(fmt::format("Unsupported task type: {}", magic_enum::enum_name(task.type)));
@@ -147,10 +150,11 @@ std::pair<bool, bool> DeltaMergeStore::MergeDeltaTaskPool::tryAddTask(
 
     LOG_DEBUG(
         log_,
-        "Segment task add to background task pool, segment={} task={} by_whom={}",
+        "Segment task add to background task pool, segment={} task={} by_whom={} urgent={}",
         task.segment->simpleInfo(),
         magic_enum::enum_name(task.type),
-        magic_enum::enum_name(whom));
+        magic_enum::enum_name(whom),
+        task.urgent);
     return std::make_pair(true, is_heavy);
 }
 
@@ -162,7 +166,7 @@ DeltaMergeStore::BackgroundTask DeltaMergeStore::MergeDeltaTaskPool::nextTask(bo
     if (tasks.empty())
         return {};
     auto task = tasks.front();
-    tasks.pop();
+    tasks.pop_front();
 
     LOG_DEBUG(
         log_,
@@ -196,6 +200,26 @@ ColumnDefinesPtr generateStoreColumns(const ColumnDefines & table_columns, bool
     }
     return columns;
 }
+
+// The number of streams (or source operators) to read the tasks. A small read is not worth `num_streams`
+// concurrency, creating the streams and scheduling them costs more than reading the data, so the concurrency is
+// also limited by the estimated rows to read when `dt_min_rows_per_read_stream` is set.
+size_t getFinalNumStreams(
+    const DB::Settings & settings,
+    bool enable_read_thread,
+    size_t num_streams,
+    const SegmentReadTasks & tasks)
+{
+    size_t final_num_stream = enable_read_thread ? num_streams : std::min(num_streams, tasks.size());
+    if (const size_t min_rows_per_stream = settings.dt_min_rows_per_read_stream; min_rows_per_stream > 0)
+    {
+        size_t estimated_rows = 0;
+        for (const auto & task : tasks)
+            estimated_rows += task->read_snapshot->getRows();
+        final_num_stream = std::min(final_num_stream, estimated_rows / min_rows_per_stream + 1);
+    }
+    return std::max(1, final_num_stream);
+}
 } // namespace
 
 DeltaMergeStore::Settings DeltaMergeStore::EMPTY_SETTINGS
@@ -741,6 +765,8 @@ bool DeltaMergeStore::flushCache(const DMContextPtr & dm_context, const RowKeyRa
     while (!cur_range.none())
     {
         RowKeyRange segment_range;
+        DeltaValueSpacePtr delta_to_flush;
+        UInt64 version_to_flush = 0;
 
         // Keep trying until succeeded if needed.
         while (true)
@@ -756,6 +782,19 @@ bool DeltaMergeStore::flushCache(const DMContextPtr & dm_context, const RowKeyRa
 
             segment_range = segment->getRowKeyRange();
 
+            // Only the data written before this call is required to be flushed. When many regions of the
+            // same segment are flushed at the same time, most of them are covered by a flush done by others,
+            // so we skip them instead of generating lots of tiny column files.
+            if (segment->getDelta() != delta_to_flush)
+            {
+                delta_to_flush = segment->getDelta();
+                version_to_flush = delta_to_flush->getMemTableVersion();
+            }
+            if (delta_to_flush->isFlushedUntil(version_to_flush))
+            {
+                break;
+            }
+
             if (segment->flushCache(*dm_context))
             {
                 break;
@@ -1052,8 +1091,7 @@ void DeltaMergeStore::readRaw(
     auto after_segment_read = [&](const DMContextPtr & dm_context_, const SegmentPtr & segment_) {
         this->checkSegmentUpdate(dm_context_, segment_, ThreadType::Read, InputType::NotRaft);
     };
-    size_t final_num_stream
-        = enable_read_thread ? std::max(1, num_streams) : std::max(1, std::min(num_streams, tasks.size()));
+    size_t final_num_stream = getFinalNumStreams(db_context.getSettingsRef(), enable_read_thread, num_streams, tasks);
     String req_info;
     if (db_context.getDAGContext() != nullptr && db_context.getDAGContext()->isMPPTask())
         req_info = db_context.getDAGContext()->getMPPTaskId().toString();
@@ -1127,7 +1165,8 @@ ReadMode DeltaMergeStore::getReadMode(
     const Context & db_context,
     bool is_fast_scan,
     bool keep_order,
-    const PushDownFilterPtr & filter)
+    const PushDownFilterPtr & filter,
+    bool count_only)
 {
     auto read_mode = getReadModeImpl(db_context, is_fast_scan, keep_order);
     RUNTIME_CHECK_MSG(
@@ -1135,6 +1174,9 @@ ReadMode DeltaMergeStore::getReadMode(
         "Push down filters needs bitmap, push down filters is empty: {}, read mode: {}",
         filter == nullptr || filter->before_where == nullptr,
         magic_enum::enum_name(read_mode));
+    // The number of rows can be got from the bitmap filter if there is no filter.
+    if (count_only && read_mode == ReadMode::Bitmap && (!filter || (!filter->rs_operator && !filter->before_where)))
+        return ReadMode::Count;
     return read_mode;
 }
 
@@ -1154,7 +1196,8 @@ BlockInputStreams DeltaMergeStore::read(
     size_t expected_block_size,
     const SegmentIdSet & read_segments,
     size_t extra_table_id_index,
-    ScanContextPtr scan_context)
+    ScanContextPtr scan_context,
+    bool count_only)
 {
     // Use the id from MPP/Coprocessor level as tracing_id
     auto dm_context = newDMContext(db_context, db_settings, tracing_id, scan_context);
@@ -1189,7 +1232,9 @@ BlockInputStreams DeltaMergeStore::read(
 
     GET_METRIC(tiflash_storage_read_tasks_count).Increment(tasks.size());
     size_t final_num_stream = std::max(1, std::min(num_streams, tasks.size()));
-    auto read_mode = getReadMode(db_context, is_fast_scan, keep_order, filter);
+    // The runtime filters may be appended to the filter after the read begins, so the rows can not be counted.
+    auto read_mode
+        = getReadMode(db_context, is_fast_scan, keep_order, filter, count_only && runtime_filter_list.empty());
     auto read_task_pool = std::make_shared<SegmentReadTaskPool>(
         extra_table_id_index,
         columns_to_read,
@@ -1263,7 +1308,8 @@ void DeltaMergeStore::read(
     size_t expected_block_size,
     const SegmentIdSet & read_segments,
     size_t extra_table_id_index,
-    ScanContextPtr scan_context)
+    ScanContextPtr scan_context,
+    bool count_only)
 {
     // Use the id from MPP/Coprocessor level as tracing_id
     auto dm_context = newDMContext(db_context, db_settings, tracing_id, scan_context);
@@ -1297,9 +1343,10 @@ void DeltaMergeStore::read(
     };
 
     GET_METRIC(tiflash_storage_read_tasks_count).Increment(tasks.size());
-    size_t final_num_stream
-        = enable_read_thread ? std::max(1, num_streams) : std::max(1, std::min(num_streams, tasks.size()));
-    auto read_mode = getReadMode(db_context, is_fast_scan, keep_order, filter);
+    size_t final_num_stream = getFinalNumStreams(db_context.getSettingsRef(), enable_read_thread, num_streams, tasks);
+    // The runtime filters may be appended to the filter after the read begins, so the rows can not be counted.
+    auto read_mode
+        = getReadMode(db_context, is_fast_scan, keep_order, filter, count_only && runtime_filter_list.empty());
     auto read_task_pool = std::make_shared<SegmentReadTaskPool>(
         extra_table_id_index,
         columns_to_read,
@@ -1409,6 +1456,31 @@ size_t forceMergeDeltaDeletes(const DMContextPtr & dm_context)
     return dm_context->global_context.getSettingsRef().dt_segment_force_merge_delta_deletes;
 }
 
+bool reachSlowdownWrite(const DMContextPtr & dm_context, size_t delta_rows, size_t delta_bytes)
+{
+    const auto & settings = dm_context->global_context.getSettingsRef();
+    const size_t slowdown_rows = settings.dt_segment_slowdown_write_delta_rows;
+    const size_t slowdown_bytes = settings.dt_segment_slowdown_write_delta_size;
+    return (slowdown_rows != 0 && delta_rows >= slowdown_rows)
+        || (slowdown_bytes != 0 && delta_bytes >= slowdown_bytes);
+}
+
+// How far the delta goes from the threshold of slowdown write to the threshold of force merge, in [0, 1].
+double slowdownWriteRatio(const DMContextPtr & dm_context, size_t delta_rows, size_t delta_bytes)
+{
+    auto ratio = [](size_t value, size_t begin, size_t end) {
+        if (begin == 0 || value < begin)
+            return 0.0;
+        if (value >= end || begin >= end)
+            return 1.0;
+        return static_cast<double>(value - begin) / (end - begin);
+    };
+    const auto & settings = dm_context->global_context.getSettingsRef();
+    return std::max(
+        ratio(delta_rows, settings.dt_segment_slowdown_write_delta_rows, forceMergeDeltaRows(dm_context)),
+        ratio(delta_bytes, settings.dt_segment_slowdown_write_delta_size, forceMergeDeltaBytes(dm_context)));
+}
+
 void DeltaMergeStore::waitForWrite(const DMContextPtr & dm_context, const SegmentPtr & segment)
 {
     size_t delta_rows = segment->getDelta()->getRows();
@@ -1416,7 +1488,10 @@ void DeltaMergeStore::waitForWrite(const DMContextPtr & dm_context, const Segmen
 
     // No need to stall the write stall if not exceeding the threshold of force merge.
     if (delta_rows < forceMergeDeltaRows(dm_context) && delta_bytes < forceMergeDeltaBytes(dm_context))
+    {
+        slowdownWrite(dm_context, segment, delta_rows, delta_bytes);
         return;
+    }
 
     // FIXME: checkSegmentUpdate will also count write stalls at each call.
     Stopwatch watch;
@@ -1459,6 +1534,35 @@ void DeltaMergeStore::waitForWrite(const DMContextPtr & dm_context, const Segmen
     }
 }
 
+void DeltaMergeStore::slowdownWrite(
+    const DMContextPtr & dm_context,
+    const SegmentPtr & segment,
+    size_t delta_rows,
+    size_t delta_bytes)
+{
+    const size_t max_sleep_ms = dm_context->global_context.getSettingsRef().dt_segment_slowdown_write_max_ms;
+    size_t sleep_ms = slowdownWriteRatio(dm_context, delta_rows, delta_bytes) * max_sleep_ms;
+    if (sleep_ms == 0)
+        return;
+
+    Stopwatch watch;
+    SCOPE_EXIT(
+        { GET_METRIC(tiflash_storage_write_stall_duration_seconds, type_slowdown).Observe(watch.elapsedSeconds()); });
+
+    // Add the urgent background merge delta task before sleep, see `checkSegmentUpdate`.
+    checkSegmentUpdate(dm_context, segment, ThreadType::Write, InputType::NotRaft);
+
+    // The more the delta exceeds the threshold, the longer the write waits, so that the writes slow down
+    // gradually instead of stopping suddenly when the delta reaches the threshold of force merge.
+    size_t sleep_step = 10;
+    while (!segment->hasAbandoned() && sleep_ms > 0)
+    {
+        size_t ms = std::min(sleep_ms, sleep_step);
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        sleep_ms -= ms;
+    }
+}
+
 void DeltaMergeStore::waitForDeleteRange(const DB::DM::DMContextPtr &, const DB::DM::SegmentPtr &)
 {
     // TODO: maybe we should wait, if there are too many delete ranges?
@@ -1504,8 +1608,10 @@ bool DeltaMergeStore::checkSegmentUpdate(
     auto & delta_last_try_split_bytes = delta->getLastTrySplitBytes();
     auto & delta_last_try_place_delta_index_rows = delta->getLastTryPlaceDeltaIndexRows();
 
-    auto segment_limit_rows = dm_context->segment_limit_rows;
-    auto segment_limit_bytes = dm_context->segment_limit_bytes;
+    // The segments which are only scanned are allowed to be larger, see `Segment::getSegmentLimitFactor`
+    const auto segment_limit_factor = segment->getSegmentLimitFactor(*dm_context);
+    auto segment_limit_rows = dm_context->segment_limit_rows * segment_limit_factor;
+    auto segment_limit_bytes = dm_context->segment_limit_bytes * segment_limit_factor;
     auto delta_limit_rows = dm_context->delta_limit_rows;
     auto delta_limit_bytes = dm_context->delta_limit_bytes;
     auto delta_cache_limit_rows = dm_context->delta_cache_limit_rows;
@@ -1533,6 +1639,8 @@ bool DeltaMergeStore::checkSegmentUpdate(
     bool should_foreground_merge_delta_by_rows_or_bytes
         = delta_check_rows >= forceMergeDeltaRows(dm_context) || delta_check_bytes >= forceMergeDeltaBytes(dm_context);
     bool should_foreground_merge_delta_by_deletes = delta_deletes >= forceMergeDeltaDeletes(dm_context);
+    // The writes to this segment are being slowed down, merge its delta before the other segments.
+    bool should_urgent_merge_delta = reachSlowdownWrite(dm_context, delta_check_rows, delta_check_bytes);
 
     // Note that, we must use || to combine rows and bytes checks in split check, and use && in merge check.
     // Otherwise, segments could be split and merged over and over again.
@@ -1677,7 +1785,8 @@ bool DeltaMergeStore::checkSegmentUpdate(
         if (should_background_merge_delta)
         {
             delta_last_try_merge_delta_rows = delta_rows;
-            try_add_background_task(BackgroundTask{TaskType::MergeDelta, dm_context, segment});
+            try_add_background_task(
+                BackgroundTask{TaskType::MergeDelta, dm_context, segment, should_urgent_merge_delta});
             return true;
         }
         return false;
@@ -36,6 +36,7 @@
 #include <Storages/Page/PageStorage_fwd.h>
 #include <TiDB/Schema/TiDB.h>
 
+#include <deque>
 #include <queue>
 
 namespace DB
@@ -108,6 +109,11 @@ struct SegmentStats
     UInt64 stable_dmfiles_size = 0;
     UInt64 stable_dmfiles_size_on_disk = 0;
     UInt64 stable_dmfiles_packs = 0;
+
+    UInt64 read_full_scans = 0;
+    UInt64 read_range_reads = 0;
+    String read_pattern;
+    UInt64 adaptive_stable_pack_rows = 0;
 };
 using SegmentsStats = std::vector<SegmentStats>;
 
@@ -227,6 +233,8 @@ public:
 
         DMContextPtr dm_context;
         SegmentPtr segment;
+        // The writes to the segment are being slowed down, run this task before the others.
+        bool urgent = false;
 
         explicit operator bool() const { return segment != nullptr; }
     };
@@ -239,7 +247,7 @@ public:
     public:
 #endif
 
-        using TaskQueue = std::queue<BackgroundTask, std::list<BackgroundTask>>;
+        using TaskQueue = std::deque<BackgroundTask>;
         TaskQueue light_tasks;
         TaskQueue heavy_tasks;
 
@@ -415,7 +423,8 @@ public:
         size_t expected_block_size = DEFAULT_BLOCK_SIZE,
         const SegmentIdSet & read_segments = {},
         size_t extra_table_id_index = InvalidColumnID,
-        ScanContextPtr scan_context = nullptr);
+        ScanContextPtr scan_context = nullptr,
+        bool count_only = false);
 
 
     /// Read rows in two modes:
@@ -440,7 +449,8 @@ public:
         size_t expected_block_size = DEFAULT_BLOCK_SIZE,
         const SegmentIdSet & read_segments = {},
         size_t extra_table_id_index = InvalidColumnID,
-        ScanContextPtr scan_context = nullptr);
+        ScanContextPtr scan_context = nullptr,
+        bool count_only = false);
 
     Remote::DisaggPhysicalTableReadSnapshotPtr writeNodeBuildRemoteReadSnapshot(
         const Context & db_context,
@@ -526,11 +536,13 @@ public:
     bool isCommonHandle() const { return is_common_handle; }
     size_t getRowKeyColumnSize() const { return rowkey_column_size; }
 
+    /// `count_only` means only the number of rows is needed by the upper layer.
     static ReadMode getReadMode(
         const Context & db_context,
         bool is_fast_scan,
         bool keep_order,
-        const PushDownFilterPtr & filter);
+        const PushDownFilterPtr & filter,
+        bool count_only = false);
 
 public:
     /// Methods mainly used by region split.
@@ -551,10 +563,13 @@ private:
     static bool pkIsHandle(const ColumnDefine & handle_define) { return handle_define.id != EXTRA_HANDLE_COLUMN_ID; }
 
     /// Try to stall the writing. It will suspend the current thread if flow control is necessary.
-    /// There are roughly two flow control mechanisms:
+    /// There are roughly three flow control mechanisms:
+    /// - Slowdown Write (disabled by default, see slowdown_write_delta_rows|size): Wait for a few milliseconds which
+    ///   grows with the delta size, and raise the priority of the background merge delta of the segment.
     /// - Force Merge (1 GB by default, see force_merge_delta_rows|size): Wait for a small amount of time at most.
     /// - Stop Write (2 GB by default, see stop_write_delta_rows|size): Wait until delta is merged.
     void waitForWrite(const DMContextPtr & context, const SegmentPtr & segment);
+    void slowdownWrite(const DMContextPtr & context, const SegmentPtr & segment, size_t delta_rows, size_t delta_bytes);
 
     void waitForDeleteRange(const DMContextPtr & context, const SegmentPtr & segment);
 
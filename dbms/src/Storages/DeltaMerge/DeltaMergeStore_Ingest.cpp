@@ -1155,7 +1155,8 @@ Segments DeltaMergeStore::buildSegmentsFromCheckpointInfo(
         segment_meta_infos,
         range,
         checkpoint_info->temp_ps,
-        wbs);
+        wbs,
+        dm_context->global_context.getSettingsRef().fap_restore_segment_concurrency);
 
     if (restored_segments.empty())
     {
@@ -321,8 +321,9 @@ std::vector<SegmentPtr> DeltaMergeStore::getMergeableSegments(
     // Note: it is possible that there is a very small segment close to a very large segment.
     // In this case, the small segment will not get merged. It is possible that we can allow
     // segment merging for this case in future.
-    auto max_total_rows = context->segment_limit_rows;
-    auto max_total_bytes = context->segment_limit_bytes;
+    const auto segment_limit_factor = baseSegment->getSegmentLimitFactor(*context);
+    auto max_total_rows = context->segment_limit_rows * segment_limit_factor;
+    auto max_total_bytes = context->segment_limit_bytes * segment_limit_factor;
 
     std::vector<SegmentPtr> results;
     {
@@ -697,7 +698,9 @@ SegmentPtr DeltaMergeStore::gcTrySegmentMerge(const DMContextPtr & dm_context, c
 {
     auto segment_rows = segment->getEstimatedRows();
     auto segment_bytes = segment->getEstimatedBytes();
-    if (segment_rows >= dm_context->segment_limit_rows || segment_bytes >= dm_context->segment_limit_bytes)
+    const auto segment_limit_factor = segment->getSegmentLimitFactor(*dm_context);
+    if (segment_rows >= dm_context->segment_limit_rows * segment_limit_factor
+        || segment_bytes >= dm_context->segment_limit_bytes * segment_limit_factor)
     {
         LOG_TRACE(
             log,
@@ -17,6 +17,8 @@
 #include <Storages/DeltaMerge/StoragePool.h>
 #include <Storages/Page/PageStorage.h>
 
+#include <magic_enum.hpp>
+
 namespace DB
 {
 namespace DM
@@ -144,6 +146,9 @@ StoreStats DeltaMergeStore::getStoreStats()
 
 SegmentsStats DeltaMergeStore::getSegmentsStats()
 {
+    // Used to get the adaptive decisions of segments
+    auto dm_context = newDMContext(global_context, global_context.getSettingsRef(), "getSegmentsStats");
+
     std::shared_lock lock(read_write_mutex);
 
     SegmentsStats stats;
@@ -187,6 +192,12 @@ SegmentsStats DeltaMergeStore::getSegmentsStats()
         stat.stable_dmfiles_size_on_disk = stable->getDMFilesBytesOnDisk();
         stat.stable_dmfiles_packs = stable->getDMFilesPacks();
 
+        stat.read_full_scans = segment->getFullScans();
+        stat.read_range_reads = segment->getRangeReads();
+        const auto read_pattern = segment->getReadPattern(dm_context->adaptive_segment_min_reads);
+        stat.read_pattern = String(magic_enum::enum_name(read_pattern));
+        stat.adaptive_stable_pack_rows = segment->getStablePackRows(*dm_context);
+
         stats.emplace_back(stat);
     }
     return stats;
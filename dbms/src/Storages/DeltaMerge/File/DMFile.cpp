@@ -68,6 +68,7 @@ inline constexpr static const char * FOLDER_PREFIX_DROPPED = ".del.dmf_";
 inline constexpr static const char * DATA_FILE_SUFFIX = ".dat";
 inline constexpr static const char * INDEX_FILE_SUFFIX = ".idx";
 inline constexpr static const char * MARK_FILE_SUFFIX = ".mrk";
+inline constexpr static const char * BLOOM_FILTER_FILE_SUFFIX = ".bf";
 
 inline String getNGCPath(const String & prefix)
 {
@@ -202,6 +203,11 @@ String DMFile::colIndexCacheKey(const FileNameBase & file_name_base) const
     return colIndexPath(file_name_base);
 }
 
+String DMFile::colBloomFilterCacheKey(const FileNameBase & file_name_base) const
+{
+    return subFilePath(colBloomFilterFileName(file_name_base));
+}
+
 String DMFile::colMarkCacheKey(const FileNameBase & file_name_base) const
 {
     return colMarkPath(file_name_base);
@@ -322,6 +328,10 @@ String DMFile::colMarkFileName(const FileNameBase & file_name_base)
 {
     return file_name_base + details::MARK_FILE_SUFFIX;
 }
+String DMFile::colBloomFilterFileName(const FileNameBase & file_name_base)
+{
+    return file_name_base + details::BLOOM_FILTER_FILE_SUFFIX;
+}
 
 DMFile::OffsetAndSize DMFile::writeMetaToBuffer(WriteBuffer & buffer) const
 {
@@ -892,16 +902,33 @@ DMFile::MetaBlockHandle DMFile::writeMergedSubFilePosotionsToBuffer(WriteBuffer
     return MetaBlockHandle{MetaBlockType::MergedSubFilePos, offset, buffer.count() - offset};
 }
 
+DMFile::MetaBlockHandle DMFile::writeBloomFilterIndexToBuffer(WriteBuffer & buffer) const
+{
+    auto offset = buffer.count();
+    writeIntBinary(bloom_filter_bytes.size(), buffer);
+    for (const auto & [col_id, bytes] : bloom_filter_bytes)
+    {
+        writeIntBinary(col_id, buffer);
+        writeIntBinary(bytes, buffer);
+    }
+    return MetaBlockHandle{MetaBlockType::BloomFilterIndex, offset, buffer.count() - offset};
+}
+
 void DMFile::finalizeMetaV2(WriteBuffer & buffer)
 {
     auto tmp_buffer = WriteBufferFromOwnString{};
-    std::array meta_block_handles = {
+    std::vector<MetaBlockHandle> meta_block_handles = {
         writeSLPackStatToBuffer(tmp_buffer),
         writeSLPackPropertyToBuffer(tmp_buffer),
         writeColumnStatToBuffer(tmp_buffer),
         writeMergedSubFilePosotionsToBuffer(tmp_buffer),
     };
-    writePODBinary(meta_block_handles, tmp_buffer);
+    if (!bloom_filter_bytes.empty())
+        meta_block_handles.push_back(writeBloomFilterIndexToBuffer(tmp_buffer));
+    writeString(
+        reinterpret_cast<const char *>(meta_block_handles.data()),
+        meta_block_handles.size() * sizeof(MetaBlockHandle),
+        tmp_buffer);
     writeIntBinary(static_cast<UInt64>(meta_block_handles.size()), tmp_buffer);
     writeIntBinary(version, tmp_buffer);
 
@@ -1000,6 +1027,9 @@ void DMFile::parseMetaV2(std::string_view buffer)
         case MetaBlockType::MergedSubFilePos:
             parseMergedSubFilePos(buffer.substr(handle->offset, handle->size));
             break;
+        case MetaBlockType::BloomFilterIndex:
+            parseBloomFilterIndex(buffer.substr(handle->offset, handle->size));
+            break;
         default:
             throw Exception(
                 ErrorCodes::INCORRECT_DATA,
@@ -1043,6 +1073,22 @@ void DMFile::parseMergedSubFilePos(std::string_view buffer)
     }
 }
 
+void DMFile::parseBloomFilterIndex(std::string_view buffer)
+{
+    ReadBufferFromString rbuf(buffer);
+    size_t count;
+    readIntBinary(count, rbuf);
+    bloom_filter_bytes.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        ColId col_id;
+        UInt64 bytes;
+        readIntBinary(col_id, rbuf);
+        readIntBinary(bytes, rbuf);
+        bloom_filter_bytes.emplace(col_id, bytes);
+    }
+}
+
 void DMFile::parsePackProperty(std::string_view buffer)
 {
     const auto * pp = reinterpret_cast<const PackProperty *>(buffer.data());
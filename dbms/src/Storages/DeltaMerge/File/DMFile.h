@@ -144,6 +144,9 @@ public:
         PackProperty,
         ColumnStat,
         MergedSubFilePos,
+        // Only written when some columns have bloom filter index, so that DMFiles without
+        // bloom filter index can still be read by the older versions.
+        BloomFilterIndex,
     };
     struct MetaBlockHandle
     {
@@ -384,6 +387,9 @@ public:
 
     bool isColIndexExist(const ColId & col_id) const;
 
+    String colBloomFilterCacheKey(const FileNameBase & file_name_base) const;
+    bool isColBloomFilterExist(const ColId & col_id) const { return bloom_filter_bytes.contains(col_id); }
+
     String encryptionBasePath() const;
     EncryptionPath encryptionDataPath(const FileNameBase & file_name_base) const;
     EncryptionPath encryptionIndexPath(const FileNameBase & file_name_base) const;
@@ -409,6 +415,7 @@ public:
     static String colDataFileName(const FileNameBase & file_name_base);
     static String colIndexFileName(const FileNameBase & file_name_base);
     static String colMarkFileName(const FileNameBase & file_name_base);
+    static String colBloomFilterFileName(const FileNameBase & file_name_base);
 
     using OffsetAndSize = std::tuple<size_t, size_t>;
     OffsetAndSize writeMetaToBuffer(WriteBuffer & buffer) const;
@@ -455,10 +462,12 @@ public:
     MetaBlockHandle writeSLPackPropertyToBuffer(WriteBuffer & buffer) const;
     MetaBlockHandle writeColumnStatToBuffer(WriteBuffer & buffer);
     MetaBlockHandle writeMergedSubFilePosotionsToBuffer(WriteBuffer & buffer);
+    MetaBlockHandle writeBloomFilterIndexToBuffer(WriteBuffer & buffer) const;
     std::vector<char> readMetaV2(const FileProviderPtr & file_provider) const;
     void parseMetaV2(std::string_view buffer);
     void parseColumnStat(std::string_view buffer);
     void parseMergedSubFilePos(std::string_view buffer);
+    void parseBloomFilterIndex(std::string_view buffer);
     void parsePackProperty(std::string_view buffer);
     void parsePackStat(std::string_view buffer);
     void finalizeDirName();
@@ -480,6 +489,8 @@ public:
     PackProperties pack_properties;
     ColumnStats column_stats;
     std::unordered_set<ColId> column_indices;
+    // ColId -> bytes of its bloom filter index in the merged file. Only available in DMFileFormat::V3.
+    std::unordered_map<ColId, UInt64> bloom_filter_bytes;
 
     Status status;
     DMConfigurationOpt configuration; // configuration
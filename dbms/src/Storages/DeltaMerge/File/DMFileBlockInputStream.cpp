@@ -16,6 +16,7 @@
 #include <Storages/DeltaMerge/File/DMFileBlockInputStream.h>
 #include <Storages/DeltaMerge/ScanContext.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace DB::DM
@@ -26,7 +27,11 @@ DMFileBlockInputStreamBuilder::DMFileBlockInputStreamBuilder(const Context & con
 {
     // init from global context
     const auto & global_context = context.getGlobalContext();
-    setCaches(global_context.getMarkCache(), global_context.getMinMaxIndexCache());
+    setCaches(
+        global_context.getMarkCache(),
+        global_context.getMinMaxIndexCache(),
+        global_context.getBloomFilterIndexCache(),
+        global_context.getDMFilePackCache());
     // init from settings
     setFromSettings(context.getSettingsRef());
 }
@@ -61,7 +66,8 @@ DMFileBlockInputStreamPtr DMFileBlockInputStreamBuilder::build(
         file_provider,
         read_limiter,
         scan_context,
-        tracing_id);
+        tracing_id,
+        bloom_filter_cache);
 
     bool enable_read_thread = SegmentReaderPoolManager::instance().isSegmentReader();
 
@@ -79,6 +85,15 @@ DMFileBlockInputStreamPtr DMFileBlockInputStreamBuilder::build(
         GET_METRIC(tiflash_storage_read_thread_counter, type_add_cache_total_bytes_limit).Increment();
     }
 
+    // Large scans and one-off scans do not use the decoded pack cache, so that they can not evict the hot packs.
+    if (pack_cache != nullptr)
+    {
+        const auto & use_packs = pack_filter.getUsePacksConst();
+        const size_t read_packs_count = std::count(use_packs.begin(), use_packs.end(), true);
+        if (drop_page_cache || read_packs_count > pack_cache_max_read_packs)
+            pack_cache = nullptr;
+    }
+
     DMFileReader reader(
         dmfile,
         read_columns,
@@ -91,14 +106,18 @@ DMFileBlockInputStreamPtr DMFileBlockInputStreamBuilder::build(
         mark_cache,
         enable_column_cache,
         column_cache,
+        pack_cache,
         aio_threshold,
         max_read_buffer_size,
+        is_fast_scan ? read_ahead_packs_fast_scan : read_ahead_packs,
+        drop_page_cache,
         file_provider,
         read_limiter,
         rows_threshold_per_read,
         read_one_pack_every_time,
         tracing_id,
         max_sharing_column_count,
+        enable_circular_scan && allow_circular_scan && !read_one_pack_every_time,
         scan_context);
 
     return std::make_shared<DMFileBlockInputStream>(std::move(reader), max_sharing_column_count > 0);
@@ -151,6 +151,14 @@ public:
         return *this;
     }
 
+    // Only call this when the caller does not depend on the order of packs, such as fast mode.
+    // Note that `dt_enable_circular_scan` and data sharing must be also enabled.
+    DMFileBlockInputStreamBuilder & enableCircularScan(bool allow_circular_scan_)
+    {
+        allow_circular_scan = allow_circular_scan_;
+        return *this;
+    }
+
 private:
     // These methods are called by the ctor
 
@@ -159,16 +167,25 @@ private:
         enable_column_cache = settings.dt_enable_stable_column_cache;
         aio_threshold = settings.min_bytes_to_use_direct_io;
         max_read_buffer_size = settings.max_read_buffer_size;
+        read_ahead_packs = settings.dt_read_ahead_packs;
+        read_ahead_packs_fast_scan = settings.dt_read_ahead_packs_fast_scan;
+        drop_page_cache = settings.dt_scan_drop_page_cache;
+        pack_cache_max_read_packs = settings.dt_decoded_pack_cache_max_read_packs;
         max_sharing_column_bytes_for_all = settings.dt_max_sharing_column_bytes_for_all;
         max_sharing_column_count = settings.dt_max_sharing_column_count;
+        enable_circular_scan = settings.dt_enable_circular_scan;
         return *this;
     }
     DMFileBlockInputStreamBuilder & setCaches(
         const MarkCachePtr & mark_cache_,
-        const MinMaxIndexCachePtr & index_cache_)
+        const MinMaxIndexCachePtr & index_cache_,
+        const BloomFilterIndexCachePtr & bloom_filter_cache_,
+        const DMFilePackCachePtr & pack_cache_)
     {
         mark_cache = mark_cache_;
         index_cache = index_cache_;
+        bloom_filter_cache = bloom_filter_cache_;
+        pack_cache = pack_cache_;
         return *this;
     }
 
@@ -187,16 +204,26 @@ private:
     IdSetPtr read_packs{};
     MarkCachePtr mark_cache;
     MinMaxIndexCachePtr index_cache;
+    BloomFilterIndexCachePtr bloom_filter_cache;
     // column cache
     bool enable_column_cache = false;
     ColumnCachePtr column_cache;
+    // decoded pack cache, bypassed when reading more packs than `pack_cache_max_read_packs` from a DMFile
+    DMFilePackCachePtr pack_cache;
+    size_t pack_cache_max_read_packs = 0;
     ReadLimiterPtr read_limiter;
     size_t aio_threshold{};
     size_t max_read_buffer_size{};
+    // The read ahead packs for normal mode and fast scan (fast mode and bitmap filter mode)
+    size_t read_ahead_packs = 0;
+    size_t read_ahead_packs_fast_scan = 0;
+    bool drop_page_cache = false;
     size_t rows_threshold_per_read = DMFILE_READ_ROWS_THRESHOLD;
     bool read_one_pack_every_time = false;
     size_t max_sharing_column_bytes_for_all = 0;
     size_t max_sharing_column_count = 0;
+    bool enable_circular_scan = false;
+    bool allow_circular_scan = false;
     String tracing_id;
 };
 
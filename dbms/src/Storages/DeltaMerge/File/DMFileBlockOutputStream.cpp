@@ -17,21 +17,36 @@
 
 namespace DB::DM
 {
+namespace
+{
+DMFileWriter::Options createWriterOptions(const Context & context)
+{
+    const auto & settings = context.getSettingsRef();
+    DMFileWriter::Options options{
+        CompressionSettings(settings.dt_compression_method, settings.dt_compression_level),
+        settings.min_compress_block_size,
+        settings.max_compress_block_size};
+    options.compression_settings.min_saved_ratio = settings.dt_compression_min_saved_ratio;
+    options.enable_lightweight_compression = settings.dt_enable_lightweight_compression;
+    options.write_concurrency = settings.dt_dmfile_write_concurrency;
+    if (settings.dt_enable_bloom_filter_index)
+    {
+        options.bloom_filter_options = BloomFilterIndex::Options{
+            .expected_pack_rows = settings.dt_segment_stable_pack_rows,
+            .bits_per_key = settings.dt_bloom_filter_index_bits_per_key,
+            .ngram_size = settings.dt_bloom_filter_index_ngram_size,
+            .max_dictionary_size = settings.dt_bloom_filter_index_max_dictionary_size,
+        };
+    }
+    return options;
+}
+} // namespace
+
 DMFileBlockOutputStream::DMFileBlockOutputStream(
     const Context & context,
     const DMFilePtr & dmfile,
     const ColumnDefines & write_columns)
-    : writer(
-        dmfile,
-        write_columns,
-        context.getFileProvider(),
-        context.getWriteLimiter(),
-        DMFileWriter::Options{
-            CompressionSettings(
-                context.getSettingsRef().dt_compression_method,
-                context.getSettingsRef().dt_compression_level),
-            context.getSettingsRef().min_compress_block_size,
-            context.getSettingsRef().max_compress_block_size})
+    : writer(dmfile, write_columns, context.getFileProvider(), context.getWriteLimiter(), createWriterOptions(context))
 {}
 
-} // namespace DB::DM
\ No newline at end of file
+} // namespace DB::DM
@@ -0,0 +1,86 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Columns/IColumn.h>
+#include <Common/LRUCache.h>
+#include <Storages/DeltaMerge/DeltaMergeDefines.h>
+
+#include <boost/functional/hash/hash.hpp>
+
+namespace DB::DM
+{
+/// A pack of a column in a DMFile. DMFiles are immutable and their ids are never reused, so the path of
+/// the DMFile is enough to identify the data.
+struct DMFilePackCacheKey
+{
+    String path;
+    ColId col_id;
+    size_t pack_id;
+
+    bool operator==(const DMFilePackCacheKey & rhs) const
+    {
+        return pack_id == rhs.pack_id && col_id == rhs.col_id && path == rhs.path;
+    }
+};
+
+struct DMFilePackCacheKeyHash
+{
+    size_t operator()(const DMFilePackCacheKey & key) const
+    {
+        size_t seed = 0;
+        boost::hash_combine(seed, boost::hash_value(key.path));
+        boost::hash_combine(seed, boost::hash_value(key.col_id));
+        boost::hash_combine(seed, boost::hash_value(key.pack_id));
+        return seed;
+    }
+};
+
+struct DMFilePackCacheValue
+{
+    // The column of the data type on disk, before being converted to the data type of the read column
+    ColumnPtr column;
+};
+using DMFilePackCacheValuePtr = std::shared_ptr<DMFilePackCacheValue>;
+
+struct DMFilePackCacheWeightFunction
+{
+    size_t operator()(const DMFilePackCacheKey & key, const DMFilePackCacheValue & value) const
+    {
+        return value.column->allocatedBytes() + key.path.size() + sizeof(DMFilePackCacheKey)
+            + sizeof(DMFilePackCacheValue) + sizeof(std::list<DMFilePackCacheKey>);
+    }
+};
+
+/// A global cache of the decoded columns of DMFile packs. Unlike `ColumnCache`, which only lives in the
+/// reads of a segment, it is shared by all queries, so the repeated queries on hot packs skip reading,
+/// decompressing and deserializing them. The reads of many packs of a DMFile bypass it, so that a large
+/// scan can not evict the hot packs, see `dt_decoded_pack_cache_max_read_packs`.
+class DMFilePackCache
+    : public LRUCache<DMFilePackCacheKey, DMFilePackCacheValue, DMFilePackCacheKeyHash, DMFilePackCacheWeightFunction>
+{
+private:
+    using Base
+        = LRUCache<DMFilePackCacheKey, DMFilePackCacheValue, DMFilePackCacheKeyHash, DMFilePackCacheWeightFunction>;
+
+public:
+    explicit DMFilePackCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes)
+    {}
+};
+
+using DMFilePackCachePtr = std::shared_ptr<DMFilePackCache>;
+
+} // namespace DB::DM
@@ -54,7 +54,8 @@ public:
         const FileProviderPtr & file_provider,
         const ReadLimiterPtr & read_limiter,
         const ScanContextPtr & scan_context,
-        const String & tracing_id)
+        const String & tracing_id,
+        const BloomFilterIndexCachePtr & bloom_filter_cache = nullptr)
     {
         auto pack_filter = DMFilePackFilter(
             dmfile,
@@ -66,7 +67,8 @@ public:
             file_provider,
             read_limiter,
             scan_context,
-            tracing_id);
+            tracing_id,
+            bloom_filter_cache);
         pack_filter.init();
         return pack_filter;
     }
@@ -127,9 +129,11 @@ private:
         const FileProviderPtr & file_provider_,
         const ReadLimiterPtr & read_limiter_,
         const ScanContextPtr & scan_context_,
-        const String & tracing_id)
+        const String & tracing_id,
+        const BloomFilterIndexCachePtr & bloom_filter_cache_)
         : dmfile(dmfile_)
         , index_cache(index_cache_)
+        , bloom_filter_cache(bloom_filter_cache_)
         , set_cache_if_miss(set_cache_if_miss_)
         , rowkey_ranges(rowkey_ranges_)
         , filter(filter_)
@@ -343,24 +347,109 @@ private:
         indexes.emplace(col_id, RSIndex(type, minmax_index));
     }
 
+    static BloomFilterIndexPtr loadBloomFilter(
+        const DMFilePtr & dmfile,
+        const FileProviderPtr & file_provider,
+        const BloomFilterIndexCachePtr & bloom_filter_cache,
+        bool set_cache_if_miss,
+        ColId col_id,
+        const ReadLimiterPtr & read_limiter,
+        const ScanContextPtr & scan_context)
+    {
+        // Bloom filter index is only written into the merged file of v3
+        RUNTIME_CHECK(dmfile->useMetaV2());
+        const auto file_name_base = DMFile::getFileNameBase(col_id);
+        const auto fname = dmfile->colBloomFilterFileName(file_name_base);
+
+        auto load = [&]() {
+            auto info = dmfile->merged_sub_file_infos.find(fname);
+            if (info == dmfile->merged_sub_file_infos.end())
+            {
+                throw Exception(
+                    fmt::format("Unknown bloom filter file {}", dmfile->subFilePath(fname)),
+                    ErrorCodes::LOGICAL_ERROR);
+            }
+            auto index_file_size = info->second.size;
+            auto index_guard = S3::S3RandomAccessFile::setReadFileInfo(
+                {dmfile->getReadFileSize(col_id, fname), scan_context});
+
+            auto buffer = ReadBufferFromFileProvider(
+                file_provider,
+                dmfile->mergedPath(info->second.number),
+                dmfile->encryptionMergedPath(info->second.number),
+                dmfile->getConfiguration()->getChecksumFrameLength(),
+                read_limiter);
+            buffer.seek(info->second.offset);
+
+            String raw_data;
+            raw_data.resize(index_file_size);
+            buffer.read(reinterpret_cast<char *>(raw_data.data()), index_file_size);
+
+            auto buf = createReadBufferFromData(
+                std::move(raw_data),
+                dmfile->subFilePath(fname),
+                dmfile->getConfiguration()->getChecksumFrameLength(),
+                dmfile->configuration->getChecksumAlgorithm(),
+                dmfile->configuration->getChecksumFrameLength());
+            return BloomFilterIndex::read(*buf);
+        };
+
+        BloomFilterIndexPtr bloom_filter;
+        const auto cache_key = dmfile->colBloomFilterCacheKey(file_name_base);
+        if (bloom_filter_cache && set_cache_if_miss)
+        {
+            bloom_filter = bloom_filter_cache->getOrSet(cache_key, load);
+        }
+        else
+        {
+            if (bloom_filter_cache)
+                bloom_filter = bloom_filter_cache->get(cache_key);
+            if (bloom_filter == nullptr)
+                bloom_filter = load();
+        }
+        return bloom_filter;
+    }
+
     void tryLoadIndex(const ColId col_id)
     {
         if (param.indexes.count(col_id))
             return;
 
-        if (!dmfile->isColIndexExist(col_id))
+        const bool has_minmax = dmfile->isColIndexExist(col_id);
+        const bool has_bloom_filter = dmfile->isColBloomFilterExist(col_id);
+        if (!has_minmax && !has_bloom_filter)
             return;
 
         Stopwatch watch;
-        loadIndex(
-            param.indexes,
-            dmfile,
-            file_provider,
-            index_cache,
-            set_cache_if_miss,
-            col_id,
-            read_limiter,
-            scan_context);
+        if (has_minmax)
+        {
+            loadIndex(
+                param.indexes,
+                dmfile,
+                file_provider,
+                index_cache,
+                set_cache_if_miss,
+                col_id,
+                read_limiter,
+                scan_context);
+        }
+        else
+        {
+            // Only bloom filter index for this column (e.g. string columns)
+            param.indexes.emplace(col_id, RSIndex(dmfile->getColumnStat(col_id).type, nullptr));
+        }
+
+        if (has_bloom_filter)
+        {
+            param.indexes.at(col_id).bloom_filter = loadBloomFilter(
+                dmfile,
+                file_provider,
+                bloom_filter_cache,
+                set_cache_if_miss,
+                col_id,
+                read_limiter,
+                scan_context);
+        }
 
         scan_context->total_dmfile_rough_set_index_check_time_ns += watch.elapsed();
     }
@@ -368,6 +457,7 @@ private:
 private:
     DMFilePtr dmfile;
     MinMaxIndexCachePtr index_cache;
+    BloomFilterIndexCachePtr bloom_filter_cache;
     bool set_cache_if_miss;
     RowKeyRanges rowkey_ranges;
     RSOperatorPtr filter;
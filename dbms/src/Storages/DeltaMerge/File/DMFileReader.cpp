@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include <Columns/ColumnsCommon.h>
+#include <Common/Checksum.h>
 #include <Common/CurrentMetrics.h>
 #include <Common/MemoryTracker.h>
+#include <Common/ProfileEvents.h>
 #include <Common/Stopwatch.h>
 #include <Common/escapeForFileName.h>
 #include <DataTypes/IDataType.h>
@@ -34,10 +36,23 @@
 #include <Storages/S3/S3Common.h>
 #include <Storages/S3/S3RandomAccessFile.h>
 #include <fmt/format.h>
+#include <fcntl.h>
+
 namespace CurrentMetrics
 {
 extern const Metric OpenFileForRead;
-}
+extern const Metric DT_DMFileReadAheadPendingPacks;
+} // namespace CurrentMetrics
+
+namespace ProfileEvents
+{
+extern const Event DMFileReadAheadRequest;
+extern const Event DMFileReadAheadBytes;
+extern const Event DMFileDropPageCacheBytes;
+extern const Event DMFileCircularScan;
+extern const Event DMFilePackCacheHits;
+extern const Event DMFilePackCacheMisses;
+} // namespace ProfileEvents
 
 namespace DB
 {
@@ -51,6 +66,27 @@ extern const char skip_seek_before_read_dmfile[];
 } // namespace FailPoints
 namespace DM
 {
+namespace
+{
+size_t getChecksumFrameHeaderSize(ChecksumAlgo algo)
+{
+    switch (algo)
+    {
+    case ChecksumAlgo::None:
+        return sizeof(ChecksumFrame<Digest::None>);
+    case ChecksumAlgo::CRC32:
+        return sizeof(ChecksumFrame<Digest::CRC32>);
+    case ChecksumAlgo::CRC64:
+        return sizeof(ChecksumFrame<Digest::CRC64>);
+    case ChecksumAlgo::City128:
+        return sizeof(ChecksumFrame<Digest::City128>);
+    case ChecksumAlgo::XXH3:
+        return sizeof(ChecksumFrame<Digest::XXH3>);
+    }
+    throw Exception(fmt::format("Unknown checksum algorithm {}", static_cast<UInt64>(algo)), ErrorCodes::LOGICAL_ERROR);
+}
+} // namespace
+
 DMFileReader::Stream::Stream(
     DMFileReader & reader,
     ColId col_id,
@@ -267,6 +303,98 @@ DMFileReader::Stream::Stream(
             reader.dmfile->configuration->getChecksumAlgorithm(),
             reader.dmfile->configuration->getChecksumFrameLength());
     }
+
+    // Read ahead and dropping page cache are useless for the data merged into the v3 merged file (which is
+    // loaded into memory), the remote data and the data read by direct IO.
+    bool can_read_ahead = (reader.read_ahead_packs > 0 || reader.drop_page_cache)
+        && !S3::S3FilenameView::fromKeyWithPrefix(reader.dmfile->colDataPath(file_name_base)).isValid();
+    if (!reader.dmfile->configuration)
+        can_read_ahead = can_read_ahead && (aio_threshold == 0 || estimated_size < aio_threshold);
+    else if (reader.dmfile->useMetaV2())
+        can_read_ahead = can_read_ahead
+            && !reader.dmfile->merged_sub_file_infos.contains(reader.dmfile->colDataFileName(file_name_base));
+    if (can_read_ahead)
+    {
+        read_ahead_file = reader.file_provider->newRandomAccessFile(
+            reader.dmfile->colDataPath(file_name_base),
+            reader.dmfile->encryptionDataPath(file_name_base));
+        read_ahead_file_size = data_file_size;
+        if (reader.dmfile->configuration)
+        {
+            checksum_frame_size = reader.dmfile->configuration->getChecksumFrameLength();
+            checksum_header_size = getChecksumFrameHeaderSize(reader.dmfile->configuration->getChecksumAlgorithm());
+        }
+    }
+}
+
+size_t DMFileReader::Stream::readAhead(size_t start_pack_id, size_t end_pack_id) const
+{
+    if (!read_ahead_file || read_ahead_file->getFd() < 0 || start_pack_id >= end_pack_id)
+        return 0;
+
+    const size_t packs = marks->size();
+    size_t begin = getOffsetInFile(start_pack_id);
+    // The last compressed block may be shared with the packs after `end_pack_id`
+    while (end_pack_id < packs && getOffsetInDecompressedBlock(end_pack_id) > 0)
+        ++end_pack_id;
+    // 0 length means reading ahead until the end of file
+    size_t length = 0;
+    size_t bytes = read_ahead_file_size > begin ? read_ahead_file_size - begin : 0;
+    if (end_pack_id < packs)
+    {
+        size_t end = getOffsetInFile(end_pack_id);
+        if (checksum_frame_size > 0)
+        {
+            // Convert the offsets of the data to the offsets of the checksum frames in the file
+            const size_t frame_bytes = checksum_header_size + checksum_frame_size;
+            begin = begin / checksum_frame_size * frame_bytes;
+            end = (end + checksum_frame_size - 1) / checksum_frame_size * frame_bytes;
+        }
+        if (end <= begin)
+            return 0;
+        length = end - begin;
+        bytes = length;
+    }
+    else if (checksum_frame_size > 0)
+    {
+        begin = begin / checksum_frame_size * (checksum_header_size + checksum_frame_size);
+    }
+
+#ifdef __linux__
+    // It is only a hint, ignore the error.
+    ::posix_fadvise(read_ahead_file->getFd(), begin, length, POSIX_FADV_WILLNEED);
+    return bytes;
+#else
+    return 0;
+#endif
+}
+
+size_t DMFileReader::Stream::dropPageCache(size_t start_pack_id, size_t end_pack_id) const
+{
+    if (!read_ahead_file || read_ahead_file->getFd() < 0 || start_pack_id >= end_pack_id)
+        return 0;
+
+    const size_t packs = marks->size();
+    size_t begin = getOffsetInFile(start_pack_id);
+    // Unlike read ahead, keep the last compressed block which may be shared with the packs after `end_pack_id`
+    size_t end = end_pack_id < packs ? getOffsetInFile(end_pack_id) : read_ahead_file_size;
+    if (checksum_frame_size > 0)
+    {
+        // Only drop the whole checksum frames, the last frame may be shared with the packs after `end_pack_id`
+        const size_t frame_bytes = checksum_header_size + checksum_frame_size;
+        begin = begin / checksum_frame_size * frame_bytes;
+        end = end_pack_id < packs ? end / checksum_frame_size * frame_bytes : read_ahead_file_size;
+    }
+    if (end <= begin)
+        return 0;
+
+#ifdef __linux__
+    // It is only a hint, ignore the error.
+    ::posix_fadvise(read_ahead_file->getFd(), begin, end - begin, POSIX_FADV_DONTNEED);
+    return end - begin;
+#else
+    return 0;
+#endif
 }
 
 DMFileReader::DMFileReader(
@@ -284,14 +412,18 @@ DMFileReader::DMFileReader(
     const MarkCachePtr & mark_cache_,
     bool enable_column_cache_,
     const ColumnCachePtr & column_cache_,
+    const DMFilePackCachePtr & pack_cache_,
     size_t aio_threshold,
     size_t max_read_buffer_size,
+    size_t read_ahead_packs_,
+    bool drop_page_cache_,
     const FileProviderPtr & file_provider_,
     const ReadLimiterPtr & read_limiter,
     size_t rows_threshold_per_read_,
     bool read_one_pack_every_time_,
     const String & tracing_id_,
     size_t max_sharing_column_count,
+    bool enable_circular_scan_,
     const ScanContextPtr & scan_context_)
     : dmfile(dmfile_)
     , read_columns(read_columns_)
@@ -306,8 +438,14 @@ DMFileReader::DMFileReader(
     , mark_cache(mark_cache_)
     , enable_column_cache(enable_column_cache_ && column_cache_)
     , column_cache(column_cache_)
+    , pack_cache(pack_cache_)
     , scan_context(scan_context_)
     , rows_threshold_per_read(rows_threshold_per_read_)
+    , enable_circular_scan(enable_circular_scan_ && max_sharing_column_count > 0)
+    , scan_end_pack_id(pack_filter.getUsePacksConst().size())
+    , read_ahead_packs(read_ahead_packs_)
+    , read_ahead_pending_packs(CurrentMetrics::DT_DMFileReadAheadPendingPacks, 0)
+    , drop_page_cache(drop_page_cache_)
     , file_provider(file_provider_)
     , log(Logger::get(tracing_id_))
 {
@@ -345,6 +483,9 @@ DMFileReader::DMFileReader(
 
 bool DMFileReader::shouldSeek(size_t pack_id) const
 {
+    // The first pack of each lap of a circular scan does not follow the last read pack.
+    if (scan_start_pack_id != 0 && (pack_id == scan_start_pack_id || pack_id == 0))
+        return true;
     // If current pack is the first one, or we just finished reading the last pack, then no need to seek.
     return pack_id != 0 && !pack_filter.getUsePacksConst()[pack_id - 1];
 }
@@ -354,14 +495,14 @@ bool DMFileReader::getSkippedRows(size_t & skip_rows)
     skip_rows = 0;
     const auto & use_packs = pack_filter.getUsePacksConst();
     const auto & pack_stats = dmfile->getPackStats();
-    for (; next_pack_id < use_packs.size() && !use_packs[next_pack_id]; ++next_pack_id)
+    for (; next_pack_id < scan_end_pack_id && !use_packs[next_pack_id]; ++next_pack_id)
     {
         skip_rows += pack_stats[next_pack_id].rows;
         scan_context->total_dmfile_skipped_packs += 1;
         scan_context->total_dmfile_skipped_rows += pack_stats[next_pack_id].rows;
     }
     next_row_offset += skip_rows;
-    return next_pack_id < use_packs.size();
+    return next_pack_id < scan_end_pack_id;
 }
 
 size_t DMFileReader::skipNextBlock()
@@ -525,13 +666,26 @@ Block DMFileReader::read()
     Stopwatch watch;
     SCOPE_EXIT(scan_context->total_dmfile_read_time_ns += watch.elapsed(););
 
+    if (enable_circular_scan && !circular_scan_inited)
+        initCircularScan();
+
     // Go to next available pack.
     size_t skip_rows;
 
     getSkippedRows(skip_rows);
     const auto & use_packs = pack_filter.getUsePacksConst();
 
-    if (next_pack_id >= use_packs.size())
+    if (next_pack_id >= scan_end_pack_id && scan_end_pack_id != scan_start_pack_id && scan_start_pack_id != 0)
+    {
+        // Wrap around to read the packs before the start of the circular scan.
+        scan_end_pack_id = scan_start_pack_id;
+        next_pack_id = 0;
+        next_row_offset = 0;
+        read_ahead_end_pack_id = 0;
+        getSkippedRows(skip_rows);
+    }
+
+    if (next_pack_id >= scan_end_pack_id)
         return {};
     // Find max continuing rows we can read.
     size_t start_pack_id = next_pack_id;
@@ -550,7 +704,7 @@ Block DMFileReader::read()
 
     const std::vector<RSResult> & handle_res = pack_filter.getHandleRes(); // alias of handle_res in pack_filter
     RSResult expected_handle_res = handle_res[next_pack_id];
-    for (; next_pack_id < use_packs.size() && use_packs[next_pack_id] && read_rows < rows_threshold_per_read;
+    for (; next_pack_id < scan_end_pack_id && use_packs[next_pack_id] && read_rows < rows_threshold_per_read;
          ++next_pack_id)
     {
         if (read_pack_limit != 0 && next_pack_id - start_pack_id >= read_pack_limit)
@@ -578,8 +732,14 @@ Block DMFileReader::read()
     if (read_rows == 0)
         return {};
 
+    // Issue the read ahead before reading current packs, so that they can be done concurrently
+    readAhead();
+
     Block res;
     res.setStartOffset(start_row_offset);
+    // The rows of the packs without not clean rows have distinct handles and none of them is deleted,
+    // the version filter can skip comparing the handles.
+    res.setMVCCClean(not_clean_rows == 0);
 
     size_t read_packs = next_pack_id - start_pack_id;
 
@@ -764,9 +924,78 @@ Block DMFileReader::read()
             e.rethrow();
         }
     }
+    dropPageCache(start_pack_id, next_pack_id);
     return res;
 }
 
+void DMFileReader::readAhead()
+{
+    if (read_ahead_packs == 0)
+        return;
+
+    const auto & use_packs = pack_filter.getUsePacksConst();
+    const size_t window_end = std::min(next_pack_id + read_ahead_packs, scan_end_pack_id);
+    // Avoid issuing too many small requests, only read ahead after half of the window is consumed.
+    if (read_ahead_end_pack_id < next_pack_id + read_ahead_packs / 2 && read_ahead_end_pack_id < window_end)
+    {
+        size_t bytes = 0;
+        size_t requests = 0;
+        for (size_t i = std::max(read_ahead_end_pack_id, next_pack_id); i < window_end;)
+        {
+            if (!use_packs[i])
+            {
+                ++i;
+                continue;
+            }
+            size_t end = i + 1;
+            while (end < window_end && use_packs[end])
+                ++end;
+            for (const auto & [name, stream] : column_streams)
+            {
+                if (size_t hinted = stream->readAhead(i, end); hinted > 0)
+                {
+                    bytes += hinted;
+                    ++requests;
+                }
+            }
+            i = end;
+        }
+        read_ahead_end_pack_id = window_end;
+        ProfileEvents::increment(ProfileEvents::DMFileReadAheadRequest, requests);
+        ProfileEvents::increment(ProfileEvents::DMFileReadAheadBytes, bytes);
+    }
+    const size_t pending_packs = read_ahead_end_pack_id > next_pack_id ? read_ahead_end_pack_id - next_pack_id : 0;
+    read_ahead_pending_packs.changeTo(static_cast<CurrentMetrics::Value>(pending_packs));
+}
+
+void DMFileReader::dropPageCache(size_t start_pack_id, size_t end_pack_id) const
+{
+    if (!drop_page_cache)
+        return;
+
+    size_t bytes = 0;
+    for (const auto & [name, stream] : column_streams)
+        bytes += stream->dropPageCache(start_pack_id, end_pack_id);
+    ProfileEvents::increment(ProfileEvents::DMFileDropPageCacheBytes, bytes);
+}
+
+void DMFileReader::initCircularScan()
+{
+    circular_scan_inited = true;
+    auto position = DMFileReaderPool::instance().getCircularScanPosition(*this);
+    if (!position)
+        return;
+
+    const auto & pack_stats = dmfile->getPackStats();
+    scan_start_pack_id = *position;
+    next_pack_id = scan_start_pack_id;
+    read_ahead_end_pack_id = scan_start_pack_id;
+    for (size_t i = 0; i < scan_start_pack_id; ++i)
+        next_row_offset += pack_stats[i].rows;
+    ProfileEvents::increment(ProfileEvents::DMFileCircularScan);
+    LOG_DEBUG(log, "Start circular scan, start_pack_id={} total_packs={}", scan_start_pack_id, pack_stats.size());
+}
+
 void DMFileReader::readFromDisk(
     const ColumnDefine & column_define,
     MutableColumnPtr & column,
@@ -813,19 +1042,23 @@ void DMFileReader::readColumn(
     size_t skip_packs)
 {
     bool has_concurrent_reader = DMFileReaderPool::instance().hasConcurrentReader(*this);
-    if (!getCachedPacks(column_define.id, start_pack_id, pack_count, read_rows, column))
+    if (!getCachedPacks(column_define.id, start_pack_id, pack_count, read_rows, column)
+        && !getPackCacheColumn(column_define.id, start_pack_id, pack_count, read_rows, column))
     {
         // If there are concurrent read requests, this data is likely to be shared.
         // So the allocation and deallocation of this data may not be in the same MemoryTracker.
         // This can lead to inaccurate memory statistics of MemoryTracker.
         // To solve this problem, we use a independent global memory tracker to trace the shared column data in ColumnSharingCacheMap.
-        auto mem_tracker_guard
-            = has_concurrent_reader ? std::make_optional<MemoryTrackerSetter>(true, nullptr) : std::nullopt;
+        // So does the data put into the decoded pack cache, which is shared by queries.
+        auto mem_tracker_guard = (has_concurrent_reader || pack_cache)
+            ? std::make_optional<MemoryTrackerSetter>(true, nullptr)
+            : std::nullopt;
         auto data_type = dmfile->getColumnStat(column_define.id).type;
         auto col = data_type->createColumn();
         readFromDisk(column_define, col, start_pack_id, read_rows, skip_packs, last_read_from_cache[column_define.id]);
         column = std::move(col);
         last_read_from_cache[column_define.id] = false;
+        setPackCacheColumns(column_define.id, start_pack_id, pack_count, column);
     }
     else
     {
@@ -844,7 +1077,8 @@ void DMFileReader::addCachedPacks(ColId col_id, size_t start_pack_id, size_t pac
     {
         return;
     }
-    if (next_pack_id >= start_pack_id + pack_count)
+    // The packs after `scan_end_pack_id` have been read before a circular scan wraps around.
+    if (next_pack_id >= start_pack_id + pack_count || start_pack_id >= scan_end_pack_id)
     {
         col_data_cache->addStale();
     }
@@ -854,6 +1088,13 @@ void DMFileReader::addCachedPacks(ColId col_id, size_t start_pack_id, size_t pac
     }
 }
 
+std::optional<size_t> DMFileReader::getScanPosition() const
+{
+    if (next_pack_id == 0 || next_pack_id >= scan_end_pack_id)
+        return std::nullopt;
+    return next_pack_id;
+}
+
 bool DMFileReader::getCachedPacks(
     ColId col_id,
     size_t start_pack_id,
@@ -870,5 +1111,63 @@ bool DMFileReader::getCachedPacks(
     col_data_cache->del(col_id, next_pack_id);
     return found;
 }
+
+bool DMFileReader::getPackCacheColumn(
+    ColId col_id,
+    size_t start_pack_id,
+    size_t pack_count,
+    size_t read_rows,
+    ColumnPtr & col) const
+{
+    if (pack_cache == nullptr)
+        return false;
+
+    const auto file_path = path();
+    std::vector<ColumnPtr> columns;
+    columns.reserve(pack_count);
+    for (size_t pack_id = start_pack_id; pack_id < start_pack_id + pack_count; ++pack_id)
+    {
+        auto value = pack_cache->get(DMFilePackCacheKey{file_path, col_id, pack_id});
+        if (value == nullptr)
+        {
+            ProfileEvents::increment(ProfileEvents::DMFilePackCacheMisses);
+            return false;
+        }
+        columns.push_back(value->column);
+    }
+    ProfileEvents::increment(ProfileEvents::DMFilePackCacheHits);
+
+    if (columns.size() == 1)
+    {
+        col = columns[0];
+        return true;
+    }
+    auto res = columns[0]->cloneEmpty();
+    res->reserve(read_rows);
+    for (const auto & column : columns)
+        res->insertRangeFrom(*column, 0, column->size());
+    col = std::move(res);
+    return true;
+}
+
+void DMFileReader::setPackCacheColumns(ColId col_id, size_t start_pack_id, size_t pack_count, const ColumnPtr & col)
+    const
+{
+    if (pack_cache == nullptr)
+        return;
+
+    const auto file_path = path();
+    const auto & pack_stats = dmfile->getPackStats();
+    size_t offset = 0;
+    for (size_t pack_id = start_pack_id; pack_id < start_pack_id + pack_count; ++pack_id)
+    {
+        const size_t rows = pack_stats[pack_id].rows;
+        auto value = std::make_shared<DMFilePackCacheValue>();
+        // Columns are immutable once they are read, so the column of a single pack can be shared directly.
+        value->column = pack_count == 1 ? col : col->cut(offset, rows);
+        pack_cache->set(DMFilePackCacheKey{file_path, col_id, pack_id}, value);
+        offset += rows;
+    }
+}
 } // namespace DM
 } // namespace DB
@@ -14,12 +14,15 @@
 
 #pragma once
 
+#include <Common/CurrentMetrics.h>
 #include <DataStreams/MarkInCompressedFile.h>
 #include <Encryption/CompressedReadBufferFromFileProvider.h>
+#include <Encryption/RandomAccessFile.h>
 #include <Storages/DeltaMerge/DeltaMergeDefines.h>
 #include <Storages/DeltaMerge/DeltaMergeHelpers.h>
 #include <Storages/DeltaMerge/File/ColumnCache.h>
 #include <Storages/DeltaMerge/File/DMFile.h>
+#include <Storages/DeltaMerge/File/DMFilePackCache.h>
 #include <Storages/DeltaMerge/File/DMFilePackFilter.h>
 #include <Storages/DeltaMerge/ReadThread/ColumnSharingCache.h>
 #include <Storages/DeltaMerge/RowKeyRange.h>
@@ -59,6 +62,22 @@ public:
         size_t getOffsetInDecompressedBlock(size_t i) const { return (*marks)[i].offset_in_decompressed_block; }
 
         std::unique_ptr<CompressedSeekableReaderBuffer> buf;
+
+        /// Hint the OS to load the data of packs [start_pack_id, end_pack_id) into page cache asynchronously,
+        /// so that the device can serve the following reads while we are decompressing the current packs.
+        /// Return the number of bytes hinted, 0 if read ahead is not available for this stream.
+        size_t readAhead(size_t start_pack_id, size_t end_pack_id) const;
+
+        /// Hint the OS to drop the page cache of packs [start_pack_id, end_pack_id) which have been read.
+        /// Return the number of bytes hinted, 0 if it is not available for this stream.
+        size_t dropPageCache(size_t start_pack_id, size_t end_pack_id) const;
+
+        // Only available for the local data files which are read through page cache.
+        RandomAccessFilePtr read_ahead_file;
+        size_t read_ahead_file_size = 0;
+        // The offsets in marks exclude the checksum frame headers, 0 if the data file is not framed.
+        size_t checksum_frame_size = 0;
+        size_t checksum_header_size = 0;
     };
     using StreamPtr = std::unique_ptr<Stream>;
     using ColumnStreams = std::map<String, StreamPtr>;
@@ -82,14 +101,22 @@ public:
         const MarkCachePtr & mark_cache_,
         bool enable_column_cache_,
         const ColumnCachePtr & column_cache_,
+        // nullptr means not to use the decoded pack cache
+        const DMFilePackCachePtr & pack_cache_,
         size_t aio_threshold,
         size_t max_read_buffer_size,
+        // The number of packs to read ahead, 0 means disable read ahead.
+        size_t read_ahead_packs_,
+        // Whether to drop the page cache of the packs after reading them.
+        bool drop_page_cache_,
         const FileProviderPtr & file_provider_,
         const ReadLimiterPtr & read_limiter,
         size_t rows_threshold_per_read_,
         bool read_one_pack_every_time_,
         const String & tracing_id_,
         size_t max_sharing_column_count,
+        // Whether the packs can be returned in any order, see `enable_circular_scan`.
+        bool enable_circular_scan_,
         const ScanContextPtr & scan_context_);
 
     Block getHeader() const { return toEmptyBlock(read_columns); }
@@ -116,6 +143,8 @@ public:
         return DMFile::getPathByStatus(dmfile->parentPath(), dmfile->fileId(), DMFile::Status::READABLE);
     }
     void addCachedPacks(ColId col_id, size_t start_pack_id, size_t pack_count, ColumnPtr & col) const;
+    // Return the next pack to read if the reader is in the middle of scanning the DMFile.
+    std::optional<size_t> getScanPosition() const;
 
 private:
     bool shouldSeek(size_t pack_id) const;
@@ -135,6 +164,18 @@ private:
         size_t read_rows,
         size_t skip_packs);
     bool getCachedPacks(ColId col_id, size_t start_pack_id, size_t pack_count, size_t read_rows, ColumnPtr & col) const;
+    // Get the packs [start_pack_id, start_pack_id + pack_count) from the decoded pack cache, return false if any
+    // of them is not cached.
+    bool getPackCacheColumn(ColId col_id, size_t start_pack_id, size_t pack_count, size_t read_rows, ColumnPtr & col)
+        const;
+    // Put the packs [start_pack_id, start_pack_id + pack_count) read from disk into the decoded pack cache.
+    void setPackCacheColumns(ColId col_id, size_t start_pack_id, size_t pack_count, const ColumnPtr & col) const;
+    // Read ahead the packs after `next_pack_id` for all column streams.
+    void readAhead();
+    // Drop the page cache of packs [start_pack_id, end_pack_id) for all column streams.
+    void dropPageCache(size_t start_pack_id, size_t end_pack_id) const;
+    // Start from the position of a concurrent reader of the same DMFile. Called before the first read.
+    void initCircularScan();
 
     DMFilePtr dmfile;
     ColumnDefines read_columns;
@@ -171,6 +212,7 @@ private:
     MarkCachePtr mark_cache;
     const bool enable_column_cache;
     ColumnCachePtr column_cache;
+    DMFilePackCachePtr pack_cache;
 
     const ScanContextPtr scan_context;
 
@@ -179,6 +221,28 @@ private:
     size_t next_pack_id = 0;
     size_t next_row_offset = 0;
 
+    /// Circular scan
+    // If true, a reader starting later than another reader of the same DMFile begins at the position of that
+    // reader, so that they can share the packs read by each other. After reaching the end of the DMFile, it
+    // wraps around to read the packs before the position.
+    const bool enable_circular_scan;
+    bool circular_scan_inited = false;
+    // The first pack to read, 0 if the reader does not join another reader.
+    size_t scan_start_pack_id = 0;
+    // The end of the packs to read in the current lap, it is the number of packs before wrapping around
+    // and `scan_start_pack_id` after that.
+    size_t scan_end_pack_id;
+
+    /// Read ahead
+    const size_t read_ahead_packs;
+    // The packs before it have been read ahead.
+    size_t read_ahead_end_pack_id = 0;
+    // The number of packs which have been read ahead but not read yet.
+    CurrentMetrics::Increment read_ahead_pending_packs;
+
+    // Drop the page cache of the packs after reading them, for the one-off scans.
+    const bool drop_page_cache;
+
     FileProviderPtr file_provider;
 
     LoggerPtr log;
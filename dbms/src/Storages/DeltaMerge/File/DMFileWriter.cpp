@@ -14,6 +14,7 @@
 
 #include <Common/TiFlashException.h>
 #include <Encryption/createWriteBufferFromFileBaseByFileProvider.h>
+#include <IO/IOThreadPools.h>
 #include <Storages/DeltaMerge/DeltaMergeHelpers.h>
 #include <Storages/DeltaMerge/File/DMFileWriter.h>
 #include <Storages/S3/S3Common.h>
@@ -24,11 +25,41 @@
 #include <unistd.h>
 #endif
 
+#include <future>
+
 
 namespace DB
 {
 namespace DM
 {
+namespace
+{
+CompressionSettings getStreamCompressionSettings(
+    const DMFileWriter::Options & options,
+    const DataTypePtr & type,
+    const IDataType::SubstreamPath & substream_path)
+{
+    auto compression_settings = options.compression_settings;
+    if (!options.enable_lightweight_compression || substream_path.size() > 1)
+        return compression_settings;
+
+    // The null map is an array of UInt8, the elements of nullable column is the same as its nested column
+    if (IDataType::isNullMap(substream_path))
+    {
+        compression_settings.integer_width = sizeof(UInt8);
+        compression_settings.integer_signed = false;
+        return compression_settings;
+    }
+    const auto data_type = removeNullable(type);
+    if (data_type->isValueRepresentedByInteger())
+    {
+        compression_settings.integer_width = data_type->getSizeOfValueInMemory();
+        compression_settings.integer_signed = !data_type->isUnsignedInteger() && !data_type->isDateOrDateTime();
+    }
+    return compression_settings;
+}
+} // namespace
+
 DMFileWriter::DMFileWriter(
     const DMFilePtr & dmfile_,
     const ColumnDefines & write_columns_,
@@ -63,7 +94,10 @@ DMFileWriter::DMFileWriter(
         /// for handle column always generate index
         auto type = removeNullable(cd.type);
         bool do_index = cd.id == EXTRA_HANDLE_COLUMN_ID || type->isInteger() || type->isDateOrDateTime();
-        addStreams(cd.id, cd.type, do_index);
+        // Bloom filter index is stored in the merged file, so it requires DMFileFormat::V3.
+        bool do_bloom_filter = options.bloom_filter_options.has_value() && dmfile->useMetaV2()
+            && cd.id != EXTRA_HANDLE_COLUMN_ID && type->isString();
+        addStreams(cd.id, cd.type, do_index, do_bloom_filter);
         dmfile->column_stats.emplace(cd.id, ColumnStat{cd.id, cd.type, /*avg_size=*/0});
     }
 }
@@ -112,7 +146,7 @@ DMFileWriter::WriteBufferFromFileBasePtr DMFileWriter::createPackStatsFile()
                                      options.max_compress_block_size);
 }
 
-void DMFileWriter::addStreams(ColId col_id, DataTypePtr type, bool do_index)
+void DMFileWriter::addStreams(ColId col_id, DataTypePtr type, bool do_index, bool do_bloom_filter)
 {
     auto callback = [&](const IDataType::SubstreamPath & substream_path) {
         const auto stream_name = DMFile::getFileNameBase(col_id, substream_path);
@@ -120,11 +154,12 @@ void DMFileWriter::addStreams(ColId col_id, DataTypePtr type, bool do_index)
             dmfile,
             stream_name,
             type,
-            options.compression_settings,
+            getStreamCompressionSettings(options, type, substream_path),
             options.max_compress_block_size,
             file_provider,
             write_limiter,
-            IDataType::isNullMap(substream_path) ? false : do_index);
+            IDataType::isNullMap(substream_path) ? false : do_index,
+            (do_bloom_filter && !IDataType::isNullMap(substream_path)) ? options.bloom_filter_options : std::nullopt);
         column_streams.emplace(stream_name, std::move(stream));
     };
 
@@ -145,15 +180,14 @@ void DMFileWriter::write(const Block & block, const BlockProperty & block_proper
     const ColumnVector<UInt8> * del_mark
         = !del_mark_column ? nullptr : static_cast<const ColumnVector<UInt8> *>(del_mark_column.get());
 
+    writeColumns(block, del_mark);
+
     for (auto & cd : write_columns)
     {
-        const auto & col = getByColumnId(block, cd.id).column;
-        writeColumn(cd.id, *cd.type, *col, del_mark);
-
         if (cd.id == VERSION_COLUMN_ID)
-            stat.first_version = col->get64(0);
+            stat.first_version = getByColumnId(block, cd.id).column->get64(0);
         else if (cd.id == TAG_COLUMN_ID)
-            stat.first_tag = static_cast<UInt8>(col->get64(0));
+            stat.first_tag = static_cast<UInt8>(getByColumnId(block, cd.id).column->get64(0));
     }
 
     dmfile->addPack(stat);
@@ -165,6 +199,61 @@ void DMFileWriter::write(const Block & block, const BlockProperty & block_proper
     property->set_deleted_rows(block_property.deleted_rows);
 }
 
+void DMFileWriter::writeColumns(const Block & block, const ColumnVector<UInt8> * del_mark)
+{
+    // Every column has its own streams, so the columns can be compressed and written concurrently.
+    auto * pool = DMFileWritePool::tryGet();
+    const size_t concurrency = std::min(options.write_concurrency, write_columns.size());
+    if (concurrency <= 1 || pool == nullptr)
+    {
+        for (auto & cd : write_columns)
+            writeColumn(cd.id, *cd.type, *getByColumnId(block, cd.id).column, del_mark);
+        return;
+    }
+
+    auto write_group = [&](size_t group) {
+        for (size_t i = group; i < write_columns.size(); i += concurrency)
+        {
+            const auto & cd = write_columns[i];
+            writeColumn(cd.id, *cd.type, *getByColumnId(block, cd.id).column, del_mark);
+        }
+    };
+    std::vector<std::future<void>> results;
+    results.reserve(concurrency - 1);
+    for (size_t group = 1; group < concurrency; ++group)
+    {
+        auto task = std::make_shared<std::packaged_task<void()>>([&write_group, group] { write_group(group); });
+        results.push_back(task->get_future());
+        if (!pool->trySchedule([task] { (*task)(); }))
+            (*task)(); // The pool is full, write this group in the current thread.
+    }
+
+    // The tasks refer to the block and the streams, wait for all of them before throwing any exception.
+    std::exception_ptr first_exception;
+    try
+    {
+        write_group(0);
+    }
+    catch (...)
+    {
+        first_exception = std::current_exception();
+    }
+    for (auto & f : results)
+    {
+        try
+        {
+            f.get();
+        }
+        catch (...)
+        {
+            if (!first_exception)
+                first_exception = std::current_exception();
+        }
+    }
+    if (first_exception)
+        std::rethrow_exception(first_exception);
+}
+
 void DMFileWriter::finalize()
 {
     for (auto & cd : write_columns)
@@ -223,6 +312,8 @@ void DMFileWriter::writeColumn(
                     column,
                     (col_id == EXTRA_HANDLE_COLUMN_ID || col_id == TAG_COLUMN_ID) ? nullptr : del_mark);
             }
+            if (stream->bloom_filter)
+                stream->bloom_filter->addPack(column, del_mark);
 
             /// There could already be enough data to compress into the new block.
             if (stream->compressed_buf->offset() >= options.min_compress_block_size)
@@ -344,6 +435,34 @@ void DMFileWriter::finalizeColumn(ColId col_id, DataTypePtr type)
                 buffer->next();
             }
 
+            // write bloom filter index into merged_file_writer
+            if (stream->bloom_filter && !is_empty_file)
+            {
+                dmfile->checkMergedFile(merged_file, file_provider, write_limiter);
+
+                auto fname = dmfile->colBloomFilterFileName(stream_name);
+
+                auto buffer = createWriteBufferFromFileBaseByWriterBuffer(
+                    merged_file.buffer,
+                    dmfile->configuration->getChecksumAlgorithm(),
+                    dmfile->configuration->getChecksumFrameLength());
+
+                stream->bloom_filter->write(*buffer);
+
+                auto bloom_filter_bytes = buffer->getMaterializedBytes();
+                MergedSubFileInfo info{
+                    fname,
+                    merged_file.file_info.number,
+                    merged_file.file_info.size,
+                    bloom_filter_bytes};
+                dmfile->merged_sub_file_infos[fname] = info;
+                dmfile->bloom_filter_bytes[col_id] = bloom_filter_bytes;
+
+                merged_file.file_info.size += bloom_filter_bytes;
+                bytes_written += bloom_filter_bytes;
+                buffer->next();
+            }
+
             // write mark into merged_file_writer
             if (!is_empty_file)
             {
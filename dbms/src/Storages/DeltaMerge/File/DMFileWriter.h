@@ -22,6 +22,7 @@
 #include <IO/WriteBufferFromOStream.h>
 #include <Storages/DeltaMerge/DMChecksumConfig.h>
 #include <Storages/DeltaMerge/File/DMFile.h>
+#include <Storages/DeltaMerge/Index/BloomFilterIndex.h>
 #include <Storages/DeltaMerge/Index/MinMaxIndex.h>
 
 namespace DB
@@ -53,7 +54,8 @@ public:
             size_t max_compress_block_size,
             FileProviderPtr & file_provider,
             const WriteLimiterPtr & write_limiter_,
-            bool do_index)
+            bool do_index,
+            const std::optional<BloomFilterIndex::Options> & bloom_filter_options)
             : plain_file(WriteBufferByFileProviderBuilder(
                              dmfile->configuration.has_value(),
                              file_provider,
@@ -71,6 +73,7 @@ public:
                                         : std::unique_ptr<WriteBuffer>(
                                             new CompressedWriteBuffer<true>(*plain_file, compression_settings)))
             , minmaxes(do_index ? std::make_shared<MinMaxIndex>(*type) : nullptr)
+            , bloom_filter(bloom_filter_options ? BloomFilterIndex::create(*bloom_filter_options) : nullptr)
         {
             if (!dmfile->useMetaV2())
             {
@@ -98,6 +101,8 @@ public:
 
         MinMaxIndexPtr minmaxes;
 
+        BloomFilterIndexPtr bloom_filter;
+
         MarksInCompressedFilePtr marks;
 
         WriteBufferFromFileBasePtr mark_file;
@@ -118,6 +123,12 @@ public:
         CompressionSettings compression_settings;
         size_t min_compress_block_size{};
         size_t max_compress_block_size{};
+        // Build bloom filter index for string columns. Only take effects for DMFileFormat::V3.
+        std::optional<BloomFilterIndex::Options> bloom_filter_options;
+        // Try the lightweight encodings (FOR and Delta) before compressing the integer columns.
+        bool enable_lightweight_compression = false;
+        // The max number of threads to write the columns of a block, 1 means writing in the current thread.
+        size_t write_concurrency = 1;
 
         Options() = default;
 
@@ -149,6 +160,9 @@ public:
 
 private:
     void finalizeColumn(ColId col_id, DataTypePtr type);
+    /// Write the columns of the block, the columns are split into groups and written in `DMFileWritePool`
+    /// if `options.write_concurrency` > 1.
+    void writeColumns(const Block & block, const ColumnVector<UInt8> * del_mark);
     void writeColumn(
         ColId col_id,
         const IDataType & type,
@@ -158,7 +172,7 @@ private:
     /// Add streams with specified column id. Since a single column may have more than one Stream,
     /// for example Nullable column has a NullMap column, we would track them with a mapping
     /// FileNameBase -> Stream.
-    void addStreams(ColId col_id, DataTypePtr type, bool do_index);
+    void addStreams(ColId col_id, DataTypePtr type, bool do_index, bool do_bloom_filter);
 
     WriteBufferFromFileBasePtr createMetaFile();
     WriteBufferFromFileBasePtr createMetaV2File();
@@ -32,8 +32,14 @@ public:
     RSResults roughCheck(size_t start_pack, size_t pack_count, const RSCheckParam & param) override
     {
         RSResults results(pack_count, RSResult::Some);
-        GET_RSINDEX_FROM_PARAM_NOT_FOUND_RETURN_DIRECTLY(param, attr, rsindex, results);
-        return rsindex.minmax->checkCmp<RoughCheck::CheckEqual>(start_pack, pack_count, value, rsindex.type);
+        const auto * rsindex = tryGetRSIndex(param, attr);
+        if (!rsindex)
+            return results;
+        if (canCheckByMinMax(*rsindex))
+            results = rsindex->minmax->checkCmp<RoughCheck::CheckEqual>(start_pack, pack_count, value, rsindex->type);
+        if (rsindex->bloom_filter)
+            rsindex->bloom_filter->checkEqual(start_pack, pack_count, value, results);
+        return results;
     }
 };
 
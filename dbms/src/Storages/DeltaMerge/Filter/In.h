@@ -56,8 +56,14 @@ public:
         if (values.empty())
             return RSResults(pack_count, RSResult::None);
         RSResults results(pack_count, RSResult::Some);
-        GET_RSINDEX_FROM_PARAM_NOT_FOUND_RETURN_DIRECTLY(param, attr, rsindex, results);
-        return rsindex.minmax->checkIn(start_pack, pack_count, values, rsindex.type);
+        const auto * rsindex = tryGetRSIndex(param, attr);
+        if (!rsindex)
+            return results;
+        if (canCheckByMinMax(*rsindex))
+            results = rsindex->minmax->checkIn(start_pack, pack_count, values, rsindex->type);
+        if (rsindex->bloom_filter)
+            rsindex->bloom_filter->checkIn(start_pack, pack_count, values, results);
+        return results;
     }
 };
 
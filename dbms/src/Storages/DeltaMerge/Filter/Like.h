@@ -21,16 +21,35 @@ namespace DB::DM
 
 class Like : public ColCmpVal
 {
+    char escape_char;
+
 public:
-    Like(const Attr & attr_, const Field & value_)
+    Like(const Attr & attr_, const Field & value_, char escape_char_ = '\\')
         : ColCmpVal(attr_, value_)
+        , escape_char(escape_char_)
     {}
 
     String name() override { return "like"; }
 
-    RSResults roughCheck(size_t /*start_pack*/, size_t pack_count, const RSCheckParam & /*param*/) override
+    String toDebugString() override
+    {
+        return fmt::format(
+            R"({{"op":"{}","col":"{}","value":"{}","escape":"{}"}})",
+            name(),
+            attr.col_name,
+            applyVisitor(FieldVisitorToDebugString(), value),
+            static_cast<Int32>(escape_char));
+    }
+
+    RSResults roughCheck(size_t start_pack, size_t pack_count, const RSCheckParam & param) override
     {
-        return RSResults(pack_count, Some);
+        RSResults results(pack_count, RSResult::Some);
+        // Only the bloom filter index (the ngram filters and the dictionaries) can be used to check like
+        const auto * rsindex = tryGetRSIndex(param, attr);
+        if (!rsindex || !rsindex->bloom_filter || value.getType() != Field::Types::String)
+            return results;
+        rsindex->bloom_filter->checkLike(start_pack, pack_count, value.get<String>(), escape_char, results);
+        return results;
     }
 };
 
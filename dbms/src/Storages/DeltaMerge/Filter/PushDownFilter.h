@@ -16,9 +16,39 @@
 
 #include <Interpreters/ExpressionActions.h>
 #include <Storages/DeltaMerge/Filter/RSOperator.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold.h>
+
+#include <atomic>
 
 namespace DB::DM
 {
+/// The selectivity of the pushed down filter measured at runtime by late materialization.
+/// It is shared by all segments read by the same query.
+struct PushDownFilterSelectivity
+{
+    std::atomic<size_t> total_rows = 0;
+    std::atomic<size_t> passed_rows = 0;
+
+    void record(size_t total, size_t passed)
+    {
+        total_rows.fetch_add(total, std::memory_order_relaxed);
+        passed_rows.fetch_add(passed, std::memory_order_relaxed);
+    }
+
+    /// Return true if at least `sample_rows` rows have been filtered, and the ratio of passed rows
+    /// is not less than `max_passed_ratio`. That is to say, the filter is hardly filtering out any
+    /// rows and late materialization is not paying off.
+    bool isUnselective(size_t sample_rows, double max_passed_ratio) const
+    {
+        if (sample_rows == 0)
+            return false;
+        const auto total = total_rows.load(std::memory_order_relaxed);
+        if (total < sample_rows)
+            return false;
+        return passed_rows.load(std::memory_order_relaxed) >= max_passed_ratio * total;
+    }
+};
+using PushDownFilterSelectivityPtr = std::shared_ptr<PushDownFilterSelectivity>;
 
 class PushDownFilter;
 using PushDownFilterPtr = std::shared_ptr<PushDownFilter>;
@@ -48,6 +78,28 @@ public:
         : rs_operator(rs_operator_)
     {}
 
+    void setTopNThreshold(const TopNThresholdPtr & topn_threshold_, const Attr & topn_attr_)
+    {
+        topn_threshold = topn_threshold_;
+        topn_attr = topn_attr_;
+    }
+
+    /// Return the filter to read a segment, whose rough set operator also includes the current threshold
+    /// of the TopN above the table scan. The threshold is snapshotted so that all the streams of the same
+    /// segment see the same rough set operator.
+    PushDownFilterPtr withTopNThreshold()
+    {
+        if (!topn_threshold)
+            return shared_from_this();
+        auto topn_rs = topn_threshold->toRSOperator(topn_attr);
+        if (!topn_rs)
+            return shared_from_this();
+        auto res = std::make_shared<PushDownFilter>(*this);
+        res->rs_operator = rs_operator ? createAnd({rs_operator, topn_rs}) : topn_rs;
+        res->topn_threshold = nullptr;
+        return res;
+    }
+
     // Rough set operator
     RSOperatorPtr rs_operator;
     // Filter expression actions and the name of the tmp filter column
@@ -64,6 +116,11 @@ public:
     const ExpressionActionsPtr extra_cast;
     // If the extra_cast is not null, the types of the columns may be changed
     const ColumnDefinesPtr columns_after_cast;
+    // The selectivity of `before_where` measured when reading
+    const PushDownFilterSelectivityPtr selectivity = std::make_shared<PushDownFilterSelectivity>();
+    // The running threshold of the TopN above the table scan and the attr of its column
+    TopNThresholdPtr topn_threshold;
+    Attr topn_attr;
 };
 
 } // namespace DB::DM
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <Common/FieldVisitors.h>
+#include <DataTypes/DataTypeNullable.h>
 #include <Storages/DeltaMerge/DeltaMergeDefines.h>
 #include <Storages/DeltaMerge/Index/RSIndex.h>
 #include <Storages/DeltaMerge/Index/RSResult.h>
@@ -116,9 +117,26 @@ public:
     if (it == (param).indexes.end())                                                \
         return (res);                                                               \
     auto(rsindex) = it->second;                                                     \
-    if (!(rsindex).type->equals(*(attr).type))                                      \
+    if (!(rsindex).type->equals(*(attr).type) || !(rsindex).minmax)                 \
         return (res);
 
+/// Return the index of `attr`, or nullptr if not found or type mismatch.
+/// Note that the minmax index may not exist if the column only has bloom filter index.
+inline const RSIndex * tryGetRSIndex(const RSCheckParam & param, const Attr & attr)
+{
+    auto it = param.indexes.find(attr.col_id);
+    if (it == param.indexes.end() || !it->second.type->equals(*attr.type))
+        return nullptr;
+    return &it->second;
+}
+
+/// The minmax index compares strings byte-wise, which does not match the padding or case insensitive collations,
+/// so the string values are only checked by the bloom filter index.
+inline bool canCheckByMinMax(const RSIndex & rsindex)
+{
+    return rsindex.minmax && !removeNullable(rsindex.type)->isStringOrFixedString();
+}
+
 // logical
 RSOperatorPtr createNot(const RSOperatorPtr & op);
 RSOperatorPtr createOr(const RSOperators & children);
@@ -133,7 +151,7 @@ RSOperatorPtr createLessEqual(const Attr & attr, const Field & value);
 // set
 RSOperatorPtr createIn(const Attr & attr, const Fields & values);
 //
-RSOperatorPtr createLike(const Attr & attr, const Field & value);
+RSOperatorPtr createLike(const Attr & attr, const Field & value, char escape_char = '\\');
 //
 RSOperatorPtr createIsNull(const Attr & attr);
 //
@@ -0,0 +1,48 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Storages/DeltaMerge/Filter/TopNThreshold.h>
+
+namespace DB::DM
+{
+void TopNThreshold::update(const Block & block, size_t limit)
+{
+    if (limit == 0 || block.rows() < limit)
+        return;
+
+    Field value;
+    block.getByName(column_name).column->get(limit - 1, value);
+    // MySQL/TiDB treats NULL as the minimum. If the n-th value is NULL, the first n rows are all NULLs
+    // in ascending order, or there are less than n non-null rows in descending order.
+    if (value.isNull())
+        return;
+
+    std::lock_guard lock(mu);
+    if (!threshold || (is_desc ? *threshold < value : value < *threshold))
+        threshold = std::move(value);
+}
+
+RSOperatorPtr TopNThreshold::toRSOperator(const Attr & attr) const
+{
+    auto value = getThreshold();
+    if (!value)
+        return EMPTY_RS_OPERATOR;
+    // Rows equal to the threshold may still make into the result when there are ties.
+    if (is_desc)
+        return createGreaterEqual(attr, *value);
+    // NULLs are placed first in ascending order.
+    return createOr({createLessEqual(attr, *value), createIsNull(attr)});
+}
+
+} // namespace DB::DM
@@ -0,0 +1,65 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Core/Block.h>
+#include <Storages/DeltaMerge/Filter/RSOperator.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold_fwd.h>
+
+#include <mutex>
+#include <optional>
+
+namespace DB::DM
+{
+/// The running threshold of a TopN (ORDER BY col LIMIT n) above a table scan.
+///
+/// The TopN updates it with the n-th value of every sorted block, rows that are worse than
+/// the threshold can not make into the result. The storage turns the current threshold into
+/// a rough set filter when it begins to read a segment, so that the packs whose min-max range
+/// can not beat the threshold are skipped.
+class TopNThreshold
+{
+public:
+    TopNThreshold(ColumnID column_id_, const String & column_name_, bool is_desc_)
+        : column_id(column_id_)
+        , column_name(column_name_)
+        , is_desc(is_desc_)
+    {}
+
+    /// `block` is sorted by the TopN column and has kept the first `limit` rows at most.
+    void update(const Block & block, size_t limit);
+
+    /// Return the rough set filter of the current threshold, or EMPTY_RS_OPERATOR if the threshold
+    /// has not been known yet. `attr` is the storage column of `column_id`.
+    RSOperatorPtr toRSOperator(const Attr & attr) const;
+
+    std::optional<Field> getThreshold() const
+    {
+        std::lock_guard lock(mu);
+        return threshold;
+    }
+
+    // The column id in storage.
+    const ColumnID column_id;
+    // The column name in the blocks sorted by the TopN.
+    const String column_name;
+    const bool is_desc;
+
+private:
+    mutable std::mutex mu;
+    std::optional<Field> threshold;
+};
+
+} // namespace DB::DM
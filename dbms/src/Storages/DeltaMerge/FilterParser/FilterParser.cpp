@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/MyTime.h>
 #include <Common/TiFlashException.h>
 #include <Flash/Coprocessor/DAGCodec.h>
 #include <Flash/Coprocessor/DAGQueryInfo.h>
@@ -22,6 +23,7 @@
 #include <common/logger_useful.h>
 
 #include <magic_enum.hpp>
+#include <optional>
 
 
 namespace DB
@@ -79,6 +81,24 @@ inline bool isRoughSetFilterSupportType(const Int32 field_type)
     return false;
 }
 
+// The bloom filter index is built from the raw bytes of strings, so only the string columns
+// with binary collations can be filtered by it.
+inline bool isBloomFilterSupportType(const tipb::FieldType & field_type)
+{
+    switch (field_type.tp())
+    {
+    case TiDB::TypeVarchar:
+    case TiDB::TypeVarString:
+    case TiDB::TypeString:
+    {
+        const auto * collator = getCollatorFromFieldType(field_type);
+        return collator == nullptr || collator->isBinary() || collator->isPaddingBinary();
+    }
+    default:
+        return false;
+    }
+}
+
 ColumnDefine getColumnDefineForColumnExpr(const tipb::Expr & expr, const ColumnDefines & columns_to_read)
 {
     assert(isColumnExpr(expr));
@@ -106,6 +126,27 @@ inline void convertFieldWithTimezone(Field & value, const TimezoneInfo & timezon
     value = Field(result_time);
 }
 
+// `cast(string literal as datetime)` is common in the filters on time columns, fold it to a datetime literal like
+// tidb_cast does, so that it can be used by the rough set filter. Return std::nullopt if the expr is not such a
+// cast or the string is not a valid datetime.
+inline std::optional<Field> foldCastStringAsDatetime(const tipb::Expr & expr)
+{
+    if (expr.tp() != tipb::ExprType::ScalarFunc || expr.sig() != tipb::ScalarFuncSig::CastStringAsTime
+        || expr.children_size() != 1 || !isLiteralExpr(expr.children(0)))
+        return std::nullopt;
+    const auto & field_type = expr.field_type();
+    if (field_type.tp() != TiDB::TypeDatetime || field_type.decimal() < 0 || field_type.decimal() > 6)
+        return std::nullopt;
+
+    Field literal = decodeLiteral(expr.children(0));
+    if (literal.getType() != Field::Types::String)
+        return std::nullopt;
+    Field value = parseMyDateTime(literal.get<String>(), field_type.decimal(), checkTimeValidAllowMonthAndDayZero);
+    if (value.isNull())
+        return std::nullopt;
+    return value;
+}
+
 inline RSOperatorPtr parseTiCompareExpr( //
     const tipb::Expr & expr,
     const FilterParser::RSFilterType filter_type,
@@ -154,7 +195,10 @@ inline RSOperatorPtr parseTiCompareExpr( //
                 return createUnsupported(expr.ShortDebugString(), "ColumnRef with no field type is not supported");
 
             auto field_type = child.field_type().tp();
-            if (!isRoughSetFilterSupportType(field_type))
+            // Equal and In on string columns can be checked by the bloom filter index
+            const bool is_bloom_filter_cmp = isBloomFilterSupportType(child.field_type())
+                && (filter_type == FilterParser::RSFilterType::Equal || filter_type == FilterParser::RSFilterType::In);
+            if (!isRoughSetFilterSupportType(field_type) && !is_bloom_filter_cmp)
                 return createUnsupported(
                     expr.ShortDebugString(),
                     fmt::format("ColumnRef with field type({}) is not supported", field_type));
@@ -162,9 +206,9 @@ inline RSOperatorPtr parseTiCompareExpr( //
             const auto col = getColumnDefineForColumnExpr(child, columns_to_read);
             attr = creator(col.id);
         }
-        else if (isLiteralExpr(child))
+        else if (auto folded_value = foldCastStringAsDatetime(child); isLiteralExpr(child) || folded_value)
         {
-            Field value = decodeLiteral(child);
+            Field value = folded_value ? *folded_value : decodeLiteral(child);
             if (is_timestamp_column)
             {
                 auto literal_type = child.field_type().tp();
@@ -180,7 +224,7 @@ inline RSOperatorPtr parseTiCompareExpr( //
         }
         else
         {
-            // Any other type of child is not supported, like: ScalarFunc.
+            // Any other type of child is not supported, like: ScalarFunc other than the folded cast above.
             // case like `cast(a as signed) > 1`, `a in (0, cast(a as signed))` is not supported.
             return createUnsupported(
                 expr.ShortDebugString(),
@@ -238,6 +282,43 @@ inline RSOperatorPtr parseTiCompareExpr( //
     }
 }
 
+// Like can only be checked by the ngram bloom filter index. Support like(column, literal, escape)
+inline RSOperatorPtr parseTiLikeExpr(
+    const tipb::Expr & expr,
+    const ColumnDefines & columns_to_read,
+    const FilterParser::AttrCreatorByColumnID & creator)
+{
+    if (unlikely(expr.children_size() != 3))
+        return createUnsupported(
+            expr.ShortDebugString(),
+            fmt::format("like with {} children is not supported", expr.children_size()));
+
+    const auto & column_child = expr.children(0);
+    const auto & pattern_child = expr.children(1);
+    const auto & escape_child = expr.children(2);
+    if (!isColumnExpr(column_child) || !isLiteralExpr(pattern_child) || !isLiteralExpr(escape_child))
+        return createUnsupported(expr.ShortDebugString(), "only like(ColumnRef, Literal, Literal) is supported");
+    if (unlikely(!column_child.has_field_type()))
+        return createUnsupported(expr.ShortDebugString(), "ColumnRef with no field type is not supported");
+    if (!isBloomFilterSupportType(column_child.field_type()))
+        return createUnsupported(
+            expr.ShortDebugString(),
+            fmt::format("ColumnRef with field type({}) is not supported", column_child.field_type().tp()));
+
+    Field pattern = decodeLiteral(pattern_child);
+    Field escape = decodeLiteral(escape_child);
+    if (pattern.getType() != Field::Types::String)
+        return createUnsupported(expr.ShortDebugString(), "pattern of like is not string");
+    char escape_char = '\\';
+    if (escape.getType() == Field::Types::Int64)
+        escape_char = static_cast<char>(escape.get<Int64>());
+    else if (escape.getType() == Field::Types::UInt64)
+        escape_char = static_cast<char>(escape.get<UInt64>());
+
+    const auto col = getColumnDefineForColumnExpr(column_child, columns_to_read);
+    return createLike(creator(col.id), pattern, escape_char);
+}
+
 RSOperatorPtr parseTiExpr(
     const tipb::Expr & expr,
     const ColumnDefines & columns_to_read,
@@ -333,8 +414,10 @@ RSOperatorPtr parseTiExpr(
             }
             break;
         }
-        // Unsupported filter type:
         case FilterParser::RSFilterType::Like:
+            return parseTiLikeExpr(expr, columns_to_read, creator);
+
+        // Unsupported filter type:
         case FilterParser::RSFilterType::Unsupported:
             break;
         }
@@ -409,6 +492,35 @@ RSOperatorPtr FilterParser::parseRFInExpr(
     }
 }
 
+RSOperatorPtr FilterParser::parseRFMinMaxExpr(
+    const tipb::RuntimeFilterType rf_type,
+    const tipb::Expr & target_expr,
+    const ColumnDefines & columns_to_read,
+    const Field & min_value,
+    const Field & max_value,
+    const TimezoneInfo & timezone_info)
+{
+    if (rf_type != tipb::MIN_MAX)
+        return createUnsupported(target_expr.ShortDebugString(), "function params should be min max predicate");
+    if (!isColumnExpr(target_expr))
+        return createUnsupported(target_expr.ShortDebugString(), "rf target expr is not column expr");
+    auto column_define = cop::getColumnDefineForColumnExpr(target_expr, columns_to_read);
+    auto attr = Attr{.col_name = column_define.name, .col_id = column_define.id, .type = column_define.type};
+    // No value matches an empty build side.
+    if (min_value.isNull() || max_value.isNull())
+        return createIn(attr, {});
+
+    Field min = min_value;
+    Field max = max_value;
+    if (target_expr.field_type().tp() == TiDB::TypeTimestamp && !timezone_info.is_utc_timezone)
+    {
+        // convert literal value from timezone specified in cop request to UTC
+        cop::convertFieldWithTimezone(min, timezone_info);
+        cop::convertFieldWithTimezone(max, timezone_info);
+    }
+    return createAnd({createGreaterEqual(attr, min), createLessEqual(attr, max)});
+}
+
 bool FilterParser::isRSFilterSupportType(const Int32 field_type)
 {
     return cop::isRoughSetFilterSupportType(field_type);
@@ -750,7 +862,7 @@ std::unordered_map<tipb::ScalarFuncSig, FilterParser::RSFilterType> FilterParser
     //{tipb::ScalarFuncSig::IsIPv6, "cast"},
     //{tipb::ScalarFuncSig::UUID, "cast"},
 
-    // {tipb::ScalarFuncSig::LikeSig, "like3Args"},
+    {tipb::ScalarFuncSig::LikeSig, FilterParser::RSFilterType::Like},
     //{tipb::ScalarFuncSig::RegexpBinarySig, "cast"},
     //{tipb::ScalarFuncSig::RegexpSig, "cast"},
 
@@ -53,6 +53,15 @@ public:
         const std::set<Field> & setElements,
         const TimezoneInfo & timezone_info);
 
+    // only for runtime filter min max predicate, `min_value` and `max_value` are Null if the build side is empty
+    static RSOperatorPtr parseRFMinMaxExpr(
+        tipb::RuntimeFilterType rf_type,
+        const tipb::Expr & target_expr,
+        const ColumnDefines & columns_to_read,
+        const Field & min_value,
+        const Field & max_value,
+        const TimezoneInfo & timezone_info);
+
     static bool isRSFilterSupportType(Int32 field_type);
 
     /// Some helper structure
@@ -0,0 +1,504 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Columns/ColumnNullable.h>
+#include <Columns/ColumnString.h>
+#include <Common/Exception.h>
+#include <Common/typeid_cast.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+#include <Storages/DeltaMerge/Index/BloomFilterIndex.h>
+#include <city.h>
+#include <common/StringRef.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+namespace DB
+{
+namespace ErrorCodes
+{
+extern const int LOGICAL_ERROR;
+extern const int UNKNOWN_FORMAT_VERSION;
+} // namespace ErrorCodes
+
+namespace DM
+{
+namespace
+{
+constexpr UInt8 BLOOM_FILTER_INDEX_VERSION = 1;
+// Version 2 appends the dictionaries of packs. Only used when the dictionaries are built, so that
+// the index without dictionaries can still be read by the older versions.
+constexpr UInt8 BLOOM_FILTER_INDEX_VERSION_WITH_DICTIONARY = 2;
+
+// The fraction of bits for ngram filter is larger than the value filter,
+// because each row usually generates more than one ngram.
+constexpr size_t NGRAM_BITS_FACTOR = 4;
+
+inline size_t roundUpToWord(size_t bits)
+{
+    return std::max<size_t>(64, (bits + 63) / 64 * 64);
+}
+
+inline size_t trimTrailingSpaces(const char * data, size_t size)
+{
+    while (size > 0 && data[size - 1] == ' ')
+        --size;
+    return size;
+}
+} // namespace
+
+BloomFilterIndex::BloomFilterIndex(
+    size_t bits_per_pack_,
+    size_t ngram_bits_per_pack_,
+    size_t hash_count_,
+    size_t ngram_size_,
+    size_t max_dictionary_size_)
+    : bits_per_pack(bits_per_pack_)
+    , ngram_bits_per_pack(ngram_bits_per_pack_)
+    , hash_count(hash_count_)
+    , ngram_size(ngram_size_)
+    , max_dictionary_size(max_dictionary_size_)
+{
+    RUNTIME_CHECK(bits_per_pack > 0 && bits_per_pack % 64 == 0, bits_per_pack);
+    RUNTIME_CHECK(ngram_size == 0 || (ngram_bits_per_pack > 0 && ngram_bits_per_pack % 64 == 0), ngram_bits_per_pack);
+    RUNTIME_CHECK(hash_count > 0, hash_count);
+    if (max_dictionary_size > 0)
+        dictionary_offsets.push_back(0);
+}
+
+BloomFilterIndexPtr BloomFilterIndex::create(const Options & options)
+{
+    const size_t bits_per_key = std::max<size_t>(1, options.bits_per_key);
+    const size_t bits_per_pack = roundUpToWord(options.expected_pack_rows * bits_per_key);
+    const size_t ngram_bits_per_pack = options.ngram_size == 0 ? 0 : bits_per_pack * NGRAM_BITS_FACTOR;
+    // The optimal number of hash functions is `bits_per_key * ln(2)`
+    const auto hash_count = std::clamp<size_t>(static_cast<size_t>(std::round(bits_per_key * 0.69)), 1, 16);
+    return std::make_shared<BloomFilterIndex>(
+        bits_per_pack,
+        ngram_bits_per_pack,
+        hash_count,
+        options.ngram_size,
+        options.max_dictionary_size);
+}
+
+UInt64 BloomFilterIndex::hashValue(const char * data, size_t size)
+{
+    return CityHash_v1_0_2::CityHash64(data, size);
+}
+
+void BloomFilterIndex::addHash(PaddedPODArray<UInt64> & bits, size_t pack_offset, size_t bit_count, UInt64 hash) const
+{
+    // Kirsch-Mitzenmacher double hashing: h_i = h1 + i * h2
+    const UInt64 h1 = hash;
+    const UInt64 h2 = (hash >> 33) | 1;
+    for (size_t i = 0; i < hash_count; ++i)
+    {
+        const UInt64 pos = (h1 + i * h2) % bit_count;
+        bits[pack_offset + pos / 64] |= (1ULL << (pos % 64));
+    }
+}
+
+bool BloomFilterIndex::mayContainHash(
+    const PaddedPODArray<UInt64> & bits,
+    size_t pack_offset,
+    size_t bit_count,
+    UInt64 hash) const
+{
+    const UInt64 h1 = hash;
+    const UInt64 h2 = (hash >> 33) | 1;
+    for (size_t i = 0; i < hash_count; ++i)
+    {
+        const UInt64 pos = (h1 + i * h2) % bit_count;
+        if (!(bits[pack_offset + pos / 64] & (1ULL << (pos % 64))))
+            return false;
+    }
+    return true;
+}
+
+void BloomFilterIndex::addPack(const IColumn & column, const ColumnVector<UInt8> * del_mark)
+{
+    const ColumnString * column_string = nullptr;
+    const PaddedPODArray<UInt8> * null_map = nullptr;
+    if (const auto * nullable = typeid_cast<const ColumnNullable *>(&column); nullable)
+    {
+        column_string = typeid_cast<const ColumnString *>(&nullable->getNestedColumn());
+        null_map = &nullable->getNullMapData();
+    }
+    else
+    {
+        column_string = typeid_cast<const ColumnString *>(&column);
+    }
+    RUNTIME_CHECK_MSG(
+        column_string != nullptr,
+        "BloomFilterIndex only supports string column, got {}",
+        column.getName());
+
+    const auto value_offset = total_packs * wordsPerPack(false);
+    value_bits.resize_fill(value_offset + wordsPerPack(false), 0);
+    const auto ngram_offset = total_packs * wordsPerPack(true);
+    if (hasNGram())
+        ngram_bits.resize_fill(ngram_offset + wordsPerPack(true), 0);
+
+    UInt8 dictionary_flag = max_dictionary_size > 0 ? (DICTIONARY_EXISTS | DICTIONARY_FULL) : 0;
+    std::unordered_set<StringRef, StringRefHash> distinct_values;
+
+    const auto * del_mark_data = del_mark ? &del_mark->getData() : nullptr;
+    for (size_t i = 0; i < column_string->size(); ++i)
+    {
+        if ((del_mark_data && (*del_mark_data)[i]) || (null_map && (*null_map)[i]))
+        {
+            dictionary_flag &= ~DICTIONARY_FULL;
+            continue;
+        }
+
+        const auto ref = column_string->getDataAt(i);
+        addHash(value_bits, value_offset, bits_per_pack, hashValue(ref.data, trimTrailingSpaces(ref.data, ref.size)));
+
+        if (hasNGram() && ref.size >= ngram_size)
+        {
+            for (size_t pos = 0; pos + ngram_size <= ref.size; ++pos)
+                addHash(ngram_bits, ngram_offset, ngram_bits_per_pack, hashValue(ref.data + pos, ngram_size));
+        }
+
+        // Give up the dictionary once there are too many distinct values
+        if ((dictionary_flag & DICTIONARY_EXISTS) && distinct_values.insert(ref).second
+            && distinct_values.size() > max_dictionary_size)
+        {
+            dictionary_flag = 0;
+            distinct_values.clear();
+        }
+    }
+
+    if (max_dictionary_size > 0)
+    {
+        for (const auto & ref : distinct_values)
+        {
+            dictionary_values.emplace_back(ref.data, ref.size);
+            dictionary_bytes += ref.size + sizeof(String);
+        }
+        dictionary_flags.push_back(dictionary_flag);
+        dictionary_offsets.push_back(dictionary_values.size());
+    }
+    ++total_packs;
+}
+
+void BloomFilterIndex::write(WriteBuffer & buf) const
+{
+    const bool with_dictionary = max_dictionary_size > 0;
+    writeIntBinary(with_dictionary ? BLOOM_FILTER_INDEX_VERSION_WITH_DICTIONARY : BLOOM_FILTER_INDEX_VERSION, buf);
+    writeIntBinary(static_cast<UInt64>(bits_per_pack), buf);
+    writeIntBinary(static_cast<UInt64>(ngram_bits_per_pack), buf);
+    writeIntBinary(static_cast<UInt64>(hash_count), buf);
+    writeIntBinary(static_cast<UInt64>(ngram_size), buf);
+    writeIntBinary(static_cast<UInt64>(total_packs), buf);
+    buf.write(reinterpret_cast<const char *>(value_bits.data()), value_bits.size() * sizeof(UInt64));
+    buf.write(reinterpret_cast<const char *>(ngram_bits.data()), ngram_bits.size() * sizeof(UInt64));
+    if (!with_dictionary)
+        return;
+
+    writeIntBinary(static_cast<UInt64>(max_dictionary_size), buf);
+    for (size_t pack_id = 0; pack_id < total_packs; ++pack_id)
+    {
+        writeIntBinary(dictionary_flags[pack_id], buf);
+        writeVarUInt(dictionary_offsets[pack_id + 1] - dictionary_offsets[pack_id], buf);
+        for (size_t i = dictionary_offsets[pack_id]; i < dictionary_offsets[pack_id + 1]; ++i)
+            writeStringBinary(dictionary_values[i], buf);
+    }
+}
+
+BloomFilterIndexPtr BloomFilterIndex::read(ReadBuffer & buf)
+{
+    UInt8 version;
+    readIntBinary(version, buf);
+    if (unlikely(version != BLOOM_FILTER_INDEX_VERSION && version != BLOOM_FILTER_INDEX_VERSION_WITH_DICTIONARY))
+        throw Exception(ErrorCodes::UNKNOWN_FORMAT_VERSION, "Unknown BloomFilterIndex version {}", version);
+
+    UInt64 bits_per_pack, ngram_bits_per_pack, hash_count, ngram_size, pack_count;
+    readIntBinary(bits_per_pack, buf);
+    readIntBinary(ngram_bits_per_pack, buf);
+    readIntBinary(hash_count, buf);
+    readIntBinary(ngram_size, buf);
+    readIntBinary(pack_count, buf);
+
+    auto index = std::make_shared<BloomFilterIndex>(bits_per_pack, ngram_bits_per_pack, hash_count, ngram_size);
+    index->total_packs = pack_count;
+    index->value_bits.resize(pack_count * index->wordsPerPack(false));
+    buf.readStrict(reinterpret_cast<char *>(index->value_bits.data()), index->value_bits.size() * sizeof(UInt64));
+    if (index->hasNGram())
+    {
+        index->ngram_bits.resize(pack_count * index->wordsPerPack(true));
+        buf.readStrict(reinterpret_cast<char *>(index->ngram_bits.data()), index->ngram_bits.size() * sizeof(UInt64));
+    }
+    if (version != BLOOM_FILTER_INDEX_VERSION_WITH_DICTIONARY)
+        return index;
+
+    UInt64 max_dictionary_size;
+    readIntBinary(max_dictionary_size, buf);
+    RUNTIME_CHECK(max_dictionary_size > 0, max_dictionary_size);
+    index->max_dictionary_size = max_dictionary_size;
+    index->dictionary_offsets.push_back(0);
+    index->dictionary_flags.reserve(pack_count);
+    index->dictionary_offsets.reserve(pack_count + 1);
+    for (size_t pack_id = 0; pack_id < pack_count; ++pack_id)
+    {
+        UInt8 flag;
+        UInt64 dictionary_size;
+        readIntBinary(flag, buf);
+        readVarUInt(dictionary_size, buf);
+        RUNTIME_CHECK(dictionary_size <= max_dictionary_size, dictionary_size, max_dictionary_size);
+        for (size_t i = 0; i < dictionary_size; ++i)
+        {
+            auto & value = index->dictionary_values.emplace_back();
+            readStringBinary(value, buf);
+            index->dictionary_bytes += value.size() + sizeof(String);
+        }
+        index->dictionary_flags.push_back(flag);
+        index->dictionary_offsets.push_back(index->dictionary_values.size());
+    }
+    return index;
+}
+
+template <typename Match>
+void BloomFilterIndex::checkDictionary(size_t start_pack, size_t pack_count, Match && match, RSResults & results)
+    const
+{
+    if (max_dictionary_size == 0)
+        return;
+
+    for (size_t i = 0; i < pack_count; ++i)
+    {
+        const size_t pack_id = start_pack + i;
+        if (results[i] == RSResult::None || !hasDictionary(pack_id))
+            continue;
+
+        bool any_may_match = false;
+        bool all_match = true;
+        for (size_t j = dictionary_offsets[pack_id]; j < dictionary_offsets[pack_id + 1]; ++j)
+        {
+            const std::optional<bool> matched = match(dictionary_values[j]);
+            any_may_match |= !matched.has_value() || *matched;
+            all_match &= matched.value_or(false);
+        }
+        // All rows are NULL or deleted if the dictionary is empty, `any_may_match` is false as well.
+        if (!any_may_match)
+            results[i] = RSResult::None;
+        else if (all_match && (dictionary_flags[pack_id] & DICTIONARY_FULL))
+            results[i] = RSResult::All;
+    }
+}
+
+void BloomFilterIndex::checkEqual(size_t start_pack, size_t pack_count, const Field & value, RSResults & results)
+    const
+{
+    checkIn(start_pack, pack_count, {value}, results);
+}
+
+void BloomFilterIndex::checkIn(
+    size_t start_pack,
+    size_t pack_count,
+    const std::vector<Field> & values,
+    RSResults & results) const
+{
+    std::vector<UInt64> hashes;
+    hashes.reserve(values.size());
+    std::vector<std::string_view> trimmed_values;
+    trimmed_values.reserve(values.size());
+    for (const auto & value : values)
+    {
+        // Can not check the value which is not a string (for example, NULL), treat it as "may exist".
+        if (value.getType() != Field::Types::String)
+            return;
+        const auto & s = value.get<String>();
+        trimmed_values.emplace_back(s.data(), trimTrailingSpaces(s.data(), s.size()));
+        hashes.push_back(hashValue(trimmed_values.back().data(), trimmed_values.back().size()));
+    }
+
+    for (size_t i = 0; i < pack_count; ++i)
+    {
+        if (results[i] == RSResult::None)
+            continue;
+        const size_t pack_offset = (start_pack + i) * wordsPerPack(false);
+        bool may_contain = false;
+        for (auto h : hashes)
+        {
+            if (mayContainHash(value_bits, pack_offset, bits_per_pack, h))
+            {
+                may_contain = true;
+                break;
+            }
+        }
+        if (!may_contain)
+            results[i] = RSResult::None;
+    }
+
+    checkDictionary(
+        start_pack,
+        pack_count,
+        [&](const String & entry) -> std::optional<bool> {
+            const std::string_view trimmed_entry(entry.data(), trimTrailingSpaces(entry.data(), entry.size()));
+            bool may_match = false;
+            for (size_t j = 0; j < values.size(); ++j)
+            {
+                if (entry == values[j].get<String>())
+                    return true;
+                // Only equal under the "PAD SPACE" collations, can not tell for the others.
+                may_match |= trimmed_entry == trimmed_values[j];
+            }
+            return may_match ? std::nullopt : std::optional<bool>(false);
+        },
+        results);
+}
+
+std::vector<String> BloomFilterIndex::extractLikeLiterals(const String & pattern, char escape_char)
+{
+    std::vector<String> literals;
+    String current;
+    for (size_t i = 0; i < pattern.size(); ++i)
+    {
+        const char c = pattern[i];
+        if (c == escape_char && i + 1 < pattern.size())
+        {
+            current.push_back(pattern[++i]);
+        }
+        else if (c == '%' || c == '_')
+        {
+            if (!current.empty())
+                literals.emplace_back(std::move(current));
+            current.clear();
+        }
+        else
+        {
+            current.push_back(c);
+        }
+    }
+    if (!current.empty())
+        literals.emplace_back(std::move(current));
+    return literals;
+}
+
+void BloomFilterIndex::checkLike(
+    size_t start_pack,
+    size_t pack_count,
+    const String & pattern,
+    char escape_char,
+    RSResults & results) const
+{
+    std::vector<UInt64> hashes;
+    if (hasNGram())
+    {
+        for (const auto & literal : extractLikeLiterals(pattern, escape_char))
+        {
+            if (literal.size() < ngram_size)
+                continue;
+            for (size_t pos = 0; pos + ngram_size <= literal.size(); ++pos)
+                hashes.push_back(hashValue(literal.data() + pos, ngram_size));
+        }
+    }
+
+    for (size_t i = 0; i < pack_count && !hashes.empty(); ++i)
+    {
+        if (results[i] == RSResult::None)
+            continue;
+        const size_t pack_offset = (start_pack + i) * wordsPerPack(true);
+        // Every ngram of the literal parts must exist in the pack.
+        for (auto h : hashes)
+        {
+            if (!mayContainHash(ngram_bits, pack_offset, ngram_bits_per_pack, h))
+            {
+                results[i] = RSResult::None;
+                break;
+            }
+        }
+    }
+
+    checkDictionary(
+        start_pack,
+        pack_count,
+        [&](const String & entry) { return matchLike(entry, pattern, escape_char); },
+        results);
+}
+
+std::optional<bool> BloomFilterIndex::matchLike(std::string_view value, std::string_view pattern, char escape_char)
+{
+    if (!value.empty() && value.back() == ' ')
+        return std::nullopt;
+
+    enum class TokenType : UInt8
+    {
+        Char,
+        AnyChar, // `_`
+        AnyString, // `%`
+    };
+    struct Token
+    {
+        TokenType type;
+        char c;
+    };
+    std::vector<Token> tokens;
+    tokens.reserve(pattern.size());
+    bool has_any_char = false;
+    for (size_t i = 0; i < pattern.size(); ++i)
+    {
+        const char c = pattern[i];
+        if (c == escape_char && i + 1 < pattern.size())
+            tokens.push_back({TokenType::Char, pattern[++i]});
+        else if (c == '%')
+            tokens.push_back({TokenType::AnyString, c});
+        else if (c == '_')
+        {
+            tokens.push_back({TokenType::AnyChar, c});
+            has_any_char = true;
+        }
+        else
+            tokens.push_back({TokenType::Char, c});
+    }
+    // `_` matches a character instead of a byte in utf8 collations
+    if (has_any_char
+        && std::any_of(value.begin(), value.end(), [](char c) { return static_cast<UInt8>(c) >= 0x80; }))
+        return std::nullopt;
+
+    // Greedy matching, backtrack to the last `%` when mismatch
+    size_t v = 0, t = 0;
+    size_t last_any_string = std::string_view::npos, last_any_string_v = 0;
+    while (v < value.size())
+    {
+        if (t < tokens.size() && tokens[t].type == TokenType::AnyString)
+        {
+            last_any_string = t++;
+            last_any_string_v = v;
+        }
+        else if (t < tokens.size() && (tokens[t].type == TokenType::AnyChar || tokens[t].c == value[v]))
+        {
+            ++t;
+            ++v;
+        }
+        else if (last_any_string != std::string_view::npos)
+        {
+            t = last_any_string + 1;
+            v = ++last_any_string_v;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    while (t < tokens.size() && tokens[t].type == TokenType::AnyString)
+        ++t;
+    return t == tokens.size();
+}
+
+} // namespace DM
+} // namespace DB
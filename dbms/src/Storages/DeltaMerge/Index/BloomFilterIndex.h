@@ -0,0 +1,184 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Columns/ColumnVector.h>
+#include <Common/LRUCache.h>
+#include <Core/Field.h>
+#include <IO/ReadBuffer.h>
+#include <IO/WriteBuffer.h>
+#include <Storages/DeltaMerge/Index/RSResult.h>
+
+#include <optional>
+#include <string_view>
+
+namespace DB
+{
+namespace DM
+{
+class BloomFilterIndex;
+using BloomFilterIndexPtr = std::shared_ptr<BloomFilterIndex>;
+
+/// A per-pack bloom filter index for string columns.
+///
+/// For each pack, there is a "value" bloom filter which is built from the whole value of each row,
+/// and an optional "ngram" bloom filter which is built from every `ngram_size`-byte substring of each row.
+/// The former is used to exclude packs for `=` and `IN`, the latter is used to exclude packs for `LIKE`.
+/// Both of them never produce false negatives, so we can only get `None` or `Some` from them.
+///
+/// For the low-cardinality columns (e.g. `status`, `service` in logs), each pack with at most
+/// `max_dictionary_size` distinct values also keeps these values as its "dictionary". `=`, `IN` and
+/// `LIKE` are evaluated once per dictionary entry instead of once per row, which can tell exactly whether
+/// no row (`None`) or every row (`All`) in the pack matches, so the strings of the pack are not read.
+///
+/// Note that trailing spaces are ignored when hashing the value, so that the result is correct for
+/// the "PAD SPACE" binary collations (utf8mb4_bin, etc). Only binary collations can be pruned by this index.
+class BloomFilterIndex
+{
+public:
+    struct Options
+    {
+        // The expected number of rows in a pack, used to calculate the size of each filter.
+        size_t expected_pack_rows = 8192;
+        size_t bits_per_key = 10;
+        // 0 means do not build the ngram bloom filter.
+        size_t ngram_size = 0;
+        // Keep the distinct values of the packs with at most `max_dictionary_size` distinct values.
+        // 0 means do not build the dictionaries.
+        size_t max_dictionary_size = 0;
+    };
+
+    BloomFilterIndex(
+        size_t bits_per_pack_,
+        size_t ngram_bits_per_pack_,
+        size_t hash_count_,
+        size_t ngram_size_,
+        size_t max_dictionary_size_ = 0);
+
+    static BloomFilterIndexPtr create(const Options & options);
+
+    size_t byteSize() const
+    {
+        return sizeof(UInt64) * (value_bits.size() + ngram_bits.size() + dictionary_offsets.size())
+            + dictionary_flags.size() + dictionary_bytes + 4 * sizeof(PaddedPODArray<UInt64>);
+    }
+
+    size_t packCount() const { return total_packs; }
+    bool hasNGram() const { return ngram_size > 0; }
+    bool hasDictionary(size_t pack_id) const
+    {
+        return max_dictionary_size > 0 && (dictionary_flags[pack_id] & DICTIONARY_EXISTS);
+    }
+
+    void addPack(const IColumn & column, const ColumnVector<UInt8> * del_mark);
+
+    void write(WriteBuffer & buf) const;
+    static BloomFilterIndexPtr read(ReadBuffer & buf);
+
+    /// Set the result of pack to `None` if the pack can not contain `value`.
+    /// If the pack has a dictionary and every row matches, set the result to `All`.
+    /// The results for other packs are left untouched.
+    void checkEqual(size_t start_pack, size_t pack_count, const Field & value, RSResults & results) const;
+    void checkIn(size_t start_pack, size_t pack_count, const std::vector<Field> & values, RSResults & results) const;
+    void checkLike(
+        size_t start_pack,
+        size_t pack_count,
+        const String & pattern,
+        char escape_char,
+        RSResults & results) const;
+
+    /// Split the like pattern into the literal parts which must appear in the matched string.
+    /// Wildcards (`%` and `_`) split the literal parts. Exposed for testing.
+    static std::vector<String> extractLikeLiterals(const String & pattern, char escape_char);
+
+    /// Match `value` with the like pattern byte by byte. Return std::nullopt if the result may
+    /// differ from the collation-aware matching, i.e. `_` meets a multi-byte character or `value`
+    /// has trailing spaces. Exposed for testing.
+    static std::optional<bool> matchLike(std::string_view value, std::string_view pattern, char escape_char);
+
+private:
+    static constexpr UInt8 DICTIONARY_EXISTS = 0x1;
+    // No NULL or deleted rows in the pack, so the pack can be `All` if every dictionary entry matches.
+    static constexpr UInt8 DICTIONARY_FULL = 0x2;
+
+    /// Set the result of the packs with dictionary by `match` which returns whether a dictionary entry
+    /// matches the filter. `match` returns std::nullopt if it can not tell.
+    template <typename Match>
+    void checkDictionary(size_t start_pack, size_t pack_count, Match && match, RSResults & results) const;
+
+    static UInt64 hashValue(const char * data, size_t size);
+
+    size_t wordsPerPack(bool is_ngram) const { return (is_ngram ? ngram_bits_per_pack : bits_per_pack) / 64; }
+
+    void addHash(PaddedPODArray<UInt64> & bits, size_t pack_offset, size_t bit_count, UInt64 hash) const;
+    bool mayContainHash(const PaddedPODArray<UInt64> & bits, size_t pack_offset, size_t bit_count, UInt64 hash) const;
+
+private:
+    size_t bits_per_pack;
+    size_t ngram_bits_per_pack;
+    size_t hash_count;
+    size_t ngram_size;
+
+    size_t total_packs = 0;
+    // total_packs * bits_per_pack / 64 words
+    PaddedPODArray<UInt64> value_bits;
+    // total_packs * ngram_bits_per_pack / 64 words, empty if ngram_size == 0
+    PaddedPODArray<UInt64> ngram_bits;
+
+    size_t max_dictionary_size;
+    // The following are empty if max_dictionary_size == 0
+    // total_packs flags, see `DICTIONARY_EXISTS` and `DICTIONARY_FULL`
+    PaddedPODArray<UInt8> dictionary_flags;
+    // total_packs + 1 offsets, the dictionary of pack i is dictionary_values[offsets[i], offsets[i+1])
+    PaddedPODArray<UInt64> dictionary_offsets;
+    Strings dictionary_values;
+    size_t dictionary_bytes = 0;
+};
+
+
+struct BloomFilterIndexWeightFunction
+{
+    size_t operator()(const String & key, const BloomFilterIndex & index) const
+    {
+        // The same approximation as `MinMaxIndexWeightFunction`
+        return index.byteSize() + 32 + key.size() * 2 + sizeof(String) * 2 + 28 + sizeof(std::list<String>);
+    }
+};
+
+
+class BloomFilterIndexCache
+    : public LRUCache<String, BloomFilterIndex, std::hash<String>, BloomFilterIndexWeightFunction>
+{
+private:
+    using Base = LRUCache<String, BloomFilterIndex, std::hash<String>, BloomFilterIndexWeightFunction>;
+
+public:
+    explicit BloomFilterIndexCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes)
+    {}
+
+    template <typename LoadFunc>
+    MappedPtr getOrSet(const Key & key, LoadFunc && load)
+    {
+        auto result = Base::getOrSet(key, load);
+        return result.first;
+    }
+};
+
+using BloomFilterIndexCachePtr = std::shared_ptr<BloomFilterIndexCache>;
+
+} // namespace DM
+
+} // namespace DB
@@ -15,6 +15,7 @@
 #include <Columns/ColumnString.h>
 #include <Columns/ColumnVector.h>
 #include <Columns/IColumn.h>
+#include <Common/Exception.h>
 #include <DataTypes/DataTypeDate.h>
 #include <DataTypes/DataTypeDateTime.h>
 #include <DataTypes/DataTypeEnum.h>
@@ -92,9 +93,9 @@ inline std::pair<size_t, size_t> minmax(
 }
 } // namespace details
 
-void MinMaxIndex::addPack(const IColumn & column, const ColumnVector<UInt8> * del_mark)
+void MinMaxIndex::addPack(const IColumn & column, const ColumnVector<UInt8> * del_mark, size_t offset, size_t limit)
 {
-    auto size = column.size();
+    RUNTIME_CHECK(offset + limit <= column.size(), offset, limit, column.size());
     bool has_null = false;
 
     size_t min_index;
@@ -108,7 +109,7 @@ void MinMaxIndex::addPack(const IColumn & column, const ColumnVector<UInt8> * de
         const auto & nullable_column = static_cast<const ColumnNullable &>(column);
         const auto & null_mark_data = nullable_column.getNullMapColumn().getData();
 
-        for (size_t i = 0; i < size; ++i)
+        for (size_t i = offset; i < offset + limit; ++i)
         {
             if ((!del_mark_data || !(*del_mark_data)[i]) && null_mark_data[i])
             {
@@ -119,13 +120,13 @@ void MinMaxIndex::addPack(const IColumn & column, const ColumnVector<UInt8> * de
 
         if (has_null)
         {
-            std::tie(min_index, max_index) = details::minmax(column, del_mark, null_mark_data, 0, column.size());
+            std::tie(min_index, max_index) = details::minmax(column, del_mark, null_mark_data, offset, limit);
         }
     }
 
     if (!has_null)
     {
-        std::tie(min_index, max_index) = details::minmax(column, del_mark, 0, column.size());
+        std::tie(min_index, max_index) = details::minmax(column, del_mark, offset, limit);
     }
 
     if (min_index != NONE_EXIST)
@@ -144,6 +145,36 @@ void MinMaxIndex::addPack(const IColumn & column, const ColumnVector<UInt8> * de
     }
 }
 
+MinMaxIndexPtr MinMaxIndex::merge(const IDataType & type, const MinMaxIndex & lhs, const MinMaxIndex & rhs)
+{
+    RUNTIME_CHECK(lhs.has_value_marks->size() == 1, lhs.has_value_marks->size());
+    RUNTIME_CHECK(rhs.has_value_marks->size() == 1, rhs.has_value_marks->size());
+
+    auto index = std::make_shared<MinMaxIndex>(type);
+    const bool lhs_has_value = (*lhs.has_value_marks)[0];
+    const bool rhs_has_value = (*rhs.has_value_marks)[0];
+    index->has_null_marks->push_back((*lhs.has_null_marks)[0] || (*rhs.has_null_marks)[0]);
+    index->has_value_marks->push_back(lhs_has_value || rhs_has_value);
+    if (lhs_has_value && rhs_has_value)
+    {
+        // minmaxes: [min, max]
+        const bool lhs_min = lhs.minmaxes->compareAt(0, 0, *rhs.minmaxes, -1) <= 0;
+        index->minmaxes->insertFrom(lhs_min ? *lhs.minmaxes : *rhs.minmaxes, 0);
+        const bool lhs_max = lhs.minmaxes->compareAt(1, 1, *rhs.minmaxes, -1) >= 0;
+        index->minmaxes->insertFrom(lhs_max ? *lhs.minmaxes : *rhs.minmaxes, 1);
+    }
+    else if (lhs_has_value || rhs_has_value)
+    {
+        index->minmaxes->insertRangeFrom(lhs_has_value ? *lhs.minmaxes : *rhs.minmaxes, 0, 2);
+    }
+    else
+    {
+        index->minmaxes->insertDefault();
+        index->minmaxes->insertDefault();
+    }
+    return index;
+}
+
 void MinMaxIndex::write(const IDataType & type, WriteBuffer & buf)
 {
     UInt64 size = has_null_marks->size();
@@ -17,7 +17,7 @@
 #include <AggregateFunctions/Helpers.h>
 #include <Columns/ColumnNullable.h>
 #include <Columns/ColumnsCommon.h>
-#include <Common/LRUCache.h>
+#include <Common/ShardedLRUCache.h>
 #include <DataTypes/DataTypeEnum.h>
 #include <DataTypes/DataTypeString.h>
 #include <DataTypes/DataTypesNumber.h>
@@ -67,7 +67,15 @@ public:
             + 3 * sizeof(PaddedPODArray<UInt8>);
     }
 
-    void addPack(const IColumn & column, const ColumnVector<UInt8> * del_mark);
+    void addPack(const IColumn & column, const ColumnVector<UInt8> * del_mark)
+    {
+        addPack(column, del_mark, 0, column.size());
+    }
+    /// Add a pack built from the rows [offset, offset + limit) of the column.
+    void addPack(const IColumn & column, const ColumnVector<UInt8> * del_mark, size_t offset, size_t limit);
+
+    /// Return a new index with one pack, which covers the only pack of `lhs` and `rhs`.
+    static MinMaxIndexPtr merge(const IDataType & type, const MinMaxIndex & lhs, const MinMaxIndex & rhs);
 
     void write(const IDataType & type, WriteBuffer & buf);
 
@@ -151,14 +159,14 @@ struct MinMaxIndexWeightFunction
 };
 
 
-class MinMaxIndexCache : public LRUCache<String, MinMaxIndex, std::hash<String>, MinMaxIndexWeightFunction>
+class MinMaxIndexCache : public ShardedLRUCache<String, MinMaxIndex, std::hash<String>, MinMaxIndexWeightFunction>
 {
 private:
-    using Base = LRUCache<String, MinMaxIndex, std::hash<String>, MinMaxIndexWeightFunction>;
+    using Base = ShardedLRUCache<String, MinMaxIndex, std::hash<String>, MinMaxIndexWeightFunction>;
 
 public:
     explicit MinMaxIndexCache(size_t max_size_in_bytes)
-        : Base(max_size_in_bytes)
+        : Base(max_size_in_bytes, Base::default_num_shards, Base::default_min_shard_bytes)
     {}
 
     template <typename LoadFunc>
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <Storages/DeltaMerge/Index/BloomFilterIndex.h>
 #include <Storages/DeltaMerge/Index/MinMaxIndex.h>
 
 namespace DB
@@ -35,6 +36,8 @@ struct RSIndex
     DataTypePtr type;
     MinMaxIndexPtr minmax;
     EqualIndexPtr equal;
+    // Only exists for string columns that enable `dt_enable_bloom_filter_index` when writing the DMFile.
+    BloomFilterIndexPtr bloom_filter;
 
     RSIndex(const DataTypePtr & type_, const MinMaxIndexPtr & minmax_)
         : type(type_)
@@ -46,6 +49,12 @@ struct RSIndex
         , minmax(minmax_)
         , equal(equal_)
     {}
+
+    RSIndex(const DataTypePtr & type_, const MinMaxIndexPtr & minmax_, const BloomFilterIndexPtr & bloom_filter_)
+        : type(type_)
+        , minmax(minmax_)
+        , bloom_filter(bloom_filter_)
+    {}
 };
 
 using ColumnIndexes = std::unordered_map<ColId, RSIndex>;
@@ -27,12 +27,14 @@ LateMaterializationBlockInputStream::LateMaterializationBlockInputStream(
     BlockInputStreamPtr filter_column_stream_,
     SkippableBlockInputStreamPtr rest_column_stream_,
     const BitmapFilterPtr & bitmap_filter_,
+    const PushDownFilterSelectivityPtr & selectivity_,
     const String & req_id_)
     : header(toEmptyBlock(columns_to_read))
     , filter_column_name(filter_column_name_)
     , filter_column_stream(std::move(filter_column_stream_))
     , rest_column_stream(std::move(rest_column_stream_))
     , bitmap_filter(bitmap_filter_)
+    , selectivity(selectivity_)
     , log(Logger::get(NAME, req_id_))
 {}
 
@@ -54,6 +56,8 @@ Block LateMaterializationBlockInputStream::readImpl()
         // If filter is nullptr, it means that these push down filters are always true.
         if (!filter)
         {
+            if (selectivity)
+                selectivity->record(filter_column_block.rows(), filter_column_block.rows());
             IColumn::Filter col_filter;
             col_filter.resize(filter_column_block.rows());
             Block rest_column_block;
@@ -81,7 +85,11 @@ Block LateMaterializationBlockInputStream::readImpl()
         // bitmap_filter[start_offset, start_offset + rows] & filter -> filter
         bitmap_filter->rangeAnd(*filter, filter_column_block.startOffset(), rows);
 
-        if (size_t passed_count = countBytesInFilter(*filter); passed_count == 0)
+        size_t passed_count = countBytesInFilter(*filter);
+        if (selectivity)
+            selectivity->record(rows, passed_count);
+
+        if (passed_count == 0)
         {
             // if all rows are filtered, skip the next block of rest_column_stream
             if (size_t skipped_rows = rest_column_stream->skipNextBlock(); skipped_rows == 0)
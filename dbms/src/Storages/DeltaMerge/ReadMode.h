@@ -37,6 +37,13 @@ enum class ReadMode
     Raw,
 
     Bitmap,
+
+    /**
+     * Read in bitmap mode, but only the number of rows is needed, for example, for `count(*)` without filters.
+     * The MVCC bitmap filter is built from the pack stats as much as possible, and the data is not read.
+     * The columns are returned as constant default values.
+     */
+    Count,
 };
 
 } // namespace DB::DM
@@ -69,6 +69,31 @@ bool DMFileReaderPool::hasConcurrentReader(DMFileReader & from_reader)
     return itr != readers.end() && itr->second.size() >= 2;
 }
 
+// Join the reader which starts the latest, so that the two readers can share the most packs.
+std::optional<size_t> DMFileReaderPool::getCircularScanPosition(DMFileReader & from_reader)
+{
+    std::lock_guard lock(mtx);
+    auto itr = readers.find(from_reader.path());
+    if (itr == readers.end())
+    {
+        return std::nullopt;
+    }
+    std::optional<size_t> position;
+    for (auto * r : itr->second)
+    {
+        if (&from_reader == r)
+        {
+            continue;
+        }
+        auto p = r->getScanPosition();
+        if (p && (!position || *p < *position))
+        {
+            position = p;
+        }
+    }
+    return position;
+}
+
 DMFileReader * DMFileReaderPool::get(const std::string & name)
 {
     std::lock_guard lock(mtx);
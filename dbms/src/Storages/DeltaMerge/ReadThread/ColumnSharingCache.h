@@ -20,6 +20,7 @@
 #include <Storages/DeltaMerge/File/DMFile.h>
 
 #include <memory>
+#include <optional>
 
 namespace DB::DM
 {
@@ -242,6 +243,8 @@ public:
     void del(DMFileReader & reader);
     void set(DMFileReader & from_reader, int64_t col_id, size_t start, size_t count, ColumnPtr & col);
     bool hasConcurrentReader(DMFileReader & from_reader);
+    // Return the position where a circular scan of `from_reader` can join another reader of the same DMFile.
+    std::optional<size_t> getCircularScanPosition(DMFileReader & from_reader);
     // `get` is just for test.
     DMFileReader * get(const std::string & name);
 
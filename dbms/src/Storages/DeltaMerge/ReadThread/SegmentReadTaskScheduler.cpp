@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include <Common/setThreadName.h>
+#include <Flash/ResourceControl/LocalAdmissionController.h>
 #include <Storages/DeltaMerge/ReadThread/SegmentReadTaskScheduler.h>
 #include <Storages/DeltaMerge/ReadThread/SegmentReader.h>
 #include <Storages/DeltaMerge/Segment.h>
@@ -203,11 +204,36 @@ bool SegmentReadTaskScheduler::isStop() const
     return stop.load(std::memory_order_relaxed);
 }
 
+void SegmentReadTaskScheduler::sortByResourceGroupPriority(std::vector<SegmentReadTaskPoolPtr> & pools)
+{
+    if (pools.size() <= 1 || LocalAdmissionController::global_instance == nullptr)
+        return;
+
+    // Get the priority of each resource group once in a round, less value means higher priority.
+    std::unordered_map<String, UInt64> priorities;
+    for (const auto & pool : pools)
+    {
+        const auto & name = pool->getResourceGroupName();
+        if (priorities.contains(name))
+            continue;
+        auto priority = LocalAdmissionController::global_instance->getPriority(name);
+        priorities.emplace(name, priority.value_or(LocalAdmissionController::HIGHEST_RESOURCE_GROUP_PRIORITY));
+    }
+    if (priorities.size() <= 1)
+        return;
+
+    std::stable_sort(pools.begin(), pools.end(), [&](const auto & lhs, const auto & rhs) {
+        return priorities.at(lhs->getResourceGroupName()) < priorities.at(rhs->getResourceGroupName());
+    });
+}
+
 std::tuple<UInt64, UInt64, UInt64> SegmentReadTaskScheduler::scheduleOneRound()
 {
     UInt64 erased_pool_count = 0;
     UInt64 sched_null_count = 0;
     UInt64 sched_succ_count = 0;
+    std::vector<SegmentReadTaskPoolPtr> pools;
+    pools.reserve(read_pools.size());
     for (auto itr = read_pools.begin(); itr != read_pools.end(); /**/)
     {
         auto & pool = itr->second;
@@ -220,8 +246,13 @@ std::tuple<UInt64, UInt64, UInt64> SegmentReadTaskScheduler::scheduleOneRound()
             itr = read_pools.erase(itr);
             continue;
         }
+        pools.push_back(pool);
         ++itr;
+    }
+    sortByResourceGroupPriority(pools);
 
+    for (auto & pool : pools)
+    {
         if (!needSchedule(pool))
         {
             ++sched_null_count;
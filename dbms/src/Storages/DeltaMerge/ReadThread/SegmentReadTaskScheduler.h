@@ -57,6 +57,10 @@ public:
     bool needScheduleToRead(const SegmentReadTaskPoolPtr & pool);
     bool needSchedule(const SegmentReadTaskPoolPtr & pool);
 
+    // Order the pools by the priority of their resource groups, so that the pools of the resource groups with
+    // higher priority are scheduled first and their reads are not queued behind the low priority ones.
+    static void sortByResourceGroupPriority(std::vector<SegmentReadTaskPoolPtr> & pools);
+
     // `scheduleOneRound()` traverses all pools in `read_pools`, try to schedule `SegmentReadTask` of each pool.
     // It returns summary information for a round of scheduling: <erased_pool_count, sched_null_count, sched_succ_count>
     // `erased_pool_count` - how many stale pools have beed erased.
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/Logger.h>
+#include <Common/TiFlashMetrics.h>
 #include <Common/setThreadName.h>
 #include <Storages/DeltaMerge/ReadThread/CPU.h>
 #include <Storages/DeltaMerge/ReadThread/SegmentReadTaskScheduler.h>
@@ -23,16 +24,36 @@
 
 namespace DB::DM
 {
+namespace
+{
+struct NumaNodeMetrics
+{
+    explicit NumaNodeMetrics(size_t numa_node)
+        : merged_tasks(TiFlashMetrics::instance().getReadThreadNumaNodeCounter(numa_node, "merged_task"))
+        , read_blocks(TiFlashMetrics::instance().getReadThreadNumaNodeCounter(numa_node, "read_blocks"))
+        , read_bytes(TiFlashMetrics::instance().getReadThreadNumaNodeCounter(numa_node, "read_bytes"))
+    {}
+
+    prometheus::Counter & merged_tasks;
+    prometheus::Counter & read_blocks;
+    prometheus::Counter & read_bytes;
+};
+
+// The metrics of the NUMA node that current `SegmentReader` thread is bound to.
+thread_local const NumaNodeMetrics * current_numa_node_metrics = nullptr;
+} // namespace
+
 class SegmentReader
 {
     inline static const std::string name{"SegmentReader"};
 
 public:
-    SegmentReader(WorkQueue<MergedTaskPtr> & task_queue_, const std::vector<int> & cpus_)
+    SegmentReader(WorkQueue<MergedTaskPtr> & task_queue_, const std::vector<int> & cpus_, size_t numa_node_)
         : task_queue(task_queue_)
         , stop(false)
-        , log(Logger::get())
+        , log(Logger::get(fmt::format("numa_node={}", numa_node_)))
         , cpus(cpus_)
+        , metrics(numa_node_)
     {
         t = std::thread(&SegmentReader::run, this);
     }
@@ -87,6 +108,7 @@ private:
                 return;
             }
 
+            metrics.merged_tasks.Increment();
             int read_count = 0;
             while (!merged_task->allStreamsFinished() && !isStop())
             {
@@ -97,7 +119,11 @@ private:
                     break;
                 }
             }
-            if (read_count <= 0)
+            if (read_count > 0)
+            {
+                metrics.read_blocks.Increment(read_count);
+            }
+            else
             {
                 LOG_DEBUG(log, "All finished, merged_task=<{}> read_count={}", merged_task->toString(), read_count);
             }
@@ -143,6 +169,7 @@ private:
     {
         setCPUAffinity();
         setThreadName(name.c_str());
+        current_numa_node_metrics = &metrics;
         while (!isStop())
         {
             readSegments();
@@ -154,6 +181,7 @@ private:
     LoggerPtr log;
     std::thread t;
     std::vector<int> cpus;
+    const NumaNodeMetrics metrics;
 };
 
 // ===== SegmentReaderPool ===== //
@@ -166,13 +194,14 @@ void SegmentReaderPool::addTask(MergedTaskPtr && task)
     }
 }
 
-SegmentReaderPool::SegmentReaderPool(int thread_count, const std::vector<int> & cpus)
-    : log(Logger::get())
+SegmentReaderPool::SegmentReaderPool(int thread_count, const std::vector<int> & cpus, size_t numa_node_)
+    : numa_node(numa_node_)
+    , log(Logger::get(fmt::format("numa_node={}", numa_node)))
 {
     LOG_INFO(log, "Create start, thread_count={} cpus={}", thread_count, cpus);
     for (int i = 0; i < thread_count; i++)
     {
-        readers.push_back(std::make_unique<SegmentReader>(task_queue, cpus));
+        readers.push_back(std::make_unique<SegmentReader>(task_queue, cpus, numa_node));
     }
     LOG_INFO(log, "Create end, thread_count={} cpus={}", thread_count, cpus);
 }
@@ -210,9 +239,9 @@ void SegmentReaderPoolManager::init(UInt32 logical_cpu_cores, double read_thread
     auto numa_nodes = getNumaNodes(log);
     RUNTIME_CHECK(!numa_nodes.empty());
     UInt32 thread_count_per_node = std::ceil(total_thread_count / numa_nodes.size());
-    for (const auto & node : numa_nodes)
+    for (size_t i = 0; i < numa_nodes.size(); ++i)
     {
-        reader_pools.push_back(std::make_unique<SegmentReaderPool>(thread_count_per_node, node));
+        reader_pools.push_back(std::make_unique<SegmentReaderPool>(thread_count_per_node, numa_nodes[i], i));
         auto ids = reader_pools.back()->getReaderIds();
         reader_ids.insert(ids.begin(), ids.end());
     }
@@ -234,6 +263,14 @@ bool SegmentReaderPoolManager::isSegmentReader() const
     return reader_ids.find(std::this_thread::get_id()) != reader_ids.end();
 }
 
+void SegmentReaderPoolManager::addReadBytes(size_t bytes)
+{
+    if (current_numa_node_metrics != nullptr)
+    {
+        current_numa_node_metrics->read_bytes.Increment(bytes);
+    }
+}
+
 void SegmentReaderPoolManager::stop()
 {
     reader_pools.clear();
@@ -35,7 +35,7 @@ using SegmentReaderUPtr = std::unique_ptr<SegmentReader>;
 class SegmentReaderPool
 {
 public:
-    SegmentReaderPool(int thread_count, const std::vector<int> & cpus);
+    SegmentReaderPool(int thread_count, const std::vector<int> & cpus, size_t numa_node);
     ~SegmentReaderPool();
 
     DISALLOW_COPY_AND_MOVE(SegmentReaderPool);
@@ -46,6 +46,7 @@ public:
 private:
     void init(int thread_count, const std::vector<int> & cpus);
 
+    const size_t numa_node;
     WorkQueue<MergedTaskPtr> task_queue;
     std::vector<SegmentReaderUPtr> readers;
     LoggerPtr log;
@@ -55,7 +56,7 @@ private:
 // The number of SegmentReadPool object is the same as the number of CPU NUMA node.
 // Thread number of a SegmentReadPool object is the same as the number of CPU logical core of a CPU NUMA node.
 // Function `addTask` dispatches MergedTask to SegmentReadPool by their segment id, so a segment read task
-// wouldn't be processed across NUMA nodes.
+// wouldn't be processed across NUMA nodes. The metrics of the read threads are reported for each NUMA node.
 class SegmentReaderPoolManager
 {
 public:
@@ -71,6 +72,10 @@ public:
     void addTask(MergedTaskPtr && task);
     bool isSegmentReader() const;
 
+    // Add the bytes of blocks read by current thread to the metrics of its NUMA node.
+    // Do nothing if current thread is not a `SegmentReader`.
+    static void addReadBytes(size_t bytes);
+
     // Explicitly, release reader_pools and reader_ids.
     // Threads need to be stop before Context::shutdown().
     void stop();
@@ -0,0 +1,61 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Common/TiFlashMetrics.h>
+#include <Storages/DeltaMerge/File/DMFile.h>
+#include <Storages/DeltaMerge/Remote/DataStore/DataStore.h>
+#include <Storages/DeltaMerge/Remote/RNDMFileCache_fwd.h>
+
+#include <boost/noncopyable.hpp>
+
+namespace DB::DM::Remote
+{
+/**
+ * Only used in disaggregated read node. It caches the DMFile objects restored from the remote data store, so that
+ * the meta of a DMFile is read and parsed once instead of in every query reading it.
+ * The DMFiles in the remote data store are never modified, so a cached DMFile is always valid.
+ */
+class RNDMFileCache : private boost::noncopyable
+{
+public:
+    /// Note that the unit of max_count is quantity, not byte size.
+    explicit RNDMFileCache(size_t max_count)
+        : cache(max_count)
+    {}
+
+    DMFilePtr getOrRestore(const IDataStorePtr & data_store, const String & remote_key)
+    {
+        auto [dmfile, miss] = cache.getOrSet(remote_key, [&] {
+            auto prepared = data_store->prepareDMFileByKey(remote_key);
+            auto restored = prepared->restore(DMFile::ReadMetaMode::all());
+            RUNTIME_CHECK(restored != nullptr, remote_key);
+            return restored;
+        });
+        if (miss)
+            GET_METRIC(tiflash_storage_remote_cache, type_dmfile_meta_miss).Increment();
+        else
+            GET_METRIC(tiflash_storage_remote_cache, type_dmfile_meta_hit).Increment();
+        return dmfile;
+    }
+
+    size_t getCacheCount() const { return cache.count(); }
+
+private:
+    LRUCache<String, DMFile> cache;
+};
+
+} // namespace DB::DM::Remote
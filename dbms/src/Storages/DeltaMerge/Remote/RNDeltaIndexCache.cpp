@@ -24,10 +24,57 @@ extern const Metric DT_DeltaIndexCacheSize;
 namespace DB::DM::Remote
 {
 
-DeltaIndexPtr RNDeltaIndexCache::getDeltaIndex(const CacheKey & key)
+DeltaIndexPtr RNDeltaIndexCache::createDeltaIndex(const CacheKey & key, size_t persisted_rows, size_t persisted_deletes)
 {
-    auto [value, miss]
-        = cache.getOrSet(key, [&key] { return std::make_shared<CacheValue>(std::make_shared<DeltaIndex>(key), 0); });
+    auto segment_key = key;
+    segment_key.delta_index_epoch = 0;
+
+    std::optional<LatestEpoch> prev_epoch;
+    {
+        std::lock_guard lock(mtx);
+        if (latest_epochs.size() >= max_latest_epochs)
+            latest_epochs.clear();
+        auto [itr, inserted] = latest_epochs.try_emplace(segment_key, LatestEpoch{key.delta_index_epoch, 0, 0});
+        if (!inserted && itr->second.delta_index_epoch < key.delta_index_epoch)
+        {
+            prev_epoch = itr->second;
+            itr->second = LatestEpoch{key.delta_index_epoch, 0, 0};
+        }
+    }
+
+    if (prev_epoch)
+    {
+        auto prev_key = segment_key;
+        prev_key.delta_index_epoch = prev_epoch->delta_index_epoch;
+        if (auto prev_value = cache.get(prev_key); prev_value)
+        {
+            GET_METRIC(tiflash_storage_delta_index_cache, type_reuse).Increment();
+            return prev_value->delta_index->cloneForNewEpoch(
+                std::min(prev_epoch->persisted_rows, persisted_rows),
+                std::min(prev_epoch->persisted_deletes, persisted_deletes),
+                key);
+        }
+    }
+    return std::make_shared<DeltaIndex>(key);
+}
+
+DeltaIndexPtr RNDeltaIndexCache::getDeltaIndex(const CacheKey & key, size_t persisted_rows, size_t persisted_deletes)
+{
+    auto [value, miss] = cache.getOrSet(key, [&] {
+        return std::make_shared<CacheValue>(createDeltaIndex(key, persisted_rows, persisted_deletes), 0);
+    });
+    {
+        // Record the persisted rows and deletes of this epoch for cloning the index of the next epoch.
+        auto segment_key = key;
+        segment_key.delta_index_epoch = 0;
+        std::lock_guard lock(mtx);
+        if (auto itr = latest_epochs.find(segment_key);
+            itr != latest_epochs.end() && itr->second.delta_index_epoch == key.delta_index_epoch)
+        {
+            itr->second.persisted_rows = std::max(itr->second.persisted_rows, persisted_rows);
+            itr->second.persisted_deletes = std::max(itr->second.persisted_deletes, persisted_deletes);
+        }
+    }
     if (miss)
     {
         GET_METRIC(tiflash_storage_delta_index_cache, type_miss).Increment();
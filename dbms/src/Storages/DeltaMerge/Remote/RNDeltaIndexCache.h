@@ -20,6 +20,7 @@
 #include <common/types.h>
 
 #include <boost/noncopyable.hpp>
+#include <unordered_map>
 
 namespace DB::DM
 {
@@ -90,8 +91,11 @@ public:
 
     /**
      * Returns a cached or newly created delta index, which is assigned to the specified segment(at)epoch.
+     * `persisted_rows` and `persisted_deletes` are the rows and deletes of the persisted column files in the
+     * snapshot. When the delta index epoch of a segment changes, the new index is cloned from the cached index of
+     * the older epoch by keeping its inserts of these persisted rows, instead of being built from scratch.
      */
-    DeltaIndexPtr getDeltaIndex(const CacheKey & key);
+    DeltaIndexPtr getDeltaIndex(const CacheKey & key, size_t persisted_rows = 0, size_t persisted_deletes = 0);
 
     // `setDeltaIndex` will updated cache size and remove overflows if necessary.
     void setDeltaIndex(const DeltaIndexPtr & delta_index);
@@ -101,8 +105,21 @@ public:
 
 
 private:
+    DeltaIndexPtr createDeltaIndex(const CacheKey & key, size_t persisted_rows, size_t persisted_deletes);
+
+    // The latest delta index epoch seen of each segment, and the max rows and deletes of the persisted column files
+    // in the snapshots of this epoch. It is keyed by CacheKey with `delta_index_epoch` = 0.
+    struct LatestEpoch
+    {
+        UInt64 delta_index_epoch;
+        size_t persisted_rows;
+        size_t persisted_deletes;
+    };
+    static constexpr size_t max_latest_epochs = 100000;
+
     std::mutex mtx;
     LRUCache<CacheKey, CacheValue, CacheKeyHasher, CacheValueWeight> cache;
+    std::unordered_map<CacheKey, LatestEpoch, CacheKeyHasher> latest_epochs;
 };
 
 } // namespace DB::DM::Remote
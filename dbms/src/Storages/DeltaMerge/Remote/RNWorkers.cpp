@@ -14,6 +14,10 @@
 
 #include <Interpreters/Context.h>
 #include <Storages/DeltaMerge/Remote/RNWorkers.h>
+
+#include <algorithm>
+#include <numeric>
+
 namespace DB::DM::Remote
 {
 
@@ -65,8 +69,26 @@ RNWorkers::RNWorkers(
         .read_mode = options.read_mode,
     });
 
-    // TODO: Can we push the task that all delta/stable data hit local cache first?
+    // Fetching the pages of a segment with a large delta takes the longest time. Push these segments first, so
+    // that their fetching overlaps with the others instead of being the tail of the query.
+    std::vector<std::pair<size_t, SegmentReadTaskPtr>> sized_tasks;
+    sized_tasks.reserve(n);
     for (auto const & seg_task : read_tasks)
+    {
+        size_t remote_page_size = 0;
+        if (seg_task->extra_remote_info.has_value())
+        {
+            const auto & page_sizes = seg_task->extra_remote_info->remote_page_sizes;
+            remote_page_size = std::accumulate(page_sizes.begin(), page_sizes.end(), 0UL);
+        }
+        sized_tasks.emplace_back(remote_page_size, seg_task);
+    }
+    std::stable_sort(sized_tasks.begin(), sized_tasks.end(), [](const auto & lhs, const auto & rhs) {
+        return lhs.first > rhs.first;
+    });
+
+    // TODO: Can we push the task that all delta/stable data hit local cache first?
+    for (auto const & [remote_page_size, seg_task] : sized_tasks)
     {
         auto push_result = worker_fetch_pages->source_queue->tryPush(seg_task);
         RUNTIME_CHECK(push_result == MPMCQueueResult::OK, magic_enum::enum_name(push_result));
@@ -25,6 +25,7 @@
 #include <Storages/DeltaMerge/Remote/DataStore/DataStore.h>
 #include <Storages/DeltaMerge/Remote/DisaggSnapshot.h>
 #include <Storages/DeltaMerge/Remote/ObjectId.h>
+#include <Storages/DeltaMerge/Remote/RNDMFileCache.h>
 #include <Storages/DeltaMerge/Remote/RNDeltaIndexCache.h>
 #include <Storages/DeltaMerge/Remote/Serializer.h>
 #include <Storages/DeltaMerge/RowKeyRange.h>
@@ -149,14 +150,17 @@ SegmentSnapshotPtr Serializer::deserializeSegment(
     auto delta_index_cache = dm_context.global_context.getSharedContextDisagg()->rn_delta_index_cache;
     if (delta_index_cache)
     {
-        delta_snap->shared_delta_index = delta_index_cache->getDeltaIndex({
-            .store_id = remote_store_id,
-            .keyspace_id = keyspace_id,
-            .table_id = table_id,
-            .segment_id = proto.segment_id(),
-            .segment_epoch = proto.segment_epoch(),
-            .delta_index_epoch = proto.delta_index_epoch(),
-        });
+        delta_snap->shared_delta_index = delta_index_cache->getDeltaIndex(
+            {
+                .store_id = remote_store_id,
+                .keyspace_id = keyspace_id,
+                .table_id = table_id,
+                .segment_id = proto.segment_id(),
+                .segment_epoch = proto.segment_epoch(),
+                .delta_index_epoch = proto.delta_index_epoch(),
+            },
+            delta_snap->persisted_files_snap->getRows(),
+            delta_snap->persisted_files_snap->getDeletes());
     }
     else
     {
@@ -166,11 +170,17 @@ SegmentSnapshotPtr Serializer::deserializeSegment(
     delta_snap->delta_index_epoch = proto.delta_index_epoch();
 
     auto new_stable = std::make_shared<StableValueSpace>(/* id */ 0);
+    const auto & dmfile_cache = dm_context.global_context.getSharedContextDisagg()->rn_dmfile_cache;
     DMFiles dmfiles;
     dmfiles.reserve(proto.stable_pages().size());
     for (const auto & stable_file : proto.stable_pages())
     {
         auto remote_key = stable_file.checkpoint_info().data_file_id();
+        if (dmfile_cache)
+        {
+            dmfiles.emplace_back(dmfile_cache->getOrRestore(data_store, remote_key));
+            continue;
+        }
         auto prepared = data_store->prepareDMFileByKey(remote_key);
         auto dmfile = prepared->restore(DMFile::ReadMetaMode::all());
         RUNTIME_CHECK(dmfile != nullptr, remote_key);
@@ -275,7 +285,8 @@ RemotePb::ColumnFileRemote Serializer::serializeCFInMemory(const ColumnFileInMem
     if (!need_mem_data)
     {
         std::scoped_lock lock(cf_in_mem.cache->mutex);
-        remote_in_memory->set_rows(cf_in_mem.cache->block.rows());
+        remote_in_memory->set_rows(
+            cf_in_mem.cache->isCompressed() ? cf_in_mem.cache->compressed_rows : cf_in_mem.cache->block.rows());
         return ret;
     }
 
@@ -284,6 +295,15 @@ RemotePb::ColumnFileRemote Serializer::serializeCFInMemory(const ColumnFileInMem
         serializeSchema(wb, cf_in_mem.getSchema()->getSchema());
     }
     std::scoped_lock lock(cf_in_mem.cache->mutex);
+    if (cf_in_mem.cache->isCompressed())
+    {
+        // The compressed data is already in the format of `serializeColumn`, send it directly.
+        for (const auto & buf : cf_in_mem.cache->compressed_columns)
+            remote_in_memory->add_block_columns(buf);
+        remote_in_memory->set_rows(cf_in_mem.cache->compressed_rows);
+        return ret;
+    }
+
     const auto block_rows = cf_in_mem.cache->block.rows();
     for (const auto & col : cf_in_mem.cache->block)
     {
@@ -15,16 +15,20 @@
 #include <Common/Exception.h>
 #include <Common/Stopwatch.h>
 #include <Common/SyncPoint/SyncPoint.h>
+#include <Common/ThreadManager.h>
 #include <Common/TiFlashMetrics.h>
+#include <Common/typeid_cast.h>
 #include <DataStreams/ConcatBlockInputStream.h>
 #include <DataStreams/EmptyBlockInputStream.h>
 #include <DataStreams/ExpressionBlockInputStream.h>
 #include <DataStreams/FilterBlockInputStream.h>
+#include <DataStreams/OneBlockInputStream.h>
 #include <DataStreams/SquashingBlockInputStream.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/SharedContexts/Disagg.h>
 #include <Poco/Logger.h>
 #include <Storages/DeltaMerge/BitmapFilter/BitmapFilterBlockInputStream.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
 #include <Storages/DeltaMerge/DMContext.h>
 #include <Storages/DeltaMerge/DMDecoratorStreams.h>
 #include <Storages/DeltaMerge/DMVersionFilterBlockInputStream.h>
@@ -45,6 +49,7 @@
 #include <Storages/DeltaMerge/RowKeyOrderedBlockInputStream.h>
 #include <Storages/DeltaMerge/Segment.h>
 #include <Storages/DeltaMerge/SegmentReadTaskPool.h>
+#include <Storages/DeltaMerge/StableResultCache.h>
 #include <Storages/DeltaMerge/StoragePool.h>
 #include <Storages/DeltaMerge/WriteBatchesImpl.h>
 #include <Storages/KVStore/KVStore.h>
@@ -91,6 +96,10 @@ extern const Event DMSegmentIsEmptyFastPath;
 extern const Event DMSegmentIsEmptySlowPath;
 extern const Event DMSegmentIngestDataByReplace;
 extern const Event DMSegmentIngestDataIntoDelta;
+extern const Event DMStableResultCacheHits;
+extern const Event DMStableResultCacheMisses;
+extern const Event DMBitmapFilterCacheHits;
+extern const Event DMBitmapFilterCacheMisses;
 
 } // namespace ProfileEvents
 
@@ -460,12 +469,11 @@ Segments Segment::createTargetSegmentsFromCheckpoint( //
     const SegmentMetaInfos & meta_infos,
     const RowKeyRange & range,
     UniversalPageStoragePtr temp_ps,
-    WriteBatches & wbs)
+    WriteBatches & wbs,
+    size_t concurrency)
 {
     UNUSED(remote_store_id);
-    Segments segments;
-    for (const auto & segment_info : meta_infos)
-    {
+    auto create_segment = [&](const SegmentMetaInfo & segment_info, WriteBatches & segment_wbs) {
         LOG_DEBUG(
             parent_log,
             "Create segment begin. Delta id {} stable id {} range {} epoch {} next_segment_id {}",
@@ -474,14 +482,19 @@ Segments Segment::createTargetSegmentsFromCheckpoint( //
             segment_info.range.toDebugString(),
             segment_info.epoch,
             segment_info.next_segment_id);
-        auto stable = StableValueSpace::createFromCheckpoint(parent_log, context, temp_ps, segment_info.stable_id, wbs);
+        auto stable = StableValueSpace::createFromCheckpoint(
+            parent_log,
+            context,
+            temp_ps,
+            segment_info.stable_id,
+            segment_wbs);
         auto delta = DeltaValueSpace::createFromCheckpoint(
             parent_log,
             context,
             temp_ps,
             segment_info.range,
             segment_info.delta_id,
-            wbs);
+            segment_wbs);
         auto segment = std::make_shared<Segment>(
             Logger::get("Checkpoint"),
             segment_info.epoch,
@@ -490,7 +503,6 @@ Segments Segment::createTargetSegmentsFromCheckpoint( //
             segment_info.next_segment_id,
             delta,
             stable);
-        segments.push_back(segment);
         LOG_DEBUG(
             parent_log,
             "Create segment end. Delta id {} stable id {} range {} epoch {} next_segment_id {}",
@@ -499,7 +511,38 @@ Segments Segment::createTargetSegmentsFromCheckpoint( //
             segment_info.range.toDebugString(),
             segment_info.epoch,
             segment_info.next_segment_id);
-    }
+        return segment;
+    };
+
+    Segments segments;
+    if (concurrency <= 1 || meta_infos.size() <= 1)
+    {
+        for (const auto & segment_info : meta_infos)
+            segments.push_back(create_segment(segment_info, wbs));
+        return segments;
+    }
+
+    // Every task restores the segments with its own WriteBatches and writes them when it is done.
+    // The written pages are recorded in `wbs`, so that they can be rolled back together.
+    segments.resize(meta_infos.size());
+    std::mutex wbs_mu;
+    auto thread_manager = newThreadPoolManager(concurrency);
+    for (size_t i = 0; i < meta_infos.size(); ++i)
+    {
+        thread_manager->schedule(true, [&, i] {
+            WriteBatches segment_wbs{*context.storage_pool};
+            SCOPE_EXIT({
+                std::lock_guard lock(wbs_mu);
+                auto & log_ids = segment_wbs.written_log;
+                auto & data_ids = segment_wbs.written_data;
+                wbs.written_log.insert(wbs.written_log.end(), log_ids.begin(), log_ids.end());
+                wbs.written_data.insert(wbs.written_data.end(), data_ids.begin(), data_ids.end());
+            });
+            segments[i] = create_segment(meta_infos[i], segment_wbs);
+            segment_wbs.writeLogAndData();
+        });
+    }
+    thread_manager->wait();
     return segments;
 }
 
@@ -797,6 +840,7 @@ BlockInputStreamPtr Segment::getInputStream(
         expected_block_size,
         columns_to_read,
         segment_snap->stable->stable);
+    recordRead(read_ranges);
     switch (read_mode)
     {
     case ReadMode::Normal:
@@ -833,6 +877,14 @@ BlockInputStreamPtr Segment::getInputStream(
             max_version,
             expected_block_size,
             clipped_block_rows);
+    case ReadMode::Count:
+        return getCountInputStream(
+            dm_context,
+            columns_to_read,
+            segment_snap,
+            read_ranges,
+            max_version,
+            expected_block_size);
     default:
         return nullptr;
     }
@@ -1046,32 +1098,74 @@ BlockInputStreamPtr Segment::getInputStreamModeFast(
         }
     }
 
-    BlockInputStreamPtr stable_stream = segment_snap->stable->getInputStream(
-        dm_context,
-        *new_columns_to_read,
-        data_ranges,
-        filter,
-        std::numeric_limits<UInt64>::max(),
-        expected_block_size,
-        /* enable_handle_clean_read */ enable_handle_clean_read,
-        /* is_fast_scan */ true,
-        /* enable_del_clean_read */ enable_del_clean_read);
-
     BlockInputStreamPtr delta_stream = std::make_shared<DeltaValueInputStream>(
         dm_context,
         segment_snap->delta,
         new_columns_to_read,
-        this->rowkey_range);
+        this->rowkey_range,
+        filter);
 
     // Do row key filtering based on data_ranges.
     delta_stream = std::make_shared<DMRowKeyFilterBlockInputStream<false>>(delta_stream, data_ranges, 0);
-    stable_stream = std::make_shared<DMRowKeyFilterBlockInputStream<true>>(stable_stream, data_ranges, 0);
 
     // Filter the unneeded column and filter out the rows whose del_mark is true.
     delta_stream
         = std::make_shared<DMDeleteFilterBlockInputStream>(delta_stream, columns_to_read, dm_context.tracing_id);
-    stable_stream
-        = std::make_shared<DMDeleteFilterBlockInputStream>(stable_stream, columns_to_read, dm_context.tracing_id);
+
+    // The stable is read without MVCC filtering in fast mode, so the result only depends on the
+    // stable snapshot and the read arguments, and can be reused by the following queries.
+    auto stable_result_cache = dm_context.global_context.getStableResultCache();
+    std::optional<String> stable_result_key;
+    StableResultPtr stable_result;
+    if (stable_result_cache && dm_context.stable_result_cache_max_entry_bytes > 0 && !dm_context.read_delta_only)
+    {
+        stable_result_key = StableResultCache::buildKey(
+            dm_context,
+            segment_id,
+            segment_snap->stable,
+            columns_to_read,
+            data_ranges,
+            filter);
+        if (stable_result_key)
+        {
+            stable_result = stable_result_cache->get(*stable_result_key);
+            ProfileEvents::increment(
+                stable_result ? ProfileEvents::DMStableResultCacheHits : ProfileEvents::DMStableResultCacheMisses);
+        }
+    }
+
+    BlockInputStreamPtr stable_stream;
+    if (stable_result)
+    {
+        stable_stream = std::make_shared<StableResultBlockInputStream>(stable_result, columns_to_read);
+    }
+    else
+    {
+        stable_stream = segment_snap->stable->getInputStream(
+            dm_context,
+            *new_columns_to_read,
+            data_ranges,
+            filter,
+            std::numeric_limits<UInt64>::max(),
+            expected_block_size,
+            /* enable_handle_clean_read */ enable_handle_clean_read,
+            /* is_fast_scan */ true,
+            /* enable_del_clean_read */ enable_del_clean_read,
+            /* read_packs */ {},
+            /* need_row_id */ false,
+            /* enable_circular_scan */ true);
+        stable_stream = std::make_shared<DMRowKeyFilterBlockInputStream<true>>(stable_stream, data_ranges, 0);
+        stable_stream
+            = std::make_shared<DMDeleteFilterBlockInputStream>(stable_stream, columns_to_read, dm_context.tracing_id);
+        if (stable_result_key)
+        {
+            stable_stream = std::make_shared<StableResultCacheWriteBlockInputStream>(
+                stable_stream,
+                stable_result_cache,
+                *stable_result_key,
+                dm_context.stable_result_cache_max_entry_bytes);
+        }
+    }
 
     BlockInputStreams streams;
 
@@ -1200,7 +1294,7 @@ StableValueSpacePtr Segment::prepareMergeDelta(
         *schema_snap,
         segment_snap,
         rowkey_range,
-        dm_context.stable_pack_rows,
+        getStablePackRows(dm_context),
         /*reorginize_block*/ true);
 
     auto new_stable = createNewStable(dm_context, schema_snap, data_stream, segment_snap->stable->getId(), wbs);
@@ -1241,6 +1335,8 @@ SegmentPtr Segment::applyMergeDelta(
 
     // avoid recheck whether to do DeltaMerge using the same gc_safe_point
     new_me->setLastCheckGCSafePoint(context.min_version);
+    // Decay the read statistics, so that the adaptive policy follows the recent reads
+    new_me->inheritReadStats(*this, /*decay*/ true);
 
     // Store new meta data
     new_me->serialize(wbs.meta);
@@ -1860,7 +1956,7 @@ std::optional<Segment::SplitInfo> Segment::prepareSplitPhysical( //
             my_delta_reader,
             read_info.index_begin,
             read_info.index_end,
-            dm_context.stable_pack_rows);
+            getStablePackRows(dm_context));
 
 
         my_data = std::make_shared<DMRowKeyFilterBlockInputStream<true>>(my_data, my_ranges, 0);
@@ -1891,7 +1987,7 @@ std::optional<Segment::SplitInfo> Segment::prepareSplitPhysical( //
             other_delta_reader,
             read_info.index_begin,
             read_info.index_end,
-            dm_context.stable_pack_rows);
+            getStablePackRows(dm_context));
 
 
         other_data = std::make_shared<DMRowKeyFilterBlockInputStream<true>>(other_data, other_ranges, 0);
@@ -1984,6 +2080,8 @@ SegmentPair Segment::applySplit( //
         this->next_segment_id,
         other_delta,
         split_info.other_stable);
+    new_me->inheritReadStats(*this, /*decay*/ false);
+    other->inheritReadStats(*this, /*decay*/ false);
 
     new_me->delta->saveMeta(wbs);
     new_me->stable->saveMeta(wbs.meta);
@@ -2187,6 +2285,8 @@ SegmentPtr Segment::applyMerge(
         last_seg->next_segment_id,
         merged_delta,
         merged_stable);
+    for (const auto & seg : ordered_segments)
+        merged->inheritReadStats(*seg, /*decay*/ false);
 
     // Store new meta data
     merged->delta->saveMeta(wbs);
@@ -2771,6 +2871,31 @@ BitmapFilterPtr Segment::buildBitmapFilterNormal(
     size_t expected_block_size)
 {
     Stopwatch sw_total;
+
+    // The concurrent reads of the same segment snapshot usually have close `max_version`,
+    // the bitmap filter built by one of them can be shared if no row is committed between them.
+    auto bitmap_filter_cache = dm_context.global_context.getBitmapFilterCache();
+    std::optional<String> cache_key;
+    if (bitmap_filter_cache)
+    {
+        cache_key = BitmapFilterCache::buildKey(dm_context, segment_id, epoch, segment_snap, read_ranges, filter);
+        if (cache_key)
+        {
+            auto cached = bitmap_filter_cache->get(*cache_key);
+            if (cached && cached->isValidFor(max_version))
+            {
+                ProfileEvents::increment(ProfileEvents::DMBitmapFilterCacheHits);
+                LOG_DEBUG(
+                    segment_snap->log,
+                    "buildBitmapFilterNormal hit cache, build_version={} max_version={}",
+                    cached->build_version,
+                    max_version);
+                return cached->bitmap_filter;
+            }
+            ProfileEvents::increment(ProfileEvents::DMBitmapFilterCacheMisses);
+        }
+    }
+
     ColumnDefines columns_to_read{
         getExtraHandleColumnDefine(is_common_handle),
     };
@@ -2784,12 +2909,26 @@ BitmapFilterPtr Segment::buildBitmapFilterNormal(
         max_version,
         expected_block_size,
         /*need_row_id*/ true);
+    auto * version_filter = typeid_cast<DMVersionFilterBlockInputStream<DM_VERSION_FILTER_MODE_MVCC> *>(stream.get());
+    if (cache_key && version_filter)
+        version_filter->enableTrackMinInvisibleVersion();
     // `total_rows` is the rows read for building bitmap
     auto total_rows = segment_snap->delta->getRows() + segment_snap->stable->getDMFilesRows();
     auto bitmap_filter = std::make_shared<BitmapFilter>(total_rows, /*default_value*/ false);
     bitmap_filter->set(stream);
     bitmap_filter->runOptimize();
 
+    if (cache_key && version_filter)
+    {
+        bitmap_filter_cache->set(
+            *cache_key,
+            std::make_shared<CachedBitmapFilter>(CachedBitmapFilter{
+                .bitmap_filter = bitmap_filter,
+                .build_version = max_version,
+                .valid_until_version = version_filter->getMinInvisibleVersion(),
+            }));
+    }
+
     const auto elapse_ns = sw_total.elapsed();
     dm_context.scan_context->build_bitmap_time_ns += elapse_ns;
     LOG_DEBUG(
@@ -2947,6 +3086,7 @@ BitmapFilterPtr Segment::buildBitmapFilterStableOnly(
     }
     if (!has_some_packs)
     {
+        bitmap_filter->runOptimize();
         auto elapse_ms = commit_elapse();
         LOG_DEBUG(
             segment_snap->log,
@@ -2984,6 +3124,7 @@ BitmapFilterPtr Segment::buildBitmapFilterStableOnly(
         is_common_handle,
         dm_context.tracing_id);
     bitmap_filter->set(stream);
+    bitmap_filter->runOptimize();
 
     auto elapse_ms = commit_elapse();
     LOG_DEBUG(
@@ -3019,14 +3160,19 @@ BlockInputStreamPtr Segment::getBitmapFilterInputStream(
         expected_block_size,
         enable_handle_clean_read,
         is_fast_scan,
-        enable_del_clean_read);
+        enable_del_clean_read,
+        /* read_packs */ {},
+        /* need_row_id */ false,
+        // The bitmap filter is applied by the start offset of blocks, so the order of packs does not matter.
+        /* enable_circular_scan */ true);
 
     auto columns_to_read_ptr = std::make_shared<ColumnDefines>(columns_to_read);
     SkippableBlockInputStreamPtr delta_stream = std::make_shared<DeltaValueInputStream>(
         dm_context,
         segment_snap->delta,
         columns_to_read_ptr,
-        this->rowkey_range);
+        this->rowkey_range,
+        filter);
 
     return std::make_shared<BitmapFilterBlockInputStream>(
         columns_to_read,
@@ -3037,6 +3183,39 @@ BlockInputStreamPtr Segment::getBitmapFilterInputStream(
         dm_context.tracing_id);
 }
 
+BlockInputStreamPtr Segment::getCountInputStream(
+    const DMContext & dm_context,
+    const ColumnDefines & columns_to_read,
+    const SegmentSnapshotPtr & segment_snap,
+    const RowKeyRanges & read_ranges,
+    UInt64 max_version,
+    size_t build_bitmap_filter_block_rows)
+{
+    auto block = toEmptyBlock(columns_to_read);
+    auto real_ranges = shrinkRowKeyRanges(read_ranges);
+    if (real_ranges.empty())
+        return std::make_shared<EmptyBlockInputStream>(block);
+
+    // The packs that are fully covered by the ranges and have no deletes or newer versions are
+    // counted by their pack stats without reading, see `buildBitmapFilterStableOnly`.
+    auto bitmap_filter = buildBitmapFilter(
+        dm_context,
+        segment_snap,
+        real_ranges,
+        EMPTY_RS_OPERATOR,
+        max_version,
+        build_bitmap_filter_block_rows);
+    segment_snap->stable->clearColumnCaches();
+
+    const auto rows = bitmap_filter->count();
+    if (rows == 0)
+        return std::make_shared<EmptyBlockInputStream>(block);
+    // The operators above a table scan do not expect const columns, so they are materialized
+    for (auto & col : block)
+        col.column = col.type->createColumnConstWithDefaultValue(rows)->convertToFullColumnIfConst();
+    return std::make_shared<OneBlockInputStream>(block);
+}
+
 BlockInputStreamPtr Segment::getLateMaterializationStream(
     BitmapFilterPtr && bitmap_filter,
     const DMContext & dm_context,
@@ -3064,8 +3243,12 @@ BlockInputStreamPtr Segment::getLateMaterializationStream(
         enable_handle_clean_read,
         is_fast_scan,
         enable_del_clean_read);
-    SkippableBlockInputStreamPtr filter_column_delta_stream
-        = std::make_shared<DeltaValueInputStream>(dm_context, segment_snap->delta, filter_columns, this->rowkey_range);
+    SkippableBlockInputStreamPtr filter_column_delta_stream = std::make_shared<DeltaValueInputStream>(
+        dm_context,
+        segment_snap->delta,
+        filter_columns,
+        this->rowkey_range,
+        filter->rs_operator);
 
     if (unlikely(filter_columns->size() == columns_to_read.size()))
     {
@@ -3146,11 +3329,13 @@ BlockInputStreamPtr Segment::getLateMaterializationStream(
         enable_handle_clean_read,
         is_fast_scan,
         enable_del_clean_read);
+    // Must skip the same column files as `filter_column_delta_stream`
     SkippableBlockInputStreamPtr rest_column_delta_stream = std::make_shared<DeltaValueInputStream>(
         dm_context,
         segment_snap->delta,
         rest_columns_to_read,
-        this->rowkey_range);
+        this->rowkey_range,
+        filter->rs_operator);
     SkippableBlockInputStreamPtr rest_column_stream = std::make_shared<RowKeyOrderedBlockInputStream>(
         *rest_columns_to_read,
         rest_column_stable_stream,
@@ -3165,9 +3350,59 @@ BlockInputStreamPtr Segment::getLateMaterializationStream(
         filter_column_stream,
         rest_column_stream,
         bitmap_filter,
+        filter->selectivity,
         dm_context.tracing_id);
 }
 
+void Segment::recordRead(const RowKeyRanges & read_ranges) const
+{
+    const bool is_full_scan = std::any_of(read_ranges.cbegin(), read_ranges.cend(), [&](const auto & range) {
+        return rowkey_range.shrink(range) == rowkey_range;
+    });
+    (is_full_scan ? full_scans : range_reads).fetch_add(1, std::memory_order_relaxed);
+}
+
+void Segment::inheritReadStats(const Segment & from, bool decay)
+{
+    const size_t shift = decay ? 1 : 0;
+    full_scans.fetch_add(from.getFullScans() >> shift, std::memory_order_relaxed);
+    range_reads.fetch_add(from.getRangeReads() >> shift, std::memory_order_relaxed);
+}
+
+Segment::ReadPattern Segment::getReadPattern(size_t min_reads) const
+{
+    // One kind of reads is dominant if it is at least `dominant_ratio` times of the other kind
+    static constexpr UInt64 dominant_ratio = 4;
+
+    const auto scans = getFullScans();
+    const auto ranges = getRangeReads();
+    if (min_reads == 0 || scans + ranges < min_reads)
+        return ReadPattern::Unknown;
+    if (ranges >= scans * dominant_ratio)
+        return ReadPattern::RangeRead;
+    if (scans >= ranges * dominant_ratio)
+        return ReadPattern::FullScan;
+    return ReadPattern::Mixed;
+}
+
+size_t Segment::getStablePackRows(const DMContext & dm_context) const
+{
+    switch (getReadPattern(dm_context.adaptive_segment_min_reads))
+    {
+    case ReadPattern::RangeRead:
+        return std::max<size_t>(dm_context.stable_pack_rows / 2, 1);
+    case ReadPattern::FullScan:
+        return dm_context.stable_pack_rows * 2;
+    default:
+        return dm_context.stable_pack_rows;
+    }
+}
+
+size_t Segment::getSegmentLimitFactor(const DMContext & dm_context) const
+{
+    return getReadPattern(dm_context.adaptive_segment_min_reads) == ReadPattern::FullScan ? 2 : 1;
+}
+
 RowKeyRanges Segment::shrinkRowKeyRanges(const RowKeyRanges & read_ranges) const
 {
     RowKeyRanges real_ranges;
@@ -3215,6 +3450,32 @@ BlockInputStreamPtr Segment::getBitmapFilterInputStream(
         segment_snap->stable->clearColumnCaches();
     }
 
+    // The unselective filter makes late materialization read all columns by two streams, which is slower
+    // than reading them at once. The columns can not be read at once if they need extra cast for the filter.
+    if (filter && filter->before_where && !filter->extra_cast
+        && filter->selectivity->isUnselective(
+            dm_context.late_materialization_sample_rows,
+            dm_context.late_materialization_max_passed_ratio))
+    {
+        BlockInputStreamPtr stream = getBitmapFilterInputStream(
+            std::move(bitmap_filter),
+            segment_snap,
+            dm_context,
+            columns_to_read,
+            real_ranges,
+            filter->rs_operator,
+            max_version,
+            read_data_block_rows);
+        stream = std::make_shared<FilterBlockInputStream>(
+            stream,
+            filter->before_where,
+            filter->filter_column_name,
+            dm_context.tracing_id);
+        stream->setExtraInfo("push down filter");
+        // remove the tmp filter column
+        return std::make_shared<DMColumnProjectionBlockInputStream>(stream, columns_to_read);
+    }
+
     if (filter && filter->before_where)
     {
         // if has filter conditions pushed down, use late materialization
@@ -179,6 +179,8 @@ public:
 
     // Create a list of temp segments from checkpoint.
     // The data of these temp segments will be included in `wbs`.
+    // The segments are restored by at most `concurrency` threads, because restoring the DMFiles
+    // from S3 is the most time consuming part of FAP.
     static Segments createTargetSegmentsFromCheckpoint( //
         const LoggerPtr & parent_log,
         DMContext & context,
@@ -186,7 +188,8 @@ public:
         const SegmentMetaInfos & meta_infos,
         const RowKeyRange & range,
         UniversalPageStoragePtr temp_ps,
-        WriteBatches & wbs);
+        WriteBatches & wbs,
+        size_t concurrency = 1);
 
     void serializeToFAPTempSegment(DB::FastAddPeerProto::FAPTempSegmentInfo * segment_info);
     UInt64 storeSegmentMetaInfo(WriteBuffer & buf) const;
@@ -596,6 +599,32 @@ public:
         last_check_gc_safe_point.store(gc_safe_point, std::memory_order_relaxed);
     }
 
+    enum class ReadPattern
+    {
+        // Not enough reads to tell the pattern
+        Unknown,
+        // Most reads cover a part of the segment, e.g. the point gets and range reads
+        RangeRead,
+        // Most reads cover the whole segment
+        FullScan,
+        Mixed,
+    };
+
+    /// Record a read of the segment. A read is a full scan if any of `read_ranges` covers the segment.
+    /// The read statistics are inherited by the new segments after merge delta, split and merge.
+    void recordRead(const RowKeyRanges & read_ranges) const;
+    void inheritReadStats(const Segment & from, bool decay);
+    UInt64 getFullScans() const { return full_scans.load(std::memory_order_relaxed); }
+    UInt64 getRangeReads() const { return range_reads.load(std::memory_order_relaxed); }
+    ReadPattern getReadPattern(size_t min_reads) const;
+
+    /// The expected pack rows when rewriting the stable of this segment. The range reads prefer
+    /// smaller packs for better pruning, the full scans prefer larger packs for less overhead.
+    size_t getStablePackRows(const DMContext & dm_context) const;
+    /// The factor of `segment_limit_rows` and `segment_limit_bytes` when checking split and merge.
+    /// The segments which are only scanned can be larger, so that there are fewer segments to read.
+    size_t getSegmentLimitFactor(const DMContext & dm_context) const;
+
 #ifndef DBMS_PUBLIC_GTEST
 private:
 #else
@@ -701,6 +730,15 @@ public:
         size_t build_bitmap_filter_block_rows,
         size_t read_data_block_rows);
 
+    /// Return the rows visible to the read as constant default values, see `ReadMode::Count`.
+    BlockInputStreamPtr getCountInputStream(
+        const DMContext & dm_context,
+        const ColumnDefines & columns_to_read,
+        const SegmentSnapshotPtr & segment_snap,
+        const RowKeyRanges & read_ranges,
+        UInt64 max_version,
+        size_t build_bitmap_filter_block_rows);
+
     BlockInputStreamPtr getLateMaterializationStream(
         BitmapFilterPtr && bitmap_filter,
         const DMContext & dm_context,
@@ -751,6 +789,9 @@ public:
     // and to avoid doing this check repeatedly, we add this flag to indicate whether the valid data ratio has already been checked.
     std::atomic<bool> check_valid_data_ratio = false;
 
+    mutable std::atomic<UInt64> full_scans = 0;
+    mutable std::atomic<UInt64> range_reads = 0;
+
     const LoggerPtr parent_log; // Used when constructing new segments in split
     const LoggerPtr log;
 };
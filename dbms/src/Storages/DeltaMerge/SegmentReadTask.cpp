@@ -171,6 +171,33 @@ void SegmentReadTask::mergeRanges()
     ranges = DM::tryMergeRanges(std::move(ranges), 1);
 }
 
+SegmentReadTasks SegmentReadTask::trySplitByStable() const
+{
+    if (ranges.size() != 1)
+        return {};
+
+    // Only split the task that reads the whole segment. The split point is the middle row of the stable,
+    // which is useless for a task that reads only part of the segment, and finding it costs reading a pack.
+    const auto & seg_range = segment->getRowKeyRange();
+    if (!(ranges.front().shrink(seg_range) == seg_range))
+        return {};
+
+    auto split_point = segment->getSplitPointFast(*dm_context, read_snapshot->stable);
+    if (!split_point.has_value())
+        return {};
+
+    const auto & range = ranges.front();
+    RowKeyRange left_range(range.start, *split_point, range.is_common_handle, range.rowkey_column_size);
+    RowKeyRange right_range(*split_point, range.end, range.is_common_handle, range.rowkey_column_size);
+    if (left_range.none() || right_range.none())
+        return {};
+
+    return {
+        std::make_shared<SegmentReadTask>(segment, read_snapshot->clone(), dm_context, RowKeyRanges{left_range}),
+        std::make_shared<SegmentReadTask>(segment, read_snapshot->clone(), dm_context, RowKeyRanges{right_range}),
+    };
+}
+
 SegmentReadTasks SegmentReadTask::trySplitReadTasks(const SegmentReadTasks & tasks, size_t expected_size)
 {
     if (tasks.empty() || tasks.size() >= expected_size)
@@ -187,30 +214,44 @@ SegmentReadTasks SegmentReadTask::trySplitReadTasks(const SegmentReadTasks & tas
         tasks.end(),
         cmp);
 
+    // Tasks that can not be split any more.
+    SegmentReadTasks result_tasks;
+
     // Split the top task.
-    while (largest_ranges_first.size() < expected_size && largest_ranges_first.top()->ranges.size() > 1)
+    while (!largest_ranges_first.empty() && largest_ranges_first.size() + result_tasks.size() < expected_size)
     {
         auto top = largest_ranges_first.top();
         largest_ranges_first.pop();
 
-        size_t split_count = top->ranges.size() / 2;
-
-        auto left = std::make_shared<SegmentReadTask>(
-            top->segment,
-            top->read_snapshot->clone(),
-            top->dm_context,
-            RowKeyRanges(top->ranges.begin(), top->ranges.begin() + split_count));
-        auto right = std::make_shared<SegmentReadTask>(
-            top->segment,
-            top->read_snapshot->clone(),
-            top->dm_context,
-            RowKeyRanges(top->ranges.begin() + split_count, top->ranges.end()));
-
-        largest_ranges_first.push(left);
-        largest_ranges_first.push(right);
+        if (top->ranges.size() > 1)
+        {
+            size_t split_count = top->ranges.size() / 2;
+
+            auto left = std::make_shared<SegmentReadTask>(
+                top->segment,
+                top->read_snapshot->clone(),
+                top->dm_context,
+                RowKeyRanges(top->ranges.begin(), top->ranges.begin() + split_count));
+            auto right = std::make_shared<SegmentReadTask>(
+                top->segment,
+                top->read_snapshot->clone(),
+                top->dm_context,
+                RowKeyRanges(top->ranges.begin() + split_count, top->ranges.end()));
+
+            largest_ranges_first.push(left);
+            largest_ranges_first.push(right);
+        }
+        else if (auto split_tasks = top->trySplitByStable(); !split_tasks.empty())
+        {
+            for (auto & split_task : split_tasks)
+                largest_ranges_first.push(split_task);
+        }
+        else
+        {
+            result_tasks.push_back(top);
+        }
     }
 
-    SegmentReadTasks result_tasks;
     while (!largest_ranges_first.empty())
     {
         result_tasks.push_back(largest_ranges_first.top());
@@ -97,8 +97,13 @@ public:
 
     void mergeRanges();
 
+    // Split tasks until there are at least `expected_size` tasks or no task can be split any more.
     static SegmentReadTasks trySplitReadTasks(const SegmentReadTasks & tasks, size_t expected_size);
 
+    // Split a task with only one range into two tasks at the split point of the stable.
+    // Return empty if the task can not be split.
+    SegmentReadTasks trySplitByStable() const;
+
     void fetchPages();
 
     void initInputStream(
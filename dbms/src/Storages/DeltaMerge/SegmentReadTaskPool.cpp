@@ -15,6 +15,7 @@
 #include <Common/FailPoint.h>
 #include <DataStreams/AddExtraTableIDColumnInputStream.h>
 #include <Interpreters/Context.h>
+#include <Storages/DeltaMerge/ReadThread/SegmentReader.h>
 #include <Storages/DeltaMerge/SegmentReadTaskPool.h>
 
 #include <magic_enum.hpp>
@@ -88,7 +89,7 @@ BlockInputStreamPtr SegmentReadTaskPool::buildInputStream(SegmentReadTaskPtr & t
 
     t->fetchPages();
 
-    if (likely(read_mode == ReadMode::Bitmap && !res_group_name.empty()))
+    if (likely((read_mode == ReadMode::Bitmap || read_mode == ReadMode::Count) && !res_group_name.empty()))
     {
         auto bytes = t->read_snapshot->estimatedBytesOfInternalColumns();
         LocalAdmissionController::global_instance->consumeBytesResource(res_group_name, bytesToRU(bytes));
@@ -96,7 +97,7 @@ BlockInputStreamPtr SegmentReadTaskPool::buildInputStream(SegmentReadTaskPtr & t
     t->initInputStream(
         columns_to_read,
         max_version,
-        filter,
+        filter ? filter->withTopNThreshold() : filter,
         read_mode,
         expected_block_size,
         t->dm_context->global_context.getSettingsRef().dt_enable_delta_index_error_fallback);
@@ -281,6 +282,7 @@ void SegmentReadTaskPool::pushBlock(Block && block)
     auto bytes = block.bytes();
     read_bytes_after_last_check += bytes;
     GET_METRIC(tiflash_storage_read_thread_counter, type_push_block_bytes).Increment(bytes);
+    SegmentReaderPoolManager::addReadBytes(bytes);
     q.push(std::move(block), nullptr);
 }
 
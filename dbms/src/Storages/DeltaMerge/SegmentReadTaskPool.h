@@ -189,6 +189,8 @@ public:
 
     bool isRUExhausted();
 
+    const String & getResourceGroupName() const { return res_group_name; }
+
     const LoggerPtr & getLogger() const { return log; }
 
 #ifndef DBMS_PUBLIC_GTEST
@@ -0,0 +1,67 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Common/FmtUtils.h>
+#include <Common/RedactHelpers.h>
+#include <Storages/DeltaMerge/DMContext.h>
+#include <Storages/DeltaMerge/File/DMFile.h>
+#include <Storages/DeltaMerge/StableResultCache.h>
+
+namespace DB::DM
+{
+std::optional<String> StableResultCache::buildKey(
+    const DMContext & dm_context,
+    UInt64 segment_id,
+    const StableValueSpace::SnapshotPtr & stable_snap,
+    const ColumnDefines & columns_to_read,
+    const RowKeyRanges & read_ranges,
+    const RSOperatorPtr & filter)
+{
+    // The values in the filter are replaced by "?" when redact log is enabled,
+    // the debug string can not tell different filters apart.
+    if (filter && Redact::isRedactLog())
+        return std::nullopt;
+
+    FmtBuffer fmt_buf;
+    fmt_buf.fmtAppend(
+        "{}/{}/{}/{}/",
+        dm_context.keyspace_id,
+        dm_context.physical_table_id,
+        segment_id,
+        stable_snap->getId());
+    // The path of DMFile contains its file id, and the store id for the remote DMFiles.
+    fmt_buf.joinStr(
+        stable_snap->getDMFiles().cbegin(),
+        stable_snap->getDMFiles().cend(),
+        [](const auto & file, FmtBuffer & fb) { fb.fmtAppend("{}:{}", file->path(), file->pageId()); },
+        ",");
+    fmt_buf.append("/");
+    fmt_buf.joinStr(
+        columns_to_read.cbegin(),
+        columns_to_read.cend(),
+        [](const auto & cd, FmtBuffer & fb) { fb.fmtAppend("{}:{}", cd.id, cd.type->getName()); },
+        ",");
+    fmt_buf.append("/");
+    fmt_buf.joinStr(
+        read_ranges.cbegin(),
+        read_ranges.cend(),
+        [](const auto & range, FmtBuffer & fb) { fb.append(range.toString()); },
+        ",");
+    fmt_buf.append("/");
+    if (filter)
+        fmt_buf.append(filter->toDebugString());
+    return fmt_buf.toString();
+}
+
+} // namespace DB::DM
@@ -0,0 +1,158 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Core/Block.h>
+#include <DataStreams/IBlockInputStream.h>
+#include <Storages/DeltaMerge/DeltaMergeHelpers.h>
+#include <Storages/DeltaMerge/Filter/RSOperator.h>
+#include <Storages/DeltaMerge/RowKeyRange.h>
+#include <Storages/DeltaMerge/StableValueSpace.h>
+
+#include <optional>
+
+namespace DB
+{
+namespace DM
+{
+struct DMContext;
+
+/// The blocks read from the stable layer of a segment in `ReadMode::Fast`.
+/// The stable layer is immutable and fast mode reads it without MVCC filtering, so the output of
+/// a stable snapshot only depends on the columns, the ranges and the rough set filter. Repeated
+/// queries (e.g. dashboards) can reuse the blocks and only scan their delta layer.
+struct StableResult
+{
+    BlocksList blocks;
+    size_t bytes = 0;
+    size_t rows = 0;
+};
+using StableResultPtr = std::shared_ptr<StableResult>;
+
+struct StableResultWeightFunction
+{
+    size_t operator()(const String & key, const StableResult & result) const
+    {
+        return result.bytes + key.size() + sizeof(StableResult) + sizeof(std::list<String>);
+    }
+};
+
+class StableResultCache : public LRUCache<String, StableResult, std::hash<String>, StableResultWeightFunction>
+{
+private:
+    using Base = LRUCache<String, StableResult, std::hash<String>, StableResultWeightFunction>;
+
+public:
+    explicit StableResultCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes)
+    {}
+
+    /// Return the cache key of reading `stable_snap` with the given arguments.
+    /// Return std::nullopt if the result is not cacheable.
+    static std::optional<String> buildKey(
+        const DMContext & dm_context,
+        UInt64 segment_id,
+        const StableValueSpace::SnapshotPtr & stable_snap,
+        const ColumnDefines & columns_to_read,
+        const RowKeyRanges & read_ranges,
+        const RSOperatorPtr & filter);
+};
+
+using StableResultCachePtr = std::shared_ptr<StableResultCache>;
+
+/// Read the blocks of a cached `StableResult`.
+class StableResultBlockInputStream : public IBlockInputStream
+{
+public:
+    StableResultBlockInputStream(const StableResultPtr & result_, const ColumnDefines & columns_to_read)
+        : result(result_)
+        , header(toEmptyBlock(columns_to_read))
+        , it(result->blocks.cbegin())
+    {}
+
+    String getName() const override { return "StableResult"; }
+
+    Block getHeader() const override { return header; }
+
+    Block read() override
+    {
+        if (it == result->blocks.cend())
+            return {};
+        return *(it++);
+    }
+
+private:
+    StableResultPtr result;
+    Block header;
+    BlocksList::const_iterator it;
+};
+
+/// Pass through the blocks of the child stream, and put them into the cache after the child stream
+/// reaches its end. Nothing is cached if the stream is not fully read or the blocks are larger than
+/// `max_bytes`.
+class StableResultCacheWriteBlockInputStream : public IBlockInputStream
+{
+public:
+    StableResultCacheWriteBlockInputStream(
+        const BlockInputStreamPtr & input,
+        const StableResultCachePtr & cache_,
+        const String & key_,
+        size_t max_bytes_)
+        : cache(cache_)
+        , key(key_)
+        , max_bytes(max_bytes_)
+        , result(std::make_shared<StableResult>())
+    {
+        children.emplace_back(input);
+    }
+
+    String getName() const override { return "StableResultCacheWrite"; }
+
+    Block getHeader() const override { return children.back()->getHeader(); }
+
+    Block read() override
+    {
+        Block block = children.back()->read();
+        if (!block)
+        {
+            if (result)
+                cache->set(key, result);
+            result = nullptr;
+            return {};
+        }
+
+        if (result)
+        {
+            result->bytes += block.allocatedBytes();
+            result->rows += block.rows();
+            if (result->bytes > max_bytes)
+                result = nullptr;
+            else
+                result->blocks.push_back(block);
+        }
+        return block;
+    }
+
+private:
+    StableResultCachePtr cache;
+    const String key;
+    const size_t max_bytes;
+    // Reset to nullptr once the result is too large to be cached
+    StableResultPtr result;
+};
+
+} // namespace DM
+} // namespace DB
@@ -475,7 +475,8 @@ SkippableBlockInputStreamPtr StableValueSpace::Snapshot::getInputStream(
     bool is_fast_scan,
     bool enable_del_clean_read,
     const std::vector<IdSetPtr> & read_packs,
-    bool need_row_id)
+    bool need_row_id,
+    bool enable_circular_scan)
 {
     LOG_DEBUG(
         log,
@@ -496,7 +497,8 @@ SkippableBlockInputStreamPtr StableValueSpace::Snapshot::getInputStream(
             .setColumnCache(column_caches[i])
             .setTracingID(context.tracing_id)
             .setRowsThreshold(expected_block_size)
-            .setReadPacks(read_packs.size() > i ? read_packs[i] : nullptr);
+            .setReadPacks(read_packs.size() > i ? read_packs[i] : nullptr)
+            .enableCircularScan(enable_circular_scan);
         streams.push_back(builder.build(stable->files[i], read_columns, rowkey_ranges, context.scan_context));
         rows.push_back(stable->files[i]->getRows());
     }
@@ -60,7 +60,9 @@ PageStorageConfig extractConfig(const Settings & settings, StorageType subtype)
     config.gc_min_bytes = settings.dt_storage_pool_##NAME##_gc_min_bytes;           \
     config.gc_min_legacy_num = settings.dt_storage_pool_##NAME##_gc_min_legacy_num; \
     config.gc_max_valid_rate = settings.dt_storage_pool_##NAME##_gc_max_valid_rate; \
-    config.blob_heavy_gc_valid_rate = settings.dt_page_gc_threshold;
+    config.blob_heavy_gc_valid_rate = settings.dt_page_gc_threshold;                \
+    config.blob_compression_method = settings.dt_page_compression_method_##NAME;    \
+    config.blob_page_cache_size = settings.dt_page_cache_size_##NAME;
 
     PageStorageConfig config = getConfigFromSettings(settings);
 
@@ -0,0 +1,235 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Columns/ColumnsNumber.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Storages/DeltaMerge/DeltaMerge.h>
+#include <Storages/DeltaMerge/DeltaMergeHelpers.h>
+#include <benchmark/benchmark.h>
+
+namespace DB::DM::bench
+{
+namespace
+{
+constexpr size_t block_size = 8192;
+constexpr size_t stable_total_rows = 1024 * 1024;
+// There are at most `handle_step - 1` delta rows between two adjacent stable rows
+constexpr Int64 handle_step = 2048;
+
+/// Return the blocks read from DMFiles.
+class MockStableInputStream : public SkippableBlockInputStream
+{
+public:
+    MockStableInputStream(const Block & header_, BlocksList && blocks_)
+        : header(header_)
+        , blocks(std::move(blocks_))
+    {}
+
+    String getName() const override { return "MockStable"; }
+    Block getHeader() const override { return header; }
+
+    bool getSkippedRows(size_t & skip_rows) override
+    {
+        skip_rows = 0;
+        return true;
+    }
+    size_t skipNextBlock() override { return 0; }
+    Block readWithFilter(const IColumn::Filter &) override { return {}; }
+
+    Block read() override
+    {
+        if (blocks.empty())
+            return {};
+        Block block = std::move(blocks.front());
+        blocks.pop_front();
+        return block;
+    }
+
+private:
+    Block header;
+    BlocksList blocks;
+};
+
+/// The delta rows in the order of being appended.
+struct MockDeltaValueReader
+{
+    Columns columns;
+
+    size_t readRows(
+        MutableColumns & output_cols,
+        size_t offset,
+        size_t limit,
+        const RowKeyRange *,
+        std::vector<UInt32> * = nullptr) const
+    {
+        for (size_t i = 0; i < output_cols.size(); ++i)
+            output_cols[i]->insertRangeFrom(*columns[i], offset, limit);
+        return limit;
+    }
+};
+
+/// Every entry inserts `count` delta rows starting from `value` before the stable row `sid`.
+struct MockIndexEntry
+{
+    UInt64 sid;
+    UInt64 count;
+    UInt64 value;
+};
+using MockIndexEntries = std::vector<MockIndexEntry>;
+
+class MockIndexIterator
+{
+public:
+    MockIndexIterator(const MockIndexEntries * entries_, size_t pos_)
+        : entries(entries_)
+        , pos(pos_)
+    {}
+
+    bool operator==(const MockIndexIterator & rhs) const { return pos == rhs.pos; }
+    bool operator!=(const MockIndexIterator & rhs) const { return pos != rhs.pos; }
+    MockIndexIterator & operator++()
+    {
+        ++pos;
+        return *this;
+    }
+
+    UInt64 getSid() const { return (*entries)[pos].sid; }
+    UInt64 getCount() const { return (*entries)[pos].count; }
+    UInt64 getValue() const { return (*entries)[pos].value; }
+    static bool isDelete() { return false; }
+
+private:
+    const MockIndexEntries * entries;
+    size_t pos;
+};
+
+} // namespace
+
+class DeltaMergeBench : public benchmark::Fixture
+{
+protected:
+    ColumnDefines column_defines;
+    Block header;
+    Blocks stable_blocks;
+    MockIndexEntries entries;
+    std::shared_ptr<MockDeltaValueReader> delta_reader;
+    size_t delta_rows = 0;
+
+public:
+    /// state.range(0): the percentage of delta rows to stable rows
+    /// state.range(1): the number of continuous delta rows which are inserted to the same position
+    void SetUp(const benchmark::State & state) override
+    {
+        column_defines = {
+            getExtraHandleColumnDefine(/*is_common_handle*/ false),
+            getVersionColumnDefine(),
+            ColumnDefine(1, "a", std::make_shared<DataTypeInt64>()),
+        };
+        header = toEmptyBlock(column_defines);
+
+        stable_blocks.clear();
+        for (size_t start = 0; start < stable_total_rows; start += block_size)
+        {
+            auto columns = header.cloneEmptyColumns();
+            for (size_t i = start; i < start + block_size; ++i)
+            {
+                const auto handle = static_cast<Int64>(i + 1) * handle_step;
+                columns[0]->insert(Field(handle));
+                columns[1]->insert(Field(static_cast<UInt64>(1)));
+                columns[2]->insert(Field(handle));
+            }
+            stable_blocks.push_back(header.cloneWithColumns(std::move(columns)));
+        }
+
+        const auto run_rows = static_cast<size_t>(state.range(1));
+        delta_rows = stable_total_rows * state.range(0) / 100 / run_rows * run_rows;
+        const size_t runs = delta_rows / run_rows;
+
+        auto delta_columns = header.cloneEmptyColumns();
+        entries.clear();
+        for (size_t r = 0; r < runs; ++r)
+        {
+            // Spread the runs evenly over the stable rows
+            const UInt64 sid = (r + 1) * stable_total_rows / (runs + 1);
+            entries.push_back(MockIndexEntry{.sid = sid, .count = run_rows, .value = r * run_rows});
+            for (size_t i = 0; i < run_rows; ++i)
+            {
+                const auto handle = static_cast<Int64>(sid + 1) * handle_step - static_cast<Int64>(run_rows - i);
+                delta_columns[0]->insert(Field(handle));
+                delta_columns[1]->insert(Field(static_cast<UInt64>(2)));
+                delta_columns[2]->insert(Field(handle));
+            }
+        }
+        delta_reader = std::make_shared<MockDeltaValueReader>();
+        for (auto & col : delta_columns)
+            delta_reader->columns.push_back(std::move(col));
+    }
+
+    SkippableBlockInputStreamPtr createStableStream() const
+    {
+        // Clone the columns so that they are exclusively owned by the stream, just like the blocks read from DMFiles.
+        BlocksList blocks;
+        for (const auto & block : stable_blocks)
+        {
+            Block cloned = block.cloneEmpty();
+            for (size_t i = 0; i < block.columns(); ++i)
+                cloned.getByPosition(i).column = block.getByPosition(i).column->cloneResized(block.rows());
+            blocks.push_back(std::move(cloned));
+        }
+        return std::make_shared<MockStableInputStream>(header, std::move(blocks));
+    }
+};
+
+BENCHMARK_DEFINE_F(DeltaMergeBench, Merge)
+(benchmark::State & state)
+{
+    const auto rowkey_range = RowKeyRange::newAll(/*is_common_handle*/ false, 1);
+    size_t total_rows = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto stable_stream = createStableStream();
+        state.ResumeTiming();
+
+        DeltaMergeBlockInputStream<MockDeltaValueReader, MockIndexIterator> stream(
+            stable_stream,
+            delta_reader,
+            MockIndexIterator(&entries, 0),
+            MockIndexIterator(&entries, entries.size()),
+            rowkey_range,
+            block_size,
+            stable_total_rows,
+            "");
+        size_t rows = 0;
+        while (Block block = stream.read())
+            rows += block.rows();
+        benchmark::DoNotOptimize(rows);
+        total_rows += rows;
+    }
+    state.SetItemsProcessed(total_rows);
+}
+
+BENCHMARK_REGISTER_F(DeltaMergeBench, Merge)
+    ->Args({1, 1})
+    ->Args({1, 64})
+    ->Args({1, 1024})
+    ->Args({10, 1})
+    ->Args({10, 64})
+    ->Args({10, 1024})
+    ->Args({50, 1})
+    ->Args({50, 64})
+    ->Args({50, 1024})
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace DB::DM::bench
@@ -0,0 +1,124 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Columns/ColumnsNumber.h>
+#include <DataStreams/BlocksListBlockInputStream.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Storages/DeltaMerge/DMVersionFilterBlockInputStream.h>
+#include <Storages/DeltaMerge/DeltaMergeHelpers.h>
+#include <benchmark/benchmark.h>
+
+namespace DB::DM::bench
+{
+namespace
+{
+constexpr size_t block_size = 8192;
+constexpr size_t total_rows = 1024 * 1024;
+constexpr UInt64 version_limit = 100;
+} // namespace
+
+class VersionFilterBench : public benchmark::Fixture
+{
+protected:
+    ColumnDefines column_defines;
+    BlocksList blocks;
+
+public:
+    /// state.range(0): the percentage of rows which have an older version
+    /// state.range(1): whether to mark the blocks as mvcc clean, only takes effect when there is no older version
+    void SetUp(const benchmark::State & state) override
+    {
+        column_defines = {
+            getExtraHandleColumnDefine(/*is_common_handle*/ false),
+            getVersionColumnDefine(),
+            getTagColumnDefine(),
+            ColumnDefine(1, "a", std::make_shared<DataTypeInt64>()),
+        };
+        const auto header = toEmptyBlock(column_defines);
+        const auto multi_version_percent = static_cast<size_t>(state.range(0));
+        const bool mvcc_clean = multi_version_percent == 0 && state.range(1) != 0;
+
+        blocks.clear();
+        auto columns = header.cloneEmptyColumns();
+        Int64 handle = 0;
+        for (size_t i = 0; i < total_rows; ++i)
+        {
+            // Every `100 / multi_version_percent` rows, write an older version of the next handle before it.
+            const bool older_version = multi_version_percent != 0 && i % (100 / multi_version_percent) == 0;
+            columns[0]->insert(Field(handle));
+            columns[1]->insert(Field(static_cast<UInt64>(older_version ? 1 : 2)));
+            columns[2]->insert(Field(static_cast<UInt64>(0)));
+            columns[3]->insert(Field(handle));
+            if (!older_version)
+                ++handle;
+
+            if (columns[0]->size() == block_size)
+            {
+                auto block = header.cloneWithColumns(std::move(columns));
+                block.setMVCCClean(mvcc_clean);
+                blocks.push_back(std::move(block));
+                columns = header.cloneEmptyColumns();
+            }
+        }
+    }
+};
+
+template <int MODE>
+void runVersionFilter(benchmark::State & state, const ColumnDefines & column_defines, const BlocksList & blocks)
+{
+    size_t read_rows = 0;
+    for (auto _ : state)
+    {
+        DMVersionFilterBlockInputStream<MODE> stream(
+            std::make_shared<BlocksListBlockInputStream>(BlocksList(blocks)),
+            column_defines,
+            version_limit,
+            /*is_common_handle*/ false);
+        size_t rows = 0;
+        while (Block block = stream.read())
+            rows += block.rows();
+        benchmark::DoNotOptimize(rows);
+        read_rows += total_rows;
+    }
+    state.SetItemsProcessed(read_rows);
+}
+
+BENCHMARK_DEFINE_F(VersionFilterBench, MVCC)
+(benchmark::State & state)
+{
+    runVersionFilter<DM_VERSION_FILTER_MODE_MVCC>(state, column_defines, blocks);
+}
+
+BENCHMARK_DEFINE_F(VersionFilterBench, Compact)
+(benchmark::State & state)
+{
+    runVersionFilter<DM_VERSION_FILTER_MODE_COMPACT>(state, column_defines, blocks);
+}
+
+BENCHMARK_REGISTER_F(VersionFilterBench, MVCC)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({1, 0})
+    ->Args({10, 0})
+    ->Args({50, 0})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(VersionFilterBench, Compact)
+    ->Args({0, 0})
+    ->Args({1, 0})
+    ->Args({10, 0})
+    ->Args({50, 0})
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace DB::DM::bench
@@ -0,0 +1,118 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilter.h>
+#include <gtest/gtest.h>
+
+namespace DB::DM::tests
+{
+namespace
+{
+String getFilter(const BitmapFilter & bitmap_filter, UInt32 start, UInt32 limit)
+{
+    IColumn::Filter f(limit, 0);
+    if (bitmap_filter.get(f, start, limit))
+        return String(limit, '1');
+    String s(limit, '0');
+    for (UInt32 i = 0; i < limit; ++i)
+        s[i] = f[i] ? '1' : '0';
+    return s;
+}
+
+String rangeAnd(const BitmapFilter & bitmap_filter, UInt32 start, UInt32 limit)
+{
+    IColumn::Filter f(limit, 1);
+    bitmap_filter.rangeAnd(f, start, limit);
+    String s(limit, '0');
+    for (UInt32 i = 0; i < limit; ++i)
+        s[i] = f[i] ? '1' : '0';
+    return s;
+}
+} // namespace
+
+TEST(BitmapFilterTest, Words)
+{
+    BitmapFilter bitmap_filter(200, /*default_value*/ false);
+    bitmap_filter.set(10, 100);
+    std::vector<UInt32> row_ids{0, 2, 150};
+    bitmap_filter.set(row_ids.data(), row_ids.size(), nullptr);
+    // Alternate rows, too many runs to be run encoded.
+    for (UInt32 i = 160; i < 200; i += 2)
+        bitmap_filter.set(i, 1);
+    bitmap_filter.runOptimize();
+    ASSERT_FALSE(bitmap_filter.isRunEncoded());
+
+    String expected(200, '0');
+    expected[0] = expected[2] = expected[150] = '1';
+    std::fill(expected.begin() + 10, expected.begin() + 110, '1');
+    for (UInt32 i = 160; i < 200; i += 2)
+        expected[i] = '1';
+    ASSERT_EQ(bitmap_filter.toDebugString(), expected);
+    ASSERT_EQ(bitmap_filter.count(), 3 + 100 + 20);
+
+    // The range covers whole words and partial words.
+    ASSERT_EQ(getFilter(bitmap_filter, 10, 100), String(100, '1'));
+    for (const auto & [start, limit] : std::vector<std::pair<UInt32, UInt32>>{{0, 200}, {5, 70}, {100, 100}, {63, 2}})
+    {
+        ASSERT_EQ(getFilter(bitmap_filter, start, limit), expected.substr(start, limit)) << start << " " << limit;
+        ASSERT_EQ(rangeAnd(bitmap_filter, start, limit), expected.substr(start, limit)) << start << " " << limit;
+    }
+}
+
+TEST(BitmapFilterTest, Runs)
+{
+    BitmapFilter bitmap_filter(100000, /*default_value*/ false);
+    bitmap_filter.set(0, 30000);
+    bitmap_filter.set(50000, 50000);
+    IColumn::Filter f(2, 0);
+    f[1] = 1;
+    std::vector<UInt32> row_ids{60000, 40000};
+    bitmap_filter.set(row_ids.data(), row_ids.size(), &f);
+    const auto bytes_before = bitmap_filter.bytes();
+    bitmap_filter.runOptimize();
+    ASSERT_TRUE(bitmap_filter.isRunEncoded());
+    ASSERT_LT(bitmap_filter.bytes(), bytes_before);
+    ASSERT_THROW(bitmap_filter.set(0, 1), DB::Exception);
+
+    String expected(100000, '1');
+    std::fill(expected.begin() + 30000, expected.begin() + 50000, '0');
+    expected[40000] = '1';
+    expected[60000] = '0';
+    ASSERT_EQ(bitmap_filter.toDebugString(), expected);
+    ASSERT_EQ(bitmap_filter.count(), 30000 + 1 + 49999);
+
+    ASSERT_EQ(getFilter(bitmap_filter, 1000, 8192), String(8192, '1'));
+    for (const auto & [start, limit] :
+         std::vector<std::pair<UInt32, UInt32>>{{0, 100000}, {29000, 12000}, {39999, 3}, {59990, 8192}, {30000, 100}})
+    {
+        ASSERT_EQ(getFilter(bitmap_filter, start, limit), expected.substr(start, limit)) << start << " " << limit;
+        ASSERT_EQ(rangeAnd(bitmap_filter, start, limit), expected.substr(start, limit)) << start << " " << limit;
+    }
+}
+
+TEST(BitmapFilterTest, AllMatch)
+{
+    BitmapFilter bitmap_filter(130, /*default_value*/ true);
+    bitmap_filter.runOptimize();
+    ASSERT_EQ(bitmap_filter.count(), 130);
+    ASSERT_EQ(bitmap_filter.toDebugString(), String(130, '1'));
+    ASSERT_EQ(getFilter(bitmap_filter, 0, 130), String(130, '1'));
+
+    BitmapFilter empty(0, /*default_value*/ false);
+    empty.runOptimize();
+    ASSERT_EQ(empty.count(), 0);
+    ASSERT_EQ(empty.toDebugString(), "");
+}
+} // namespace DB::DM::tests
@@ -0,0 +1,323 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Columns/ColumnNullable.h>
+#include <Columns/ColumnString.h>
+#include <DataTypes/DataTypeString.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
+#include <Storages/DeltaMerge/Filter/Like.h>
+#include <Storages/DeltaMerge/Index/BloomFilterIndex.h>
+#include <TestUtils/TiFlashTestBasic.h>
+
+namespace DB::DM::tests
+{
+
+class DMBloomFilterIndexTest : public ::testing::Test
+{
+protected:
+    static MutableColumnPtr createStringColumn(const Strings & values)
+    {
+        auto col = ColumnString::create();
+        for (const auto & v : values)
+            col->insert(Field(v));
+        return col;
+    }
+
+    static BloomFilterIndexPtr createIndex(
+        const std::vector<Strings> & packs,
+        size_t ngram_size = 3,
+        size_t max_dictionary_size = 0)
+    {
+        auto index = BloomFilterIndex::create(BloomFilterIndex::Options{
+            .expected_pack_rows = 128,
+            .bits_per_key = 10,
+            .ngram_size = ngram_size,
+            .max_dictionary_size = max_dictionary_size});
+        for (const auto & pack : packs)
+        {
+            auto col = createStringColumn(pack);
+            index->addPack(*col, nullptr);
+        }
+        return index;
+    }
+};
+
+TEST_F(DMBloomFilterIndexTest, CheckEqualAndIn)
+try
+{
+    auto index = createIndex({{"apple", "banana"}, {"cherry", "durian"}, {"elderberry"}});
+    ASSERT_EQ(index->packCount(), 3);
+
+    {
+        RSResults results(3, RSResult::Some);
+        index->checkEqual(0, 3, Field(String("banana")), results);
+        ASSERT_EQ(results[0], RSResult::Some);
+        ASSERT_EQ(results[1], RSResult::None);
+        ASSERT_EQ(results[2], RSResult::None);
+    }
+    {
+        // Trailing spaces are ignored
+        RSResults results(3, RSResult::Some);
+        index->checkEqual(0, 3, Field(String("durian  ")), results);
+        ASSERT_EQ(results[0], RSResult::None);
+        ASSERT_EQ(results[1], RSResult::Some);
+        ASSERT_EQ(results[2], RSResult::None);
+    }
+    {
+        // Check a sub range of packs
+        RSResults results(2, RSResult::Some);
+        index->checkEqual(1, 2, Field(String("elderberry")), results);
+        ASSERT_EQ(results[0], RSResult::None);
+        ASSERT_EQ(results[1], RSResult::Some);
+    }
+    {
+        RSResults results(3, RSResult::Some);
+        index->checkIn(0, 3, {Field(String("apple")), Field(String("elderberry"))}, results);
+        ASSERT_EQ(results[0], RSResult::Some);
+        ASSERT_EQ(results[1], RSResult::None);
+        ASSERT_EQ(results[2], RSResult::Some);
+    }
+    {
+        // Non-string value can not be checked
+        RSResults results(3, RSResult::Some);
+        index->checkIn(0, 3, {Field(String("apple")), Field()}, results);
+        for (auto r : results)
+            ASSERT_EQ(r, RSResult::Some);
+    }
+}
+CATCH
+
+TEST_F(DMBloomFilterIndexTest, SkipNullAndDeleted)
+try
+{
+    auto index = BloomFilterIndex::create(BloomFilterIndex::Options{.expected_pack_rows = 128});
+
+    auto nested = createStringColumn({"a", "b", "c"});
+    auto null_map = ColumnUInt8::create();
+    null_map->insert(UInt64(0));
+    null_map->insert(UInt64(1));
+    null_map->insert(UInt64(0));
+    auto nullable = ColumnNullable::create(std::move(nested), std::move(null_map));
+
+    auto del_mark = ColumnUInt8::create();
+    del_mark->insert(UInt64(0));
+    del_mark->insert(UInt64(0));
+    del_mark->insert(UInt64(1));
+    index->addPack(*nullable, del_mark.get());
+
+    RSResults results(1, RSResult::Some);
+    index->checkEqual(0, 1, Field(String("a")), results);
+    ASSERT_EQ(results[0], RSResult::Some);
+    index->checkIn(0, 1, {Field(String("b")), Field(String("c"))}, results);
+    ASSERT_EQ(results[0], RSResult::None);
+
+    // Only string columns are supported
+    auto col_int = ColumnUInt8::create();
+    ASSERT_ANY_THROW(index->addPack(*col_int, nullptr));
+}
+CATCH
+
+TEST_F(DMBloomFilterIndexTest, ExtractLikeLiterals)
+try
+{
+    using Literals = std::vector<String>;
+    ASSERT_EQ(BloomFilterIndex::extractLikeLiterals("abc", '\\'), (Literals{"abc"}));
+    ASSERT_EQ(BloomFilterIndex::extractLikeLiterals("%abc%", '\\'), (Literals{"abc"}));
+    ASSERT_EQ(BloomFilterIndex::extractLikeLiterals("ab_cd%ef", '\\'), (Literals{"ab", "cd", "ef"}));
+    ASSERT_EQ(BloomFilterIndex::extractLikeLiterals("ab\\%cd", '\\'), (Literals{"ab%cd"}));
+    ASSERT_EQ(BloomFilterIndex::extractLikeLiterals("ab|_cd", '|'), (Literals{"ab_cd"}));
+    ASSERT_EQ(BloomFilterIndex::extractLikeLiterals("%%_", '\\'), (Literals{}));
+}
+CATCH
+
+TEST_F(DMBloomFilterIndexTest, CheckLike)
+try
+{
+    auto index = createIndex({{"hello world", "foo"}, {"tiflash", "storage"}});
+
+    {
+        RSResults results(2, RSResult::Some);
+        index->checkLike(0, 2, "%flash%", '\\', results);
+        ASSERT_EQ(results[0], RSResult::None);
+        ASSERT_EQ(results[1], RSResult::Some);
+    }
+    {
+        RSResults results(2, RSResult::Some);
+        index->checkLike(0, 2, "hello%world", '\\', results);
+        ASSERT_EQ(results[0], RSResult::Some);
+        ASSERT_EQ(results[1], RSResult::None);
+    }
+    {
+        // The literals are shorter than ngram_size, nothing can be pruned
+        RSResults results(2, RSResult::Some);
+        index->checkLike(0, 2, "%zz%", '\\', results);
+        ASSERT_EQ(results[0], RSResult::Some);
+        ASSERT_EQ(results[1], RSResult::Some);
+    }
+
+    // Without ngram filter, like can not be pruned
+    auto index_no_ngram = createIndex({{"hello world"}}, 0);
+    ASSERT_FALSE(index_no_ngram->hasNGram());
+    RSResults results(1, RSResult::Some);
+    index_no_ngram->checkLike(0, 1, "%flash%", '\\', results);
+    ASSERT_EQ(results[0], RSResult::Some);
+}
+CATCH
+
+TEST_F(DMBloomFilterIndexTest, LikeDebugString)
+try
+{
+    // The debug string is used as the key of the filter caches, the escape char must be a part of it
+    const Attr attr{"a", 1, std::make_shared<DataTypeString>()};
+    auto like = createLike(attr, Field(String("a|%%")), '\\');
+    auto like_with_escape = createLike(attr, Field(String("a|%%")), '|');
+    ASSERT_NE(like->toDebugString(), like_with_escape->toDebugString());
+    ASSERT_NE(like_with_escape->toDebugString().find(R"("escape":"124")"), String::npos);
+}
+CATCH
+
+TEST_F(DMBloomFilterIndexTest, Serialize)
+try
+{
+    auto index = createIndex({{"apple", "banana"}, {"cherry"}});
+
+    WriteBufferFromOwnString write_buf;
+    index->write(write_buf);
+    ReadBufferFromString read_buf(write_buf.str());
+    auto restored = BloomFilterIndex::read(read_buf);
+    ASSERT_TRUE(read_buf.eof());
+
+    ASSERT_EQ(restored->packCount(), index->packCount());
+    ASSERT_EQ(restored->byteSize(), index->byteSize());
+    ASSERT_TRUE(restored->hasNGram());
+
+    RSResults results(2, RSResult::Some);
+    restored->checkEqual(0, 2, Field(String("cherry")), results);
+    ASSERT_EQ(results[0], RSResult::None);
+    ASSERT_EQ(results[1], RSResult::Some);
+
+    RSResults like_results(2, RSResult::Some);
+    restored->checkLike(0, 2, "%anan%", '\\', like_results);
+    ASSERT_EQ(like_results[0], RSResult::Some);
+    ASSERT_EQ(like_results[1], RSResult::None);
+}
+CATCH
+
+TEST_F(DMBloomFilterIndexTest, MatchLike)
+try
+{
+    ASSERT_EQ(BloomFilterIndex::matchLike("abc", "abc", '\\'), true);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abc", "ab", '\\'), false);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abc", "a%", '\\'), true);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abc", "%c", '\\'), true);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abc", "%b%", '\\'), true);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abc", "%d%", '\\'), false);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abcbd", "%b_", '\\'), true);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abcbd", "a%b", '\\'), false);
+    ASSERT_EQ(BloomFilterIndex::matchLike("", "%", '\\'), true);
+    ASSERT_EQ(BloomFilterIndex::matchLike("", "_", '\\'), false);
+    ASSERT_EQ(BloomFilterIndex::matchLike("a%c", "a\\%c", '\\'), true);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abc", "a\\%c", '\\'), false);
+    ASSERT_EQ(BloomFilterIndex::matchLike("a_c", "a|_c", '|'), true);
+    // Can not tell for the multi-byte characters and trailing spaces
+    const String multi_byte = "a\u4e2dc";
+    ASSERT_EQ(BloomFilterIndex::matchLike(multi_byte, "a_c", '\\'), std::nullopt);
+    ASSERT_EQ(BloomFilterIndex::matchLike(multi_byte, "a%c", '\\'), true);
+    ASSERT_EQ(BloomFilterIndex::matchLike("abc ", "abc", '\\'), std::nullopt);
+}
+CATCH
+
+TEST_F(DMBloomFilterIndexTest, Dictionary)
+try
+{
+    auto index = createIndex(
+        {{"200", "200", "404"}, {"200", "200"}, {"500", "502", "503", "504"}, {"200", "301", "302"}},
+        /*ngram_size*/ 0,
+        /*max_dictionary_size*/ 3);
+    ASSERT_TRUE(index->hasDictionary(0));
+    ASSERT_TRUE(index->hasDictionary(1));
+    // Too many distinct values
+    ASSERT_FALSE(index->hasDictionary(2));
+    ASSERT_TRUE(index->hasDictionary(3));
+
+    {
+        RSResults results(4, RSResult::Some);
+        index->checkEqual(0, 4, Field(String("200")), results);
+        ASSERT_EQ(results[0], RSResult::Some);
+        ASSERT_EQ(results[1], RSResult::All);
+        ASSERT_EQ(results[3], RSResult::Some);
+    }
+    {
+        RSResults results(4, RSResult::Some);
+        index->checkIn(0, 4, {Field(String("200")), Field(String("404"))}, results);
+        ASSERT_EQ(results[0], RSResult::All);
+        ASSERT_EQ(results[1], RSResult::All);
+        ASSERT_EQ(results[3], RSResult::Some);
+    }
+    {
+        // Can not be `All` because `202 ` is not equal to `202` for the "NO PAD" binary collation
+        auto pad_index = createIndex({{"202 ", "202"}}, 0, 3);
+        RSResults results(1, RSResult::Some);
+        pad_index->checkEqual(0, 1, Field(String("202")), results);
+        ASSERT_EQ(results[0], RSResult::Some);
+    }
+    {
+        // Like is evaluated on the dictionary even without the ngram filter
+        RSResults results(4, RSResult::Some);
+        index->checkLike(0, 4, "3%", '\\', results);
+        ASSERT_EQ(results[0], RSResult::None);
+        ASSERT_EQ(results[1], RSResult::None);
+        ASSERT_EQ(results[2], RSResult::Some);
+        ASSERT_EQ(results[3], RSResult::Some);
+
+        RSResults all_results(4, RSResult::Some);
+        index->checkLike(0, 4, "_0_", '\\', all_results);
+        ASSERT_EQ(all_results[0], RSResult::All);
+        ASSERT_EQ(all_results[1], RSResult::All);
+    }
+
+    // The packs with NULL or deleted rows can not be `All`
+    auto nested = createStringColumn({"a", "a", "a"});
+    auto null_map = ColumnUInt8::create();
+    null_map->insert(UInt64(0));
+    null_map->insert(UInt64(1));
+    null_map->insert(UInt64(0));
+    auto nullable = ColumnNullable::create(std::move(nested), std::move(null_map));
+    auto null_index = BloomFilterIndex::create(
+        BloomFilterIndex::Options{.expected_pack_rows = 128, .max_dictionary_size = 3});
+    null_index->addPack(*nullable, nullptr);
+    RSResults results(1, RSResult::Some);
+    null_index->checkEqual(0, 1, Field(String("a")), results);
+    ASSERT_EQ(results[0], RSResult::Some);
+    null_index->checkEqual(0, 1, Field(String("b")), results);
+    ASSERT_EQ(results[0], RSResult::None);
+
+    // The dictionaries are kept after serialization
+    WriteBufferFromOwnString write_buf;
+    index->write(write_buf);
+    ReadBufferFromString read_buf(write_buf.str());
+    auto restored = BloomFilterIndex::read(read_buf);
+    ASSERT_TRUE(read_buf.eof());
+    ASSERT_EQ(restored->byteSize(), index->byteSize());
+    for (size_t pack_id = 0; pack_id < index->packCount(); ++pack_id)
+        ASSERT_EQ(restored->hasDictionary(pack_id), index->hasDictionary(pack_id));
+    RSResults restored_results(4, RSResult::Some);
+    restored->checkEqual(0, 4, Field(String("200")), restored_results);
+    ASSERT_EQ(restored_results[1], RSResult::All);
+    ASSERT_EQ(restored_results[2], RSResult::None);
+}
+CATCH
+
+} // namespace DB::DM::tests
@@ -0,0 +1,151 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Storages/DeltaMerge/DeltaIndex.h>
+#include <TestUtils/TiFlashTestBasic.h>
+
+namespace DB::DM::tests
+{
+
+namespace
+{
+// Return the (rid, tuple_id) of all inserts in the delta tree
+std::vector<std::pair<UInt64, UInt64>> getInserts(const DeltaTreePtr & tree)
+{
+    std::vector<std::pair<UInt64, UInt64>> inserts;
+    for (auto it = tree->begin(), end = tree->end(); it != end; ++it)
+    {
+        if (it.isInsert())
+            inserts.emplace_back(it.getRid(), it.getValue());
+    }
+    return inserts;
+}
+} // namespace
+
+TEST(DeltaIndexTest, CloneWithUpdatesKeepPlacedDeletes)
+try
+{
+    // A ColumnFileInMemory with handles [30, 10, 20], placed in the order of handle.
+    auto delta_tree = std::make_shared<DefaultDeltaTree>();
+    delta_tree->addInsert(0, 0);
+    delta_tree->addInsert(0, 1);
+    delta_tree->addInsert(1, 2);
+    // A delete range after the ColumnFile deletes handle 20.
+    delta_tree->addDelete(1);
+    auto delta_index = std::make_shared<DeltaIndex>(delta_tree, 3, 1);
+
+    // The ColumnFile is sorted by flush, the sorted handles are [10, 20, 30].
+    IColumn::Permutation perm{1, 2, 0};
+    DeltaIndex::Updates updates;
+    updates.emplace_back(/*delete_ranges_offset*/ 0, /*rows_offset*/ 0, perm);
+
+    auto new_index = delta_index->cloneWithUpdates(updates);
+    ASSERT_EQ(new_index->getPlacedStatus(), std::make_pair(3UL, 1UL));
+    using Inserts = std::vector<std::pair<UInt64, UInt64>>;
+    ASSERT_EQ(getInserts(new_index->getDeltaTree()), (Inserts{{0, 0}, {1, 2}}));
+    // The original index is not changed.
+    ASSERT_EQ(getInserts(delta_index->getDeltaTree()), (Inserts{{0, 1}, {1, 0}}));
+}
+CATCH
+
+TEST(DeltaIndexTest, CloneWithUpdatesPartiallyPlaced)
+try
+{
+    // Two ColumnFileInMemory with 2 rows each, only the first 3 rows are placed.
+    auto delta_tree = std::make_shared<DefaultDeltaTree>();
+    delta_tree->addInsert(0, 0);
+    delta_tree->addInsert(1, 1);
+    delta_tree->addInsert(2, 2);
+    auto delta_index = std::make_shared<DeltaIndex>(delta_tree, 3, 0);
+
+    IColumn::Permutation perm{1, 0};
+    DeltaIndex::Updates updates;
+    updates.emplace_back(/*delete_ranges_offset*/ 0, /*rows_offset*/ 0, perm);
+    updates.emplace_back(/*delete_ranges_offset*/ 0, /*rows_offset*/ 2, perm);
+
+    // The first ColumnFile is remapped, the inserts of the second ColumnFile are removed.
+    auto new_index = delta_index->cloneWithUpdates(updates);
+    ASSERT_EQ(new_index->getPlacedStatus(), std::make_pair(2UL, 0UL));
+    using Inserts = std::vector<std::pair<UInt64, UInt64>>;
+    ASSERT_EQ(getInserts(new_index->getDeltaTree()), (Inserts{{0, 1}, {1, 0}}));
+}
+CATCH
+
+TEST(DeltaIndexTest, CloneForNewEpoch)
+try
+{
+    // 2 persisted rows and 2 rows in memtable are placed.
+    auto delta_tree = std::make_shared<DefaultDeltaTree>();
+    delta_tree->addInsert(0, 0);
+    delta_tree->addInsert(1, 1);
+    delta_tree->addInsert(2, 2);
+    delta_tree->addInsert(3, 3);
+    auto delta_index = std::make_shared<DeltaIndex>(delta_tree, 4, 0);
+
+    Remote::RNDeltaIndexCache::CacheKey key{
+        .store_id = 1,
+        .keyspace_id = NullspaceID,
+        .table_id = 100,
+        .segment_id = 1,
+        .segment_epoch = 1,
+        .delta_index_epoch = 2,
+    };
+    // The inserts of the memtable rows are removed.
+    auto new_index = delta_index->cloneForNewEpoch(/*persisted_rows*/ 2, /*persisted_deletes*/ 0, key);
+    ASSERT_EQ(new_index->getPlacedStatus(), std::make_pair(2UL, 0UL));
+    ASSERT_TRUE(new_index->getRNCacheKey() == key);
+    using Inserts = std::vector<std::pair<UInt64, UInt64>>;
+    ASSERT_EQ(getInserts(new_index->getDeltaTree()), (Inserts{{0, 0}, {1, 1}}));
+
+    // Deletes after the persisted rows are placed, can not reuse.
+    delta_tree->addDelete(0);
+    delta_index = std::make_shared<DeltaIndex>(delta_tree, 4, 1);
+    new_index = delta_index->cloneForNewEpoch(/*persisted_rows*/ 2, /*persisted_deletes*/ 0, key);
+    ASSERT_EQ(new_index->getPlacedStatus(), std::make_pair(0UL, 0UL));
+}
+CATCH
+
+TEST(DeltaIndexTest, RNDeltaIndexCacheReuseOlderEpoch)
+try
+{
+    Remote::RNDeltaIndexCache cache(1024 * 1024);
+    Remote::RNDeltaIndexCache::CacheKey key{
+        .store_id = 1,
+        .keyspace_id = NullspaceID,
+        .table_id = 100,
+        .segment_id = 1,
+        .segment_epoch = 1,
+        .delta_index_epoch = 1,
+    };
+    auto index_1 = cache.getDeltaIndex(key, /*persisted_rows*/ 2, /*persisted_deletes*/ 0);
+    auto delta_tree = std::make_shared<DefaultDeltaTree>();
+    for (UInt64 i = 0; i < 3; ++i)
+        delta_tree->addInsert(i, i);
+    index_1->update(delta_tree, 3, 0);
+    cache.setDeltaIndex(index_1);
+
+    key.delta_index_epoch = 2;
+    auto index_2 = cache.getDeltaIndex(key, /*persisted_rows*/ 3, /*persisted_deletes*/ 0);
+    ASSERT_NE(index_2, index_1);
+    // Only the inserts of the persisted rows of epoch 1 are kept.
+    ASSERT_EQ(index_2->getPlacedStatus(), std::make_pair(2UL, 0UL));
+    ASSERT_EQ(cache.getDeltaIndex(key, 3, 0), index_2);
+
+    // An older epoch does not reuse the newer one.
+    key.delta_index_epoch = 0;
+    ASSERT_EQ(cache.getDeltaIndex(key, 3, 0)->getPlacedStatus(), std::make_pair(0UL, 0UL));
+}
+CATCH
+
+} // namespace DB::DM::tests
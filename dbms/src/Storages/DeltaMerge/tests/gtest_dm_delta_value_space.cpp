@@ -19,6 +19,7 @@
 #include <Storages/DeltaMerge/DMContext.h>
 #include <Storages/DeltaMerge/DeltaMergeStore.h>
 #include <Storages/DeltaMerge/File/DMFileBlockOutputStream.h>
+#include <Storages/DeltaMerge/Filter/RSOperator.h>
 #include <Storages/DeltaMerge/Segment.h>
 #include <Storages/DeltaMerge/WriteBatchesImpl.h>
 #include <Storages/DeltaMerge/tests/DMTestEnv.h>
@@ -363,7 +364,7 @@ TEST_F(DeltaValueSpaceTest, Flush)
         ASSERT_EQ(flush_task->getTaskNum(), 3);
         ASSERT_EQ(flush_task->getFlushRows(), 2 * num_rows_write_per_batch);
         ASSERT_EQ(flush_task->getFlushDeletes(), 1);
-        flush_task->prepare(wbs);
+        flush_task->prepare(wbs, /*placed_rows*/ 0);
     }
     // another thread write more data to the delta value space
     {
@@ -379,6 +380,80 @@ TEST_F(DeltaValueSpaceTest, Flush)
     }
 }
 
+TEST_F(DeltaValueSpaceTest, CompressSealedMemTableFiles)
+{
+    DB::Settings db_settings;
+    db_settings.dt_compress_sealed_mem_table_files = true;
+    db_settings.dt_segment_delta_cache_limit_rows = num_rows_write_per_batch;
+    delta = reload({}, std::move(db_settings));
+
+    Blocks write_blocks;
+    size_t total_rows_write = 0;
+    // Each batch fills up a `ColumnFileInMemory`, and the full one is compressed when the next batch comes.
+    for (size_t i = 0; i < 3; ++i)
+    {
+        write_blocks.push_back(
+            appendBlockToDeltaValueSpace(dmContext(), delta, total_rows_write, num_rows_write_per_batch));
+        total_rows_write += num_rows_write_per_batch;
+    }
+    {
+        auto snapshot = delta->createSnapshot(dmContext(), false, CurrentMetrics::DT_SnapshotOfRead);
+        const auto & column_files = snapshot->getMemTableSetSnapshot()->getColumnFiles();
+        ASSERT_EQ(column_files.size(), 3);
+        ASSERT_TRUE(column_files[0]->tryToInMemoryFile()->getCache()->isCompressed());
+        ASSERT_TRUE(column_files[1]->tryToInMemoryFile()->getCache()->isCompressed());
+        ASSERT_FALSE(column_files[2]->tryToInMemoryFile()->getCache()->isCompressed());
+    }
+    checkDeltaValueSpaceData(
+        delta,
+        dmContext(),
+        tableColumns(),
+        write_blocks,
+        total_rows_write,
+        HandleRange(0, num_rows_write_per_batch + 10),
+        num_rows_write_per_batch + 10);
+
+    // The compressed column files are decompressed when they are flushed.
+    ASSERT_TRUE(delta->flush(dmContext()));
+    ASSERT_EQ(delta->getPersistedFileSet()->getRows(), total_rows_write);
+    checkDeltaValueSpaceData(
+        delta,
+        dmContext(),
+        tableColumns(),
+        write_blocks,
+        total_rows_write,
+        HandleRange(0, num_rows_write_per_batch + 10),
+        num_rows_write_per_batch + 10);
+}
+
+TEST_F(DeltaValueSpaceTest, FlushedVersion)
+{
+    size_t total_rows_write = 0;
+    appendBlockToDeltaValueSpace(dmContext(), delta, total_rows_write, num_rows_write_per_batch);
+    total_rows_write += num_rows_write_per_batch;
+    const auto version_1 = delta->getMemTableVersion();
+    ASSERT_FALSE(delta->isFlushedUntil(version_1));
+
+    ASSERT_TRUE(delta->flush(dmContext()));
+    ASSERT_TRUE(delta->isFlushedUntil(version_1));
+
+    // The data written after the flush is not flushed
+    appendBlockToDeltaValueSpace(dmContext(), delta, total_rows_write, num_rows_write_per_batch);
+    total_rows_write += num_rows_write_per_batch;
+    const auto version_2 = delta->getMemTableVersion();
+    ASSERT_GT(version_2, version_1);
+    ASSERT_TRUE(delta->isFlushedUntil(version_1));
+    ASSERT_FALSE(delta->isFlushedUntil(version_2));
+
+    ASSERT_TRUE(delta->flush(dmContext()));
+    ASSERT_TRUE(delta->isFlushedUntil(version_2));
+    ASSERT_EQ(delta->getUnsavedRows(), 0);
+
+    // Flushing an empty mem table also marks the version as flushed
+    ASSERT_TRUE(delta->flush(dmContext()));
+    ASSERT_TRUE(delta->isFlushedUntil(delta->getMemTableVersion()));
+}
+
 TEST_F(DeltaValueSpaceTest, MinorCompaction)
 {
     auto persisted_file_set = delta->getPersistedFileSet();
@@ -492,6 +567,47 @@ TEST_F(DeltaValueSpaceTest, MinorCompaction)
     }
 }
 
+TEST_F(DeltaValueSpaceTest, SkipColumnFilesByFilter)
+try
+{
+    WriteBatches wbs(*dmContext().storage_pool, dmContext().getWriteLimiter());
+    // `ColumnFileInMemory` [0, 100), `ColumnFileTiny` [100, 200), and `ColumnFileInMemory` [200, 300)
+    // which is appended twice
+    appendBlockToDeltaValueSpace(dmContext(), delta, 0, 100);
+    appendColumnFileTinyToDeltaValueSpace(dmContext(), delta, 100, 100, wbs);
+    appendBlockToDeltaValueSpace(dmContext(), delta, 200, 50);
+    appendBlockToDeltaValueSpace(dmContext(), delta, 250, 50);
+
+    const Attr handle_attr{EXTRA_HANDLE_COLUMN_NAME, EXTRA_HANDLE_COLUMN_ID, EXTRA_HANDLE_COLUMN_INT_TYPE};
+    // Return the start offset and rows of each block read from delta
+    auto read_with_filter = [&](const RSOperatorPtr & filter) {
+        auto snapshot = delta->createSnapshot(dmContext(), false, CurrentMetrics::DT_SnapshotOfRead);
+        DeltaValueInputStream stream(dmContext(), snapshot, table_columns, RowKeyRange::newAll(false, 1), filter);
+        std::vector<std::pair<size_t, size_t>> blocks;
+        while (Block block = stream.read())
+            blocks.emplace_back(block.startOffset(), block.rows());
+        return blocks;
+    };
+    using ReadBlocks = std::vector<std::pair<size_t, size_t>>;
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        ASSERT_EQ(read_with_filter(EMPTY_RS_OPERATOR), (ReadBlocks{{0, 100}, {100, 100}, {200, 100}}));
+        ASSERT_EQ(read_with_filter(createLess(handle_attr, Field(static_cast<Int64>(50)))), (ReadBlocks{{0, 100}}));
+        ASSERT_EQ(
+            read_with_filter(createGreaterEqual(handle_attr, Field(static_cast<Int64>(150)))),
+            (ReadBlocks{{100, 100}, {200, 100}}));
+        ASSERT_EQ(
+            read_with_filter(createGreater(handle_attr, Field(static_cast<Int64>(280)))),
+            (ReadBlocks{{200, 100}}));
+        ASSERT_EQ(read_with_filter(createGreater(handle_attr, Field(static_cast<Int64>(1000)))), (ReadBlocks{}));
+
+        // The indexes are kept after flushing to `ColumnFileTiny`
+        delta->flush(dmContext());
+    }
+}
+CATCH
+
 TEST_F(DeltaValueSpaceTest, Restore)
 {
     auto persisted_file_set = delta->getPersistedFileSet();
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/FailPoint.h>
+#include <Common/ProfileEvents.h>
 #include <Core/ColumnWithTypeAndName.h>
 #include <Encryption/PosixRandomAccessFile.h>
 #include <Encryption/PosixWritableFile.h>
@@ -37,6 +38,15 @@
 #include <algorithm>
 #include <magic_enum.hpp>
 #include <vector>
+
+namespace ProfileEvents
+{
+extern const Event DMFileReadAheadRequest;
+extern const Event DMFileDropPageCacheBytes;
+extern const Event DMFileCircularScan;
+extern const Event DMFilePackCacheHits;
+} // namespace ProfileEvents
+
 namespace DB
 {
 namespace ErrorCodes
@@ -345,6 +355,352 @@ try
 }
 CATCH
 
+TEST_P(DMFileTest, ReadAhead)
+try
+{
+    auto cols = DMTestEnv::getDefaultColumns(DMTestEnv::PkType::HiddenTiDBRowID, /*add_nullable*/ true);
+
+    const size_t num_packs = 10;
+    const size_t rows_per_pack = 64;
+    {
+        auto stream = std::make_shared<DMFileBlockOutputStream>(dbContext(), dm_file, *cols);
+        stream->writePrefix();
+        for (size_t i = 0; i < num_packs; ++i)
+        {
+            Block block
+                = DMTestEnv::prepareSimpleWriteBlockWithNullable(i * rows_per_pack, (i + 1) * rows_per_pack);
+            stream->write(block, DMFileBlockOutputStream::BlockProperty{0, 0, 0, 0});
+        }
+        stream->writeSuffix();
+        ASSERT_EQ(dm_file->getPacks(), num_packs);
+    }
+
+    auto & db_settings = dbContext().getSettingsRef();
+    db_settings.dt_read_ahead_packs = 4;
+    SCOPE_EXIT({ db_settings.dt_read_ahead_packs = 0; });
+
+    [[maybe_unused]] const auto requests_before = ProfileEvents::counters[ProfileEvents::DMFileReadAheadRequest].load();
+    {
+        DMFileBlockInputStreamBuilder builder(dbContext());
+        auto stream = builder.setColumnCache(column_cache)
+                          .onlyReadOnePackEveryTime()
+                          .build(
+                              dm_file,
+                              *cols,
+                              RowKeyRanges{RowKeyRange::newAll(false, 1)},
+                              std::make_shared<ScanContext>());
+        // The skipped packs are not read ahead
+        auto & use_packs = stream->reader.pack_filter.getUsePacks();
+        use_packs[2] = false;
+        use_packs[3] = false;
+        auto expected = createNumbers<Int64>(0, 2 * rows_per_pack);
+        auto rest = createNumbers<Int64>(4 * rows_per_pack, num_packs * rows_per_pack);
+        expected.insert(expected.end(), rest.begin(), rest.end());
+        ASSERT_INPUTSTREAM_COLS_UR(
+            stream,
+            Strings({DMTestEnv::pk_name}),
+            createColumns({
+                createColumn<Int64>(expected),
+            }));
+    }
+#ifdef __linux__
+    // The tiny data files of V3 are merged and loaded into memory, no need to read ahead
+    if (GetParam() != DMFileMode::DirectoryMetaV2)
+        ASSERT_GT(ProfileEvents::counters[ProfileEvents::DMFileReadAheadRequest].load(), requests_before);
+#endif
+}
+CATCH
+
+TEST_P(DMFileTest, DropPageCache)
+try
+{
+    auto cols = DMTestEnv::getDefaultColumns(DMTestEnv::PkType::HiddenTiDBRowID, /*add_nullable*/ true);
+
+    const size_t num_packs = 10;
+    const size_t rows_per_pack = 64;
+    {
+        auto stream = std::make_shared<DMFileBlockOutputStream>(dbContext(), dm_file, *cols);
+        stream->writePrefix();
+        for (size_t i = 0; i < num_packs; ++i)
+        {
+            Block block
+                = DMTestEnv::prepareSimpleWriteBlockWithNullable(i * rows_per_pack, (i + 1) * rows_per_pack);
+            stream->write(block, DMFileBlockOutputStream::BlockProperty{0, 0, 0, 0});
+        }
+        stream->writeSuffix();
+        ASSERT_EQ(dm_file->getPacks(), num_packs);
+    }
+
+    auto & db_settings = dbContext().getSettingsRef();
+    db_settings.dt_scan_drop_page_cache = true;
+    SCOPE_EXIT({ db_settings.dt_scan_drop_page_cache = false; });
+
+    [[maybe_unused]] const auto bytes_before = ProfileEvents::counters[ProfileEvents::DMFileDropPageCacheBytes].load();
+    {
+        DMFileBlockInputStreamBuilder builder(dbContext());
+        auto stream = builder.setColumnCache(column_cache)
+                          .onlyReadOnePackEveryTime()
+                          .build(
+                              dm_file,
+                              *cols,
+                              RowKeyRanges{RowKeyRange::newAll(false, 1)},
+                              std::make_shared<ScanContext>());
+        // Dropping the page cache of the read packs does not affect the following reads
+        ASSERT_INPUTSTREAM_COLS_UR(
+            stream,
+            Strings({DMTestEnv::pk_name}),
+            createColumns({
+                createColumn<Int64>(createNumbers<Int64>(0, num_packs * rows_per_pack)),
+            }));
+    }
+#ifdef __linux__
+    // The tiny data files of V3 are merged and loaded into memory, they are not read through page cache
+    if (GetParam() != DMFileMode::DirectoryMetaV2)
+        ASSERT_GT(ProfileEvents::counters[ProfileEvents::DMFileDropPageCacheBytes].load(), bytes_before);
+#endif
+}
+CATCH
+
+TEST_P(DMFileTest, DecodedPackCache)
+try
+{
+    auto cols = DMTestEnv::getDefaultColumns(DMTestEnv::PkType::HiddenTiDBRowID, /*add_nullable*/ true);
+
+    const size_t num_packs = 10;
+    const size_t rows_per_pack = 64;
+    {
+        auto stream = std::make_shared<DMFileBlockOutputStream>(dbContext(), dm_file, *cols);
+        stream->writePrefix();
+        for (size_t i = 0; i < num_packs; ++i)
+        {
+            Block block
+                = DMTestEnv::prepareSimpleWriteBlockWithNullable(i * rows_per_pack, (i + 1) * rows_per_pack);
+            stream->write(block, DMFileBlockOutputStream::BlockProperty{0, 0, 0, 0});
+        }
+        stream->writeSuffix();
+        ASSERT_EQ(dm_file->getPacks(), num_packs);
+    }
+
+    auto pack_cache = std::make_shared<DMFilePackCache>(64 * 1024 * 1024);
+    auto scan_context = std::make_shared<ScanContext>();
+    const RowKeyRanges ranges{RowKeyRange::newAll(false, 1)};
+    auto create_stream = [&](size_t rows_threshold_per_read) {
+        DMFileReader reader(
+            dm_file,
+            *cols,
+            /*is_common_handle*/ false,
+            /*enable_handle_clean_read*/ false,
+            /*enable_del_clean_read*/ false,
+            /*is_fast_scan*/ false,
+            std::numeric_limits<UInt64>::max(),
+            DMFilePackFilter::loadFrom(
+                dm_file,
+                dbContext().getMinMaxIndexCache(),
+                /*set_cache_if_miss*/ true,
+                ranges,
+                EMPTY_RS_OPERATOR,
+                /*read_packs*/ nullptr,
+                dbContext().getFileProvider(),
+                /*read_limiter*/ nullptr,
+                scan_context,
+                /*tracing_id*/ ""),
+            dbContext().getMarkCache(),
+            /*enable_column_cache*/ false,
+            /*column_cache*/ nullptr,
+            pack_cache,
+            /*aio_threshold*/ 0,
+            DBMS_DEFAULT_BUFFER_SIZE,
+            /*read_ahead_packs*/ 0,
+            /*drop_page_cache*/ false,
+            dbContext().getFileProvider(),
+            /*read_limiter*/ nullptr,
+            rows_threshold_per_read,
+            /*read_one_pack_every_time*/ false,
+            /*tracing_id*/ "",
+            /*max_sharing_column_count*/ 0,
+            /*enable_circular_scan*/ false,
+            scan_context);
+        return std::make_shared<DMFileBlockInputStream>(std::move(reader), /*enable_data_sharing*/ false);
+    };
+
+    const auto expected = createColumns({
+        createColumn<Int64>(createNumbers<Int64>(0, num_packs * rows_per_pack)),
+    });
+    // The first read puts every pack into the cache, and the second read, which reads two packs at a time,
+    // gets all of them from the cache.
+    ASSERT_INPUTSTREAM_COLS_UR(create_stream(rows_per_pack), Strings({DMTestEnv::pk_name}), expected);
+    ASSERT_EQ(pack_cache->count(), num_packs * cols->size());
+
+    const auto hits_before = ProfileEvents::counters[ProfileEvents::DMFilePackCacheHits].load();
+    ASSERT_INPUTSTREAM_COLS_UR(create_stream(2 * rows_per_pack), Strings({DMTestEnv::pk_name}), expected);
+    ASSERT_EQ(
+        ProfileEvents::counters[ProfileEvents::DMFilePackCacheHits].load() - hits_before,
+        num_packs / 2 * cols->size());
+}
+CATCH
+
+TEST_P(DMFileTest, CircularScan)
+try
+{
+    auto cols = DMTestEnv::getDefaultColumns(DMTestEnv::PkType::HiddenTiDBRowID);
+
+    const size_t num_packs = 10;
+    const size_t rows_per_pack = 64;
+    {
+        auto stream = std::make_shared<DMFileBlockOutputStream>(dbContext(), dm_file, *cols);
+        stream->writePrefix();
+        for (size_t i = 0; i < num_packs; ++i)
+        {
+            Block block = DMTestEnv::prepareSimpleWriteBlock(i * rows_per_pack, (i + 1) * rows_per_pack, false);
+            stream->write(block, DMFileBlockOutputStream::BlockProperty{0, 0, 0, 0});
+        }
+        stream->writeSuffix();
+        ASSERT_EQ(dm_file->getPacks(), num_packs);
+    }
+
+    // Data sharing is only enabled in read threads by the builder, so create the readers directly.
+    auto scan_context = std::make_shared<ScanContext>();
+    const RowKeyRanges ranges{RowKeyRange::newAll(false, 1)};
+    auto create_stream = [&]() {
+        DMFileReader reader(
+            dm_file,
+            *cols,
+            /*is_common_handle*/ false,
+            /*enable_handle_clean_read*/ false,
+            /*enable_del_clean_read*/ false,
+            /*is_fast_scan*/ true,
+            std::numeric_limits<UInt64>::max(),
+            DMFilePackFilter::loadFrom(
+                dm_file,
+                dbContext().getMinMaxIndexCache(),
+                /*set_cache_if_miss*/ true,
+                ranges,
+                EMPTY_RS_OPERATOR,
+                /*read_packs*/ nullptr,
+                dbContext().getFileProvider(),
+                /*read_limiter*/ nullptr,
+                scan_context,
+                /*tracing_id*/ ""),
+            dbContext().getMarkCache(),
+            /*enable_column_cache*/ false,
+            /*column_cache*/ nullptr,
+            /*pack_cache*/ nullptr,
+            /*aio_threshold*/ 0,
+            DBMS_DEFAULT_BUFFER_SIZE,
+            /*read_ahead_packs*/ 0,
+            /*drop_page_cache*/ false,
+            dbContext().getFileProvider(),
+            /*read_limiter*/ nullptr,
+            /*rows_threshold_per_read*/ rows_per_pack,
+            /*read_one_pack_every_time*/ false,
+            /*tracing_id*/ "",
+            /*max_sharing_column_count*/ 5,
+            /*enable_circular_scan*/ true,
+            scan_context);
+        return std::make_shared<DMFileBlockInputStream>(std::move(reader), /*enable_data_sharing*/ true);
+    };
+    auto check_block = [&](const Block & block, size_t pack_id) {
+        ASSERT_EQ(block.rows(), rows_per_pack);
+        ASSERT_EQ(block.startOffset(), pack_id * rows_per_pack);
+        // The handle is the same as the row offset
+        const auto & handle = block.getByPosition(0).column;
+        ASSERT_EQ(handle->getInt(0), static_cast<Int64>(pack_id * rows_per_pack));
+        ASSERT_EQ(handle->getInt(rows_per_pack - 1), static_cast<Int64>((pack_id + 1) * rows_per_pack - 1));
+    };
+
+    auto leader = create_stream();
+    for (size_t i = 0; i < 3; ++i)
+        check_block(leader->read(), i);
+
+    // The follower starts from the position of the leader and wraps around.
+    const auto circular_scans_before = ProfileEvents::counters[ProfileEvents::DMFileCircularScan].load();
+    auto follower = create_stream();
+    std::vector<size_t> pack_ids;
+    for (size_t i = 3; i < num_packs; ++i)
+        pack_ids.push_back(i);
+    for (size_t i = 0; i < 3; ++i)
+        pack_ids.push_back(i);
+    for (auto pack_id : pack_ids)
+        check_block(follower->read(), pack_id);
+    ASSERT_FALSE(follower->read());
+    ASSERT_EQ(ProfileEvents::counters[ProfileEvents::DMFileCircularScan].load(), circular_scans_before + 1);
+
+    // The leader reads the rest packs, some of them are shared by the follower.
+    for (size_t i = 3; i < num_packs; ++i)
+        check_block(leader->read(), i);
+    ASSERT_FALSE(leader->read());
+}
+CATCH
+
+TEST_P(DMFileTest, LightweightCompression)
+try
+{
+    auto cols = DMTestEnv::getDefaultColumns(DMTestEnv::PkType::HiddenTiDBRowID, /*add_nullable*/ true);
+
+    auto & db_settings = dbContext().getSettingsRef();
+    db_settings.dt_enable_lightweight_compression = true;
+    SCOPE_EXIT({ db_settings.dt_enable_lightweight_compression = false; });
+
+    const size_t num_rows_write = 8192;
+    {
+        Block block = DMTestEnv::prepareSimpleWriteBlockWithNullable(0, num_rows_write);
+        auto stream = std::make_shared<DMFileBlockOutputStream>(dbContext(), dm_file, *cols);
+        stream->writePrefix();
+        stream->write(block, DMFileBlockOutputStream::BlockProperty{0, 0, 0, 0});
+        stream->writeSuffix();
+    }
+
+    dm_file = restoreDMFile();
+    DMFileBlockInputStreamBuilder builder(dbContext());
+    auto stream
+        = builder.build(dm_file, *cols, RowKeyRanges{RowKeyRange::newAll(false, 1)}, std::make_shared<ScanContext>());
+    ASSERT_INPUTSTREAM_COLS_UR(
+        stream,
+        Strings({DMTestEnv::pk_name}),
+        createColumns({
+            createColumn<Int64>(createNumbers<Int64>(0, num_rows_write)),
+        }));
+}
+CATCH
+
+TEST_P(DMFileTest, ConcurrentWriteColumns)
+try
+{
+    auto cols = DMTestEnv::getDefaultColumns(DMTestEnv::PkType::HiddenTiDBRowID, /*add_nullable*/ true);
+
+    auto & db_settings = dbContext().getSettingsRef();
+    auto origin_concurrency = db_settings.dt_dmfile_write_concurrency.get();
+    db_settings.dt_dmfile_write_concurrency = 3;
+    SCOPE_EXIT({ db_settings.dt_dmfile_write_concurrency = origin_concurrency; });
+
+    const size_t num_rows_write = 8192;
+    const size_t num_packs = 4;
+    {
+        auto stream = std::make_shared<DMFileBlockOutputStream>(dbContext(), dm_file, *cols);
+        stream->writePrefix();
+        for (size_t i = 0; i < num_packs; ++i)
+        {
+            Block block
+                = DMTestEnv::prepareSimpleWriteBlockWithNullable(i * num_rows_write, (i + 1) * num_rows_write);
+            stream->write(block, DMFileBlockOutputStream::BlockProperty{0, 0, 0, 0});
+        }
+        stream->writeSuffix();
+    }
+
+    dm_file = restoreDMFile();
+    ASSERT_EQ(dm_file->getPacks(), num_packs);
+    DMFileBlockInputStreamBuilder builder(dbContext());
+    auto stream
+        = builder.build(dm_file, *cols, RowKeyRanges{RowKeyRange::newAll(false, 1)}, std::make_shared<ScanContext>());
+    ASSERT_INPUTSTREAM_COLS_UR(
+        stream,
+        Strings({DMTestEnv::pk_name}),
+        createColumns({
+            createColumn<Int64>(createNumbers<Int64>(0, num_rows_write * num_packs)),
+        }));
+}
+CATCH
+
 // test tiny data into v3, and read it
 // check all data is in 0.merged and meta
 TEST_P(DMFileTest, CheckDMFileV3WithTinyData)
@@ -15,8 +15,10 @@
 #include <Common/Logger.h>
 #include <Core/BlockGen.h>
 #include <DataTypes/DataTypeEnum.h>
+#include <DataTypes/DataTypeMyDateTime.h>
 #include <Flash/Coprocessor/DAGCodec.h>
 #include <Flash/Coprocessor/DAGQueryInfo.h>
+#include <Flash/Coprocessor/DAGUtils.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/convertFieldToType.h>
 #include <Storages/DeltaMerge/DMContext.h>
@@ -2264,4 +2266,72 @@ try
 }
 CATCH
 
+
+TEST_F(DMMinMaxIndexTest, ParseCastStringAsDatetime)
+try
+{
+    auto make_filter = [](const String & datetime) {
+        // a > cast(datetime as datetime)
+        tipb::Expr expr;
+        expr.set_sig(tipb::ScalarFuncSig::GTTime);
+        expr.set_tp(tipb::ExprType::ScalarFunc);
+        {
+            tipb::Expr * col = expr.add_children();
+            col->set_tp(tipb::ExprType::ColumnRef);
+            {
+                WriteBufferFromOwnString ss;
+                encodeDAGInt64(0, ss);
+                col->set_val(ss.releaseStr());
+            }
+            auto * field_type = col->mutable_field_type();
+            field_type->set_tp(TiDB::TypeDatetime);
+            field_type->set_flag(0);
+        }
+        {
+            tipb::Expr * cast = expr.add_children();
+            cast->set_sig(tipb::ScalarFuncSig::CastStringAsTime);
+            cast->set_tp(tipb::ExprType::ScalarFunc);
+            auto * field_type = cast->mutable_field_type();
+            field_type->set_tp(TiDB::TypeDatetime);
+            field_type->set_decimal(0);
+            *cast->add_children() = constructStringLiteralTiExpr(datetime);
+        }
+        google::protobuf::RepeatedPtrField<tipb::Expr> filters;
+        filters.Add()->CopyFrom(expr);
+        return filters;
+    };
+
+    const ColumnDefines columns_to_read = {ColumnDefine{1, "a", std::make_shared<DataTypeMyDateTime>(0)}};
+    auto create_attr_by_column_id = [&columns_to_read](ColumnID column_id) -> Attr {
+        auto iter
+            = std::find_if(columns_to_read.begin(), columns_to_read.end(), [column_id](const ColumnDefine & d) -> bool {
+                  return d.id == column_id;
+              });
+        if (iter != columns_to_read.end())
+            return Attr{.col_name = iter->name, .col_id = iter->id, .type = iter->type};
+        return Attr{.col_name = "", .col_id = column_id, .type = DataTypePtr{}};
+    };
+    auto parse = [&](const String & datetime) {
+        const google::protobuf::RepeatedPtrField<tipb::Expr> pushed_down_filters{};
+        const auto filters = make_filter(datetime);
+        auto dag_query = std::make_unique<DAGQueryInfo>(
+            filters,
+            pushed_down_filters, // Not care now
+            std::vector<TiDB::ColumnInfo>{}, // Not care now
+            std::vector<int>{},
+            0,
+            context->getTimezoneInfo());
+        return DB::DM::FilterParser::parseDAGQuery(*dag_query, columns_to_read, create_attr_by_column_id, Logger::get());
+    };
+
+    // The cast of a string literal is folded to a datetime literal
+    auto op = parse("2023-01-01 10:00:00");
+    ASSERT_EQ(op->name(), "greater");
+    ASSERT_EQ(op->getColumnIDs(), ColIds{1});
+    // The string is not a datetime, leave it to the filter
+    op = parse("not a datetime");
+    ASSERT_EQ(op->name(), "unsupported");
+}
+CATCH
+
 } // namespace DB::DM::tests
@@ -473,6 +473,34 @@ try
 }
 CATCH
 
+TEST_F(DeltaMergeStoreGCTest, UrgentMergeDeltaTaskFirst)
+try
+{
+    ensureSegmentBreakpoints({0, 10, 20});
+
+    DeltaMergeStore::MergeDeltaTaskPool pool;
+    auto log = Logger::get();
+    auto add_task = [&](Int64 key, bool urgent) {
+        auto [added, heavy] = pool.tryAddTask(
+            DeltaMergeStore::BackgroundTask{DeltaMergeStore::MergeDelta, dm_context, getSegmentAt(key), urgent},
+            DeltaMergeStore::Write,
+            10,
+            log);
+        ASSERT_TRUE(added);
+        ASSERT_TRUE(heavy);
+    };
+    add_task(-1, false);
+    add_task(5, false);
+    add_task(15, true);
+
+    // The urgent task runs before the tasks added earlier.
+    ASSERT_EQ(pool.nextTask(true, log).segment, getSegmentAt(15));
+    ASSERT_EQ(pool.nextTask(true, log).segment, getSegmentAt(-1));
+    ASSERT_EQ(pool.nextTask(true, log).segment, getSegmentAt(5));
+    ASSERT_FALSE(pool.nextTask(true, log));
+}
+CATCH
+
 
 } // namespace tests
 } // namespace DM
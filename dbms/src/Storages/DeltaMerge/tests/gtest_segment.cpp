@@ -19,13 +19,16 @@
 #include <Common/SyncPoint/Ctl.h>
 #include <DataStreams/OneBlockInputStream.h>
 #include <Interpreters/Context.h>
+#include <Storages/DeltaMerge/BitmapFilter/BitmapFilterCache.h>
 #include <Storages/DeltaMerge/DeltaMergeStore.h>
 #include <Storages/DeltaMerge/Remote/RNWorkerPrepareStreams.h>
 #include <Storages/DeltaMerge/SegmentReadTask.h>
+#include <Storages/DeltaMerge/StableResultCache.h>
 #include <Storages/DeltaMerge/WriteBatchesImpl.h>
 #include <Storages/DeltaMerge/tests/gtest_segment_test_basic.h>
 #include <Storages/DeltaMerge/tests/gtest_segment_util.h>
 #include <TestUtils/FunctionTestUtils.h>
+#include <TestUtils/InputStreamTestUtils.h>
 #include <TestUtils/TiFlashTestBasic.h>
 #include <common/defines.h>
 #include <gtest/gtest.h>
@@ -36,6 +39,10 @@ namespace ProfileEvents
 {
 extern const Event DMSegmentIsEmptyFastPath;
 extern const Event DMSegmentIsEmptySlowPath;
+extern const Event DMStableResultCacheHits;
+extern const Event DMStableResultCacheMisses;
+extern const Event DMBitmapFilterCacheHits;
+extern const Event DMBitmapFilterCacheMisses;
 } // namespace ProfileEvents
 
 namespace CurrentMetrics
@@ -477,6 +484,49 @@ try
 CATCH
 
 
+TEST_F(SegmentOperationTest, AdaptiveByReadPattern)
+try
+{
+    reloadWithOptions({.db_settings = {.dt_segment_stable_pack_rows = 100, .dt_adaptive_segment_min_reads = 8}});
+
+    writeSegment(DELTA_MERGE_FIRST_SEGMENT_ID, 1000);
+    mergeSegmentDelta(DELTA_MERGE_FIRST_SEGMENT_ID);
+    const auto default_packs = segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getStable()->getDMFilesPacks();
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getReadPattern(8), Segment::ReadPattern::Unknown);
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getStablePackRows(*dm_context), 100);
+
+    // Point gets and range reads prefer smaller packs
+    const RowKeyRanges point_ranges{RowKeyRange::fromHandleRange(HandleRange(10, 11))};
+    for (size_t i = 0; i < 16; ++i)
+        segments[DELTA_MERGE_FIRST_SEGMENT_ID]->recordRead(point_ranges);
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getReadPattern(8), Segment::ReadPattern::RangeRead);
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getStablePackRows(*dm_context), 50);
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getSegmentLimitFactor(*dm_context), 1);
+
+    mergeSegmentDelta(DELTA_MERGE_FIRST_SEGMENT_ID);
+    ASSERT_GT(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getStable()->getDMFilesPacks(), default_packs);
+    // The statistics are halved after merge delta
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getRangeReads(), 8);
+
+    // Full scans prefer larger packs and larger segments
+    const RowKeyRanges all_ranges{RowKeyRange::newAll(false, 1)};
+    for (size_t i = 0; i < 64; ++i)
+        segments[DELTA_MERGE_FIRST_SEGMENT_ID]->recordRead(all_ranges);
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getReadPattern(8), Segment::ReadPattern::FullScan);
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getStablePackRows(*dm_context), 200);
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getSegmentLimitFactor(*dm_context), 2);
+
+    mergeSegmentDelta(DELTA_MERGE_FIRST_SEGMENT_ID);
+    ASSERT_LT(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getStable()->getDMFilesPacks(), default_packs);
+
+    // The new segments inherit the statistics after split
+    auto new_seg_id = splitSegment(DELTA_MERGE_FIRST_SEGMENT_ID, Segment::SplitMode::Physical);
+    ASSERT_TRUE(new_seg_id.has_value());
+    ASSERT_EQ(segments[DELTA_MERGE_FIRST_SEGMENT_ID]->getReadPattern(8), Segment::ReadPattern::FullScan);
+    ASSERT_EQ(segments[*new_seg_id]->getReadPattern(8), Segment::ReadPattern::FullScan);
+}
+CATCH
+
 TEST_F(SegmentOperationTest, DeltaPagesAfterDeltaMerge)
 try
 {
@@ -1133,6 +1183,130 @@ try
 CATCH
 
 
+class StableResultCacheTest : public SegmentTestBasic
+{
+public:
+    void SetUp() override
+    {
+        SegmentTestBasic::SetUp();
+        auto & global_context = db_context->getGlobalContext();
+        if (!global_context.getStableResultCache())
+            global_context.setStableResultCache(64 * 1024 * 1024);
+    }
+
+    void TearDown() override { db_context->getGlobalContext().dropStableResultCache(); }
+
+protected:
+    size_t getSegmentRowNumModeFast(PageIdU64 segment_id)
+    {
+        auto [segment, snapshot] = getSegmentForRead(segment_id);
+        auto in = segment->getInputStreamModeFast(
+            *dm_context,
+            *tableColumns(),
+            snapshot,
+            {segment->getRowKeyRange()},
+            EMPTY_RS_OPERATOR);
+        return getInputStreamNRows(in);
+    }
+};
+
+TEST_F(StableResultCacheTest, Basic)
+try
+{
+    writeSegment(DELTA_MERGE_FIRST_SEGMENT_ID, 100, /* at */ 0);
+    mergeSegmentDelta(DELTA_MERGE_FIRST_SEGMENT_ID);
+
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMStableResultCacheMisses, +1, {
+        ASSERT_EQ(100, getSegmentRowNumModeFast(DELTA_MERGE_FIRST_SEGMENT_ID));
+    });
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMStableResultCacheHits, +1, {
+        ASSERT_EQ(100, getSegmentRowNumModeFast(DELTA_MERGE_FIRST_SEGMENT_ID));
+    });
+
+    // The stable is not changed, only the delta is read.
+    writeSegment(DELTA_MERGE_FIRST_SEGMENT_ID, 50, /* at */ 100);
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMStableResultCacheHits, +1, {
+        ASSERT_EQ(150, getSegmentRowNumModeFast(DELTA_MERGE_FIRST_SEGMENT_ID));
+    });
+
+    // A new stable is generated, the cached result can not be used.
+    mergeSegmentDelta(DELTA_MERGE_FIRST_SEGMENT_ID);
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMStableResultCacheMisses, +1, {
+        ASSERT_EQ(150, getSegmentRowNumModeFast(DELTA_MERGE_FIRST_SEGMENT_ID));
+    });
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMStableResultCacheHits, +1, {
+        ASSERT_EQ(150, getSegmentRowNumModeFast(DELTA_MERGE_FIRST_SEGMENT_ID));
+    });
+}
+CATCH
+
+
+class BitmapFilterCacheTest : public SegmentTestBasic
+{
+public:
+    void SetUp() override
+    {
+        SegmentTestBasic::SetUp();
+        auto & global_context = db_context->getGlobalContext();
+        if (!global_context.getBitmapFilterCache())
+            global_context.setBitmapFilterCache(64 * 1024 * 1024);
+    }
+
+    void TearDown() override { db_context->getGlobalContext().dropBitmapFilterCache(); }
+
+protected:
+    BitmapFilterPtr buildBitmapFilter(PageIdU64 segment_id, UInt64 max_version)
+    {
+        auto [segment, snapshot] = getSegmentForRead(segment_id);
+        return segment->buildBitmapFilter(
+            *dm_context,
+            snapshot,
+            {segment->getRowKeyRange()},
+            EMPTY_RS_OPERATOR,
+            max_version,
+            DEFAULT_BLOCK_SIZE);
+    }
+};
+
+TEST_F(BitmapFilterCacheTest, Basic)
+try
+{
+    // The rows are written with version 1, and kept in the delta so that the bitmap is built by delta merge.
+    writeSegment(DELTA_MERGE_FIRST_SEGMENT_ID, 100, /* at */ 0);
+
+    BitmapFilterPtr bitmap_filter;
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMBitmapFilterCacheMisses, +1, {
+        bitmap_filter = buildBitmapFilter(DELTA_MERGE_FIRST_SEGMENT_ID, 10);
+    });
+    ASSERT_EQ(bitmap_filter->count(), 100);
+    // No row is committed after version 10, so the bitmap can be reused by the newer reads.
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMBitmapFilterCacheHits, +1, {
+        ASSERT_EQ(buildBitmapFilter(DELTA_MERGE_FIRST_SEGMENT_ID, 20), bitmap_filter);
+    });
+    // The older reads can not reuse it
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMBitmapFilterCacheMisses, +1, {
+        ASSERT_NE(buildBitmapFilter(DELTA_MERGE_FIRST_SEGMENT_ID, 5), bitmap_filter);
+    });
+
+    // The rows are invisible for version 0, and the bitmap is valid until version 1.
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMBitmapFilterCacheMisses, +1, {
+        ASSERT_EQ(buildBitmapFilter(DELTA_MERGE_FIRST_SEGMENT_ID, 0)->count(), 0);
+    });
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMBitmapFilterCacheHits, +1, {
+        ASSERT_EQ(buildBitmapFilter(DELTA_MERGE_FIRST_SEGMENT_ID, 0)->count(), 0);
+    });
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMBitmapFilterCacheMisses, +1, {
+        ASSERT_EQ(buildBitmapFilter(DELTA_MERGE_FIRST_SEGMENT_ID, 1)->count(), 100);
+    });
+
+    // The snapshot is changed after writing
+    writeSegment(DELTA_MERGE_FIRST_SEGMENT_ID, 50, /* at */ 100);
+    ASSERT_PROFILE_EVENT(ProfileEvents::DMBitmapFilterCacheMisses, +1, {
+        ASSERT_EQ(buildBitmapFilter(DELTA_MERGE_FIRST_SEGMENT_ID, 10)->count(), 150);
+    });
+}
+CATCH
+
 class IsEmptyTest : public SegmentTestBasic
 {
 };
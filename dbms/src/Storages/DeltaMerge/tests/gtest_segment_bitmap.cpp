@@ -18,6 +18,7 @@
 #include <Storages/DeltaMerge/tests/gtest_segment_test_basic.h>
 #include <Storages/DeltaMerge/tests/gtest_segment_util.h>
 #include <TestUtils/FunctionTestUtils.h>
+#include <TestUtils/InputStreamTestUtils.h>
 #include <TestUtils/TiFlashTestBasic.h>
 #include <common/defines.h>
 
@@ -467,4 +468,34 @@ try
 }
 CATCH
 
+TEST_F(SegmentBitmapFilterTest, CountOnly)
+try
+{
+    writeSegment("s:[0, 10000)|d_tiny:[5000, 12000)|d_dr:[0, 1000)|d_mem:[20000, 21000)");
+    auto [seg, snap] = getSegmentForRead(SEG_ID);
+    auto read = [&](ReadMode read_mode) {
+        return seg->getInputStream(
+            read_mode,
+            *dm_context,
+            *tableColumns(),
+            snap,
+            {seg->getRowKeyRange()},
+            EMPTY_FILTER,
+            std::numeric_limits<UInt64>::max(),
+            DEFAULT_BLOCK_SIZE);
+    };
+
+    auto stream = read(ReadMode::Count);
+    stream->readPrefix();
+    auto block = stream->read();
+    ASSERT_EQ(block.rows(), 12000);
+    for (const auto & col : block)
+        ASSERT_TRUE(col.column->isColumnConst());
+    ASSERT_FALSE(stream->read());
+    stream->readSuffix();
+
+    ASSERT_EQ(getInputStreamNRows(read(ReadMode::Bitmap)), 12000);
+}
+CATCH
+
 } // namespace DB::DM::tests
@@ -0,0 +1,80 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <DataTypes/DataTypesNumber.h>
+#include <Storages/DeltaMerge/Filter/TopNThreshold.h>
+#include <TestUtils/FunctionTestUtils.h>
+#include <gtest/gtest.h>
+
+namespace DB::DM::tests
+{
+namespace
+{
+Block createBlock(const std::vector<std::optional<Int64>> & values)
+{
+    return Block{createColumn<Nullable<Int64>>(values, "a")};
+}
+} // namespace
+
+TEST(TopNThresholdTest, Desc)
+{
+    TopNThreshold threshold(1, "a", /*is_desc*/ true);
+    const Attr attr{.col_name = "a", .col_id = 1, .type = std::make_shared<DataTypeInt64>()};
+    ASSERT_EQ(threshold.toRSOperator(attr), EMPTY_RS_OPERATOR);
+
+    // Less than `limit` rows
+    threshold.update(createBlock({100, 90}), 3);
+    ASSERT_FALSE(threshold.getThreshold().has_value());
+
+    // The n-th value is NULL
+    threshold.update(createBlock({100, 90, {}}), 3);
+    ASSERT_FALSE(threshold.getThreshold().has_value());
+
+    threshold.update(createBlock({100, 90, 80}), 3);
+    ASSERT_EQ(threshold.getThreshold(), Field(static_cast<Int64>(80)));
+
+    // Only a larger value is a better threshold
+    threshold.update(createBlock({100, 90, 70}), 3);
+    ASSERT_EQ(threshold.getThreshold(), Field(static_cast<Int64>(80)));
+    threshold.update(createBlock({100, 95, 85}), 3);
+    ASSERT_EQ(threshold.getThreshold(), Field(static_cast<Int64>(85)));
+
+    auto rs_operator = threshold.toRSOperator(attr);
+    ASSERT_NE(rs_operator, EMPTY_RS_OPERATOR);
+    ASSERT_EQ(rs_operator->toDebugString(), R"({"op":"greater_equal","col":"a","value":"85"})");
+}
+
+TEST(TopNThresholdTest, Asc)
+{
+    TopNThreshold threshold(1, "a", /*is_desc*/ false);
+    const Attr attr{.col_name = "a", .col_id = 1, .type = std::make_shared<DataTypeInt64>()};
+
+    threshold.update(createBlock({{}, 1, 5}), 3);
+    ASSERT_EQ(threshold.getThreshold(), Field(static_cast<Int64>(5)));
+
+    // Only a smaller value is a better threshold
+    threshold.update(createBlock({1, 2, 6}), 3);
+    ASSERT_EQ(threshold.getThreshold(), Field(static_cast<Int64>(5)));
+    threshold.update(createBlock({1, 2, 3}), 3);
+    ASSERT_EQ(threshold.getThreshold(), Field(static_cast<Int64>(3)));
+
+    // NULLs are placed first in ascending order, they can not be skipped.
+    auto rs_operator = threshold.toRSOperator(attr);
+    ASSERT_NE(rs_operator, EMPTY_RS_OPERATOR);
+    ASSERT_EQ(
+        rs_operator->toDebugString(),
+        R"({"op":"or","children":[{"op":"less_equal","col":"a","value":"3"},{"op":"isnull","col":"a"}]})");
+}
+
+} // namespace DB::DM::tests
@@ -175,6 +175,75 @@ TEST(VersionFilterTest, MVCC)
     }
 }
 
+TEST(VersionFilterTest, MVCCMultiRowsBlock)
+{
+    // Handles with multiple versions cross the boundary of blocks.
+    auto make_block = [](const std::vector<Int64> & handles,
+                         const std::vector<UInt64> & versions,
+                         const std::vector<UInt64> & tags,
+                         const Strings & values) {
+        return Block{
+            createColumn<Int64>(handles, DMTestEnv::pk_name, EXTRA_HANDLE_COLUMN_ID),
+            createColumn<UInt64>(versions, VERSION_COLUMN_NAME, VERSION_COLUMN_ID),
+            createColumn<UInt8>(tags, TAG_COLUMN_NAME, TAG_COLUMN_ID),
+            createColumn<String>(values, str_col_name, DebugBlockInputStream::extra_column_id),
+        };
+    };
+    BlocksList blocks;
+    blocks.push_back(make_block(
+        {1, 1, 2, 3, 3, 3, 4},
+        {10, 20, 10, 10, 20, 30, 10},
+        {0, 0, 0, 0, 1, 0, 0},
+        {"1_10", "1_20", "2_10", "3_10", "3_20", "3_30", "4_10"}));
+    blocks.push_back(make_block({4, 5, 6, 6}, {20, 10, 10, 20}, {0, 1, 0, 1}, {"4_20", "5_10", "6_10", "6_20"}));
+
+    ColumnDefines columns = getColumnDefinesFromBlock(blocks.back());
+    {
+        auto in = getVersionFilterInputStream<DM_VERSION_FILTER_MODE_MVCC>(blocks, columns, 30, false);
+        ASSERT_INPUTSTREAM_COLS_UR(
+            in,
+            Strings({str_col_name}),
+            createColumns({createColumn<String>({"1_20", "2_10", "3_30", "4_20"})}));
+    }
+    {
+        auto in = getVersionFilterInputStream<DM_VERSION_FILTER_MODE_MVCC>(blocks, columns, 15, false);
+        ASSERT_INPUTSTREAM_COLS_UR(
+            in,
+            Strings({str_col_name}),
+            createColumns({createColumn<String>({"1_10", "2_10", "3_10", "4_10", "6_10"})}));
+    }
+}
+
+TEST(VersionFilterTest, MVCCCleanBlock)
+{
+    auto make_block = [](const std::vector<UInt64> & versions) {
+        Block block{
+            createColumn<Int64>({1, 2, 3, 4}, DMTestEnv::pk_name, EXTRA_HANDLE_COLUMN_ID),
+            createColumn<UInt64>(versions, VERSION_COLUMN_NAME, VERSION_COLUMN_ID),
+            createColumn<UInt8>({0, 0, 0, 0}, TAG_COLUMN_NAME, TAG_COLUMN_ID),
+            createColumn<String>({"1", "2", "3", "4"}, str_col_name, DebugBlockInputStream::extra_column_id),
+        };
+        block.setMVCCClean(true);
+        return block;
+    };
+    {
+        BlocksList blocks{make_block({10, 20, 10, 20})};
+        ColumnDefines columns = getColumnDefinesFromBlock(blocks.back());
+        auto in = getVersionFilterInputStream<DM_VERSION_FILTER_MODE_MVCC>(blocks, columns, 20, false);
+        ASSERT_INPUTSTREAM_COLS_UR(
+            in,
+            Strings({str_col_name}),
+            createColumns({createColumn<String>({"1", "2", "3", "4"})}));
+    }
+    {
+        // Some rows are invisible, fall back to compare the handles and versions.
+        BlocksList blocks{make_block({10, 20, 10, 20})};
+        ColumnDefines columns = getColumnDefinesFromBlock(blocks.back());
+        auto in = getVersionFilterInputStream<DM_VERSION_FILTER_MODE_MVCC>(blocks, columns, 15, false);
+        ASSERT_INPUTSTREAM_COLS_UR(in, Strings({str_col_name}), createColumns({createColumn<String>({"1", "3"})}));
+    }
+}
+
 TEST(VersionFilterTest, RangesMVCC)
 {
     BlocksList blocks;
@@ -14,6 +14,7 @@
 
 #include <Common/Exception.h>
 #include <Common/Logger.h>
+#include <Common/ProfileEvents.h>
 #include <Interpreters/Context.h>
 #include <Poco/Logger.h>
 #include <Poco/Util/LayeredConfiguration.h>
@@ -30,9 +31,33 @@
 #include <Storages/DeltaMerge/workload/TimestampGenerator.h>
 #include <Storages/DeltaMerge/workload/Utils.h>
 #include <TestUtils/TiFlashTestEnv.h>
+#include <sys/resource.h>
+
+namespace ProfileEvents
+{
+extern const Event WriteBufferFromFileDescriptorWriteBytes;
+extern const Event PSMWriteBytes;
+} // namespace ProfileEvents
 
 namespace DB::DM::tests
 {
+namespace
+{
+// The bytes written to the files of DMFiles and PageStorage
+uint64_t diskWriteBytes()
+{
+    return ProfileEvents::get(ProfileEvents::WriteBufferFromFileDescriptorWriteBytes)
+        + ProfileEvents::get(ProfileEvents::PSMWriteBytes);
+}
+
+uint64_t maxRSSBytes()
+{
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return usage.ru_maxrss * 1024; // ru_maxrss is in kilobytes
+}
+} // namespace
 
 DTWorkload::DTWorkload(
     const WorkloadOptions & opts_,
@@ -142,11 +167,13 @@ void DTWorkload::write(ThreadStat & write_stat)
         auto limiter = Limiter::create(*opts);
         uint64_t write_count = std::ceil(static_cast<double>(opts->write_count) / opts->write_thread_count);
         auto block = std::get<0>(data_gen->get(0)); // Block for reuse.
+        write_stat.latencies_us.reserve(write_count);
 
         Stopwatch sw;
         for (uint64_t i = 0; i < write_count; i++)
         {
             limiter->request();
+            Stopwatch write_sw;
             uint64_t key = key_gen->get64();
             std::unique_lock<std::recursive_mutex> lock;
             if (handle_lock != nullptr)
@@ -156,6 +183,8 @@ void DTWorkload::write(ThreadStat & write_stat)
             auto ts = updateBlock(block, key);
 
             store->write(*context, context->getSettingsRef(), block);
+            write_stat.latencies_us.push_back(write_sw.elapsedMicroseconds());
+            write_stat.bytes += block.bytes();
 
             if (handle_table != nullptr)
             {
@@ -310,6 +339,7 @@ void DTWorkload::scanAll(ThreadStat & read_stat)
             };
             Stopwatch sw;
             read(columns, stream_count, count_row);
+            read_stat.latencies_us.push_back(sw.elapsedMicroseconds());
             read_stat.ms = sw.elapsedMilliseconds();
             read_stat.count = read_count;
             LOG_INFO(
@@ -329,6 +359,7 @@ void DTWorkload::scanAll(ThreadStat & read_stat)
 
 void DTWorkload::run(uint64_t r)
 {
+    auto disk_write_bytes = diskWriteBytes();
     std::vector<std::thread> write_threads;
     for (uint64_t i = 0; i < opts->write_thread_count; i++)
     {
@@ -349,6 +380,10 @@ void DTWorkload::run(uint64_t r)
     {
         t.join();
     }
+    // The flush, merge and GC in the background threads are also counted, they are part of the cost of the writes.
+    stat.disk_write_bytes += diskWriteBytes() - disk_write_bytes;
+    stat.max_rss_bytes = maxRSSBytes();
+    stat.summarizeLatencies();
     if (opts->verification)
     {
         verifyHandle(r);
@@ -17,9 +17,11 @@
 #include <Interpreters/Context_fwd.h>
 #include <fmt/ranges.h>
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace DB
@@ -62,7 +64,12 @@ public:
 private:
     uint64_t ms = 0;
     uint64_t count = 0;
+    // The latency of each write request or each round of scan
+    std::vector<uint64_t> latencies_us;
+    // The bytes of the blocks written, used to calculate the write amplification
+    uint64_t bytes = 0;
     friend class DTWorkload;
+    friend class Statistics;
 };
 
 class Statistics
@@ -90,10 +97,32 @@ public:
 
     uint64_t initMS() const { return init_ms; }
 
+    uint64_t writeP50US() const { return write_p50_us; }
+    uint64_t writeP99US() const { return write_p99_us; }
+    uint64_t readP50US() const { return read_p50_us; }
+    uint64_t readP99US() const { return read_p99_us; }
+
+    // The bytes written to disk, including flush, compaction, merge and GC, divided by the bytes of the written blocks
+    double writeAmplification() const
+    {
+        uint64_t bytes = 0;
+        std::for_each(write_stats.begin(), write_stats.end(), [&](const ThreadStat & stat) { bytes += stat.bytes; });
+        return bytes == 0 ? 0 : static_cast<double>(disk_write_bytes) / bytes;
+    }
+
+    uint64_t maxRSSBytes() const { return max_rss_bytes; }
+
     std::vector<std::string> toStrings() const
     {
         std::vector<std::string> v;
         v.push_back(fmt::format("init_ms {}", initMS()));
+        v.push_back(fmt::format(
+            "write_latency_us p50 {} p99 {} read_latency_us p50 {} p99 {}",
+            writeP50US(),
+            writeP99US(),
+            readP50US(),
+            readP99US()));
+        v.push_back(fmt::format("write_amplification {:.2f} max_rss_bytes {}", writeAmplification(), maxRSSBytes()));
         for (size_t i = 0; i < write_stats.size(); i++)
         {
             v.push_back(fmt::format("write_{}: {}", i, write_stats[i].toString()));
@@ -106,9 +135,40 @@ public:
     }
 
 private:
+    // Calculate the percentiles of the latencies and release them, the statistics of each round are kept until the end.
+    void summarizeLatencies()
+    {
+        std::tie(write_p50_us, write_p99_us) = percentiles(write_stats);
+        std::tie(read_p50_us, read_p99_us) = percentiles(read_stats);
+    }
+
+    static std::pair<uint64_t, uint64_t> percentiles(std::vector<ThreadStat> & stats)
+    {
+        std::vector<uint64_t> latencies;
+        for (auto & stat : stats)
+        {
+            latencies.insert(latencies.end(), stat.latencies_us.begin(), stat.latencies_us.end());
+            std::vector<uint64_t>().swap(stat.latencies_us);
+        }
+        if (latencies.empty())
+            return {0, 0};
+        auto nth = [&](double p) {
+            auto itr = latencies.begin() + static_cast<size_t>(p * (latencies.size() - 1));
+            std::nth_element(latencies.begin(), itr, latencies.end());
+            return *itr;
+        };
+        return {nth(0.5), nth(0.99)};
+    }
+
     uint64_t init_ms;
     std::vector<ThreadStat> write_stats;
     std::vector<ThreadStat> read_stats;
+    uint64_t write_p50_us = 0;
+    uint64_t write_p99_us = 0;
+    uint64_t read_p50_us = 0;
+    uint64_t read_p99_us = 0;
+    uint64_t disk_write_bytes = 0;
+    uint64_t max_rss_bytes = 0;
 
     friend class DTWorkload;
 };
@@ -16,7 +16,9 @@
 #include <Storages/DeltaMerge/workload/Options.h>
 #include <fmt/core.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <mutex>
 #include <random>
 
@@ -87,6 +89,56 @@ private:
     std::normal_distribution<> normal_dist;
 };
 
+// Generate keys in [0, key_count) following a zipfian distribution, the smaller keys are the hotter ones.
+// It is the algorithm of "Quickly Generating Billion-Record Synthetic Databases", Gray et al, SIGMOD 1994,
+// which is also used by YCSB.
+class ZipfianDistributionKeyGenerator : public KeyGenerator
+{
+public:
+    ZipfianDistributionKeyGenerator(uint64_t key_count_, double theta_)
+        : key_count(key_count_)
+        , theta(theta_)
+        , alpha(1.0 / (1.0 - theta_))
+        , zetan(zeta(key_count_, theta_))
+        , eta((1.0 - std::pow(2.0 / key_count_, 1.0 - theta_)) / (1.0 - zeta(2, theta_) / zetan))
+        , rand_gen(std::random_device()())
+    {}
+
+    uint64_t get64() override
+    {
+        double u = 0;
+        {
+            std::lock_guard lock(mtx);
+            u = uniform_dist(rand_gen);
+        }
+        double uz = u * zetan;
+        if (uz < 1.0)
+            return 0;
+        if (uz < 1.0 + std::pow(0.5, theta))
+            return 1;
+        return std::min(key_count - 1, static_cast<uint64_t>(key_count * std::pow(eta * u - eta + 1.0, alpha)));
+    }
+
+private:
+    static double zeta(uint64_t n, double theta)
+    {
+        double sum = 0;
+        for (uint64_t i = 1; i <= n; ++i)
+            sum += 1.0 / std::pow(static_cast<double>(i), theta);
+        return sum;
+    }
+
+    const uint64_t key_count;
+    const double theta;
+    const double alpha;
+    const double zetan;
+    const double eta;
+
+    std::mutex mtx;
+    std::mt19937_64 rand_gen;
+    std::uniform_real_distribution<double> uniform_dist;
+};
+
 std::unique_ptr<KeyGenerator> KeyGenerator::create(const WorkloadOptions & opts)
 {
     const auto & dist = opts.write_key_distribution;
@@ -107,6 +159,10 @@ std::unique_ptr<KeyGenerator> KeyGenerator::create(const WorkloadOptions & opts)
     {
         return std::make_unique<NormalDistributionKeyGenerator>(opts.max_key_count);
     }
+    else if (dist == "zipf")
+    {
+        return std::make_unique<ZipfianDistributionKeyGenerator>(opts.max_key_count, opts.zipf_theta);
+    }
     else
     {
         throw std::invalid_argument(fmt::format("KeyGenerator::create '{}' not support.", dist));
@@ -95,6 +95,10 @@ void initThreadPool()
         /*max_threads*/ default_num_threads,
         /*max_free_threads*/ default_num_threads / 2,
         /*queue_size*/ default_num_threads * 2);
+    DMFileWritePool::initialize(
+        /*max_threads*/ default_num_threads,
+        /*max_free_threads*/ default_num_threads / 2,
+        /*queue_size*/ default_num_threads * 2);
 }
 
 void initReadThread()
@@ -171,7 +175,9 @@ ContextPtr init(WorkloadOptions & opts)
 
 void outputResultHeader()
 {
-    std::cout << "Date,Table Schema,Workload,Init Seconds,Write Speed(rows count),Read Speed(rows count)" << std::endl;
+    std::cout << "Date,Table Schema,Workload,Init Seconds,Write Speed(rows count),Read Speed(rows count),"
+                 "Write P50(us),Write P99(us),Read P50(us),Read P99(us),Write Amplification,Max RSS(MiB)"
+              << std::endl;
 }
 
 uint64_t average(const std::vector<uint64_t> & v)
@@ -195,28 +201,44 @@ void outputResult(Poco::Logger * log, const std::vector<Statistics> & stats, Wor
     }
 
     uint64_t max_init_ms = 0;
+    uint64_t max_rss_bytes = 0;
+    double write_amplification = 0;
     std::vector<uint64_t> write_per_seconds, read_per_seconds;
+    std::vector<uint64_t> write_p50s, write_p99s, read_p50s, read_p99s;
     for_each(stats.begin(), stats.end(), [&](const Statistics & stat) {
         max_init_ms = std::max(max_init_ms, stat.initMS());
+        max_rss_bytes = std::max(max_rss_bytes, stat.maxRSSBytes());
+        write_amplification += stat.writeAmplification() / stats.size();
         write_per_seconds.push_back(stat.writePerSecond());
         read_per_seconds.push_back(stat.readPerSecond());
+        write_p50s.push_back(stat.writeP50US());
+        write_p99s.push_back(stat.writeP99US());
+        read_p50s.push_back(stat.readP50US());
+        read_p99s.push_back(stat.readP99US());
     });
 
-    std::sort(write_per_seconds.begin(), write_per_seconds.end());
-    std::sort(read_per_seconds.begin(), read_per_seconds.end());
+    for (auto * v : {&write_per_seconds, &read_per_seconds, &write_p50s, &write_p99s, &read_p50s, &read_p99s})
+        std::sort(v->begin(), v->end());
 
     auto avg_write_per_second = average(write_per_seconds);
     auto avg_read_per_second = average(read_per_seconds);
 
-    // Date, Table Schema, Workload, Init Seconds, Write Speed(rows count), Read Speed(rows count)
+    // Date, Table Schema, Workload, Init Seconds, Write Speed(rows count), Read Speed(rows count),
+    // Write P50(us), Write P99(us), Read P50(us), Read P99(us), Write Amplification, Max RSS(MiB)
     auto s = fmt::format(
-        "{},{},{},{:.2f},{},{}",
+        "{},{},{},{:.2f},{},{},{},{},{},{},{:.2f},{}",
         localDate(),
         opts.table,
         opts.write_key_distribution,
         max_init_ms / 1000.0,
         avg_write_per_second,
-        avg_read_per_second);
+        avg_read_per_second,
+        average(write_p50s),
+        average(write_p99s),
+        average(read_p50s),
+        average(read_p99s),
+        write_amplification,
+        max_rss_bytes / 1024 / 1024);
     LOG_INFO(log, s);
     std::cout << s << std::endl;
 }
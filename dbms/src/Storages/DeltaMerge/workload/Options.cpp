@@ -25,6 +25,7 @@ std::string WorkloadOptions::toString(std::string seperator) const
 {
     return fmt::format("max_key_count {}{}", max_key_count, seperator) + //
         fmt::format("write_key_distribution {}{}", write_key_distribution, seperator) + //
+        fmt::format("zipf_theta {}{}", zipf_theta, seperator) + //
         fmt::format("write_count {}{}", write_count, seperator) + //
         fmt::format("write_thread_count {}{}", write_thread_count, seperator) + //
         fmt::format("table {}{}", table, seperator) + //
@@ -60,7 +61,8 @@ std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv
     desc.add_options() //
         ("help", "produce help message") //
         ("max_key_count", value<uint64_t>()->default_value(20000000), "Default is 2000w.") //
-        ("write_key_distribution", value<std::string>()->default_value("uniform"), "uniform/normal/incremental") //
+        ("write_key_distribution", value<std::string>()->default_value("uniform"), "uniform/normal/incremental/zipf") //
+        ("zipf_theta", value<double>()->default_value(0.99), "The skew of the zipf distribution, in (0, 1)") //
         ("write_count", value<uint64_t>()->default_value(5000000), "Default is 500w.") //
         ("write_thread_count", value<uint64_t>()->default_value(4), "") //
         ("max_write_per_sec", value<uint64_t>()->default_value(0), "") //
@@ -131,6 +133,11 @@ std::pair<bool, std::string> WorkloadOptions::parseOptions(int argc, char * argv
 
     max_key_count = vm["max_key_count"].as<uint64_t>();
     write_key_distribution = vm["write_key_distribution"].as<std::string>();
+    zipf_theta = vm["zipf_theta"].as<double>();
+    if (zipf_theta <= 0 || zipf_theta >= 1)
+    {
+        return {false, fmt::format("zipf_theta must be in (0, 1), but got {}", zipf_theta)};
+    }
     write_count = vm["write_count"].as<uint64_t>();
     write_thread_count = vm["write_thread_count"].as<uint64_t>();
     max_write_per_sec = vm["max_write_per_sec"].as<uint64_t>();
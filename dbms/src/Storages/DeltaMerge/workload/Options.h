@@ -25,6 +25,7 @@ struct WorkloadOptions
 {
     uint64_t max_key_count;
     std::string write_key_distribution;
+    double zipf_theta;
     uint64_t write_count;
     uint64_t write_thread_count;
 
@@ -130,7 +130,13 @@ static DM::WriteResult writeRegionDataToStorage(
             block_decoding_schema_epoch = decoding_schema_snapshot->decoding_schema_epoch;
 
             auto reader = RegionBlockReader(decoding_schema_snapshot);
-            if (!reader.read(*block_ptr, data_list_read, force_decode))
+            const auto & settings = context.getSettingsRef();
+            if (!reader.readParallel(
+                    *block_ptr,
+                    data_list_read,
+                    force_decode,
+                    settings.raft_decode_concurrency,
+                    settings.raft_decode_min_rows_per_thread))
                 return false;
             region_decode_cost = watch.elapsedMilliseconds();
             GET_METRIC(tiflash_raft_write_data_to_storage_duration_seconds, type_decode)
@@ -14,6 +14,8 @@
 
 #include <Columns/ColumnsNumber.h>
 #include <Common/Exception.h>
+#include <Common/ThreadManager.h>
+#include <Common/TiFlashMetrics.h>
 #include <Common/typeid_cast.h>
 #include <Core/Names.h>
 #include <Storages/ColumnsDescription.h>
@@ -105,6 +107,60 @@ bool RegionBlockReader::read(Block & block, const RegionDataReadInfoList & data_
     }
 }
 
+bool RegionBlockReader::readParallel(
+    Block & block,
+    const RegionDataReadInfoList & data_list,
+    bool force_decode,
+    size_t concurrency,
+    size_t min_rows_per_task)
+{
+    const size_t num_tasks = std::min(concurrency, data_list.size() / std::max<size_t>(min_rows_per_task, 1));
+    if (num_tasks <= 1)
+        return read(block, data_list, force_decode);
+    GET_METRIC(tiflash_raft_raft_events_count, type_parallel_decode).Increment();
+
+    // Every part is decoded into its own block by one worker, so the workers do not share any column.
+    const size_t rows_per_task = (data_list.size() + num_tasks - 1) / num_tasks;
+    std::vector<RegionDataReadInfoList> parts(num_tasks);
+    std::vector<Block> part_blocks(num_tasks);
+    std::vector<UInt8> part_results(num_tasks, false);
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        const size_t begin = std::min(i * rows_per_task, data_list.size());
+        const size_t end = std::min(begin + rows_per_task, data_list.size());
+        parts[i].assign(data_list.begin() + begin, data_list.begin() + end);
+        part_blocks[i] = block.cloneEmpty();
+    }
+
+    auto thread_manager = newThreadManager();
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        thread_manager->schedule(true, "RegionDecode", [&, i] {
+            part_results[i] = read(part_blocks[i], parts[i], force_decode);
+        });
+    }
+    thread_manager->wait();
+    for (auto result : part_results)
+    {
+        if (!result)
+            return false;
+    }
+
+    // Concatenate the parts in order after the rows already in `block`
+    MutableColumns columns(block.columns());
+    for (size_t pos = 0; pos < block.columns(); ++pos)
+    {
+        columns[pos] = (*std::move(block.getByPosition(pos).column)).mutate();
+        for (const auto & part_block : part_blocks)
+        {
+            const auto & part_column = *part_block.getByPosition(pos).column;
+            columns[pos]->insertRangeFrom(part_column, 0, part_column.size());
+        }
+    }
+    block.setColumns(std::move(columns));
+    return true;
+}
+
 template <TMTPKType pk_type>
 bool RegionBlockReader::readImpl(Block & block, const RegionDataReadInfoList & data_list, bool force_decode)
 {
@@ -169,6 +225,32 @@ bool RegionBlockReader::readImpl(Block & block, const RegionDataReadInfoList & d
         }
     }
 
+    // Resolve the columns once instead of looking them up for every row.
+    auto get_raw_column = [&block](size_t pos) {
+        return const_cast<IColumn *>(block.getByPosition(pos).column.get());
+    };
+    // The columns filled with default values for the deleted rows.
+    std::vector<IColumn *> raw_columns_for_delete;
+    if (need_decode_value)
+    {
+        auto column_ids_iter_copy = column_ids_iter;
+        auto next_column_pos_copy = next_column_pos;
+        while (column_ids_iter_copy != read_column_ids.end())
+        {
+            const auto & ci = schema_snapshot->column_infos[column_ids_iter_copy->second];
+            // when pk is handle, we can decode the pk from the key
+            if (!(schema_snapshot->pk_is_handle && ci.hasPriKeyFlag()))
+                raw_columns_for_delete.push_back(get_raw_column(next_column_pos_copy));
+            column_ids_iter_copy++;
+            next_column_pos_copy++;
+        }
+    }
+    IColumn * raw_extra_column = get_raw_column(extra_handle_column_pos);
+    std::vector<IColumn *> raw_pk_columns;
+    raw_pk_columns.reserve(pk_column_ids.size());
+    for (const auto & pk_column_id : pk_column_ids)
+        raw_pk_columns.push_back(get_raw_column(pk_pos_map.at(pk_column_id)));
+
     size_t index = 0;
     for (const auto & [pk, write_type, commit_ts, value_ptr] : data_list)
     {
@@ -180,21 +262,8 @@ bool RegionBlockReader::readImpl(Block & block, const RegionDataReadInfoList & d
         {
             if (write_type == Region::DelFlag)
             {
-                auto column_ids_iter_copy = column_ids_iter;
-                auto next_column_pos_copy = next_column_pos;
-                while (column_ids_iter_copy != read_column_ids.end())
-                {
-                    const auto & ci = schema_snapshot->column_infos[column_ids_iter_copy->second];
-                    // when pk is handle, we can decode the pk from the key
-                    if (!(schema_snapshot->pk_is_handle && ci.hasPriKeyFlag()))
-                    {
-                        auto * raw_column
-                            = const_cast<IColumn *>((block.getByPosition(next_column_pos_copy)).column.get());
-                        raw_column->insertDefault();
-                    }
-                    column_ids_iter_copy++;
-                    next_column_pos_copy++;
-                }
+                for (auto * raw_column : raw_columns_for_delete)
+                    raw_column->insertDefault();
             }
             else
             {
@@ -217,15 +286,12 @@ bool RegionBlockReader::readImpl(Block & block, const RegionDataReadInfoList & d
             // For non-common handle, extra handle column's type is always Int64.
             // We need to copy the handle value from encoded key.
             const auto handle_value = static_cast<Int64>(pk);
-            auto * raw_extra_column
-                = const_cast<IColumn *>((block.getByPosition(extra_handle_column_pos)).column.get());
             static_cast<ColumnInt64 *>(raw_extra_column)->getData().push_back(handle_value);
             // For pk_is_handle == true, we need to decode the handle value from encoded key, and insert
             // to the specify column
-            if (!pk_column_ids.empty())
+            if (!raw_pk_columns.empty())
             {
-                auto * raw_pk_column
-                    = const_cast<IColumn *>((block.getByPosition(pk_pos_map.at(pk_column_ids[0]))).column.get());
+                auto * raw_pk_column = raw_pk_columns[0];
                 if constexpr (pk_type == TMTPKType::INT64)
                     static_cast<ColumnInt64 *>(raw_pk_column)->getData().push_back(handle_value);
                 else if constexpr (pk_type == TMTPKType::UINT64)
@@ -257,8 +323,6 @@ bool RegionBlockReader::readImpl(Block & block, const RegionDataReadInfoList & d
         else
         {
             // For common handle, sometimes we need to decode the value from encoded key instead of encoded value
-            auto * raw_extra_column
-                = const_cast<IColumn *>((block.getByPosition(extra_handle_column_pos)).column.get());
             raw_extra_column->insertData(pk->data(), pk->size());
             /// decode key and insert pk columns if needed
             size_t cursor = 0, pos = 0;
@@ -269,8 +333,7 @@ bool RegionBlockReader::readImpl(Block & block, const RegionDataReadInfoList & d
                 /// some examples that we must decode column value from value part
                 ///   1) if collation is enabled, the extra key may be a transformation of the original value of pk cols
                 ///   2) the primary key may just be a prefix of a column
-                auto * raw_pk_column
-                    = const_cast<IColumn *>(block.getByPosition(pk_pos_map.at(pk_column_ids[pos])).column.get());
+                auto * raw_pk_column = raw_pk_columns[pos];
                 if (raw_pk_column->size() == index)
                 {
                     raw_pk_column->insert(value);
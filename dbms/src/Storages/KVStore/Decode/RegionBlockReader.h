@@ -37,6 +37,16 @@ public:
     /// which will use carefully adjusted 'force_decode' with appropriate error handling/retry to get what they want.
     bool read(Block & block, const RegionDataReadInfoList & data_list, bool force_decode);
 
+    /// Same as `read`, but split `data_list` into at most `concurrency` continuous parts and decode them
+    /// by multiple threads. The parts are appended to `block` in order, so the result is the same as `read`.
+    /// Fallback to `read` when there are less than `min_rows_per_task` rows for every part.
+    bool readParallel(
+        Block & block,
+        const RegionDataReadInfoList & data_list,
+        bool force_decode,
+        size_t concurrency,
+        size_t min_rows_per_task);
+
 private:
     template <TMTPKType pk_type>
     bool readImpl(Block & block, const RegionDataReadInfoList & data_list, bool force_decode);
@@ -84,11 +84,7 @@ void KVStore::restore(PathPool & path_pool, const TiFlashRaftProxyHelper * proxy
     LOG_INFO(log, "Restored {} regions", manage_lock.regions.size());
 
     // init range index
-    for (const auto & [id, region] : manage_lock.regions)
-    {
-        std::ignore = id;
-        manage_lock.index.add(region);
-    }
+    manage_lock.index.build(manage_lock.regions);
 
     {
         const size_t batch = 512;
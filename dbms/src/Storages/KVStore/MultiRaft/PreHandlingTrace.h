@@ -58,6 +58,10 @@ struct PreHandlingTrace : MutexLockWrap
     std::atomic<uint64_t> ongoing_prehandle_subtask_count{0};
     std::mutex cpu_resource_mut;
     std::condition_variable cpu_resource_cv;
+    // The waiters of subtask resources are served in FIFO order, so that a snapshot which requires many subtasks
+    // won't be starved by the following snapshots which require less. Protected by `cpu_resource_mut`.
+    uint64_t next_wait_ticket = 0;
+    uint64_t serving_wait_ticket = 0;
     LoggerPtr log;
 
     PreHandlingTrace()
@@ -36,6 +36,7 @@
 namespace CurrentMetrics
 {
 extern const Metric RaftNumPrehandlingSubTasks;
+extern const Metric RaftNumWaitingPrehandleSubTasks;
 extern const Metric RaftNumParallelPrehandlingTasks;
 } // namespace CurrentMetrics
 
@@ -65,41 +66,44 @@ struct ReadFromStreamResult
 
 void PreHandlingTrace::waitForSubtaskResources(uint64_t region_id, size_t parallel, size_t parallel_subtask_limit)
 {
-    {
+    // Admit the subtasks anyway if there is no ongoing subtask, otherwise a snapshot requires more subtasks
+    // than the limit would wait forever.
+    auto can_acquire = [&]() {
         auto current = ongoing_prehandle_subtask_count.load();
-        if (current + parallel <= parallel_subtask_limit
-            && ongoing_prehandle_subtask_count.compare_exchange_weak(current, current + parallel))
-        {
-            LOG_DEBUG(
-                log,
-                "Prehandle resource meet, limit={}, current={}, region_id={}",
-                parallel_subtask_limit,
-                ongoing_prehandle_subtask_count.load(),
-                region_id);
-            return;
-        }
+        return current == 0 || current + parallel <= parallel_subtask_limit;
+    };
+
+    std::unique_lock<std::mutex> cpu_resource_lock{cpu_resource_mut};
+    if (next_wait_ticket == serving_wait_ticket && can_acquire())
+    {
+        ongoing_prehandle_subtask_count.fetch_add(parallel);
+        LOG_DEBUG(
+            log,
+            "Prehandle resource meet, limit={}, current={}, region_id={}",
+            parallel_subtask_limit,
+            ongoing_prehandle_subtask_count.load(),
+            region_id);
+        return;
     }
+
     Stopwatch watch;
+    const auto ticket = next_wait_ticket++;
     LOG_DEBUG(
         log,
-        "Prehandle resource wait begin, limit={} current={} parallel={} region_id={}",
+        "Prehandle resource wait begin, limit={} current={} parallel={} waiting={} region_id={}",
         parallel_subtask_limit,
         ongoing_prehandle_subtask_count.load(),
         parallel,
+        ticket - serving_wait_ticket,
         region_id);
-    while (true)
-    {
-        std::unique_lock<std::mutex> cpu_resource_lock{cpu_resource_mut};
-        cpu_resource_cv.wait(cpu_resource_lock, [&]() {
-            return ongoing_prehandle_subtask_count.load() + parallel <= parallel_subtask_limit;
-        });
-        auto current = ongoing_prehandle_subtask_count.load();
-        if (current + parallel <= parallel_subtask_limit
-            && ongoing_prehandle_subtask_count.compare_exchange_weak(current, current + parallel))
-        {
-            break;
-        }
-    }
+    CurrentMetrics::add(CurrentMetrics::RaftNumWaitingPrehandleSubTasks, parallel);
+    cpu_resource_cv.wait(cpu_resource_lock, [&]() { return serving_wait_ticket == ticket && can_acquire(); });
+    CurrentMetrics::sub(CurrentMetrics::RaftNumWaitingPrehandleSubTasks, parallel);
+    ongoing_prehandle_subtask_count.fetch_add(parallel);
+    ++serving_wait_ticket;
+    // Wake up the next waiter, which may be able to acquire the left resources.
+    cpu_resource_cv.notify_all();
+
     GET_METRIC(tiflash_raft_command_duration_seconds, type_apply_snapshot_predecode_parallel_wait)
         .Observe(watch.elapsedSeconds());
     LOG_INFO(
@@ -299,11 +303,10 @@ static inline std::pair<std::vector<std::string>, size_t> getSplitKey(
     LoggerPtr log,
     KVStore * kvstore,
     RegionPtr new_region,
-    std::shared_ptr<DM::SSTFilesToBlockInputStream> sst_stream)
+    std::shared_ptr<DM::SSTFilesToBlockInputStream> sst_stream,
+    size_t parallel_prehandle_threshold)
 {
     // We don't use this is the single snapshot is small, due to overhead in decoding.
-    constexpr size_t default_parallel_prehandle_threshold = 1 * 1024 * 1024 * 1024;
-    size_t parallel_prehandle_threshold = default_parallel_prehandle_threshold;
     fiu_do_on(FailPoints::force_set_parallel_prehandle_threshold, {
         if (auto v = FailPointHelper::getFailPointVal(FailPoints::force_set_parallel_prehandle_threshold); v)
             parallel_prehandle_threshold = std::any_cast<size_t>(v.value());
@@ -703,7 +706,12 @@ PrehandleResult KVStore::preHandleSSTsToDTFiles(
                 DM::SSTFilesToBlockInputStreamOpts(opt));
 
             // `split_keys` do not begin with 'z'.
-            auto [split_keys, approx_bytes] = getSplitKey(log, this, new_region, sst_stream);
+            auto [split_keys, approx_bytes] = getSplitKey(
+                log,
+                this,
+                new_region,
+                sst_stream,
+                context.getSettingsRef().raft_snapshot_parallel_prehandle_threshold);
             prehandling_trace.waitForSubtaskResources(region_id, split_keys.size() + 1, getMaxParallelPrehandleSize());
             ReadFromStreamResult result;
             if (split_keys.empty())
@@ -817,6 +825,19 @@ PrehandleResult KVStore::preHandleSSTsToDTFiles(
         }
     } // while
 
+    const auto elapsed_seconds = watch.elapsedSeconds();
+    LOG_INFO(
+        log,
+        "Finished prehandling snapshot, parallels={} total_keys={} raft_snapshot_bytes={} dmfiles={} "
+        "dt_total_bytes={} cost={:.3f}s throughput={:.2f}MB/s region_id={}",
+        prehandle_result.stats.parallels,
+        prehandle_result.stats.total_keys,
+        prehandle_result.stats.raft_snapshot_bytes,
+        prehandle_result.ingest_ids.size(),
+        prehandle_result.stats.dt_total_bytes,
+        elapsed_seconds,
+        elapsed_seconds > 0 ? prehandle_result.stats.raft_snapshot_bytes / elapsed_seconds / 1024 / 1024 : 0.0,
+        region_id);
     return prehandle_result;
 }
 
@@ -49,6 +49,18 @@ void RegionData::reportDelta(size_t prev, size_t current)
 }
 
 size_t RegionData::insert(ColumnFamilyType cf, TiKVKey && key, TiKVValue && value, DupCheck mode)
+{
+    if (!persist_delta.isTracking())
+        return doInsert(cf, std::move(key), std::move(value), mode);
+
+    auto persist_key = TiKVKey::copyFrom(key);
+    auto persist_value = TiKVValue::copyFrom(value);
+    auto delta = doInsert(cf, std::move(key), std::move(value), mode);
+    persist_delta.recordInsert(cf, std::move(persist_key), std::move(persist_value), mode);
+    return delta;
+}
+
+size_t RegionData::doInsert(ColumnFamilyType cf, TiKVKey && key, TiKVValue && value, DupCheck mode)
 {
     switch (cf)
     {
@@ -88,6 +100,7 @@ void RegionData::remove(ColumnFamilyType cf, const TiKVKey & key)
         auto delta = write_cf.remove(RegionWriteCFData::Key{pk, ts}, true);
         cf_data_size -= delta;
         reportDealloc(delta);
+        persist_delta.recordRemove(cf, key);
         return;
     }
     case ColumnFamilyType::Default:
@@ -99,17 +112,26 @@ void RegionData::remove(ColumnFamilyType cf, const TiKVKey & key)
         auto delta = default_cf.remove(RegionDefaultCFData::Key{pk, ts}, true);
         cf_data_size -= delta;
         reportDealloc(delta);
+        persist_delta.recordRemove(cf, key);
         return;
     }
     case ColumnFamilyType::Lock:
     {
         lock_cf.remove(RegionLockCFDataTrait::Key{nullptr, std::string_view(key.data(), key.dataSize())}, true);
+        persist_delta.recordRemove(cf, key);
         return;
     }
     }
 }
 
 RegionData::WriteCFIter RegionData::removeDataByWriteIt(const WriteCFIter & write_it)
+{
+    if (persist_delta.isTracking())
+        persist_delta.recordRemoveByWrite(RegionWriteCFData::getTiKVKey(write_it->second));
+    return doRemoveDataByWriteIt(write_it);
+}
+
+RegionData::WriteCFIter RegionData::doRemoveDataByWriteIt(const WriteCFIter & write_it)
 {
     const auto & [key, value, decoded_val] = write_it->second;
     const auto & [pk, ts] = write_it->first;
@@ -264,6 +286,9 @@ DecodedLockCFValuePtr RegionData::getLockInfo(const RegionLockReadQuery & query)
 
 void RegionData::splitInto(const RegionRange & range, RegionData & new_region_data)
 {
+    // The region should be fully persisted after the data is moved in bulk.
+    persist_delta.clear();
+    new_region_data.persist_delta.clear();
     size_t size_changed = 0;
     size_changed += default_cf.splitInto(range, new_region_data.default_cf);
     size_changed += write_cf.splitInto(range, new_region_data.write_cf);
@@ -275,6 +300,7 @@ void RegionData::splitInto(const RegionRange & range, RegionData & new_region_da
 
 void RegionData::mergeFrom(const RegionData & ori_region_data)
 {
+    persist_delta.clear();
     size_t size_changed = 0;
     size_changed += default_cf.mergeFrom(ori_region_data.default_cf);
     size_changed += write_cf.mergeFrom(ori_region_data.write_cf);
@@ -294,6 +320,7 @@ void RegionData::assignRegionData(RegionData && new_region_data)
     write_cf = std::move(new_region_data.write_cf);
     lock_cf = std::move(new_region_data.lock_cf);
     orphan_keys_info = std::move(new_region_data.orphan_keys_info);
+    persist_delta.clear();
 
     cf_data_size = new_region_data.cf_data_size.load();
 }
@@ -359,11 +386,154 @@ RegionData & RegionData::operator=(RegionData && rhs)
     write_cf = std::move(rhs.write_cf);
     default_cf = std::move(rhs.default_cf);
     lock_cf = std::move(rhs.lock_cf);
+    persist_delta.clear();
     reportDelta(cf_data_size, rhs.cf_data_size.load());
     cf_data_size = rhs.cf_data_size.load();
     return *this;
 }
 
+RegionData::PersistDelta::~PersistDelta()
+{
+    reportDealloc(bytes);
+}
+
+void RegionData::PersistDelta::reset(UInt64 base_applied_index_, size_t limit_bytes_)
+{
+    changes.clear();
+    reportDealloc(bytes);
+    bytes = 0;
+    base_applied_index = base_applied_index_;
+    limit_bytes = limit_bytes_;
+    tracking = true;
+    base_persisted = false;
+}
+
+void RegionData::PersistDelta::clear()
+{
+    changes = {};
+    reportDealloc(bytes);
+    bytes = 0;
+    tracking = false;
+    base_persisted = false;
+}
+
+void RegionData::PersistDelta::onBasePersisted(UInt64 persisted_applied_index)
+{
+    if (tracking && base_applied_index == persisted_applied_index)
+        base_persisted = true;
+}
+
+void RegionData::PersistDelta::recordInsert(
+    ColumnFamilyType cf,
+    TiKVKey && key,
+    TiKVValue && value,
+    DupCheck mode)
+{
+    record(Change{
+        .type = ChangeType::Insert,
+        .cf = cf,
+        .mode = mode,
+        .key = std::move(key),
+        .value = std::move(value),
+    });
+}
+
+void RegionData::PersistDelta::recordRemove(ColumnFamilyType cf, const TiKVKey & key)
+{
+    if (!tracking)
+        return;
+    record(Change{
+        .type = ChangeType::Remove,
+        .cf = cf,
+        .mode = DupCheck::Deny,
+        .key = TiKVKey::copyFrom(key),
+        .value = {},
+    });
+}
+
+void RegionData::PersistDelta::recordRemoveByWrite(const TiKVKey & write_key)
+{
+    if (!tracking)
+        return;
+    record(Change{
+        .type = ChangeType::RemoveByWrite,
+        .cf = ColumnFamilyType::Write,
+        .mode = DupCheck::Deny,
+        .key = TiKVKey::copyFrom(write_key),
+        .value = {},
+    });
+}
+
+void RegionData::PersistDelta::record(Change && change)
+{
+    if (!tracking)
+        return;
+    const size_t change_bytes = change.key.dataSize() + change.value.dataSize();
+    if (bytes + change_bytes > limit_bytes)
+    {
+        // Persisting the whole region is cheaper now.
+        clear();
+        return;
+    }
+    changes.emplace_back(std::move(change));
+    bytes += change_bytes;
+    reportAlloc(change_bytes);
+}
+
+size_t RegionData::PersistDelta::serialize(WriteBuffer & buf) const
+{
+    size_t total_size = writeBinary2(static_cast<UInt64>(changes.size()), buf);
+    for (const auto & change : changes)
+    {
+        total_size += writeBinary2(static_cast<UInt8>(change.type), buf);
+        total_size += writeBinary2(static_cast<UInt8>(change.cf), buf);
+        total_size += writeBinary2(static_cast<UInt8>(change.mode), buf);
+        total_size += change.key.serialize(buf);
+        if (change.type == ChangeType::Insert)
+            total_size += change.value.serialize(buf);
+    }
+    return total_size;
+}
+
+void RegionData::PersistDelta::apply(ReadBuffer & buf, RegionData & region_data)
+{
+    const auto count = readBinary2<UInt64>(buf);
+    for (UInt64 i = 0; i < count; ++i)
+    {
+        const auto type = static_cast<ChangeType>(readBinary2<UInt8>(buf));
+        const auto cf = static_cast<ColumnFamilyType>(readBinary2<UInt8>(buf));
+        const auto mode = static_cast<DupCheck>(readBinary2<UInt8>(buf));
+        auto key = TiKVKey::deserialize(buf);
+        switch (type)
+        {
+        case ChangeType::Insert:
+        {
+            auto value = TiKVValue::deserialize(buf);
+            region_data.doInsert(cf, std::move(key), std::move(value), mode);
+            break;
+        }
+        case ChangeType::Remove:
+            region_data.remove(cf, key);
+            break;
+        case ChangeType::RemoveByWrite:
+        {
+            auto raw_key = RecordKVFormat::decodeTiKVKey(key);
+            auto pk = RecordKVFormat::getRawTiDBPK(raw_key);
+            Timestamp ts = RecordKVFormat::getTs(key);
+            auto & write_map = region_data.write_cf.getDataMut();
+            if (auto it = write_map.find(RegionWriteCFData::Key{pk, ts}); it != write_map.end())
+                region_data.doRemoveDataByWriteIt(it);
+            break;
+        }
+        default:
+            throw Exception(
+                ErrorCodes::LOGICAL_ERROR,
+                "Unknown change type of region persist delta, type={}",
+                static_cast<UInt8>(type));
+        }
+    }
+}
+
 void RegionData::OrphanKeysInfo::observeExtraKey(TiKVKey && key)
 {
     remained_keys.insert(std::move(key));
@@ -82,6 +82,63 @@ public:
     RegionData(RegionData && data);
     RegionData & operator=(RegionData &&);
 
+    // The changes of data since the last full persistence of the region. Persisting them instead of the
+    // whole region saves lots of writes for the regions with large uncommitted data in lock/default cf.
+    class PersistDelta
+    {
+    public:
+        PersistDelta() = default;
+        PersistDelta(const PersistDelta &) = delete;
+        PersistDelta & operator=(const PersistDelta &) = delete;
+        ~PersistDelta();
+
+        // Start to track the changes after the full persistence at `base_applied_index_`.
+        // Stop tracking once the changes take more than `limit_bytes_`.
+        void reset(UInt64 base_applied_index_, size_t limit_bytes_);
+        void clear();
+
+        void onBasePersisted(UInt64 persisted_applied_index);
+
+        bool isTracking() const { return tracking; }
+        // Whether the changes can be persisted instead of the whole region.
+        bool isReady() const { return tracking && base_persisted; }
+        UInt64 baseAppliedIndex() const { return base_applied_index; }
+
+        void recordInsert(ColumnFamilyType cf, TiKVKey && key, TiKVValue && value, DupCheck mode);
+        void recordRemove(ColumnFamilyType cf, const TiKVKey & key);
+        void recordRemoveByWrite(const TiKVKey & write_key);
+
+        size_t serialize(WriteBuffer & buf) const;
+        // Replay the serialized changes on `region_data`, which must be the data of the full persistence.
+        static void apply(ReadBuffer & buf, RegionData & region_data);
+
+    private:
+        enum class ChangeType : UInt8
+        {
+            Insert = 1,
+            Remove = 2,
+            RemoveByWrite = 3,
+        };
+        struct Change
+        {
+            ChangeType type;
+            ColumnFamilyType cf;
+            DupCheck mode;
+            TiKVKey key;
+            TiKVValue value;
+        };
+
+        void record(Change && change);
+
+        std::vector<Change> changes;
+        UInt64 base_applied_index = 0;
+        // Bytes of the keys and values in `changes`, which are reported to the kvstore memory tracker.
+        size_t bytes = 0;
+        size_t limit_bytes = 0;
+        bool tracking = false;
+        bool base_persisted = false;
+    };
+
     struct OrphanKeysInfo
     {
         // Protected by region task lock.
@@ -117,11 +174,17 @@ public:
 private:
     friend class Region;
 
+    size_t doInsert(ColumnFamilyType cf, TiKVKey && key, TiKVValue && value, DupCheck mode);
+    WriteCFIter doRemoveDataByWriteIt(const WriteCFIter & write_it);
+
 private:
     RegionWriteCFData write_cf;
     RegionDefaultCFData default_cf;
     RegionLockCFData lock_cf;
     OrphanKeysInfo orphan_keys_info;
+    // Recorded by the writers holding the unique lock of the region. It is reset by the persisting thread
+    // holding the shared lock, which is exclusive with the writers and serialized by the region task lock.
+    mutable PersistDelta persist_delta;
 
     // Size of data cf & write cf, without lock cf.
     std::atomic<size_t> cf_data_size = 0;
@@ -28,6 +28,7 @@
 #include <Storages/Page/WriteBatchImpl.h>
 #include <Storages/Page/WriteBatchWrapperImpl.h>
 #include <Storages/PathPool.h>
+#include <common/ThreadPool.h>
 #include <common/logger_useful.h>
 #include <fiu.h>
 
@@ -35,6 +36,7 @@
 #include <magic_enum.hpp>
 #include <memory>
 #include <thread>
+#include <unordered_set>
 
 namespace CurrentMetrics
 {
@@ -57,6 +59,8 @@ void RegionPersister::drop(RegionID region_id, const RegionTaskLock &)
 {
     DB::WriteBatchWrapper wb{run_mode, getWriteBatchPrefix()};
     wb.delPage(region_id);
+    if (page_reader->getPageEntry(toDeltaPageId(region_id)).isValid())
+        wb.delPage(toDeltaPageId(region_id));
     page_writer->write(std::move(wb), global_context.getWriteLimiter());
 }
 
@@ -88,21 +92,39 @@ void RegionPersister::persist(const Region & region, const RegionTaskLock & lock
 {
     // Support only one thread persist.
     RegionCacheWriteElement region_buffer;
-    computeRegionWriteBuffer(region, region_buffer);
+    auto & [region_id, buffer, region_size, applied_index] = region_buffer;
+    region_id = region.id();
+    bool is_delta = false;
+    std::tie(region_size, applied_index, is_delta)
+        = region.serializeForPersist(buffer, global_context.getSettingsRef().kvstore_persist_delta_ratio);
+    if (unlikely(region_size > static_cast<size_t>(std::numeric_limits<UInt32>::max())))
+    {
+        LOG_WARNING(
+            log,
+            "Persisting big region={} with data info: {}, serialized_size={} is_delta={}",
+            region.toString(true),
+            region.dataInfo(),
+            region_size,
+            is_delta);
+    }
 
-    doPersist(region_buffer, lock, region);
+    doPersist(region_buffer, lock, region, is_delta);
 }
 
 void RegionPersister::doPersist(
     RegionCacheWriteElement & region_write_buffer,
     const RegionTaskLock & region_task_lock,
-    const Region & region)
+    const Region & region,
+    bool is_delta)
 {
     auto & [region_id, buffer, region_size, applied_index] = region_write_buffer;
 
     auto entry = page_reader->getPageEntry(region_id);
     if (entry.isValid() && entry.tag > applied_index)
         return;
+    auto delta_entry = page_reader->getPageEntry(toDeltaPageId(region_id));
+    if (delta_entry.isValid() && delta_entry.tag > applied_index)
+        return;
 
     if (region.isPendingRemove())
     {
@@ -113,7 +135,17 @@ void RegionPersister::doPersist(
     auto read_buf = buffer.tryGetReadBuffer();
     RUNTIME_CHECK_MSG(read_buf != nullptr, "failed to gen buffer for {}", region.toString(true));
     DB::WriteBatchWrapper wb{run_mode, getWriteBatchPrefix()};
-    wb.putPage(region_id, applied_index, read_buf, region_size);
+    if (is_delta)
+    {
+        wb.putPage(toDeltaPageId(region_id), applied_index, read_buf, region_size);
+    }
+    else
+    {
+        wb.putPage(region_id, applied_index, read_buf, region_size);
+        // The changes in the delta page are included in the new full persistence.
+        if (delta_entry.isValid())
+            wb.delPage(toDeltaPageId(region_id));
+    }
     page_writer->write(std::move(wb), global_context.getWriteLimiter());
 
 #ifdef FIU_ENABLE
@@ -139,6 +171,7 @@ void RegionPersister::doPersist(
     });
 #endif
 
+    region.onPersisted(applied_index, is_delta);
     region.updateLastCompactLogApplied(region_task_lock);
 }
 
@@ -240,6 +273,8 @@ RegionMap RegionPersister::restore(
         case PageStorageRunMode::ONLY_V3:
         {
             mergeConfigFromSettings(global_context.getSettingsRef(), config);
+            config.blob_compression_method = global_context.getSettingsRef().kvstore_page_compression_method;
+            config.blob_page_cache_size = global_context.getSettingsRef().kvstore_page_cache_size;
 
             auto page_storage_v3 = std::make_shared<PS::V3::PageStorageImpl>( //
                 "RegionPersister",
@@ -381,27 +416,93 @@ RegionMap RegionPersister::restore(
         LOG_INFO(log, "RegionPersister running. Current Run Mode is {}", magic_enum::enum_name(run_mode));
     }
 
+    // Deserializing the regions takes most of the time of restoring when there are lots of regions.
+    // Collect the pages into batches and deserialize each batch concurrently.
+    const size_t concurrency = std::max<size_t>(1, global_context.getSettingsRef().kvstore_restore_concurrency);
+    static constexpr size_t batch_size = 4096;
+
     RegionMap regions;
+    std::unordered_map<RegionID, DB::Page> delta_pages;
+    std::unordered_set<PageIdU64> restored_page_ids;
+    std::vector<DB::Page> pending_pages;
+    std::vector<RegionPtr> pending_regions;
+    pending_pages.reserve(batch_size);
+    std::unique_ptr<legacy::ThreadPool> restore_pool;
+    if (concurrency > 1)
+        restore_pool = std::make_unique<legacy::ThreadPool>(concurrency);
+
+    auto deserialize_pages = [&]() {
+        pending_regions.resize(pending_pages.size());
+        auto deserialize = [&](size_t begin, size_t step) {
+            for (size_t i = begin; i < pending_pages.size(); i += step)
+            {
+                const auto & page = pending_pages[i];
+                ReadBufferFromMemory buf(page.data.begin(), page.data.size());
+                pending_regions[i] = Region::deserialize(buf, proxy_helper);
+            }
+        };
+        if (restore_pool && pending_pages.size() > 1)
+        {
+            const size_t num_tasks = std::min(concurrency, pending_pages.size());
+            for (size_t task_idx = 0; task_idx < num_tasks; ++task_idx)
+                restore_pool->schedule([&, task_idx] { deserialize(task_idx, num_tasks); });
+            // Rethrow the first exception thrown by the tasks
+            restore_pool->wait();
+        }
+        else
+        {
+            deserialize(0, 1);
+        }
+
+        for (size_t i = 0; i < pending_pages.size(); ++i)
+        {
+            const auto page_id = pending_pages[i].page_id;
+            auto & region = pending_regions[i];
+            RUNTIME_CHECK_MSG(
+                page_id == region->id(),
+                "region_id and page_id not match! region_id={} page_id={}",
+                region->id(),
+                page_id);
+            regions.emplace(page_id, std::move(region));
+        }
+        pending_pages.clear();
+        pending_regions.clear();
+    };
+
     auto acceptor = [&](const DB::Page & page) {
         // We will traverse the pages in V3 before traverse the pages in V2 When we used MIX MODE
         // If we found the page_id has been restored, just skip it.
-        if (const auto it = regions.find(page.page_id); it != regions.end())
+        if (!restored_page_ids.emplace(page.page_id).second)
         {
             LOG_INFO(log, "Already exist [page_id={}], skip it.", page.page_id);
             return;
         }
+        if (isDeltaPageId(page.page_id))
+        {
+            delta_pages.emplace(page.page_id & ~DELTA_PAGE_ID_FLAG, page);
+            return;
+        }
 
-        ReadBufferFromMemory buf(page.data.begin(), page.data.size());
-        auto region = Region::deserialize(buf, proxy_helper);
-        RUNTIME_CHECK_MSG(
-            page.page_id == region->id(),
-            "region_id and page_id not match! region_id={} page_id={}",
-            region->id(),
-            page.page_id);
-
-        regions.emplace(page.page_id, region);
+        pending_pages.emplace_back(page);
+        if (pending_pages.size() >= batch_size)
+            deserialize_pages();
     };
     page_reader->traverse(acceptor);
+    deserialize_pages();
+
+    for (auto & [region_id, page] : delta_pages)
+    {
+        auto it = regions.find(region_id);
+        if (it == regions.end())
+        {
+            LOG_WARNING(log, "The region of the delta page is not found, skip it, region_id={}", region_id);
+            continue;
+        }
+        ReadBufferFromMemory buf(page.data.begin(), page.data.size());
+        it->second = Region::applyPersistDelta(std::move(it->second), buf, proxy_helper);
+    }
+    if (!delta_pages.empty())
+        LOG_INFO(log, "Applied {} delta pages of regions", delta_pages.size());
 
     return regions;
 }
@@ -409,6 +510,7 @@ RegionMap RegionPersister::restore(
 bool RegionPersister::gc()
 {
     PageStorageConfig config = getConfigFromSettings(global_context.getSettingsRef());
+    config.blob_compression_method = global_context.getSettingsRef().kvstore_page_compression_method;
     page_writer->reloadSettings(config);
     return page_writer->gc(false, nullptr, nullptr);
 }
@@ -58,7 +58,17 @@ public:
 private:
     void forceTransformKVStoreV2toV3();
 
-    void doPersist(RegionCacheWriteElement & region_write_buffer, const RegionTaskLock & lock, const Region & region);
+    void doPersist(
+        RegionCacheWriteElement & region_write_buffer,
+        const RegionTaskLock & lock,
+        const Region & region,
+        bool is_delta);
+
+    // The changes of a region since its last full persistence are stored in a separate page.
+    // The region ids allocated by PD never reach the flag.
+    static constexpr PageIdU64 DELTA_PAGE_ID_FLAG = 1ULL << 63;
+    static PageIdU64 toDeltaPageId(RegionID region_id) { return region_id | DELTA_PAGE_ID_FLAG; }
+    static bool isDeltaPageId(PageIdU64 page_id) { return (page_id & DELTA_PAGE_ID_FLAG) != 0; }
 
     inline std::variant<String, NamespaceID> getWriteBatchPrefix() const
     {
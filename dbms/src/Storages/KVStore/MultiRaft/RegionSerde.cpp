@@ -62,9 +62,17 @@ std::tuple<size_t, UInt64> Region::serializeImpl(
     std::function<size_t(UInt32 &, WriteBuffer &)> extra_handler,
     WriteBuffer & buf) const
 {
-    size_t total_size = writeBinary2(binary_version, buf);
-
     std::shared_lock<std::shared_mutex> lock(mutex);
+    return serializeWithoutLock(binary_version, expected_extension_count, extra_handler, buf);
+}
+
+std::tuple<size_t, UInt64> Region::serializeWithoutLock(
+    UInt32 binary_version,
+    UInt32 expected_extension_count,
+    const std::function<size_t(UInt32 &, WriteBuffer &)> & extra_handler,
+    WriteBuffer & buf) const
+{
+    size_t total_size = writeBinary2(binary_version, buf);
 
     // Serialize meta
     const auto [meta_size, applied_index] = meta.serialize(buf);
@@ -90,6 +98,74 @@ std::tuple<size_t, UInt64> Region::serializeImpl(
     return {total_size, applied_index};
 }
 
+/// The format of the changes since the last full persistence
+/// |- 32b delta version -|- 64b base applied index -|- meta -|- 64b eager gc -|- changes -|
+std::tuple<size_t, UInt64, bool> Region::serializeForPersist(WriteBuffer & buf, double delta_ratio) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex);
+
+    if (data.persist_delta.isReady())
+    {
+        size_t total_size = writeBinary2(RegionPersistFormat::CURRENT_DELTA_VERSION, buf);
+        total_size += writeBinary2(data.persist_delta.baseAppliedIndex(), buf);
+        const auto [meta_size, applied_index] = meta.serialize(buf);
+        total_size += meta_size;
+        static_assert(sizeof(eager_truncated_index) == sizeof(UInt64));
+        total_size += writeBinary2(eager_truncated_index, buf);
+        total_size += data.persist_delta.serialize(buf);
+        return {total_size, applied_index, true};
+    }
+
+    const auto [total_size, applied_index] = serializeWithoutLock(
+        Region::CURRENT_VERSION,
+        0,
+        [](UInt32 &, WriteBuffer &) { return 0; },
+        buf);
+    if (delta_ratio > 0)
+        data.persist_delta.reset(applied_index, static_cast<size_t>(total_size * delta_ratio));
+    else
+        data.persist_delta.clear();
+    return {total_size, applied_index, false};
+}
+
+void Region::onPersisted(UInt64 applied_index, bool is_delta) const
+{
+    if (is_delta)
+        return;
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    data.persist_delta.onBasePersisted(applied_index);
+}
+
+RegionPtr Region::applyPersistDelta(RegionPtr && base, ReadBuffer & buf, const TiFlashRaftProxyHelper * proxy_helper)
+{
+    const auto delta_version = readBinary2<UInt32>(buf);
+    RUNTIME_CHECK_MSG(
+        delta_version == RegionPersistFormat::CURRENT_DELTA_VERSION,
+        "Unknown delta version of region persistence, region_id={} version={}",
+        base->id(),
+        delta_version);
+    const auto base_applied_index = readBinary2<UInt64>(buf);
+    RUNTIME_CHECK_MSG(
+        base_applied_index == base->appliedIndex(),
+        "The delta of region persistence does not match the base, region_id={} base_applied_index={} "
+        "delta_base_applied_index={}",
+        base->id(),
+        base->appliedIndex(),
+        base_applied_index);
+
+    RegionPtr region = std::make_shared<Region>(RegionMeta::deserialize(buf), proxy_helper);
+    region->eager_truncated_index = readBinary2<UInt64>(buf);
+
+    // The memory of the data has been reported when deserializing the base.
+    region->data.assignRegionData(std::move(base->data));
+    base->data.cf_data_size = 0;
+    RegionData::PersistDelta::apply(buf, region->data);
+
+    region->last_restart_log_applied = region->appliedIndex();
+    region->setLastCompactLogApplied(region->appliedIndex());
+    return region;
+}
+
 RegionPtr Region::deserialize(ReadBuffer & buf, const TiFlashRaftProxyHelper * proxy_helper)
 {
     return Region::deserializeImpl(
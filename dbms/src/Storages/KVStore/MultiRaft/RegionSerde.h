@@ -27,6 +27,8 @@ namespace RegionPersistFormat
 {
 static constexpr UInt32 HAS_EAGER_TRUNCATE_INDEX = 0x01;
 // The upper bits are used to store length of extensions. DO NOT USE!
+// The version of the changes since the last full persistence, which are stored in a separate page.
+static constexpr UInt32 CURRENT_DELTA_VERSION = 1;
 } // namespace RegionPersistFormat
 
 // The RegionPersistExtension has nothing to do with `version`.
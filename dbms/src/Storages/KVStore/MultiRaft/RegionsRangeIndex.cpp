@@ -37,6 +37,46 @@ void RegionsRangeIndex::add(const RegionPtr & new_region)
         it->second.region_map.emplace(new_region->id(), new_region);
 }
 
+void RegionsRangeIndex::build(const RegionMap & regions)
+{
+    RUNTIME_CHECK_MSG(
+        root.size() == 2 && min_it->second.region_map.empty() && max_it->second.region_map.empty(),
+        "Can only build on an empty index");
+
+    std::vector<std::pair<RegionPtr, ImutRegionRangePtr>> ranges;
+    ranges.reserve(regions.size());
+    std::vector<const TiKVRangeKey *> keys;
+    keys.reserve(regions.size() * 2);
+    for (const auto & [region_id, region] : regions)
+    {
+        auto range = region->getRange();
+        keys.push_back(&range->comparableKeys().first);
+        keys.push_back(&range->comparableKeys().second);
+        ranges.emplace_back(region, std::move(range));
+    }
+
+    // Insert the keys in order so that every insertion takes amortized constant time.
+    std::sort(keys.begin(), keys.end(), [](const TiKVRangeKey * x, const TiKVRangeKey * y) {
+        return x->compare(*y) < 0;
+    });
+    auto hint = std::next(root.begin());
+    for (const auto * key : keys)
+        hint = std::next(root.emplace_hint(hint, key->copy(), IndexNode{}));
+
+    for (const auto & [region, range] : ranges)
+    {
+        const auto & range_keys = range->comparableKeys();
+        auto begin_it = root.find(range_keys.first);
+        auto end_it = root.find(range_keys.second);
+        if (begin_it == end_it)
+            throw Exception(
+                std::string(__PRETTY_FUNCTION__) + ": range of region_id=" + toString(region->id()) + " is empty",
+                ErrorCodes::LOGICAL_ERROR);
+        for (auto it = begin_it; it != end_it; ++it)
+            it->second.region_map.emplace(region->id(), region);
+    }
+}
+
 void RegionsRangeIndex::remove(const RegionRange & range, RegionID region_id)
 {
     auto begin_it = root.find(range.first);
@@ -37,6 +37,9 @@ struct LearnerReadStatistics
     UInt64 num_read_index_request = 0;
     UInt64 num_cached_read_index = 0;
     UInt64 num_stale_read = 0;
+
+    // The number of regions which have reached their read index before waiting
+    UInt64 num_ready_before_wait = 0;
 };
 
 // Container of all unavailable regions info.
@@ -126,6 +129,10 @@ private:
         Stopwatch & watch);
 
     /// wait index relate methods
+    // Return the available regions to wait, the ones that already reach their read index come first.
+    std::vector<const RegionQueryInfo *> orderRegionsToWait(
+        const LearnerReadSnapshot & regions_snapshot,
+        const RegionsReadIndexResult & batch_read_index_result);
     void waitIndex(
         const LearnerReadSnapshot & regions_snapshot,
         RegionsReadIndexResult & batch_read_index_result,
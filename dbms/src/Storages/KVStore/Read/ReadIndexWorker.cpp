@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Common/Stopwatch.h>
+#include <Common/TiFlashMetrics.h>
 #include <Common/setThreadName.h>
 #include <Storages/KVStore/FFI/ProxyFFI.h>
 #include <Storages/KVStore/KVStore.h>
@@ -468,11 +469,27 @@ void ReadIndexDataNode::doAddHistoryTasks(Timestamp ts, kvrpcpb::ReadIndexRespon
     }
 }
 
-void ReadIndexDataNode::doConsume(const TiFlashRaftProxyHelper & helper, RunningTasks::iterator it)
+void ReadIndexLatencyTracker::observe(SteadyClock::duration latency)
 {
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const UInt64 cur = us > 0 ? us : 1;
+    // Only the worker thread updates it, no need to use CAS.
+    const UInt64 prev = avg_us.load(std::memory_order_relaxed);
+    avg_us.store(prev == 0 ? cur : (prev * 7 + cur) / 8, std::memory_order_relaxed);
+}
+
+void ReadIndexDataNode::doConsume(
+    const TiFlashRaftProxyHelper & helper,
+    RunningTasks::iterator it,
+    ReadIndexLatencyTracker * latency_tracker)
+{
+    const bool has_task = it->second.task_pair.has_value();
     it->second.doPoll(helper, ReadIndexWorker::getMaxReadIndexTaskTimeout());
     if (!it->second.task_pair)
     {
+        if (has_task && latency_tracker)
+            latency_tracker->observe(SteadyClock::now() - it->second.start_time);
+
         auto start_ts = it->first;
         auto resp = std::move(it->second.resp);
 
@@ -486,13 +503,16 @@ void ReadIndexDataNode::doConsume(const TiFlashRaftProxyHelper & helper, Running
     }
 }
 
-void ReadIndexDataNode::consume(const TiFlashRaftProxyHelper & helper, Timestamp ts) NO_THREAD_SAFETY_ANALYSIS
+void ReadIndexDataNode::consume(
+    const TiFlashRaftProxyHelper & helper,
+    Timestamp ts,
+    ReadIndexLatencyTracker * latency_tracker) NO_THREAD_SAFETY_ANALYSIS
 {
     auto _ = genLockGuard();
 
     if (auto it = running_tasks.find(ts); it != running_tasks.end())
     {
-        doConsume(helper, it);
+        doConsume(helper, it, latency_tracker);
     }
 }
 
@@ -515,8 +535,10 @@ std::optional<ReadIndexTask> makeReadIndexTask(const TiFlashRaftProxyHelper & he
     }
 }
 
-void ReadIndexDataNode::runOneRound(const TiFlashRaftProxyHelper & helper, const ReadIndexNotifyCtrlPtr & notify)
-    NO_THREAD_SAFETY_ANALYSIS
+void ReadIndexDataNode::runOneRound(
+    const TiFlashRaftProxyHelper & helper,
+    const ReadIndexNotifyCtrlPtr & notify,
+    ReadIndexLatencyTracker * latency_tracker) NO_THREAD_SAFETY_ANALYSIS
 {
     auto opt_waiting_tasks = this->waiting_tasks.popAll();
     if (!opt_waiting_tasks)
@@ -562,12 +584,17 @@ void ReadIndexDataNode::runOneRound(const TiFlashRaftProxyHelper & helper, const
             }
 
             cnt_use_history_tasks += waiting_tasks.size();
+            GET_METRIC(tiflash_raft_read_index_events_count, type_reuse_history).Increment(waiting_tasks.size());
         }
         else
         {
+            // The requests are served by a running task with a start-ts not less than theirs.
+            size_t cnt_coalesced = waiting_tasks.size();
             auto run_it = running_tasks.lower_bound(max_ts);
             if (run_it == running_tasks.end())
             {
+                GET_METRIC(tiflash_raft_read_index_events_count, type_send).Increment();
+                cnt_coalesced -= 1;
                 TEST_LOG_FMT("no exist running_tasks for ts {}", max_ts);
 
                 if (auto t = makeReadIndexTask(helper, max_ts_task->req); t)
@@ -585,12 +612,14 @@ void ReadIndexDataNode::runOneRound(const TiFlashRaftProxyHelper & helper, const
                 }
             }
 
+            GET_METRIC(tiflash_raft_read_index_events_count, type_coalesce).Increment(cnt_coalesced);
+
             for (auto && e : waiting_tasks)
             {
                 run_it->second.callbacks.emplace_back(std::move(e.second));
             }
 
-            doConsume(helper, run_it);
+            doConsume(helper, run_it, latency_tracker);
         }
     }
 }
@@ -680,7 +709,7 @@ void ReadIndexWorker::consumeReadIndexNotifyCtrl()
     {
         auto node = data_map.getDataNode(region_id);
         TEST_LOG_FMT("consume region_id={}, ts {}", region_id, ts);
-        node->consume(proxy_helper, ts);
+        node->consume(proxy_helper, ts, &latency_tracker);
     }
 }
 
@@ -695,7 +724,7 @@ void ReadIndexWorker::consumeRegionNotifies(SteadyClock::duration min_dur)
     for (auto && region_id : region_notify_map.popAll())
     {
         auto node = data_map.getDataNode(region_id);
-        node->runOneRound(proxy_helper, read_index_notify_ctrl);
+        node->runOneRound(proxy_helper, read_index_notify_ctrl, &latency_tracker);
     }
 
     TEST_LOG_FMT("worker {} set last run time {}", getID(), Clock::now());
@@ -990,6 +1019,29 @@ void ReadIndexWorkerManager::ReadIndexRunner::runOneRound(SteadyClock::duration
         workers[i]->runOneRound(min_dur);
 }
 
+SteadyClock::duration ReadIndexWorkerManager::ReadIndexRunner::getCoalescingWindow(
+    SteadyClock::duration base_tick) const
+{
+    SteadyClock::duration max_latency{0};
+    for (size_t i = id; i < workers.size(); i += runner_cnt)
+        max_latency = std::max(max_latency, workers[i]->latency_tracker.get());
+    // Use the base tick before any read-index task is observed.
+    if (max_latency == SteadyClock::duration{0})
+        return base_tick;
+    auto window = std::chrono::duration_cast<SteadyClock::duration>(max_latency * COALESCING_WINDOW_RATIO);
+    return std::min(window, base_tick);
+}
+
+bool ReadIndexWorkerManager::ReadIndexRunner::hasPendingRegionNotifies() const
+{
+    for (size_t i = id; i < workers.size(); i += runner_cnt)
+    {
+        if (!workers[i]->region_notify_map.empty())
+            return true;
+    }
+    return false;
+}
+
 void ReadIndexWorkerManager::ReadIndexRunner::asyncRun()
 {
     state = State::Running;
@@ -1000,8 +1052,14 @@ void ReadIndexWorkerManager::ReadIndexRunner::asyncRun()
         while (true)
         {
             auto base_tick_timeout = fn_min_dur_handle_region();
-            blockedWaitFor(base_tick_timeout);
-            runOneRound(base_tick_timeout);
+            auto window = getCoalescingWindow(base_tick_timeout);
+            // Wake up within the window if some requests are deferred by the last round.
+            blockedWaitFor(
+                hasPendingRegionNotifies() ? std::max(
+                    std::chrono::milliseconds(1),
+                    std::chrono::duration_cast<std::chrono::milliseconds>(window))
+                                           : base_tick_timeout);
+            runOneRound(window);
             if (state.load(std::memory_order_acquire) != State::Running)
                 break;
         }
@@ -132,6 +132,15 @@ private:
         /// Create one thread to run asynchronously.
         void asyncRun();
 
+        /// The minimal duration between two rounds of handling the region read-index requests. The requests arrived
+        /// within it are coalesced. It follows the observed read-index latency of its workers so that the waiting
+        /// takes at most `COALESCING_WINDOW_RATIO` of the latency, and is bounded by `base_tick`.
+        SteadyClock::duration getCoalescingWindow(SteadyClock::duration base_tick) const;
+
+        bool hasPendingRegionNotifies() const;
+
+        static constexpr double COALESCING_WINDOW_RATIO = 0.1;
+
         ReadIndexRunner(
             size_t id_,
             size_t runner_cnt_,
@@ -198,6 +207,17 @@ struct ReadIndexFuture : MutexLockWrap
     mutable std::shared_ptr<AsyncNotifier> notifier;
 };
 
+// Exponential moving average of the latency of the read-index tasks sent to proxy.
+struct ReadIndexLatencyTracker
+{
+    void observe(SteadyClock::duration latency);
+
+    // Return 0 if no task has been observed.
+    SteadyClock::duration get() const { return std::chrono::microseconds(avg_us.load(std::memory_order_relaxed)); }
+
+    std::atomic<UInt64> avg_us{0};
+};
+
 struct ReadIndexDataNode : MutexLockWrap
 {
     struct ReadIndexElement
@@ -257,11 +277,20 @@ struct ReadIndexDataNode : MutexLockWrap
 
     void doAddHistoryTasks(Timestamp ts, kvrpcpb::ReadIndexResponse && resp);
 
-    void doConsume(const TiFlashRaftProxyHelper & helper, RunningTasks::iterator it);
+    void doConsume(
+        const TiFlashRaftProxyHelper & helper,
+        RunningTasks::iterator it,
+        ReadIndexLatencyTracker * latency_tracker = nullptr);
 
-    void consume(const TiFlashRaftProxyHelper & helper, Timestamp ts);
+    void consume(
+        const TiFlashRaftProxyHelper & helper,
+        Timestamp ts,
+        ReadIndexLatencyTracker * latency_tracker = nullptr);
 
-    void runOneRound(const TiFlashRaftProxyHelper & helper, const ReadIndexNotifyCtrlPtr & notify);
+    void runOneRound(
+        const TiFlashRaftProxyHelper & helper,
+        const ReadIndexNotifyCtrlPtr & notify,
+        ReadIndexLatencyTracker * latency_tracker = nullptr);
 
     ReadIndexFuturePtr insertTask(const kvrpcpb::ReadIndexRequest & req);
 
@@ -349,6 +378,8 @@ struct ReadIndexWorker
 
     // no need to be protected
     std::atomic<SteadyClock::time_point> last_run_time{SteadyClock::time_point::min()};
+
+    ReadIndexLatencyTracker latency_tracker;
 };
 
 struct MockStressTestCfg
@@ -321,6 +321,7 @@ void Region::tryCompactionFilter(const Timestamp safe_point)
     // No need to check default cf. Because tikv will gc default cf before write cf.
     if (del_write)
     {
+        data.persist_delta.clear();
         LOG_INFO(log, "delete {} records in write cf for region_id={}", del_write, meta.regionId());
     }
 }
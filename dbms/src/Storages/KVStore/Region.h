@@ -182,6 +182,17 @@ public: // Stats
         ReadBuffer & buf,
         const TiFlashRaftProxyHelper * proxy_helper = nullptr);
 
+    // Serialize the changes since the last full persistence if they are tracked, otherwise serialize the whole
+    // region and start tracking the changes when `delta_ratio` > 0. Return <size, applied_index, is_delta>.
+    std::tuple<size_t, UInt64, bool> serializeForPersist(WriteBuffer & buf, double delta_ratio) const;
+    // Must be called after the result of `serializeForPersist` is written.
+    void onPersisted(UInt64 applied_index, bool is_delta) const;
+    // Return the region restored from the full persistence `base` and the changes in `buf`.
+    static RegionPtr applyPersistDelta(
+        RegionPtr && base,
+        ReadBuffer & buf,
+        const TiFlashRaftProxyHelper * proxy_helper = nullptr);
+
     friend bool operator==(const Region & region1, const Region & region2)
     {
         std::shared_lock<std::shared_mutex> lock1(region1.mutex);
@@ -279,6 +290,12 @@ private:
     RegionPtr splitInto(RegionMeta && meta);
     void setPeerState(raft_serverpb::PeerState state);
 
+    std::tuple<size_t, UInt64> serializeWithoutLock(
+        UInt32 binary_version,
+        UInt32 expected_extension_count,
+        const std::function<size_t(UInt32 &, WriteBuffer &)> & extra_handler,
+        WriteBuffer & buf) const;
+
 private:
     // Modification to data or meta requires this mutex.
     mutable std::shared_mutex mutex;
@@ -193,6 +193,7 @@ TMTContext::TMTContext(
         // TODO: make it reloadable
         remote_gc_config.interval_seconds = context.getSettingsRef().remote_gc_interval_seconds;
         remote_gc_config.verify_locks = context.getSettingsRef().remote_gc_verify_consistency > 0;
+        remote_gc_config.lock_full_scan_rounds = context.getSettingsRef().remote_gc_lock_full_scan_rounds;
         // set the gc_method so that S3LockService can set tagging when create delmark
         S3::ClientFactory::instance().gc_method = remote_gc_config.method;
         s3gc_manager = std::make_unique<S3::S3GCManagerService>(
@@ -126,6 +126,18 @@ protected:
             ColumnIDValue(10, DecimalField(ToDecimal<UInt64, Decimal64>(12345678910ULL, 4), 4)),
             ColumnIDValueNull<UInt64>(11));
     }
+
+    std::pair<TableInfo, std::vector<Field>> getWideTableInfoFields(size_t num_extra_columns) const
+    {
+        auto table_info_fields = getNormalTableInfoFields({2}, false);
+        auto & [table_info, fields] = table_info_fields;
+        for (size_t i = 0; i < num_extra_columns; ++i)
+        {
+            table_info.columns.emplace_back(getColumnInfo<Int64>(100 + i));
+            fields.emplace_back(static_cast<Int64>(i));
+        }
+        return table_info_fields;
+    }
 };
 
 BENCHMARK_DEFINE_F(RegionBlockReaderBenchTest, CommonHandle)
@@ -168,6 +180,19 @@ BENCHMARK_DEFINE_F(RegionBlockReaderBenchTest, PKIsHandle)
     }
 }
 
+BENCHMARK_DEFINE_F(RegionBlockReaderBenchTest, WideTable)
+(benchmark::State & state)
+{
+    size_t num_rows = state.range(0);
+    auto [table_info, fields] = getWideTableInfoFields(64);
+    encodeColumns(table_info, fields, RowEncodeVersion::RowV2, num_rows);
+    auto decoding_schema = getDecodingStorageSchemaSnapshot(table_info);
+    for (auto _ : state)
+    {
+        decodeColumns(decoding_schema, true);
+    }
+}
+
 constexpr size_t num_iterations_test = 1000;
 
 BENCHMARK_REGISTER_F(RegionBlockReaderBenchTest, PKIsHandle)
@@ -185,5 +210,10 @@ BENCHMARK_REGISTER_F(RegionBlockReaderBenchTest, PKIsNotHandle)
     ->Arg(1)
     ->Arg(10)
     ->Arg(100);
+BENCHMARK_REGISTER_F(RegionBlockReaderBenchTest, WideTable)
+    ->Iterations(num_iterations_test)
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(100);
 
 } // namespace DB::tests
@@ -1483,6 +1483,47 @@ TEST_F(RegionKVStoreOldTest, RegionRange)
 
         ASSERT_EQ(root_map.size(), 2);
     }
+    {
+        // Test build in bulk is the same as adding one by one.
+        RegionMap regions;
+        regions.emplace(1, makeRegion(1, RecordKVFormat::genKey(1, 0), RecordKVFormat::genKey(1, 10)));
+        regions.emplace(2, makeRegion(2, RecordKVFormat::genKey(1, 0), RecordKVFormat::genKey(1, 3)));
+        regions.emplace(3, makeRegion(3, RecordKVFormat::genKey(1, 0), RecordKVFormat::genKey(1, 1)));
+        regions.emplace(4, makeRegion(4, RecordKVFormat::genKey(1, 1), RecordKVFormat::genKey(1, 4)));
+        regions.emplace(5, makeRegion(5, RecordKVFormat::genKey(1, 10), TiKVKey("")));
+
+        RegionsRangeIndex added_index;
+        for (const auto & [id, region] : regions)
+            added_index.add(region);
+        RegionsRangeIndex built_index;
+        built_index.build(regions);
+
+        const auto & added_root = added_index.getRoot();
+        const auto & built_root = built_index.getRoot();
+        // -inf,0,1,3,4,10,inf
+        ASSERT_EQ(built_root.size(), 7);
+        ASSERT_EQ(added_root.size(), built_root.size());
+        for (auto added_it = added_root.begin(), built_it = built_root.begin(); added_it != added_root.end();
+             ++added_it, ++built_it)
+        {
+            ASSERT_EQ(added_it->first.compare(built_it->first), 0);
+            const auto & added_map = added_it->second.region_map;
+            const auto & built_map = built_it->second.region_map;
+            ASSERT_EQ(added_map.size(), built_map.size());
+            for (const auto & [id, region] : added_map)
+                ASSERT_TRUE(built_map.contains(id));
+        }
+
+        auto res = built_index.findByRangeOverlap(
+            RegionRangeKeys::makeComparableKeys(RecordKVFormat::genKey(1, 2), RecordKVFormat::genKey(1, 5)));
+        ASSERT_EQ(res.size(), 3);
+        ASSERT_TRUE(res.find(1) != res.end());
+        ASSERT_TRUE(res.find(2) != res.end());
+        ASSERT_TRUE(res.find(4) != res.end());
+
+        // Can not build on a non-empty index.
+        ASSERT_ANY_THROW(built_index.build(regions));
+    }
 
     {
         // Test add and remove.
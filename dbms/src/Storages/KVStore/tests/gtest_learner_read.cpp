@@ -59,6 +59,23 @@ protected:
         worker.recordReadIndexError(regions_snapshot, read_index_result);
     }
 
+    static std::vector<const RegionQueryInfo *> orderRegionsToWait(
+        LearnerReadWorker & worker,
+        const LearnerReadSnapshot & regions_snapshot,
+        const RegionsReadIndexResult & read_index_result)
+    {
+        return worker.orderRegionsToWait(regions_snapshot, read_index_result);
+    }
+
+    static void waitIndex(
+        LearnerReadWorker & worker,
+        const LearnerReadSnapshot & regions_snapshot,
+        RegionsReadIndexResult & read_index_result)
+    {
+        Stopwatch watch;
+        worker.waitIndex(regions_snapshot, read_index_result, /*timeout_ms*/ 0, watch);
+    }
+
 protected:
     LoggerPtr log;
 };
@@ -176,4 +193,71 @@ try
 }
 CATCH
 
+TEST_F(LearnerReadTest, OrderRegionsToWait)
+try
+{
+    auto & global_ctx = TiFlashTestEnv::getGlobalContext();
+    auto & tmt = global_ctx.getTMTContext();
+
+    const RegionID region_id_200 = 200;
+    const RegionID region_id_201 = 201;
+    const RegionID region_id_202 = 202;
+    const TableID table_id = 100;
+
+    auto region_200
+        = makeRegion(region_id_200, RecordKVFormat::genKey(table_id, 0), RecordKVFormat::genKey(table_id, 10000));
+    auto region_201
+        = makeRegion(region_id_201, RecordKVFormat::genKey(table_id, 10000), RecordKVFormat::genKey(table_id, 20000));
+    auto region_202
+        = makeRegion(region_id_202, RecordKVFormat::genKey(table_id, 20000), RecordKVFormat::genKey(table_id, 30000));
+    region_200->setApplied(10, 5);
+    region_201->setApplied(30, 5);
+    region_202->setApplied(30, 5);
+    LearnerReadSnapshot snapshot{
+        {region_id_200, RegionLearnerReadSnapshot(region_200)},
+        {region_id_201, RegionLearnerReadSnapshot(region_201)},
+        {region_id_202, RegionLearnerReadSnapshot(region_202)},
+    };
+
+    MvccQueryInfo mvcc_query_info(false, 10000, nullptr);
+    for (const auto & region_id : {region_id_200, region_id_201, region_id_202})
+    {
+        const auto & region = snapshot.find(region_id)->second;
+        mvcc_query_info.regions_query_info.emplace_back(RegionQueryInfo{
+            region_id,
+            region->version(),
+            region->confVer(),
+            table_id,
+        });
+    }
+    LearnerReadWorker worker(mvcc_query_info, tmt, true, false, log);
+
+    // region_200 is lagging behind its read index, region_201 and region_202 are ready
+    RegionsReadIndexResult read_index_result{
+        {region_id_200, makeReadIndexResult(20)},
+        {region_id_201, makeReadIndexResult(20)},
+        {region_id_202, makeReadIndexResult(20)},
+    };
+    auto regions_to_wait = orderRegionsToWait(worker, snapshot, read_index_result);
+    ASSERT_EQ(regions_to_wait.size(), 3);
+    ASSERT_EQ(regions_to_wait[0]->region_id, region_id_201);
+    ASSERT_EQ(regions_to_wait[1]->region_id, region_id_202);
+    ASSERT_EQ(regions_to_wait[2]->region_id, region_id_200);
+    ASSERT_EQ(worker.getStats().num_ready_before_wait, 2);
+
+    // The applied index of region_200 advances after it has been checked, it must still be waited
+    // instead of being left out of both the ready and the lagging regions.
+    region_200->setApplied(20, 5);
+    waitIndex(worker, snapshot, read_index_result);
+    ASSERT_TRUE(worker.getUnavailableRegions().empty());
+    ASSERT_EQ(worker.getStats().num_ready_before_wait, 3);
+
+    regions_to_wait = orderRegionsToWait(worker, snapshot, read_index_result);
+    ASSERT_EQ(regions_to_wait.size(), 3);
+    ASSERT_EQ(regions_to_wait[0]->region_id, region_id_200);
+    ASSERT_EQ(regions_to_wait[1]->region_id, region_id_201);
+    ASSERT_EQ(regions_to_wait[2]->region_id, region_id_202);
+}
+CATCH
+
 } // namespace DB::tests
@@ -612,6 +612,60 @@ try
 }
 CATCH
 
+// Test the threshold of parallel prehandling is configurable by settings.
+TEST_F(RegionKVStoreV2Test, KVStoreSingleSnapThresholdBySettings)
+try
+{
+    auto ctx = TiFlashTestEnv::getGlobalContext();
+    proxy_instance->cluster_ver = RaftstoreVer::V2;
+    auto & settings = ctx.getTMTContext().getContext().getSettingsRef();
+    const auto origin_threshold = settings.raft_snapshot_parallel_prehandle_threshold.get();
+    SCOPE_EXIT({ settings.raft_snapshot_parallel_prehandle_threshold = origin_threshold; });
+    UInt64 region_id = 2;
+    initStorages();
+    KVStore & kvs = getKVS();
+    TableID table_id = proxy_instance->bootstrapTable(ctx, kvs, ctx.getTMTContext());
+    auto start = RecordKVFormat::genKey(table_id, 0);
+    auto end = RecordKVFormat::genKey(table_id, 20);
+    proxy_instance->bootstrapWithRegion(
+        kvs,
+        ctx.getTMTContext(),
+        region_id,
+        std::make_pair(start.toString(), end.toString()));
+
+    auto [value_write, value_default] = proxy_instance->generateTiKVKeyValue(111, 999);
+    auto gen_snapshot = [&]() {
+        MockSSTReader::getMockSSTData().clear();
+        MockSSTGenerator default_cf{region_id, table_id, ColumnFamilyType::Default};
+        MockSSTGenerator write_cf{region_id, table_id, ColumnFamilyType::Write};
+        for (HandleID h = 1; h < 20; h++)
+        {
+            auto k = RecordKVFormat::genKey(table_id, h, 111);
+            default_cf.insert_raw(k, value_default);
+            write_cf.insert_raw(k, value_write);
+        }
+        default_cf.finish_file(SSTFormatKind::KIND_TABLET);
+        default_cf.freeze();
+        write_cf.finish_file(SSTFormatKind::KIND_TABLET);
+        write_cf.freeze();
+        return proxy_instance
+            ->snapshot(kvs, ctx.getTMTContext(), region_id, {default_cf, write_cf}, 0, 0, std::nullopt);
+    };
+    {
+        // The snapshot is smaller than the default threshold
+        auto [kvr1, res] = gen_snapshot();
+        ASSERT_EQ(res.stats.write_cf_keys, 19);
+        ASSERT_EQ(res.stats.parallels, 1);
+    }
+    {
+        settings.raft_snapshot_parallel_prehandle_threshold = 0;
+        auto [kvr1, res] = gen_snapshot();
+        ASSERT_EQ(res.stats.write_cf_keys, 19);
+        ASSERT_EQ(res.stats.parallels, 4);
+    }
+}
+CATCH
+
 // Test if there is only one pk with may versions.
 TEST_F(RegionKVStoreV2Test, KVStoreSingleSnap2)
 try
@@ -970,5 +1024,61 @@ try
 }
 CATCH
 
+TEST_F(RegionKVStoreV2Test, PrehandleSubtaskResourcesFIFO)
+try
+{
+    PreHandlingTrace trace;
+    auto wait_for_waiters = [&](uint64_t waiters) {
+        while (true)
+        {
+            {
+                std::unique_lock lock(trace.cpu_resource_mut);
+                if (trace.next_wait_ticket - trace.serving_wait_ticket == waiters)
+                    return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    };
+
+    trace.waitForSubtaskResources(1, 2, 2);
+    ASSERT_EQ(trace.ongoing_prehandle_subtask_count.load(), 2);
+
+    std::atomic<int> order = 0;
+    int acquired_2 = -1;
+    int acquired_3 = -1;
+    // Region 2 requires all the resources, and waits before region 3.
+    auto t2 = std::thread([&] {
+        trace.waitForSubtaskResources(2, 2, 2);
+        acquired_2 = order++;
+    });
+    wait_for_waiters(1);
+    auto t3 = std::thread([&] {
+        trace.waitForSubtaskResources(3, 1, 2);
+        acquired_3 = order++;
+    });
+    wait_for_waiters(2);
+
+    // Region 3 could acquire the released resource, but is not allowed to overtake region 2.
+    trace.releaseSubtaskResources(1, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(order.load(), 0);
+
+    trace.releaseSubtaskResources(1, 1);
+    t2.join();
+    ASSERT_EQ(acquired_2, 0);
+    ASSERT_EQ(trace.ongoing_prehandle_subtask_count.load(), 2);
+
+    trace.releaseSubtaskResources(2, 0);
+    t3.join();
+    ASSERT_EQ(acquired_3, 1);
+    ASSERT_EQ(trace.ongoing_prehandle_subtask_count.load(), 2);
+
+    trace.releaseSubtaskResources(2, 1);
+    trace.releaseSubtaskResources(3, 0);
+    ASSERT_EQ(trace.ongoing_prehandle_subtask_count.load(), 0);
+    wait_for_waiters(0);
+}
+CATCH
+
 } // namespace tests
 } // namespace DB
@@ -40,6 +40,7 @@ public:
     static void testBatch();
     static void testNormal();
     static void testError();
+    static void testCoalescingWindow();
 };
 
 void ReadIndexTest::testError()
@@ -644,6 +645,49 @@ void ReadIndexTest::testBatch()
     ASSERT(!GCMonitor::instance().empty());
 }
 
+void ReadIndexTest::testCoalescingWindow()
+{
+    MockRaftStoreProxy proxy_instance;
+    TiFlashRaftProxyHelper proxy_helper;
+    {
+        proxy_helper = MockRaftStoreProxy::SetRaftStoreProxyFFIHelper(RaftStoreProxyPtr{&proxy_instance});
+        proxy_instance.init(10);
+    }
+    auto manager = ReadIndexWorkerManager::newReadIndexWorkerManager(
+        proxy_helper,
+        4,
+        [&]() { return std::chrono::milliseconds(10); },
+        2);
+    const SteadyClock::duration base_tick = std::chrono::milliseconds(10);
+    auto & runner0 = *manager->runners[0];
+    auto & runner1 = *manager->runners[1];
+
+    // Use the base tick before any read-index task is observed.
+    ASSERT_EQ(runner0.getCoalescingWindow(base_tick), base_tick);
+
+    {
+        ReadIndexLatencyTracker tracker;
+        tracker.observe(std::chrono::milliseconds(8));
+        ASSERT_EQ(tracker.get(), std::chrono::milliseconds(8));
+        tracker.observe(std::chrono::milliseconds(16));
+        ASSERT_EQ(tracker.get(), std::chrono::milliseconds(9));
+    }
+
+    // Worker 0 and 2 belong to runner 0, the window follows the slowest one.
+    manager->workers[0]->latency_tracker.observe(std::chrono::milliseconds(20));
+    manager->workers[2]->latency_tracker.observe(std::chrono::milliseconds(40));
+    ASSERT_EQ(runner0.getCoalescingWindow(base_tick), std::chrono::milliseconds(4));
+    ASSERT_EQ(runner1.getCoalescingWindow(base_tick), base_tick);
+
+    // Bounded by the base tick.
+    manager->workers[1]->latency_tracker.observe(std::chrono::seconds(1));
+    ASSERT_EQ(runner1.getCoalescingWindow(base_tick), base_tick);
+
+    ASSERT_FALSE(runner0.hasPendingRegionNotifies());
+    auto future = manager->genReadIndexFuture(make_read_index_reqs(2, 10));
+    ASSERT_TRUE(runner0.hasPendingRegionNotifies());
+    ASSERT_FALSE(runner1.hasPendingRegionNotifies());
+}
 
 TEST_F(ReadIndexTest, workers)
 try
@@ -655,5 +699,12 @@ try
 }
 CATCH
 
+TEST_F(ReadIndexTest, CoalescingWindow)
+try
+{
+    testCoalescingWindow();
+}
+CATCH
+
 } // namespace tests
 } // namespace DB
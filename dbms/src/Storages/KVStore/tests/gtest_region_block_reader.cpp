@@ -338,6 +338,27 @@ TEST_F(RegionBlockReaderTest, CommonHandle)
     ASSERT_TRUE(decodeAndCheckColumns(decoding_schema, true));
 }
 
+TEST_F(RegionBlockReaderTest, ReadParallel)
+{
+    auto [table_info, fields] = getNormalTableInfoFields({EXTRA_HANDLE_COLUMN_ID}, false);
+    rows = 1000;
+    encodeColumns(table_info, fields, RowEncodeVersion::RowV2);
+    auto decoding_schema = getDecodingStorageSchemaSnapshot(table_info);
+
+    RegionBlockReader reader{decoding_schema};
+    Block expected = createBlockSortByColumnID(decoding_schema);
+    ASSERT_TRUE(reader.read(expected, data_list_read, true));
+    // 1 part, 3 parts with a smaller last part, 4 parts
+    std::vector<std::pair<size_t, size_t>> cases{{4, 1000}, {3, 100}, {4, 250}};
+    for (const auto & [concurrency, min_rows_per_task] : cases)
+    {
+        Block block = createBlockSortByColumnID(decoding_schema);
+        ASSERT_TRUE(reader.readParallel(block, data_list_read, true, concurrency, min_rows_per_task));
+        checkBlock(decoding_schema, block);
+        ASSERT_BLOCK_EQ(expected, block);
+    }
+}
+
 TEST_F(RegionBlockReaderTest, MissingColumnRowV2)
 {
     auto [table_info, fields] = getNormalTableInfoFields({EXTRA_HANDLE_COLUMN_ID}, false);
@@ -14,6 +14,7 @@
 
 #include <Common/FailPoint.h>
 #include <Common/Logger.h>
+#include <Common/MemoryTracker.h>
 #include <Common/Stopwatch.h>
 #include <Common/SyncPoint/Ctl.h>
 #include <IO/ReadBufferFromFile.h>
@@ -36,6 +37,8 @@
 #include <ext/scope_guard.h>
 #include <future>
 
+extern std::shared_ptr<MemoryTracker> root_of_kvstore_mem_trackers;
+
 namespace DB
 {
 namespace FailPoints
@@ -766,6 +769,88 @@ try
 }
 CATCH
 
+TEST_P(RegionPersisterTest, PersistDelta)
+try
+{
+    RegionManager region_manager;
+
+    auto ctx = TiFlashTestEnv::getGlobalContext();
+    ctx.getSettingsRef().kvstore_persist_delta_ratio = 1.0;
+
+    const RegionID region_id = 100;
+    const TableID table_id = 100;
+    PageStorageConfig config;
+    config.file_roll_size = 128 * MB;
+
+    auto region = std::make_shared<Region>(createRegionMeta(region_id, table_id));
+    const String large_value(1024, 'v');
+    {
+        RegionPersister persister(ctx);
+        persister.restore(*mocked_path_pool, nullptr, config);
+
+        auto region_task_lock = region_manager.genRegionTaskLock(region_id);
+        for (HandleID handle = 0; handle < 10; ++handle)
+        {
+            TiKVKey key = RecordKVFormat::genKey(table_id, handle, 1);
+            region->insert(ColumnFamilyType::Default, TiKVKey::copyFrom(key), TiKVValue(large_value.c_str()));
+            region->insert(
+                ColumnFamilyType::Lock,
+                RecordKVFormat::genKey(table_id, handle),
+                RecordKVFormat::encodeLockCfValue('P', "", 1, 0));
+        }
+        region->setApplied(10, 5);
+        // The first persistence is always full.
+        persister.persist(*region, region_task_lock);
+
+        // Only persist the changes since the last full persistence.
+        region->remove("lock", RecordKVFormat::genKey(table_id, 0));
+        region->remove("default", RecordKVFormat::genKey(table_id, 0, 1));
+        TiKVKey key = RecordKVFormat::genKey(table_id, 100, 2);
+        TiKVValue value("value");
+        // Both the region data and the tracked change hold a copy of the key and value.
+        const auto tracked_bytes = root_of_kvstore_mem_trackers->get();
+        region->insert(ColumnFamilyType::Default, TiKVKey::copyFrom(key), TiKVValue::copyFrom(value));
+        ASSERT_EQ(
+            static_cast<size_t>(root_of_kvstore_mem_trackers->get() - tracked_bytes),
+            2 * (key.dataSize() + value.dataSize()));
+        region->insert(ColumnFamilyType::Write, TiKVKey::copyFrom(key), RecordKVFormat::encodeWriteCfValue('P', 1));
+        region->setApplied(11, 5);
+        {
+            MemoryWriteBuffer buf;
+            ASSERT_TRUE(std::get<2>(region->serializeForPersist(buf, 1.0)));
+        }
+        persister.persist(*region, region_task_lock);
+        region->setApplied(12, 5);
+        persister.persist(*region, region_task_lock);
+    }
+
+    reload();
+    {
+        RegionPersister persister(ctx);
+        auto restored_regions = persister.restore(*mocked_path_pool, nullptr, config);
+        ASSERT_EQ(restored_regions.size(), 1);
+        const auto & restored_region = restored_regions.at(region_id);
+        ASSERT_EQ(restored_region->appliedIndex(), 12);
+        ASSERT_EQ(*restored_region, *region);
+
+        // The changes exceeding the limit make the next persistence full.
+        auto region_task_lock = region_manager.genRegionTaskLock(region_id);
+        persister.persist(*restored_region, region_task_lock);
+        for (HandleID handle = 200; handle < 220; ++handle)
+        {
+            TiKVKey key = RecordKVFormat::genKey(table_id, handle, 1);
+            restored_region->insert(
+                ColumnFamilyType::Default,
+                TiKVKey::copyFrom(key),
+                TiKVValue(large_value.c_str()));
+        }
+        restored_region->setApplied(13, 5);
+        MemoryWriteBuffer buf;
+        ASSERT_FALSE(std::get<2>(restored_region->serializeForPersist(buf, 1.0)));
+    }
+}
+CATCH
+
 INSTANTIATE_TEST_CASE_P(
     TestMode,
     RegionPersisterTest,
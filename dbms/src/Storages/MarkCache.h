@@ -14,8 +14,8 @@
 
 #pragma once
 
-#include <Common/LRUCache.h>
 #include <Common/ProfileEvents.h>
+#include <Common/ShardedLRUCache.h>
 #include <Common/SipHash.h>
 #include <DataStreams/MarkInCompressedFile.h>
 #include <Interpreters/AggregationCommon.h>
@@ -59,14 +59,14 @@ struct MarksWeightFunction
 /** Cache of 'marks' for StorageDeltaMerge.
   * Marks is an index structure that addresses ranges in column file, corresponding to ranges of primary key.
   */
-class MarkCache : public LRUCache<String, MarksInCompressedFile, std::hash<String>, MarksWeightFunction>
+class MarkCache : public ShardedLRUCache<String, MarksInCompressedFile, std::hash<String>, MarksWeightFunction>
 {
 private:
-    using Base = LRUCache<String, MarksInCompressedFile, std::hash<String>, MarksWeightFunction>;
+    using Base = ShardedLRUCache<String, MarksInCompressedFile, std::hash<String>, MarksWeightFunction>;
 
 public:
     explicit MarkCache(size_t max_size_in_bytes)
-        : Base(max_size_in_bytes)
+        : Base(max_size_in_bytes, Base::default_num_shards, Base::default_min_shard_bytes)
     {}
 
     template <typename LoadFunc>
@@ -101,9 +101,17 @@ struct PageStorageConfig
     SettingDouble blob_heavy_gc_valid_rate = 0.5;
     SettingDouble blob_heavy_gc_valid_rate_raft_data = 0.05;
     SettingUInt64 blob_block_alignment_bytes = 0;
+    // The method of compressing the page data, NONE means the page data is stored uncompressed.
+    SettingCompressionMethod blob_compression_method = CompressionMethod::NONE;
+    SettingCompressionMethod blob_compression_method_raft_data = CompressionMethod::NONE;
+    // The max bytes of the memory cache of page data, 0 means disable the cache. Only take effect on restart.
+    SettingUInt64 blob_page_cache_size = 0;
+    SettingUInt64 blob_page_cache_size_raft_data = 0;
 
     SettingUInt64 wal_roll_size = PAGE_META_ROLL_SIZE;
     SettingUInt64 wal_max_persisted_log_files = MAX_PERSISTED_LOG_FILES;
+    // The number of threads to decode the WAL records when restoring. Only take effect on restart.
+    SettingUInt64 wal_restore_decode_concurrency = 4;
 
     void reload(const PageStorageConfig & rhs)
     {
@@ -125,6 +133,8 @@ struct PageStorageConfig
         blob_heavy_gc_valid_rate = rhs.blob_heavy_gc_valid_rate;
         blob_heavy_gc_valid_rate_raft_data = rhs.blob_heavy_gc_valid_rate_raft_data;
         blob_block_alignment_bytes = rhs.blob_block_alignment_bytes;
+        blob_compression_method = rhs.blob_compression_method;
+        blob_compression_method_raft_data = rhs.blob_compression_method_raft_data;
 
         wal_roll_size = rhs.wal_roll_size;
         wal_max_persisted_log_files = rhs.wal_max_persisted_log_files;
@@ -155,12 +165,18 @@ struct PageStorageConfig
             "PageStorageConfig {{"
             "blob_file_limit_size: {}, blob_spacemap_type: {}, "
             "blob_heavy_gc_valid_rate: {:.3f}, blob_heavy_gc_valid_rate_raft_data: {:.3f}, "
-            "blob_block_alignment_bytes: {}, wal_roll_size: {}, wal_max_persisted_log_files: {}}}",
+            "blob_block_alignment_bytes: {}, blob_compression_method: {}, blob_compression_method_raft_data: {}, "
+            "blob_page_cache_size: {}, blob_page_cache_size_raft_data: {}, "
+            "wal_roll_size: {}, wal_max_persisted_log_files: {}}}",
             blob_file_limit_size.get(),
             blob_spacemap_type.get(),
             blob_heavy_gc_valid_rate.get(),
             blob_heavy_gc_valid_rate_raft_data.get(),
             blob_block_alignment_bytes.get(),
+            blob_compression_method.toString(),
+            blob_compression_method_raft_data.toString(),
+            blob_page_cache_size.get(),
+            blob_page_cache_size_raft_data.get(),
             wal_roll_size.get(),
             wal_max_persisted_log_files.get());
     }
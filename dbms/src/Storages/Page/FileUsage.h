@@ -33,6 +33,11 @@ struct FileUsageStatistics
     // in-memory
     size_t num_pages = 0;
 
+    // page cache
+    size_t page_cache_bytes = 0;
+    size_t page_cache_hits = 0;
+    size_t page_cache_misses = 0;
+
     FileUsageStatistics & merge(const FileUsageStatistics & rhs)
     {
         total_disk_size += rhs.total_disk_size;
@@ -43,6 +48,10 @@ struct FileUsageStatistics
         total_log_file_num += rhs.total_log_file_num;
 
         num_pages += rhs.num_pages;
+
+        page_cache_bytes += rhs.page_cache_bytes;
+        page_cache_hits += rhs.page_cache_hits;
+        page_cache_misses += rhs.page_cache_misses;
         return *this;
     }
 };
@@ -29,6 +29,10 @@ struct BlobConfig
     SettingUInt64 block_alignment_bytes = 0;
     SettingDouble heavy_gc_valid_rate = 0.2;
     SettingDouble heavy_gc_valid_rate_raft_data = 0.05;
+    SettingCompressionMethod compression_method = CompressionMethod::NONE;
+    SettingCompressionMethod compression_method_raft_data = CompressionMethod::NONE;
+    SettingUInt64 page_cache_size = 0;
+    SettingUInt64 page_cache_size_raft_data = 0;
 
     String toString()
     {
@@ -37,12 +41,18 @@ struct BlobConfig
             "[file_limit_size={}] [spacemap_type={}] "
             "[block_alignment_bytes={}] "
             "[heavy_gc_valid_rate={}]"
-            "[heavy_gc_valid_rate_raft_data={}]",
+            "[heavy_gc_valid_rate_raft_data={}]"
+            "[compression_method={}] [compression_method_raft_data={}]"
+            "[page_cache_size={}] [page_cache_size_raft_data={}]",
             file_limit_size,
             spacemap_type,
             block_alignment_bytes,
             heavy_gc_valid_rate,
-            heavy_gc_valid_rate_raft_data);
+            heavy_gc_valid_rate_raft_data,
+            compression_method.toString(),
+            compression_method_raft_data.toString(),
+            page_cache_size,
+            page_cache_size_raft_data);
     }
 
     static BlobConfig from(const PageStorageConfig & config)
@@ -54,6 +64,10 @@ struct BlobConfig
         blob_config.heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate;
         blob_config.heavy_gc_valid_rate_raft_data = config.blob_heavy_gc_valid_rate_raft_data;
         blob_config.block_alignment_bytes = config.blob_block_alignment_bytes;
+        blob_config.compression_method = config.blob_compression_method;
+        blob_config.compression_method_raft_data = config.blob_compression_method_raft_data;
+        blob_config.page_cache_size = config.blob_page_cache_size;
+        blob_config.page_cache_size_raft_data = config.blob_page_cache_size_raft_data;
 
         return blob_config;
     }
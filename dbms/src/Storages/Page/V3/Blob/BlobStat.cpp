@@ -206,7 +206,8 @@ void BlobStats::setAllToReadOnly() NO_THREAD_SAFETY_ANALYSIS
 std::pair<BlobStats::BlobStatPtr, BlobFileId> BlobStats::chooseStat(
     size_t buf_size,
     PageType page_type,
-    const std::lock_guard<std::mutex> &)
+    const std::lock_guard<std::mutex> &,
+    bool for_gc)
 {
     BlobStatPtr stat_ptr = nullptr;
 
@@ -231,7 +232,7 @@ std::pair<BlobStats::BlobStatPtr, BlobFileId> BlobStats::chooseStat(
         // Try to find a suitable stat under current path (path=`stats_iter->first`)
         for (const auto & stat : stats_iter->second)
         {
-            if (PageTypeUtils::getPageType(stat->id) != page_type)
+            if (PageTypeUtils::getPageType(stat->id) != page_type || stat->is_gc_output != for_gc)
                 continue;
 
             auto defer_lock = stat->defer_lock();
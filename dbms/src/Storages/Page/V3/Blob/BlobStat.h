@@ -63,6 +63,10 @@ public:
         UInt64 sm_valid_size = 0;
         // sm_valid_size / sm_total_size
         double sm_valid_rate = 0.0;
+        // Whether the BlobFile stores the pages migrated by GC. The migrated pages have lived through
+        // at least one GC and are likely to be cold, so they are not mixed with the newly written pages.
+        // Protected by the lock of `BlobStats`. It is not persisted and reset to false after restart.
+        bool is_gc_output = false;
 
         BlobStat(BlobFileId id_, SpaceMap::SpaceMapType sm_type, UInt64 sm_max_caps_, BlobStatType type_)
             : id(id_)
@@ -151,11 +155,14 @@ public:
      * eq. {`BlobStatPtr`,INVALID_BLOBFILE_ID}.
      * The `INVALID_BLOBFILE_ID` means that you don't need create a new `BlobFile`.
      * 
+     * `for_gc` means choosing a `BlobStat` for the pages migrated by GC, only the `BlobStat`
+     * with the same `is_gc_output` will be chosen.
      */
     std::pair<BlobStatPtr, BlobFileId> chooseStat(
         size_t buf_size,
         PageType page_type,
-        const std::lock_guard<std::mutex> &);
+        const std::lock_guard<std::mutex> &,
+        bool for_gc = false);
 
     BlobStatPtr blobIdToStat(BlobFileId file_id, bool ignore_not_exist = false);
 
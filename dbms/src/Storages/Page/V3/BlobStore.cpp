@@ -20,6 +20,11 @@
 #include <Common/Stopwatch.h>
 #include <Common/TiFlashMetrics.h>
 #include <Common/formatReadable.h>
+#include <IO/CompressedReadBuffer.h>
+#include <IO/CompressedWriteBuffer.h>
+#include <IO/ReadBufferFromMemory.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
 #include <Poco/File.h>
 #include <Storages/Page/FileUsage.h>
 #include <Storages/Page/V3/Blob/GCInfo.h>
@@ -88,7 +93,13 @@ BlobStore<Trait>::BlobStore(
     , page_type_and_config(page_type_and_config_)
     , log(Logger::get(storage_name))
     , blob_stats(log, delegator, config)
-{}
+{
+    for (const auto & [page_type, page_type_config] : page_type_and_config)
+    {
+        if (page_type_config.page_cache_size.get() > 0)
+            page_caches.emplace(page_type, std::make_unique<PageCache>(page_type_config.page_cache_size.get()));
+    }
+}
 
 template <typename Trait>
 void BlobStore<Trait>::registerPaths() NO_THREAD_SAFETY_ANALYSIS
@@ -139,6 +150,9 @@ void BlobStore<Trait>::reloadConfig(const BlobConfig & rhs)
     config.block_alignment_bytes = rhs.block_alignment_bytes;
     config.heavy_gc_valid_rate = rhs.heavy_gc_valid_rate;
     config.heavy_gc_valid_rate_raft_data = rhs.heavy_gc_valid_rate_raft_data;
+    config.compression_method = rhs.compression_method;
+    config.compression_method_raft_data = rhs.compression_method_raft_data;
+    // The page caches are created with BlobStore, so `page_cache_size` is not reloaded.
     auto reload_page_type_config = [this](PageType page_type, const PageTypeConfig & config) {
         auto iter = page_type_and_config.find(page_type);
         if (iter != page_type_and_config.end())
@@ -146,11 +160,23 @@ void BlobStore<Trait>::reloadConfig(const BlobConfig & rhs)
             iter->second = config;
         }
     };
-    reload_page_type_config(PageType::Normal, PageTypeConfig{.heavy_gc_valid_rate = config.heavy_gc_valid_rate});
+    reload_page_type_config(
+        PageType::Normal,
+        PageTypeConfig{
+            .heavy_gc_valid_rate = config.heavy_gc_valid_rate,
+            .compression_method = config.compression_method,
+            .page_cache_size = config.page_cache_size});
     reload_page_type_config(
         PageType::RaftData,
-        PageTypeConfig{.heavy_gc_valid_rate = config.heavy_gc_valid_rate_raft_data});
-    reload_page_type_config(PageType::Local, PageTypeConfig{.heavy_gc_valid_rate = config.heavy_gc_valid_rate});
+        PageTypeConfig{
+            .heavy_gc_valid_rate = config.heavy_gc_valid_rate_raft_data,
+            .compression_method = config.compression_method_raft_data,
+            .page_cache_size = config.page_cache_size_raft_data});
+    reload_page_type_config(
+        PageType::Local,
+        PageTypeConfig{
+            .heavy_gc_valid_rate = config.heavy_gc_valid_rate,
+            .compression_method = config.compression_method});
 }
 
 template <typename Trait>
@@ -183,6 +209,16 @@ FileUsageStatistics BlobStore<Trait>::getFileUsageStatistics() const NO_THREAD_S
         usage.total_file_num += stats.size();
     }
 
+    for (const auto & [page_type, page_cache] : page_caches)
+    {
+        (void)page_type;
+        size_t hits = 0, misses = 0;
+        page_cache->getStats(hits, misses);
+        usage.page_cache_bytes += page_cache->weight();
+        usage.page_cache_hits += hits;
+        usage.page_cache_misses += misses;
+    }
+
     return usage;
 }
 
@@ -385,6 +421,145 @@ typename BlobStore<Trait>::PageEntriesEdit BlobStore<Trait>::handleLargeWrite(
     return edit;
 }
 
+template <typename Trait>
+std::vector<typename BlobStore<Trait>::CompressedWrite> BlobStore<Trait>::compressWrites(
+    typename Trait::WriteBatch & wb,
+    PageType page_type)
+{
+    std::vector<CompressedWrite> compressed_writes;
+    auto iter = page_type_and_config.find(page_type);
+    if (iter == page_type_and_config.end() || iter->second.compression_method.get() == CompressionMethod::NONE)
+        return compressed_writes;
+
+    const CompressionSettings compression_settings(iter->second.compression_method.get());
+    auto & writes = wb.getMutWrites();
+    compressed_writes.resize(writes.size());
+    for (size_t write_index = 0; write_index < writes.size(); ++write_index)
+    {
+        auto & write = writes[write_index];
+        if ((write.type != WriteBatchWriteType::PUT && write.type != WriteBatchWriteType::UPDATE_DATA_FROM_REMOTE)
+            || write.size == 0 || !write.offsets.empty())
+            continue;
+
+        String data(write.size, '\0');
+        write.read_buffer->readStrict(data.data(), write.size);
+        WriteBufferFromOwnString compressed_buf;
+        {
+            CompressedWriteBuffer<false> compressed_out(compressed_buf, compression_settings, write.size);
+            compressed_out.write(data.data(), data.size());
+            compressed_out.next();
+        }
+        String compressed = compressed_buf.releaseStr();
+        // Store the original data if it can not be compressed
+        if (compressed.size() < data.size())
+        {
+            // The checksum is computed over the uncompressed data, which is also the data uploaded to checkpoints
+            ChecksumClass digest;
+            digest.update(data.data(), data.size());
+            compressed_writes[write_index].uncompressed_size = write.size;
+            compressed_writes[write_index].uncompressed_checksum = digest.checksum();
+            write.size = compressed.size();
+            data = std::move(compressed);
+        }
+        write.read_buffer = std::make_shared<ReadBufferFromOwnString>(data);
+    }
+    return compressed_writes;
+}
+
+template <typename Trait>
+Page BlobStore<Trait>::decompressPage(
+    const PageId & page_id_v3,
+    const PageEntryV3 & entry,
+    const char * compressed_data)
+{
+    const size_t buf_size = entry.uncompressed_size;
+    char * data_buf = static_cast<char *>(alloc(buf_size));
+    MemHolder mem_holder = createMemHolder(data_buf, [&, buf_size](char * p) { free(p, buf_size); });
+
+    ReadBufferFromMemory compressed_in(compressed_data, entry.size);
+    CompressedReadBuffer<false> decompressed_in(compressed_in);
+    decompressed_in.readStrict(data_buf, buf_size);
+
+    Page page(Trait::PageIdTrait::getU64ID(page_id_v3));
+    page.data = std::string_view(data_buf, buf_size);
+    page.mem_holder = mem_holder;
+    return page;
+}
+
+template <typename Trait>
+PageCache * BlobStore<Trait>::getPageCache(BlobFileId blob_id) const
+{
+    if (page_caches.empty())
+        return nullptr;
+    auto iter = page_caches.find(PageTypeUtils::getPageType(blob_id));
+    return iter == page_caches.end() ? nullptr : iter->second.get();
+}
+
+template <typename Trait>
+std::optional<Page> BlobStore<Trait>::readFromPageCache(const PageId & page_id_v3, const PageEntryV3 & entry) const
+{
+    auto * page_cache = getPageCache(entry.file_id);
+    if (page_cache == nullptr)
+        return std::nullopt;
+
+    auto value = page_cache->get(PageCacheKey{.file_id = entry.file_id, .offset = entry.offset});
+    if (!value || value->checksum != entry.checksum)
+        return std::nullopt;
+
+    Page page(Trait::PageIdTrait::getU64ID(page_id_v3));
+    page.data = std::string_view(value->data);
+    // Share the ownership of the cached value, it is kept alive even if it is evicted from the cache
+    page.mem_holder = MemHolder(value, value->data.data());
+    for (size_t index = 0; index < entry.field_offsets.size(); index++)
+    {
+        const auto offset = entry.field_offsets[index].first;
+        page.field_offsets.emplace(index, offset);
+    }
+    return page;
+}
+
+template <typename Trait>
+void BlobStore<Trait>::putToPageCache(const PageEntryV3 & entry, const Page & page) const
+{
+    auto * page_cache = getPageCache(entry.file_id);
+    if (page_cache == nullptr || page.data.empty() || page.data.size() > page_cache->maxEntrySize())
+        return;
+
+    // Copy the data so that the cache does not hold the read buffer shared with other pages
+    auto value = std::make_shared<PageCacheValue>();
+    value->checksum = entry.checksum;
+    value->data = String(page.data);
+    page_cache->set(PageCacheKey{.file_id = entry.file_id, .offset = entry.offset}, value);
+}
+
+template <typename Trait>
+Page BlobStore<Trait>::copyFieldsToPage(const PageId & page_id_v3, const Page & page, std::vector<size_t> fields)
+{
+    // The field offsets of a page must be in the same order as the field indexes
+    std::sort(fields.begin(), fields.end());
+    size_t buf_size = 0;
+    for (const auto field_index : fields)
+        buf_size += page.getFieldData(field_index).size();
+
+    Page field_page(Trait::PageIdTrait::getU64ID(page_id_v3));
+    if (buf_size == 0)
+        return field_page;
+
+    char * data_buf = static_cast<char *>(alloc(buf_size));
+    MemHolder mem_holder = createMemHolder(data_buf, [&, buf_size](char * p) { free(p, buf_size); });
+    size_t offset = 0;
+    for (const auto field_index : fields)
+    {
+        const auto field_data = page.getFieldData(field_index);
+        memcpy(data_buf + offset, field_data.data(), field_data.size());
+        field_page.field_offsets.emplace(field_index, offset);
+        offset += field_data.size();
+    }
+    field_page.data = std::string_view(data_buf, buf_size);
+    field_page.mem_holder = mem_holder;
+    return field_page;
+}
+
 template <typename Trait>
 typename BlobStore<Trait>::PageEntriesEdit BlobStore<Trait>::write(
     typename Trait::WriteBatch && wb,
@@ -393,7 +568,7 @@ typename BlobStore<Trait>::PageEntriesEdit BlobStore<Trait>::write(
 {
     ProfileEvents::increment(ProfileEvents::PSMWritePages, wb.putWriteCount());
 
-    const size_t all_page_data_size = wb.getTotalDataSize();
+    size_t all_page_data_size = wb.getTotalDataSize();
 
     PageEntriesEdit edit;
 
@@ -495,6 +670,13 @@ typename BlobStore<Trait>::PageEntriesEdit BlobStore<Trait>::write(
         return handleLargeWrite(std::move(wb), page_type, write_limiter);
     }
 
+    const auto compressed_writes = compressWrites(wb, page_type);
+    for (size_t write_index = 0; write_index < compressed_writes.size(); ++write_index)
+    {
+        if (compressed_writes[write_index].uncompressed_size != 0)
+            all_page_data_size -= compressed_writes[write_index].uncompressed_size - wb.getWrites()[write_index].size;
+    }
+
     char * buffer = static_cast<char *>(alloc(all_page_data_size));
     SCOPE_EXIT({ free(buffer, all_page_data_size); });
     char * buffer_pos = buffer;
@@ -512,8 +694,10 @@ typename BlobStore<Trait>::PageEntriesEdit BlobStore<Trait>::write(
 
     size_t offset_in_allocated = 0;
 
-    for (auto & write : wb.getMutWrites())
+    auto & writes = wb.getMutWrites();
+    for (size_t write_index = 0; write_index < writes.size(); ++write_index)
     {
+        auto & write = writes[write_index];
         switch (write.type)
         {
         case WriteBatchWriteType::PUT:
@@ -525,6 +709,7 @@ typename BlobStore<Trait>::PageEntriesEdit BlobStore<Trait>::write(
 
             entry.file_id = blob_id;
             entry.size = write.size;
+            entry.uncompressed_size = compressed_writes.empty() ? 0 : compressed_writes[write_index].uncompressed_size;
             entry.tag = write.tag;
             entry.offset = offset_in_file + offset_in_allocated;
             offset_in_allocated += write.size;
@@ -535,8 +720,15 @@ typename BlobStore<Trait>::PageEntriesEdit BlobStore<Trait>::write(
                 entry.padded_size = replenish_size;
             }
 
-            digest.update(buffer_pos, write.size);
-            entry.checksum = digest.checksum();
+            if (entry.isCompressed())
+            {
+                entry.checksum = compressed_writes[write_index].uncompressed_checksum;
+            }
+            else
+            {
+                digest.update(buffer_pos, write.size);
+                entry.checksum = digest.checksum();
+            }
 
             UInt64 field_begin, field_end;
 
@@ -676,6 +868,10 @@ void BlobStore<Trait>::remove(const PageEntries & del_entries) NO_THREAD_SAFETY_
             continue;
         }
 
+        // The location may be reused by other pages after it is removed
+        if (auto * page_cache = getPageCache(entry.file_id); page_cache != nullptr)
+            page_cache->remove(PageCacheKey{.file_id = entry.file_id, .offset = entry.offset});
+
         try
         {
             removePosFromStats(entry.file_id, entry.offset, entry.getTotalSize());
@@ -716,20 +912,23 @@ void BlobStore<Trait>::remove(const PageEntries & del_entries) NO_THREAD_SAFETY_
 }
 
 template <typename Trait>
-std::pair<BlobFileId, BlobFileOffset> BlobStore<Trait>::getPosFromStats(size_t size, PageType page_type)
-    NO_THREAD_SAFETY_ANALYSIS
+std::pair<BlobFileId, BlobFileOffset> BlobStore<Trait>::getPosFromStats(
+    size_t size,
+    PageType page_type,
+    bool for_gc) NO_THREAD_SAFETY_ANALYSIS
 {
     Stopwatch watch;
     BlobStatPtr stat;
 
-    auto lock_stat = [size, this, &stat, &page_type]() NO_THREAD_SAFETY_ANALYSIS {
+    auto lock_stat = [size, this, &stat, &page_type, for_gc]() NO_THREAD_SAFETY_ANALYSIS {
         auto lock_stats = blob_stats.lock();
         BlobFileId blob_file_id = INVALID_BLOBFILE_ID;
-        std::tie(stat, blob_file_id) = blob_stats.chooseStat(size, page_type, lock_stats);
+        std::tie(stat, blob_file_id) = blob_stats.chooseStat(size, page_type, lock_stats, for_gc);
         if (stat == nullptr)
         {
             // No valid stat for putting data with `size`, create a new one
             stat = blob_stats.createStat(blob_file_id, std::max(size, config.file_limit_size.get()), lock_stats);
+            stat->is_gc_output = for_gc;
         }
 
         // We must get the lock from BlobStat under the BlobStats lock
@@ -830,6 +1029,38 @@ typename BlobStore<Trait>::PageMap BlobStore<Trait>::read(FieldReadInfos & to_re
         return {};
     }
 
+    PageMap page_map;
+    if (!page_caches.empty())
+    {
+        // The pages that can be cached are read as a whole through the page cache, and then the fields are
+        // copied from the whole pages. So the hot small pages that are always read by fields can be cached.
+        FieldReadInfos infos_through_cache;
+        std::erase_if(to_read, [&](const FieldReadInfo & info) {
+            auto * page_cache = getPageCache(info.entry.file_id);
+            if (page_cache == nullptr || info.entry.getDataSize() > page_cache->maxEntrySize())
+                return false;
+            infos_through_cache.push_back(info);
+            return true;
+        });
+        if (!infos_through_cache.empty())
+        {
+            PageIdAndEntries entries;
+            entries.reserve(infos_through_cache.size());
+            for (const auto & info : infos_through_cache)
+                entries.emplace_back(info.page_id, info.entry);
+            const auto whole_pages = read(entries, read_limiter);
+            for (const auto & info : infos_through_cache)
+            {
+                const auto page_map_key = Trait::PageIdTrait::getPageMapKey(info.page_id);
+                page_map.emplace(
+                    page_map_key,
+                    copyFieldsToPage(info.page_id, whole_pages.at(page_map_key), info.fields));
+            }
+        }
+        if (to_read.empty())
+            return page_map;
+    }
+
     ProfileEvents::increment(ProfileEvents::PSMReadPages, to_read.size());
 
     // Sort in ascending order by offset in file.
@@ -851,7 +1082,6 @@ typename BlobStore<Trait>::PageMap BlobStore<Trait>::read(FieldReadInfos & to_re
         }
     }
 
-    PageMap page_map;
     if (unlikely(buf_size == 0))
     {
         // We should never persist an empty column inside a block. If the buf size is 0
@@ -898,42 +1128,63 @@ typename BlobStore<Trait>::PageMap BlobStore<Trait>::read(FieldReadInfos & to_re
     {
         size_t read_size_this_entry = 0;
         char * write_offset = pos;
-        for (const auto field_index : fields)
+        for (size_t run_begin = 0; run_begin < fields.size();)
         {
-            // TODO: Continuously fields can read by one system call.
-            const auto [beg_offset, end_offset] = entry.getFieldOffsets(field_index);
-            const auto size_to_read = end_offset - beg_offset;
-            auto blob_file
-                = read(page_id_v3, entry.file_id, entry.offset + beg_offset, write_offset, size_to_read, read_limiter);
-            fields_offset_in_page.emplace(field_index, read_size_this_entry);
-
-            if constexpr (BLOBSTORE_CHECKSUM_ON_READ)
+            // The fields are sorted, read the continuous fields by one system call.
+            const auto run_beg_offset = entry.getFieldOffsets(fields[run_begin]).first;
+            auto run_end_offset = entry.getFieldOffsets(fields[run_begin]).second;
+            size_t run_end = run_begin + 1;
+            for (; run_end < fields.size(); ++run_end)
             {
-                const auto expect_checksum = entry.field_offsets[field_index].second;
-                ChecksumClass digest;
-                digest.update(write_offset, size_to_read);
-                auto field_checksum = digest.checksum();
-                if (unlikely(entry.size != 0 && field_checksum != expect_checksum))
+                const auto [beg_offset, end_offset] = entry.getFieldOffsets(fields[run_end]);
+                if (beg_offset != run_end_offset)
+                    break;
+                run_end_offset = end_offset;
+            }
+            auto blob_file = read(
+                page_id_v3,
+                entry.file_id,
+                entry.offset + run_beg_offset,
+                write_offset,
+                run_end_offset - run_beg_offset,
+                read_limiter);
+
+            for (size_t i = run_begin; i < run_end; ++i)
+            {
+                const auto field_index = fields[i];
+                const auto [beg_offset, end_offset] = entry.getFieldOffsets(field_index);
+                const auto size_to_read = end_offset - beg_offset;
+                fields_offset_in_page.emplace(field_index, read_size_this_entry);
+
+                if constexpr (BLOBSTORE_CHECKSUM_ON_READ)
                 {
-                    throw Exception(
-                        ErrorCodes::CHECKSUM_DOESNT_MATCH,
-                        "Reading with fields meet checksum not match "
-                        "[page_id={}] [expected=0x{:X}] [actual=0x{:X}] "
-                        "[field_index={}] [field_offset={}] [field_size={}] "
-                        "[entry={}] [file={}]",
-                        page_id_v3,
-                        expect_checksum,
-                        field_checksum,
-                        field_index,
-                        beg_offset,
-                        size_to_read,
-                        entry,
-                        blob_file->getPath());
+                    const auto expect_checksum = entry.field_offsets[field_index].second;
+                    ChecksumClass digest;
+                    digest.update(write_offset, size_to_read);
+                    auto field_checksum = digest.checksum();
+                    if (unlikely(entry.size != 0 && field_checksum != expect_checksum))
+                    {
+                        throw Exception(
+                            ErrorCodes::CHECKSUM_DOESNT_MATCH,
+                            "Reading with fields meet checksum not match "
+                            "[page_id={}] [expected=0x{:X}] [actual=0x{:X}] "
+                            "[field_index={}] [field_offset={}] [field_size={}] "
+                            "[entry={}] [file={}]",
+                            page_id_v3,
+                            expect_checksum,
+                            field_checksum,
+                            field_index,
+                            beg_offset,
+                            size_to_read,
+                            entry,
+                            blob_file->getPath());
+                    }
                 }
-            }
 
-            read_size_this_entry += size_to_read;
-            write_offset += size_to_read;
+                read_size_this_entry += size_to_read;
+                write_offset += size_to_read;
+            }
+            run_begin = run_end;
         }
 
         Page page(Trait::PageIdTrait::getU64ID(page_id_v3));
@@ -978,25 +1229,63 @@ typename BlobStore<Trait>::PageMap BlobStore<Trait>::read(
         return {};
     }
 
+    PageMap page_map;
+    if (!page_caches.empty())
+    {
+        // Only the pages missed by the page cache are read from BlobFiles
+        std::erase_if(entries, [&](const PageIdAndEntry & id_entry) {
+            auto page = readFromPageCache(id_entry.first, id_entry.second);
+            if (!page)
+                return false;
+            page_map.emplace(Trait::PageIdTrait::getPageMapKey(id_entry.first), std::move(*page));
+            return true;
+        });
+        if (entries.empty())
+            return page_map;
+    }
+
     ProfileEvents::increment(ProfileEvents::PSMReadPages, entries.size());
 
-    // Sort in ascending order by offset in file.
+    // Sort in ascending order by blob file and offset in file.
     std::sort(entries.begin(), entries.end(), [](const auto & a, const auto & b) {
-        return a.second.offset < b.second.offset;
+        return std::tie(a.second.file_id, a.second.offset) < std::tie(b.second.file_id, b.second.offset);
     });
 
+    // Merge the pages that are adjacent in the same blob file into one read, the padding
+    // between them is also read into the buffer.
+    struct ReadRange
+    {
+        size_t first_entry_idx;
+        BlobFileOffset offset;
+        size_t size;
+    };
+    std::vector<ReadRange> ranges;
     // allocate data_buf that can hold all pages
     size_t buf_size = 0;
-    for (const auto & p : entries)
+    for (size_t i = 0; i < entries.size(); ++i)
     {
-        buf_size += p.second.size;
+        const auto & entry = entries[i].second;
+        if (!ranges.empty())
+        {
+            auto & last_range = ranges.back();
+            const auto & prev_entry = entries[i - 1].second;
+            if (prev_entry.file_id == entry.file_id && last_range.offset + last_range.size == prev_entry.offset + prev_entry.size
+                && prev_entry.offset + prev_entry.getTotalSize() == entry.offset)
+            {
+                const size_t extend_size = prev_entry.padded_size + entry.size;
+                last_range.size += extend_size;
+                buf_size += extend_size;
+                continue;
+            }
+        }
+        ranges.emplace_back(ReadRange{.first_entry_idx = i, .offset = entry.offset, .size = entry.size});
+        buf_size += entry.size;
     }
 
     // When we read `WriteBatch` which is `WriteType::PUT_EXTERNAL`.
     // The `buf_size` will be 0, we need avoid calling malloc/free with size 0.
     if (buf_size == 0)
     {
-        PageMap page_map;
         for (const auto & [page_id_v3, entry] : entries)
         {
             // Unexpected behavior but do no harm
@@ -1011,45 +1300,69 @@ typename BlobStore<Trait>::PageMap BlobStore<Trait>::read(
     MemHolder mem_holder = createMemHolder(data_buf, [&, buf_size](char * p) { free(p, buf_size); });
 
     char * pos = data_buf;
-    PageMap page_map;
-    for (const auto & [page_id_v3, entry] : entries)
+    for (size_t range_idx = 0; range_idx < ranges.size(); ++range_idx)
     {
-        auto blob_file = read(page_id_v3, entry.file_id, entry.offset, pos, entry.size, read_limiter);
-
-        if constexpr (BLOBSTORE_CHECKSUM_ON_READ)
+        const auto & range = ranges[range_idx];
+        const size_t end_entry_idx
+            = range_idx + 1 < ranges.size() ? ranges[range_idx + 1].first_entry_idx : entries.size();
+        const auto & first_page_id = entries[range.first_entry_idx].first;
+        const auto blob_id = entries[range.first_entry_idx].second.file_id;
+        auto blob_file = read(first_page_id, blob_id, range.offset, pos, range.size, read_limiter);
+
+        for (size_t entry_idx = range.first_entry_idx; entry_idx < end_entry_idx; ++entry_idx)
         {
-            ChecksumClass digest;
-            digest.update(pos, entry.size);
-            auto checksum = digest.checksum();
-            if (unlikely(entry.size != 0 && checksum != entry.checksum))
+            const auto & [page_id_v3, entry] = entries[entry_idx];
+            char * page_pos = pos + (entry.offset - range.offset);
+            // The checksum of a compressed page is computed over the uncompressed data
+            std::optional<Page> decompressed_page;
+            if (entry.isCompressed())
+                decompressed_page = decompressPage(page_id_v3, entry, page_pos);
+            if constexpr (BLOBSTORE_CHECKSUM_ON_READ)
             {
-                throw Exception(
-                    fmt::format(
-                        "Reading with entries meet checksum not match [page_id={}] [expected=0x{:X}] [actual=0x{:X}] "
-                        "[entry={}] [file={}]",
-                        page_id_v3,
-                        entry.checksum,
-                        checksum,
-                        entry,
-                        blob_file->getPath()),
-                    ErrorCodes::CHECKSUM_DOESNT_MATCH);
+                ChecksumClass digest;
+                if (decompressed_page)
+                    digest.update(decompressed_page->data.data(), decompressed_page->data.size());
+                else
+                    digest.update(page_pos, entry.size);
+                auto checksum = digest.checksum();
+                if (unlikely(entry.size != 0 && checksum != entry.checksum))
+                {
+                    throw Exception(
+                        fmt::format(
+                            "Reading with entries meet checksum not match [page_id={}] [expected=0x{:X}] "
+                            "[actual=0x{:X}] [entry={}] [file={}]",
+                            page_id_v3,
+                            entry.checksum,
+                            checksum,
+                            entry,
+                            blob_file->getPath()),
+                        ErrorCodes::CHECKSUM_DOESNT_MATCH);
+                }
             }
-        }
 
-        Page page(Trait::PageIdTrait::getU64ID(page_id_v3));
-        page.data = std::string_view(pos, entry.size);
-        page.mem_holder = mem_holder;
+            if (decompressed_page)
+            {
+                putToPageCache(entry, *decompressed_page);
+                page_map.emplace(Trait::PageIdTrait::getPageMapKey(page_id_v3), std::move(*decompressed_page));
+                continue;
+            }
 
-        // Calculate the field_offsets from page entry
-        for (size_t index = 0; index < entry.field_offsets.size(); index++)
-        {
-            const auto offset = entry.field_offsets[index].first;
-            page.field_offsets.emplace(index, offset);
-        }
+            Page page(Trait::PageIdTrait::getU64ID(page_id_v3));
+            page.data = std::string_view(page_pos, entry.size);
+            page.mem_holder = mem_holder;
 
-        page_map.emplace(Trait::PageIdTrait::getPageMapKey(page_id_v3), std::move(page));
+            // Calculate the field_offsets from page entry
+            for (size_t index = 0; index < entry.field_offsets.size(); index++)
+            {
+                const auto offset = entry.field_offsets[index].first;
+                page.field_offsets.emplace(index, offset);
+            }
 
-        pos += entry.size;
+            putToPageCache(entry, page);
+            page_map.emplace(Trait::PageIdTrait::getPageMapKey(page_id_v3), std::move(page));
+        }
+
+        pos += range.size;
     }
 
     if (unlikely(pos != data_buf + buf_size))
@@ -1095,14 +1408,24 @@ Page BlobStore<Trait>::read(const PageIdAndEntry & id_entry, const ReadLimiterPt
         return page;
     }
 
+    if (auto page = readFromPageCache(page_id_v3, entry); page)
+        return std::move(*page);
+
     char * data_buf = static_cast<char *>(alloc(buf_size));
     MemHolder mem_holder = createMemHolder(data_buf, [&, buf_size](char * p) { free(p, buf_size); });
 
     auto blob_file = read(page_id_v3, entry.file_id, entry.offset, data_buf, buf_size, read_limiter);
+    // The checksum of a compressed page is computed over the uncompressed data
+    std::optional<Page> decompressed_page;
+    if (entry.isCompressed())
+        decompressed_page = decompressPage(page_id_v3, entry, data_buf);
     if constexpr (BLOBSTORE_CHECKSUM_ON_READ)
     {
         ChecksumClass digest;
-        digest.update(data_buf, entry.size);
+        if (decompressed_page)
+            digest.update(decompressed_page->data.data(), decompressed_page->data.size());
+        else
+            digest.update(data_buf, entry.size);
         auto checksum = digest.checksum();
         if (unlikely(entry.size != 0 && checksum != entry.checksum))
         {
@@ -1119,6 +1442,12 @@ Page BlobStore<Trait>::read(const PageIdAndEntry & id_entry, const ReadLimiterPt
         }
     }
 
+    if (decompressed_page)
+    {
+        putToPageCache(entry, *decompressed_page);
+        return std::move(*decompressed_page);
+    }
+
     Page page(Trait::PageIdTrait::getU64ID(page_id_v3));
     page.data = std::string_view(data_buf, buf_size);
     page.mem_holder = mem_holder;
@@ -1130,6 +1459,8 @@ Page BlobStore<Trait>::read(const PageIdAndEntry & id_entry, const ReadLimiterPt
         page.field_offsets.emplace(index, offset);
     }
 
+    putToPageCache(entry, page);
+
     return page;
 }
 
@@ -1408,7 +1739,7 @@ void BlobStore<Trait>::gc(
     BlobFileOffset offset_in_data = 0;
     BlobFileId blobfile_id;
     BlobFileOffset file_offset_begin;
-    std::tie(blobfile_id, file_offset_begin) = getPosFromStats(alloc_size, page_type);
+    std::tie(blobfile_id, file_offset_begin) = getPosFromStats(alloc_size, page_type, /*for_gc*/ true);
 
     // blob_file_0, [<page_id_0, ver0, entry0>,
     //               <page_id_0, ver1, entry1>,
@@ -1445,7 +1776,8 @@ void BlobStore<Trait>::gc(
                 // Acquire a span from stats for remaining data
                 auto next_alloc_size = (remaining_page_size > alloc_size ? alloc_size : remaining_page_size);
                 remaining_page_size -= next_alloc_size;
-                std::tie(blobfile_id, file_offset_begin) = getPosFromStats(next_alloc_size, page_type);
+                std::tie(blobfile_id, file_offset_begin)
+                    = getPosFromStats(next_alloc_size, page_type, /*for_gc*/ true);
             }
             assert(offset_in_data + entry.size <= alloc_size);
 
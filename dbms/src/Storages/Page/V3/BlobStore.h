@@ -21,6 +21,7 @@
 #include <Storages/Page/V3/Blob/BlobConfig.h>
 #include <Storages/Page/V3/Blob/BlobFile.h>
 #include <Storages/Page/V3/Blob/BlobStat.h>
+#include <Storages/Page/V3/PageCache.h>
 #include <Storages/Page/V3/PageDefines.h>
 #include <Storages/Page/V3/PageDirectory/PageIdTrait.h>
 #include <Storages/Page/V3/PageEntriesEdit.h>
@@ -29,6 +30,7 @@
 #include <Storages/Page/V3/spacemap/SpaceMap.h>
 
 #include <mutex>
+#include <optional>
 #include <unordered_map>
 
 namespace DB
@@ -126,6 +128,33 @@ private:
         PageType page_type,
         const WriteLimiterPtr & write_limiter = nullptr);
 
+    /**
+     *  Compress the data of the writes in `wb` with the compression method of `page_type`.
+     *  Only the pages without fields are compressed, so reading some fields of a page does not need
+     *  to read the whole page. The data of a compressed write is replaced by the compressed bytes.
+     *  Return the uncompressed size and the checksum of the uncompressed data of each write, the
+     *  uncompressed size is 0 if the write is not compressed.
+     */
+    struct CompressedWrite
+    {
+        PageSize uncompressed_size = 0;
+        UInt64 uncompressed_checksum = 0;
+    };
+    std::vector<CompressedWrite> compressWrites(typename Trait::WriteBatch & wb, PageType page_type);
+
+    // Decompress the page data read from BlobFile into a new buffer held by the returned page.
+    Page decompressPage(const PageId & page_id_v3, const PageEntryV3 & entry, const char * compressed_data);
+
+    // Return the page cache of the BlobFile, nullptr if the page cache of its type is disabled.
+    PageCache * getPageCache(BlobFileId blob_id) const;
+
+    std::optional<Page> readFromPageCache(const PageId & page_id_v3, const PageEntryV3 & entry) const;
+
+    void putToPageCache(const PageEntryV3 & entry, const Page & page) const;
+
+    // Copy the data of `fields` in the whole page `page` into a new page that is the same as reading these fields.
+    Page copyFieldsToPage(const PageId & page_id_v3, const Page & page, std::vector<size_t> fields);
+
     BlobFilePtr read(
         const PageId & page_id_v3,
         BlobFileId blob_id,
@@ -139,8 +168,9 @@ private:
      *  Ask BlobStats to get a span from BlobStat.
      *  We will lock BlobStats until we get a BlobStat that can hold the size.
      *  Then lock the BlobStat to get the span.
+     *  The pages migrated by GC (`for_gc` is true) are put into separate BlobFiles from the newly written pages.
      */
-    std::pair<BlobFileId, BlobFileOffset> getPosFromStats(size_t size, PageType page_type);
+    std::pair<BlobFileId, BlobFileOffset> getPosFromStats(size_t size, PageType page_type, bool for_gc = false);
 
     /**
      *  Request a specific BlobStat to delete a certain span.
@@ -173,6 +203,9 @@ private:
 
     std::mutex mtx_blob_files;
     std::unordered_map<BlobFileId, BlobFilePtr> blob_files;
+
+    // The memory cache of the page data of each PageType, only created for the types with `page_cache_size` > 0.
+    std::unordered_map<PageType, PageCachePtr> page_caches;
 };
 namespace u128
 {
@@ -181,6 +181,13 @@ std::unordered_set<String> getRemoteFileIdsNeedCompact(
     GET_METRIC(tiflash_storage_remote_stats, type_num_files).Set(summary.num_files);
     GET_METRIC(tiflash_storage_remote_stats, type_total_size).Set(summary.total_size);
     GET_METRIC(tiflash_storage_remote_stats, type_valid_size).Set(summary.valid_size);
+    // The files with low valid rate amplify the reads of FAP and the storage cost, and the small files amplify the
+    // number of objects. Export how many of them are waiting for compaction.
+    size_t size_to_compact = 0;
+    for (const auto & f : remote_infos.to_compact)
+        size_to_compact += f.total_size;
+    GET_METRIC(tiflash_storage_remote_stats, type_num_files_to_compact).Set(remote_infos.to_compact.size());
+    GET_METRIC(tiflash_storage_remote_stats, type_size_to_compact).Set(size_to_compact);
 
     auto compact_files = remote_infos.getCompactCandidates();
     LOG_IMPL(
@@ -17,6 +17,7 @@
 #include <Storages/Page/V3/PageEntriesEdit.h>
 #include <Storages/Page/V3/PageEntryCheckpointInfo.h>
 #include <Storages/Page/V3/Universal/UniversalPageIdFormatImpl.h>
+#include <common/ThreadPool.h>
 #include <fmt/core.h>
 
 #include <memory>
@@ -31,6 +32,7 @@ CPFilesWriter::CPFilesWriter(CPFilesWriter::Options options)
     , data_file_path_pattern(options.data_file_path_pattern)
     , sequence(options.sequence)
     , max_data_file_size(options.max_data_file_size)
+    , read_concurrency(std::max<size_t>(1, options.read_concurrency))
     , manifest_writer(CPManifestFileWriter::create({
           .file_path = options.manifest_file_path,
           .max_edit_records_per_part = options.max_edit_records_per_part,
@@ -91,6 +93,14 @@ CPDataDumpStats CPFilesWriter::writeEditsAndApplyCheckpointInfo(
     std::unordered_map<String, size_t> compact_stats;
     bool last_page_is_raft_data = true;
 
+    struct PendingDataWrite
+    {
+        universal::PageEntriesEdit::EditRecord * rec_edit;
+        StorageType storage_type;
+        bool is_compaction;
+    };
+    std::vector<PendingDataWrite> pending_writes;
+
     // 1. Iterate all edits, find these entry edits without the checkpoint info
     //    and collect the lock files from applied entries.
     auto & records = edits.getMutRecords();
@@ -168,33 +178,98 @@ CPDataDumpStats CPFilesWriter::writeEditsAndApplyCheckpointInfo(
             compact_stats.try_emplace(file_id, 0).first->second += rec_edit.entry.size;
         }
 
-        bool current_page_is_raft_data = (id_storage_type == StorageType::RaftEngine);
-        if (current_write_size
-                > 0 // If current_write_size is 0, data_writer is a empty file, not need to create a new one.
-            && (current_page_is_raft_data != last_page_is_raft_data // Data type changed
-                || (max_data_file_size != 0 && current_write_size >= max_data_file_size))) // or reach size limit.
-        {
-            newDataWriter();
-        }
-        last_page_is_raft_data = current_page_is_raft_data;
+        pending_writes.emplace_back(PendingDataWrite{
+            .rec_edit = &rec_edit,
+            .storage_type = id_storage_type,
+            .is_compaction = is_compaction,
+        });
+    }
 
-        // 2. For entry edits without the checkpoint info, or it is stored on an existing data file that needs compact,
-        // write the entry data to the data file, and assign a new checkpoint info.
+    // 2. For entry edits without the checkpoint info, or it is stored on an existing data file that needs compact,
+    // write the entry data to the data file, and assign a new checkpoint info.
+    // Reading the page data costs most of the time, so read the pages by batch concurrently, and then write
+    // them to the data files one by one to keep the same order as the edits.
+    std::unique_ptr<legacy::ThreadPool> read_pool;
+    if (read_concurrency > 1 && pending_writes.size() > 1)
+        read_pool = std::make_unique<legacy::ThreadPool>(read_concurrency);
+
+    auto read_page = [this](const PendingDataWrite & pending_write) {
+        const auto & rec_edit = *pending_write.rec_edit;
         try
         {
             auto page = data_source->read({rec_edit.page_id, rec_edit.entry});
             RUNTIME_CHECK_MSG(page.isValid(), "failed to read page, record={}", rec_edit);
+            return page;
+        }
+        catch (...)
+        {
+            LOG_ERROR(log, "failed to read page, record={}", rec_edit);
+            tryLogCurrentException(__PRETTY_FUNCTION__);
+            throw;
+        }
+    };
+
+    std::vector<Page> pages;
+    for (size_t batch_begin = 0; batch_begin < pending_writes.size();)
+    {
+        size_t batch_end = batch_begin;
+        size_t batch_bytes = 0;
+        while (batch_end < pending_writes.size() && (batch_end == batch_begin || batch_bytes < read_batch_bytes))
+        {
+            batch_bytes += pending_writes[batch_end].rec_edit->entry.size;
+            ++batch_end;
+        }
+
+        pages.clear();
+        pages.resize(batch_end - batch_begin, Page::invalidPage());
+        if (read_pool != nullptr && pages.size() > 1)
+        {
+            const size_t num_tasks = std::min(read_concurrency, pages.size());
+            for (size_t task_idx = 0; task_idx < num_tasks; ++task_idx)
+            {
+                read_pool->schedule([&, task_idx, num_tasks] {
+                    for (size_t i = task_idx; i < pages.size(); i += num_tasks)
+                        pages[i] = read_page(pending_writes[batch_begin + i]);
+                });
+            }
+            read_pool->wait();
+        }
+        else
+        {
+            for (size_t i = 0; i < pages.size(); ++i)
+                pages[i] = read_page(pending_writes[batch_begin + i]);
+        }
+
+        for (size_t i = 0; i < pages.size(); ++i)
+        {
+            const auto & pending_write = pending_writes[batch_begin + i];
+            auto & rec_edit = *pending_write.rec_edit;
+            const auto & page = pages[i];
+
+            bool current_page_is_raft_data = (pending_write.storage_type == StorageType::RaftEngine);
+            if (current_write_size
+                    > 0 // If current_write_size is 0, data_writer is a empty file, not need to create a new one.
+                && (current_page_is_raft_data != last_page_is_raft_data // Data type changed
+                    || (max_data_file_size != 0 && current_write_size >= max_data_file_size))) // or reach size limit.
+            {
+                newDataWriter();
+            }
+            last_page_is_raft_data = current_page_is_raft_data;
+
             auto data_location
                 = data_writer->write(rec_edit.page_id, rec_edit.version, page.data.begin(), page.data.size());
             // the page data size uploaded in this checkpoint
-            write_down_stats.num_bytes[static_cast<size_t>(id_storage_type)] += rec_edit.entry.size;
+            write_down_stats.num_bytes[static_cast<size_t>(pending_write.storage_type)] += rec_edit.entry.size;
             current_write_size += data_location.size_in_file;
-            RUNTIME_CHECK(page.data.size() == rec_edit.entry.size, page.data.size(), rec_edit.entry.size);
+            RUNTIME_CHECK(
+                page.data.size() == rec_edit.entry.getDataSize(),
+                page.data.size(),
+                rec_edit.entry.getDataSize());
             bool is_local_data_reclaimed
                 = rec_edit.entry.checkpoint_info.has_value() && rec_edit.entry.checkpoint_info.is_local_data_reclaimed;
             rec_edit.entry.checkpoint_info = OptionalCheckpointInfo(data_location, true, is_local_data_reclaimed);
             locked_files.emplace(*data_location.data_file_id);
-            if (is_compaction)
+            if (pending_write.is_compaction)
             {
                 write_down_stats.compact_data_bytes += rec_edit.entry.size;
                 write_down_stats.num_pages_compact += 1;
@@ -205,12 +280,7 @@ CPDataDumpStats CPFilesWriter::writeEditsAndApplyCheckpointInfo(
                 write_down_stats.num_pages_incremental += 1;
             }
         }
-        catch (...)
-        {
-            LOG_ERROR(log, "failed to read page, record={}", rec_edit);
-            tryLogCurrentException(__PRETTY_FUNCTION__);
-            throw;
-        }
+        batch_begin = batch_end;
     }
 
     LOG_DEBUG(log, "compact stats: {}", compact_stats);
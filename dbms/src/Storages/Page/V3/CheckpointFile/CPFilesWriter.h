@@ -50,6 +50,8 @@ public:
         UInt64 sequence;
         UInt64 max_data_file_size = 256 * 1024 * 1024;
         UInt64 max_edit_records_per_part = 100000;
+        // The number of threads to read the page data concurrently.
+        UInt64 read_concurrency = 1;
     };
 
     static CPFilesWriterPtr create(Options options) { return std::make_unique<CPFilesWriter>(std::move(options)); }
@@ -120,6 +122,9 @@ public:
     const String data_file_path_pattern;
     const UInt64 sequence;
     const UInt64 max_data_file_size;
+    const size_t read_concurrency;
+    // The max bytes of page data read concurrently before writing them to the data file.
+    static constexpr size_t read_batch_bytes = 64 * 1024 * 1024;
     Int32 data_file_index = 0;
     CPDataFileWriterPtr data_writer;
     const CPManifestFileWriterPtr manifest_writer;
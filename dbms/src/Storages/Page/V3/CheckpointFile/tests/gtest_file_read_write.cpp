@@ -283,6 +283,66 @@ try
 }
 CATCH
 
+TEST_F(CheckpointFileTest, WriteEditsWithConcurrentRead)
+try
+{
+    const size_t num_pages = 100;
+    std::unordered_map<size_t, std::string> data;
+    for (size_t i = 0; i < num_pages; ++i)
+        data.emplace(i, fmt::format("page_data_{}", i));
+
+    auto writer = CPFilesWriter::create({
+        .data_file_path_pattern = data_file_path_pattern,
+        .data_file_id_pattern = data_file_id_pattern,
+        .manifest_file_path = manifest_file_path,
+        .manifest_file_id = manifest_file_id,
+        .data_source = CPWriteDataSourceFixture::create(data),
+        .read_concurrency = 4,
+    });
+
+    writer->writePrefix({
+        .writer = {},
+        .sequence = 5,
+        .last_sequence = 3,
+    });
+    {
+        auto edits = universal::PageEntriesEdit{};
+        for (size_t i = 0; i < num_pages; ++i)
+        {
+            edits.appendRecord(
+                {.type = EditRecordType::VAR_ENTRY,
+                 .page_id = fmt::format("page_{}", i),
+                 .entry = {.size = static_cast<PageSize>(data[i].size()), .offset = i}});
+        }
+        auto stats = writer->writeEditsAndApplyCheckpointInfo(edits);
+        ASSERT_EQ(num_pages, stats.num_pages_incremental);
+    }
+    auto data_paths = writer->writeSuffix();
+    writer.reset();
+
+    auto manifest_file = PosixRandomAccessFile::create(manifest_file_path);
+    auto manifest_reader = CPManifestFileReader::create({
+        .plain_file = manifest_file,
+    });
+    manifest_reader->readPrefix();
+    CheckpointProto::StringsInternMap im;
+    auto edits_r = manifest_reader->readEdits(im);
+    ASSERT_TRUE(edits_r.has_value());
+    auto r = edits_r->getRecords();
+    ASSERT_EQ(num_pages, r.size());
+    // The pages are written in the same order as the edits
+    UInt64 last_offset_in_file = 0;
+    for (size_t i = 0; i < num_pages; ++i)
+    {
+        ASSERT_EQ(fmt::format("page_{}", i), r[i].page_id);
+        const auto & location = r[i].entry.checkpoint_info.data_location;
+        ASSERT_GT(location.offset_in_file, last_offset_in_file);
+        last_offset_in_file = location.offset_in_file;
+        ASSERT_EQ(data[i], readData(location));
+    }
+}
+CATCH
+
 TEST_F(CheckpointFileTest, WriteEditsWithCheckpointInfo)
 try
 {
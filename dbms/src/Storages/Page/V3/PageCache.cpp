@@ -0,0 +1,70 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <Common/ProfileEvents.h>
+#include <Storages/Page/V3/PageCache.h>
+
+namespace ProfileEvents
+{
+extern const Event PSMPageCacheHits;
+extern const Event PSMPageCacheMisses;
+} // namespace ProfileEvents
+
+namespace DB::PS::V3
+{
+PageCache::PageCache(size_t max_size_in_bytes)
+    : max_entry_size(max_size_in_bytes * probationary_ratio_percent / 100 / 16)
+    , probationary(max_size_in_bytes * probationary_ratio_percent / 100)
+    , protected_segment(max_size_in_bytes - max_size_in_bytes * probationary_ratio_percent / 100)
+{}
+
+PageCacheValuePtr PageCache::get(const PageCacheKey & key)
+{
+    if (auto value = protected_segment.get(key); value)
+    {
+        hits.fetch_add(1, std::memory_order_relaxed);
+        ProfileEvents::increment(ProfileEvents::PSMPageCacheHits);
+        return value;
+    }
+
+    if (auto value = probationary.get(key); value)
+    {
+        // Read for the second time, promote it to the protected segment
+        probationary.remove(key);
+        protected_segment.set(key, value);
+        hits.fetch_add(1, std::memory_order_relaxed);
+        ProfileEvents::increment(ProfileEvents::PSMPageCacheHits);
+        return value;
+    }
+
+    misses.fetch_add(1, std::memory_order_relaxed);
+    ProfileEvents::increment(ProfileEvents::PSMPageCacheMisses);
+    return nullptr;
+}
+
+void PageCache::set(const PageCacheKey & key, const PageCacheValuePtr & value)
+{
+    if (value->data.size() > max_entry_size)
+        return;
+    probationary.set(key, value);
+}
+
+void PageCache::remove(const PageCacheKey & key)
+{
+    probationary.remove(key);
+    protected_segment.remove(key);
+}
+
+} // namespace DB::PS::V3
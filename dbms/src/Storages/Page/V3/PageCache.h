@@ -0,0 +1,113 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Storages/Page/V3/PageDefines.h>
+#include <common/types.h>
+
+#include <atomic>
+#include <memory>
+
+namespace DB::PS::V3
+{
+/// The location of the page data in BlobFiles. A new version of a page is always written to a new location, and a
+/// location is reused only after the entries on it are removed from BlobStore, so it identifies a version of page data.
+struct PageCacheKey
+{
+    BlobFileId file_id;
+    BlobFileOffset offset;
+
+    bool operator==(const PageCacheKey & rhs) const { return file_id == rhs.file_id && offset == rhs.offset; }
+};
+
+struct PageCacheKeyHash
+{
+    size_t operator()(const PageCacheKey & key) const
+    {
+        return std::hash<UInt64>()(key.file_id) ^ (std::hash<UInt64>()(key.offset) << 1);
+    }
+};
+
+struct PageCacheValue
+{
+    // The checksum of the entry, used to double check the cached data is the same version as the entry to read.
+    UInt64 checksum = 0;
+    // The uncompressed page data
+    String data;
+};
+using PageCacheValuePtr = std::shared_ptr<PageCacheValue>;
+
+struct PageCacheWeightFunction
+{
+    size_t operator()(const PageCacheKey &, const PageCacheValue & value) const
+    {
+        // Besides the data, a cell costs the key in the hash table and the LRU queue
+        return value.data.size() + sizeof(PageCacheValue) + 2 * sizeof(PageCacheKey) + sizeof(std::list<PageCacheKey>);
+    }
+};
+
+/**
+ * A memory cache of the page data read from the BlobFiles of a BlobStore.
+ *
+ * It is a segmented LRU, which is a simplified 2Q that resists scans. A page read for the first time is put into
+ * the probationary segment, and it is promoted to the protected segment when it is read again. A large scan that
+ * reads every page once only evicts the pages in the probationary segment, the hot pages in the protected segment
+ * are kept.
+ */
+class PageCache
+{
+public:
+    explicit PageCache(size_t max_size_in_bytes);
+
+    /// Return the cached page data, or nullptr if it is not cached.
+    PageCacheValuePtr get(const PageCacheKey & key);
+
+    void set(const PageCacheKey & key, const PageCacheValuePtr & value);
+
+    /// Remove the cached page data, must be called before the location is reused by other pages.
+    void remove(const PageCacheKey & key);
+
+    /// The pages larger than this size are not cached, so that a few large pages can not evict all the others.
+    size_t maxEntrySize() const { return max_entry_size; }
+
+    size_t weight() const { return probationary.weight() + protected_segment.weight(); }
+
+    size_t count() const { return probationary.count() + protected_segment.count(); }
+
+    void getStats(size_t & out_hits, size_t & out_misses) const
+    {
+        out_hits = hits.load(std::memory_order_relaxed);
+        out_misses = misses.load(std::memory_order_relaxed);
+    }
+
+private:
+    using Segment = LRUCache<PageCacheKey, PageCacheValue, PageCacheKeyHash, PageCacheWeightFunction>;
+
+    // The ratio of the probationary segment in the whole cache
+    static constexpr size_t probationary_ratio_percent = 25;
+
+    const size_t max_entry_size;
+    Segment probationary;
+    Segment protected_segment;
+
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+};
+
+using PageCachePtr = std::unique_ptr<PageCache>;
+
+} // namespace DB::PS::V3
@@ -324,6 +324,7 @@ bool VersionedPageEntries<Trait>::updateLocalCacheForRemotePage(const PageVersio
         }
         ori_entry.file_id = entry.file_id;
         ori_entry.size = entry.size;
+        ori_entry.uncompressed_size = entry.uncompressed_size;
         ori_entry.offset = entry.offset;
         ori_entry.checksum = entry.checksum;
         ori_entry.checkpoint_info.is_local_data_reclaimed = false;
@@ -1005,8 +1006,9 @@ PageDirectorySnapshotPtr PageDirectory<Trait>::createSnapshot(const String & tra
     GET_METRIC(tiflash_storage_page_command_count, type_snapshot).Increment();
     auto snap = std::make_shared<PageDirectorySnapshot>(sequence.load(), tracing_id);
     {
-        std::lock_guard snapshots_lock(snapshots_mutex);
-        snapshots.emplace_back(std::weak_ptr<PageDirectorySnapshot>(snap));
+        auto & shard = snapshots_shards[snap->create_thread % num_snapshots_shards];
+        std::lock_guard snapshots_lock(shard.mutex);
+        shard.snapshots.emplace_back(std::weak_ptr<PageDirectorySnapshot>(snap));
     }
 
     CurrentMetrics::add(CurrentMetrics::PSMVCCSnapshotsList);
@@ -1018,14 +1020,15 @@ SnapshotsStatistics PageDirectory<Trait>::getSnapshotsStat() const
 {
     SnapshotsStatistics stat;
     DB::Int64 num_snapshots_removed = 0;
+    for (auto & shard : snapshots_shards)
     {
-        std::lock_guard lock(snapshots_mutex);
-        for (auto iter = snapshots.begin(); iter != snapshots.end(); /* empty */)
+        std::lock_guard lock(shard.mutex);
+        for (auto iter = shard.snapshots.begin(); iter != shard.snapshots.end(); /* empty */)
         {
             auto snapshot_ptr = iter->lock();
             if (!snapshot_ptr)
             {
-                iter = snapshots.erase(iter);
+                iter = shard.snapshots.erase(iter);
                 num_snapshots_removed++;
             }
             else
@@ -1560,6 +1563,9 @@ typename PageDirectory<Trait>::Writer * PageDirectory<Trait>::buildWriteGroup(
         last_writer = w;
         w->edit->clear(); // free the memory after `moved`
     }
+    // All writers in the group are committed to WAL by one record
+    GET_METRIC(tiflash_storage_page_write_group_size, type_writers).Observe(writers.size());
+    GET_METRIC(tiflash_storage_page_write_group_size, type_records).Observe(first->edit->size());
     return last_writer;
 }
 
@@ -2046,42 +2052,45 @@ typename PageDirectory<Trait>::PageEntries PageDirectory<Trait>::gcInMemEntries(
     UInt64 stale_snapshot_nums = 0;
     {
         // Cleanup released snapshots
-        std::lock_guard lock(snapshots_mutex);
         std::unordered_set<String> tracing_id_set;
-        for (auto iter = snapshots.begin(); iter != snapshots.end(); /* empty */)
+        for (auto & shard : snapshots_shards)
         {
-            if (auto snap = iter->lock(); snap == nullptr)
+            std::lock_guard lock(shard.mutex);
+            for (auto iter = shard.snapshots.begin(); iter != shard.snapshots.end(); /* empty */)
             {
-                iter = snapshots.erase(iter);
-                invalid_snapshot_nums++;
-            }
-            else
-            {
-                lowest_seq = std::min(lowest_seq, snap->sequence);
-                ++iter;
-                valid_snapshot_nums++;
-                const auto alive_time_seconds = snap->elapsedSeconds();
-
-                if (alive_time_seconds > 10 * 60) // TODO: Make `10 * 60` as a configuration
+                if (auto snap = iter->lock(); snap == nullptr)
+                {
+                    iter = shard.snapshots.erase(iter);
+                    invalid_snapshot_nums++;
+                }
+                else
                 {
-                    if (!tracing_id_set.contains(snap->tracing_id))
+                    lowest_seq = std::min(lowest_seq, snap->sequence);
+                    ++iter;
+                    valid_snapshot_nums++;
+                    const auto alive_time_seconds = snap->elapsedSeconds();
+
+                    if (alive_time_seconds > 10 * 60) // TODO: Make `10 * 60` as a configuration
                     {
-                        LOG_WARNING(
-                            log,
-                            "Meet a stale snapshot [thread id={}] [tracing id={}] [seq={}] [alive time(s)={}]",
-                            snap->create_thread,
-                            snap->tracing_id,
-                            snap->sequence,
-                            alive_time_seconds);
-                        tracing_id_set.emplace(snap->tracing_id);
+                        if (!tracing_id_set.contains(snap->tracing_id))
+                        {
+                            LOG_WARNING(
+                                log,
+                                "Meet a stale snapshot [thread id={}] [tracing id={}] [seq={}] [alive time(s)={}]",
+                                snap->create_thread,
+                                snap->tracing_id,
+                                snap->sequence,
+                                alive_time_seconds);
+                            tracing_id_set.emplace(snap->tracing_id);
+                        }
+                        stale_snapshot_nums++;
                     }
-                    stale_snapshot_nums++;
-                }
 
-                if (longest_alive_snapshot_time < alive_time_seconds)
-                {
-                    longest_alive_snapshot_time = alive_time_seconds;
-                    longest_alive_snapshot_seq = snap->sequence;
+                    if (longest_alive_snapshot_time < alive_time_seconds)
+                    {
+                        longest_alive_snapshot_time = alive_time_seconds;
+                        longest_alive_snapshot_seq = snap->sequence;
+                    }
                 }
             }
         }
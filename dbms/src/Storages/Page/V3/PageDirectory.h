@@ -32,6 +32,7 @@
 #include <common/defines.h>
 #include <common/types.h>
 
+#include <array>
 #include <magic_enum.hpp>
 #include <memory>
 #include <mutex>
@@ -616,8 +617,15 @@ private:
     mutable std::shared_mutex table_rw_mutex;
     MVCCMapType mvcc_table_directory;
 
-    mutable std::mutex snapshots_mutex;
-    mutable std::list<std::weak_ptr<PageDirectorySnapshot>> snapshots;
+    // The living snapshots are registered into shards chosen by the creating thread,
+    // so that creating snapshots from different threads won't contend on one mutex.
+    struct SnapshotsShard
+    {
+        std::mutex mutex;
+        std::list<std::weak_ptr<PageDirectorySnapshot>> snapshots;
+    };
+    static constexpr size_t num_snapshots_shards = 16;
+    mutable std::array<SnapshotsShard, num_snapshots_shards> snapshots_shards;
 
     mutable ExternalIdsByNamespace<typename Trait::PageIdTrait> external_ids_by_ns;
 
@@ -21,10 +21,12 @@
 #include <Storages/Page/V3/WAL/WALReader.h>
 #include <Storages/Page/V3/WAL/serialize.h>
 #include <Storages/Page/V3/WALStore.h>
+#include <common/ThreadPool.h>
 #include <common/logger_useful.h>
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace DB
 {
@@ -42,6 +44,7 @@ typename PageDirectoryFactory<Trait>::PageDirectoryPtr PageDirectoryFactory<Trai
     const WALConfig & config)
 {
     auto [wal, reader] = WALStore::create(storage_name, file_provider, delegator, config);
+    decode_concurrency = std::max<size_t>(1, config.restore_decode_concurrency);
     return createFromReader(storage_name, reader, std::move(wal));
 }
 
@@ -371,35 +374,87 @@ void PageDirectoryFactory<Trait>::loadFromDisk(const PageDirectoryPtr & dir, WAL
     if (max_applied_ver.sequence < checkpoint_snap_seq)
         max_applied_ver = PageVersion(checkpoint_snap_seq, 0);
 
-    while (reader->remained())
+    // Decoding the records costs most of the CPU time of restoring, while the edits must be
+    // applied in the order of records. So read the records by batch, decode them concurrently
+    // and then apply the decoded edits one by one.
+    std::unique_ptr<legacy::ThreadPool> decode_pool;
+    if (decode_concurrency > 1)
+        decode_pool = std::make_unique<legacy::ThreadPool>(decode_concurrency);
+
+    struct RecordToApply
+    {
+        bool from_checkpoint;
+        String record;
+        PageEntriesEdit edit;
+    };
+    std::vector<RecordToApply> batch;
+    bool reach_end = false;
+    while (!reach_end)
     {
-        auto [from_checkpoint, record] = reader->next();
-        if (!record)
+        batch.clear();
+        size_t batch_bytes = 0;
+        while (batch_bytes < restore_batch_bytes)
         {
-            // TODO: Handle error, some error could be ignored.
-            // If the file happened to some error,
-            // should truncate it to throw away incomplete data.
-            reader->throwIfError();
-            // else it just run to the end of file.
-            break;
+            if (!reader->remained())
+            {
+                reach_end = true;
+                break;
+            }
+            auto [from_checkpoint, record] = reader->next();
+            if (!record)
+            {
+                // TODO: Handle error, some error could be ignored.
+                // If the file happened to some error,
+                // should truncate it to throw away incomplete data.
+                reader->throwIfError();
+                // else it just run to the end of file.
+                reach_end = true;
+                break;
+            }
+            batch_bytes += record->size();
+            batch.emplace_back(RecordToApply{.from_checkpoint = from_checkpoint, .record = std::move(*record)});
         }
 
-        // The edits in later log files may have some overlap with the first checkpoint file.
-        // But we want to just apply each edit exactly once.
-        // So we will skip edits in later log files if they are already applied.
-        if constexpr (std::is_same_v<Trait, u128::FactoryTrait>)
+        if (decode_pool != nullptr && batch.size() > 1)
         {
-            auto edit = Trait::Serializer::deserializeFrom(record.value(), nullptr);
-            loadEdit(dir, edit, from_checkpoint, checkpoint_snap_seq);
+            const size_t num_tasks = std::min(decode_concurrency, batch.size());
+            for (size_t task_idx = 0; task_idx < num_tasks; ++task_idx)
+            {
+                decode_pool->schedule([&batch, task_idx, num_tasks] {
+                    // The data file ids are deduplicated when applying the edits.
+                    for (size_t i = task_idx; i < batch.size(); i += num_tasks)
+                        batch[i].edit = Trait::Serializer::deserializeFrom(batch[i].record, nullptr);
+                });
+            }
+            decode_pool->wait();
         }
-        else if constexpr (std::is_same_v<Trait, universal::FactoryTrait>)
+        else
         {
-            auto edit = Trait::Serializer::deserializeFrom(record.value(), &data_file_ids);
-            loadEdit(dir, edit, from_checkpoint, checkpoint_snap_seq);
+            for (auto & r : batch)
+                r.edit = Trait::Serializer::deserializeFrom(r.record, nullptr);
         }
-        else
+
+        for (auto & r : batch)
         {
-            RUNTIME_CHECK(false);
+            if constexpr (std::is_same_v<Trait, universal::FactoryTrait>)
+            {
+                // Share the same data file id among all entries to reduce the memory usage
+                for (auto & rec : r.edit.getMutRecords())
+                {
+                    if (!rec.entry.checkpoint_info.has_value())
+                        continue;
+                    auto & data_file_id = rec.entry.checkpoint_info.data_location.data_file_id;
+                    auto [iter, inserted] = data_file_ids.emplace(data_file_id);
+                    if (!inserted)
+                        data_file_id = *iter;
+                }
+            }
+            // The edits in later log files may have some overlap with the first checkpoint file.
+            // But we want to just apply each edit exactly once.
+            // So we will skip edits in later log files if they are already applied.
+            loadEdit(dir, r.edit, r.from_checkpoint, checkpoint_snap_seq);
+            // Release the memory as soon as possible
+            r = RecordToApply{};
         }
     }
 }
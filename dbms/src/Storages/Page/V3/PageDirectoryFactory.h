@@ -88,6 +88,11 @@ private:
 
     BlobStats * blob_stats = nullptr;
 
+    // The number of threads to decode the WAL records when restoring from disk.
+    size_t decode_concurrency = 1;
+    // The max bytes of WAL records to be decoded together when restoring from disk.
+    static constexpr size_t restore_batch_bytes = 32 * 1024 * 1024;
+
     // For debug tool
     template <typename T>
     friend class PageStorageControlV3;
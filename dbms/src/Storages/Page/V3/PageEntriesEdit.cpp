@@ -28,7 +28,9 @@ CheckpointProto::EditRecord PageEntriesEdit<UniversalPageId>::EditRecord::toProt
     proto_edit.set_version_epoch(version.epoch);
     if (type == EditRecordType::VAR_ENTRY)
     {
-        proto_edit.set_entry_size(entry.size);
+        // The page data is uploaded to the checkpoint data file uncompressed, and the checksum of a compressed
+        // page is also computed over the uncompressed data
+        proto_edit.set_entry_size(entry.getDataSize());
         proto_edit.set_entry_tag(entry.tag);
         proto_edit.set_entry_checksum(entry.checksum);
         // uploading page data may be disabled
@@ -39,9 +39,10 @@ public:
     BlobFileId file_id = 0; // The id of page data persisted in
     PageSize size = 0; // The size of page data
     PageSize padded_size = 0; // The extra align size of page data
+    PageSize uncompressed_size = 0; // The size of page data before compression, 0 means not compressed
     UInt64 tag = 0;
     BlobFileOffset offset = 0; // The offset of page data in file
-    UInt64 checksum = 0; // The checksum of whole page data
+    UInt64 checksum = 0; // The checksum of whole page data (before compression if compressed)
 
     /**
      * Whether this page entry's data is stored in a checkpoint and where it is stored.
@@ -55,6 +56,11 @@ public:
 public:
     PageSize getTotalSize() const { return size + padded_size; }
 
+    // `size` is the bytes stored in BlobFile, this is the bytes of page data returned to the readers.
+    PageSize getDataSize() const { return isCompressed() ? uncompressed_size : size; }
+
+    inline bool isCompressed() const { return uncompressed_size != 0; }
+
     inline bool isValid() const { return file_id != INVALID_BLOBFILE_ID || checkpoint_info.has_value(); }
 
     size_t getFieldSize(size_t index) const
@@ -135,11 +141,12 @@ struct fmt::formatter<DB::PS::V3::PageEntryV3>
 
         return fmt::format_to(
             ctx.out(),
-            "PageEntry{{file: {}, offset: 0x{:X}, size: {}, checksum: 0x{:X}, tag: {}, field_offsets: [{}], "
-            "checkpoint_info: {}}}",
+            "PageEntry{{file: {}, offset: 0x{:X}, size: {}, uncompressed_size: {}, checksum: 0x{:X}, tag: {}, "
+            "field_offsets: [{}], checkpoint_info: {}}}",
             entry.file_id,
             entry.offset,
             entry.size,
+            entry.uncompressed_size,
             entry.checksum,
             entry.tag,
             fmt_buf.toString(),
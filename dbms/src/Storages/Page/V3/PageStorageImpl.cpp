@@ -51,7 +51,12 @@ PageStorageImpl::PageStorageImpl(
           file_provider_,
           delegator,
           BlobConfig::from(config_),
-          PageTypeAndConfig{{PageType::Normal, PageTypeConfig{.heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate}}})
+          PageTypeAndConfig{
+              {PageType::Normal,
+               PageTypeConfig{
+                   .heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate,
+                   .compression_method = config.blob_compression_method,
+                   .page_cache_size = config.blob_page_cache_size}}})
 {
     LOG_INFO(log, "PageStorageImpl start. Config{{ {} }}", config.toDebugStringV3());
 }
@@ -165,7 +170,7 @@ DB::PageEntry PageStorageImpl::getEntryImpl(NamespaceID ns_id, PageIdU64 page_id
         entry_ret.file_id = entry.file_id;
         entry_ret.offset = entry.offset;
         entry_ret.tag = entry.tag;
-        entry_ret.size = entry.size;
+        entry_ret.size = entry.getDataSize();
         entry_ret.field_offsets = entry.field_offsets;
         entry_ret.checksum = entry.checksum;
 
@@ -36,6 +36,10 @@ enum class PageType : UInt8
 struct PageTypeConfig
 {
     SettingDouble heavy_gc_valid_rate = 0.5;
+    // The method of compressing the page data written to this type of BlobFile.
+    SettingCompressionMethod compression_method = CompressionMethod::NONE;
+    // The max bytes of the memory cache of the page data in this type of BlobFile, 0 means disable the cache.
+    SettingUInt64 page_cache_size = 0;
 };
 
 using PageTypes = std::vector<PageType>;
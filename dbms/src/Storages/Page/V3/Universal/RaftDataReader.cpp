@@ -67,17 +67,43 @@ void RaftDataReader::traverse(
     auto transformed_end = end.empty() ? UniversalPageId(raft_data_end_key, 1) : end;
     auto snapshot = uni_ps.getSnapshot(fmt::format("scan_r_{}_{}", start, transformed_end));
     const auto page_ids = uni_ps.page_directory->getAllPageIdsInRange(start, transformed_end, snapshot);
-    for (const auto & page_id : page_ids)
+    // The raft logs of a region are usually written one after another, read the local pages in batches so that
+    // the adjacent pages in BlobFiles are merged into one IO. A raft entry can be up to 8MB, so the batches are also
+    // limited by the bytes of the local pages.
+    static constexpr size_t read_batch_size = 256;
+    static constexpr size_t read_batch_bytes = 16 * 1024 * 1024;
+    for (size_t batch_begin = 0, batch_end = 0; batch_begin < page_ids.size(); batch_begin = batch_end)
     {
-        const auto page_id_and_entry = uni_ps.page_directory->getByID(page_id, snapshot);
-        const auto & checkpoint_info = page_id_and_entry.second.checkpoint_info;
-        if (checkpoint_info.has_value() && checkpoint_info.is_local_data_reclaimed)
+        PS::V3::universal::BlobStoreType::PageIdAndEntries local_entries;
+        size_t batch_bytes = 0;
+        while (batch_end < page_ids.size() && batch_end - batch_begin < read_batch_size)
         {
-            acceptor(page_id_and_entry.first, uni_ps.remote_reader->read(page_id_and_entry));
+            auto page_id_and_entry = uni_ps.page_directory->getByID(page_ids[batch_end], snapshot);
+            const auto & entry = page_id_and_entry.second;
+            const bool is_local = !entry.checkpoint_info.has_value() || !entry.checkpoint_info.is_local_data_reclaimed;
+            if (is_local)
+            {
+                if (!local_entries.empty() && batch_bytes + entry.size > read_batch_bytes)
+                    break;
+                batch_bytes += entry.size;
+                local_entries.emplace_back(std::move(page_id_and_entry));
+            }
+            ++batch_end;
         }
-        else
+        auto local_pages = uni_ps.blob_store->read(local_entries);
+
+        // Keep the order of page ids for the acceptor
+        for (size_t i = batch_begin; i < batch_end; ++i)
         {
-            acceptor(page_id_and_entry.first, uni_ps.blob_store->read(page_id_and_entry));
+            if (auto iter = local_pages.find(page_ids[i]); iter != local_pages.end())
+            {
+                acceptor(page_ids[i], std::move(iter->second));
+            }
+            else
+            {
+                const auto page_id_and_entry = uni_ps.page_directory->getByID(page_ids[i], snapshot);
+                acceptor(page_id_and_entry.first, uni_ps.remote_reader->read(page_id_and_entry));
+            }
         }
     }
 }
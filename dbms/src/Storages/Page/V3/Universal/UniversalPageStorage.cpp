@@ -49,9 +49,20 @@ UniversalPageStoragePtr UniversalPageStorage::create(
     const FileProviderPtr & file_provider)
 {
     PageTypeAndConfig page_type_and_config{
-        {PageType::Normal, PageTypeConfig{.heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate}},
-        {PageType::RaftData, PageTypeConfig{.heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate_raft_data}},
-        {PageType::Local, PageTypeConfig{.heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate}},
+        {PageType::Normal,
+         PageTypeConfig{
+             .heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate,
+             .compression_method = config.blob_compression_method,
+             .page_cache_size = config.blob_page_cache_size}},
+        {PageType::RaftData,
+         PageTypeConfig{
+             .heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate_raft_data,
+             .compression_method = config.blob_compression_method_raft_data,
+             .page_cache_size = config.blob_page_cache_size_raft_data}},
+        {PageType::Local,
+         PageTypeConfig{
+             .heavy_gc_valid_rate = config.blob_heavy_gc_valid_rate,
+             .compression_method = config.blob_compression_method}},
     };
     UniversalPageStoragePtr storage = std::make_shared<UniversalPageStorage>(name, delegator, config, file_provider);
     storage->blob_store = std::make_unique<PS::V3::universal::BlobStoreType>(
@@ -360,7 +371,7 @@ DB::PageEntry UniversalPageStorage::getEntry(const UniversalPageId & page_id, Sn
         entry_ret.file_id = entry.file_id;
         entry_ret.offset = entry.offset;
         entry_ret.tag = entry.tag;
-        entry_ret.size = entry.size;
+        entry_ret.size = entry.getDataSize();
         entry_ret.field_offsets = entry.field_offsets;
         entry_ret.checksum = entry.checksum;
 
@@ -528,6 +539,7 @@ PS::V3::CPDataDumpStats UniversalPageStorage::dumpIncrementalCheckpoint(
         .sequence = sequence,
         .max_data_file_size = options.max_data_file_size,
         .max_edit_records_per_part = options.max_edit_records_per_part,
+        .read_concurrency = options.read_concurrency,
     });
 
     writer->writePrefix({
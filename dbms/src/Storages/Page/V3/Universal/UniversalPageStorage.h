@@ -225,6 +225,8 @@ public:
 
         UInt64 max_data_file_size = 256 * 1024 * 1024; // 256MB
         UInt64 max_edit_records_per_part = 100000;
+        // The number of threads to read the page data when dumping the checkpoint data files.
+        UInt64 read_concurrency = 1;
     };
 
     PS::V3::CPDataDumpStats dumpIncrementalCheckpoint(const DumpCheckpointOptions & options);
@@ -268,6 +268,7 @@ bool UniversalPageStorageService::uploadCheckpointImpl(
             .log = log,
         },
         .only_upload_manifest = settings.remote_checkpoint_only_upload_manifest,
+        .read_concurrency = settings.remote_checkpoint_dump_concurrency,
     };
 
     const auto write_stats = uni_page_storage->dumpIncrementalCheckpoint(opts);
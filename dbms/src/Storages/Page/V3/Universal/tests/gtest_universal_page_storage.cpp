@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <IO/ReadBufferFromString.h>
 #include <Storages/Page/V3/Universal/RaftDataReader.h>
 #include <Storages/Page/V3/Universal/UniversalPageStorage.h>
 #include <Storages/Page/V3/Universal/UniversalWriteBatchImpl.h>
@@ -511,6 +512,41 @@ TEST_F(UniPageStorageTest, Scan)
     }
 }
 
+TEST_F(UniPageStorageTest, ScanRaftLogInBatches)
+{
+    UInt64 tag = 0;
+    const UInt64 region_id = 100;
+    const String region_prefix = UniversalPageIdFormat::toFullRaftLogPrefix(region_id);
+    // more than one read batch of raft logs, written in several write batches
+    const size_t num_logs = 600;
+    for (size_t batch_start = 0; batch_start < num_logs; batch_start += 100)
+    {
+        UniversalWriteBatch wb;
+        for (size_t index = batch_start; index < batch_start + 100; ++index)
+        {
+            String data = fmt::format("raft log {}", index);
+            wb.putPage(
+                UniversalPageIdFormat::toFullPageId(region_prefix, index),
+                tag,
+                std::make_shared<ReadBufferFromOwnString>(data),
+                data.size());
+        }
+        page_storage->write(std::move(wb));
+    }
+
+    RaftDataReader reader(*page_storage);
+    auto start = UniversalPageIdFormat::toFullPageId(region_prefix, 0);
+    auto end = UniversalPageIdFormat::toFullRaftLogScanEnd(region_id);
+    size_t count = 0;
+    auto checker = [&](const UniversalPageId & page_id, const DB::Page & page) {
+        ASSERT_EQ(UniversalPageIdFormat::getU64ID(page_id), count);
+        ASSERT_EQ(page.data, fmt::format("raft log {}", count));
+        count++;
+    };
+    reader.traverse(start, end, checker);
+    ASSERT_EQ(count, num_logs);
+}
+
 TEST_F(UniPageStorageTest, OnlyScanRaftLog)
 {
     UInt64 tag = 0;
@@ -26,6 +26,8 @@ struct WALConfig
 {
     SettingUInt64 roll_size = PAGE_META_ROLL_SIZE;
     SettingUInt64 max_persisted_log_files = MAX_PERSISTED_LOG_FILES;
+    // The number of threads to decode the log records when restoring
+    SettingUInt64 restore_decode_concurrency = 1;
 
 private:
     SettingUInt64 wal_recover_mode = 0;
@@ -51,6 +53,7 @@ public:
 
         wal_config.roll_size = config.wal_roll_size;
         wal_config.max_persisted_log_files = config.wal_max_persisted_log_files;
+        wal_config.restore_decode_concurrency = config.wal_restore_decode_concurrency;
 
         return wal_config;
     }
@@ -146,6 +146,18 @@ inline bool isCheckpointInfoExists(UInt32 flags)
     return flags & FLAG_CHECKPOINT_INFO;
 }
 
+static constexpr UInt32 FLAG_COMPRESSED = 0x02;
+
+inline UInt32 setCompressed(UInt32 flags)
+{
+    return flags | FLAG_COMPRESSED;
+}
+
+inline bool isCompressed(UInt32 flags)
+{
+    return flags & FLAG_COMPRESSED;
+}
+
 template <typename EditRecord>
 void serializePutTo(const EditRecord & record, WriteBuffer & buf)
 {
@@ -161,6 +173,10 @@ void serializePutTo(const EditRecord & record, WriteBuffer & buf)
     {
         flags = setCheckpointInfoExists(flags);
     }
+    if (record.entry.isCompressed())
+    {
+        flags = setCompressed(flags);
+    }
     writeIntBinary(flags, buf);
     if constexpr (std::is_same_v<EditRecord, u128::PageEntriesEdit::EditRecord>)
     {
@@ -174,6 +190,10 @@ void serializePutTo(const EditRecord & record, WriteBuffer & buf)
     writeIntBinary(record.being_ref_count, buf);
 
     serializeEntryTo(record.entry, buf, has_checkpoint_info);
+    if (record.entry.isCompressed())
+    {
+        writeIntBinary(record.entry.uncompressed_size, buf);
+    }
 }
 
 template <typename EditType>
@@ -204,6 +224,10 @@ void deserializePutFrom(
     deserializeVersionFrom(buf, rec.version);
     readIntBinary(rec.being_ref_count, buf);
     deserializeEntryFrom(buf, rec.entry, has_checkpoint_info, data_file_id_set);
+    if (isCompressed(flags))
+    {
+        readIntBinary(rec.entry.uncompressed_size, buf);
+    }
 
     edit.appendRecord(rec);
 }
@@ -53,6 +53,7 @@ public:
 protected:
     STDMapSpaceMap(UInt64 start, UInt64 end)
         : SpaceMap(start, end, SMAP64_STD_MAP)
+        , free_size(end - start)
     {
         free_map.insert({start, end - start});
         std::set<UInt64> offsets{start};
@@ -90,27 +91,13 @@ protected:
         if (last_free_block->first + last_free_block->second != end)
         {
             UInt64 total_size = end - start;
-            UInt64 valid_size = total_size;
-            for (const auto & free_block : free_map)
-            {
-                valid_size -= free_block.second;
-            }
-
-            return std::make_pair(total_size, valid_size);
+            return std::make_pair(total_size, total_size - free_size);
         }
         else
         {
+            // The last free block is not counted as the size of file
             UInt64 total_size = last_free_block->first - start;
-            UInt64 last_free_block_size = last_free_block->second;
-
-            UInt64 valid_size = 0;
-            for (const auto & free_block : free_map)
-            {
-                valid_size += free_block.second;
-            }
-            valid_size = total_size - (valid_size - last_free_block_size);
-
-            return std::make_pair(total_size, valid_size);
+            return std::make_pair(total_size, total_size - (free_size - last_free_block->second));
         }
     }
 
@@ -179,6 +166,7 @@ protected:
 
         // remove it from `free_map_invert_index`
         deleteFromInvertIndex(it->second, it->first);
+        free_size -= length;
 
         // match
         if (it->first == offset)
@@ -239,6 +227,7 @@ protected:
         deleteFromInvertIndex(length, offset);
         assert(length >= size);
         free_map.erase(offset);
+        free_size -= size;
         if (length > size)
         {
             free_map.insert({offset + size, length - size});
@@ -322,6 +311,8 @@ protected:
             }
         }
 
+        free_size += length;
+
         /**
          * Now, we can do merge.
          * Restore the prev and next to the origin one.
@@ -407,6 +398,8 @@ public:
     std::map<UInt64, UInt64> free_map;
     // Length -> set<Offset>
     std::map<UInt64, std::set<UInt64>> free_map_invert_index;
+    // The total length of free blocks, so that the sizes can be got without scanning `free_map`
+    UInt64 free_size;
 };
 
 using STDMapSpaceMapPtr = std::shared_ptr<STDMapSpaceMap>;
@@ -12,14 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <Common/Checksum.h>
 #include <Common/FailPoint.h>
 #include <Common/Logger.h>
+#include <Common/ProfileEvents.h>
 #include <Encryption/RateLimiter.h>
 #include <IO/ReadBufferFromMemory.h>
 #include <Poco/Logger.h>
 #include <Storages/Page/PageConstants.h>
 #include <Storages/Page/PageDefinesBase.h>
 #include <Storages/Page/V3/BlobStore.h>
+#include <Storages/Page/V3/PageCache.h>
 #include <Storages/Page/V3/PageDefines.h>
 #include <Storages/Page/V3/PageDirectory.h>
 #include <Storages/Page/V3/PageEntriesEdit.h>
@@ -31,6 +34,11 @@
 #include <TestUtils/TiFlashStorageTestBasic.h>
 #include <TestUtils/TiFlashTestBasic.h>
 
+namespace ProfileEvents
+{
+extern const Event PSMReadIOCalls;
+} // namespace ProfileEvents
+
 namespace DB::FailPoints
 {
 extern const char exception_after_large_write_exceed[];
@@ -421,6 +429,224 @@ TEST_F(BlobStoreTest, testWriteRead)
     ASSERT_EQ(index, buff_nums);
 }
 
+TEST_F(BlobStoreTest, testReadNonContinuousPages)
+try
+{
+    const auto file_provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+    size_t buff_nums = 10;
+    size_t buff_size = 123;
+
+    auto blob_store = BlobStore(getCurrentTestName(), file_provider, delegator, config, page_type_and_config);
+    char c_buff[buff_size * buff_nums];
+
+    WriteBatch wb;
+    for (size_t i = 0; i < buff_nums; ++i)
+    {
+        for (size_t j = 0; j < buff_size; ++j)
+            c_buff[j + i * buff_size] = static_cast<char>((j & 0xff) + i);
+        ReadBufferPtr buff
+            = std::make_shared<ReadBufferFromMemory>(const_cast<char *>(c_buff + i * buff_size), buff_size);
+        wb.putPage(i, /* tag */ 0, buff, buff_size);
+    }
+    PageEntriesEdit edit = blob_store.write(std::move(wb));
+    ASSERT_EQ(edit.size(), buff_nums);
+    const auto & records = edit.getRecords();
+
+    // Some of the pages are adjacent in the BlobFile and can be read together, the others are not.
+    // Put them in an order different from the offsets in the BlobFile.
+    std::vector<size_t> to_read_indexes{9, 2, 0, 6, 1, 5};
+    PageIDAndEntriesV3 entries;
+    for (const auto index : to_read_indexes)
+        entries.emplace_back(std::make_pair(index, records[index].entry));
+
+    const auto read_io_calls_before = ProfileEvents::counters[ProfileEvents::PSMReadIOCalls].load();
+    auto page_map = blob_store.read(entries);
+    // The pages are read by 3 ranges: {0, 1, 2}, {5, 6} and {9}
+    ASSERT_EQ(ProfileEvents::counters[ProfileEvents::PSMReadIOCalls].load() - read_io_calls_before, 3);
+    ASSERT_EQ(page_map.size(), to_read_indexes.size());
+    for (const auto index : to_read_indexes)
+    {
+        const auto & page = page_map[index];
+        ASSERT_EQ(page.data.size(), buff_size);
+        ASSERT_EQ(strncmp(c_buff + index * buff_size, page.data.begin(), page.data.size()), 0);
+    }
+}
+CATCH
+
+TEST_F(BlobStoreTest, testWriteReadCompressed)
+try
+{
+    const auto file_provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+    PageTypeAndConfig compressed_page_type_and_config{
+        {PageType::Normal, PageTypeConfig{.compression_method = CompressionMethod::LZ4}},
+    };
+    auto blob_store
+        = BlobStore(getCurrentTestName(), file_provider, delegator, config, compressed_page_type_and_config);
+
+    size_t buff_size = 4096;
+    String compressible(buff_size, 'a');
+    String incompressible(buff_size, '\0');
+    UInt64 seed = 0x12345;
+    for (size_t i = 0; i < buff_size; ++i)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        incompressible[i] = static_cast<char>(seed >> 56);
+    }
+
+    WriteBatch wb;
+    wb.putPage(1, /* tag */ 0, std::make_shared<ReadBufferFromMemory>(compressible.data(), buff_size), buff_size);
+    wb.putPage(2, /* tag */ 0, std::make_shared<ReadBufferFromMemory>(incompressible.data(), buff_size), buff_size);
+    // The page with fields is not compressed
+    wb.putPage(
+        3,
+        /* tag */ 0,
+        std::make_shared<ReadBufferFromMemory>(compressible.data(), buff_size),
+        buff_size,
+        PageFieldSizes{1024, buff_size - 1024});
+    PageEntriesEdit edit = blob_store.write(std::move(wb));
+    ASSERT_EQ(edit.size(), 3);
+
+    const auto & records = edit.getRecords();
+    ASSERT_TRUE(records[0].entry.isCompressed());
+    ASSERT_LT(records[0].entry.size, buff_size);
+    ASSERT_EQ(records[0].entry.getDataSize(), buff_size);
+    // The checksum of a compressed page is the checksum of its uncompressed data, the same as the data
+    // uploaded to checkpoints
+    {
+        Digest::CRC64 digest;
+        digest.update(compressible.data(), compressible.size());
+        ASSERT_EQ(records[0].entry.checksum, digest.checksum());
+    }
+    ASSERT_FALSE(records[1].entry.isCompressed());
+    ASSERT_EQ(records[1].entry.size, buff_size);
+    ASSERT_FALSE(records[2].entry.isCompressed());
+    ASSERT_EQ(records[2].entry.size, buff_size);
+
+    const String * expected_data[] = {&compressible, &incompressible, &compressible};
+    PageIDAndEntriesV3 entries;
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        entries.emplace_back(std::make_pair(i + 1, records[i].entry));
+        auto page = blob_store.read(entries.back());
+        ASSERT_EQ(page.data, *expected_data[i]);
+    }
+    auto page_map = blob_store.read(entries);
+    ASSERT_EQ(page_map.size(), 3);
+    for (size_t i = 0; i < records.size(); ++i)
+        ASSERT_EQ(page_map[i + 1].data, *expected_data[i]);
+}
+CATCH
+
+TEST_F(BlobStoreTest, testReadThroughPageCache)
+try
+{
+    const auto file_provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+    PageTypeAndConfig cached_page_type_and_config{
+        {PageType::Normal, PageTypeConfig{.page_cache_size = 1024 * 1024}},
+    };
+    auto blob_store = BlobStore(getCurrentTestName(), file_provider, delegator, config, cached_page_type_and_config);
+
+    size_t buff_size = 1024;
+    String data(buff_size, '\0');
+    for (size_t i = 0; i < buff_size; ++i)
+        data[i] = static_cast<char>(i % 0xff);
+
+    WriteBatch wb;
+    wb.putPage(1, /* tag */ 0, std::make_shared<ReadBufferFromMemory>(data.data(), buff_size), buff_size);
+    wb.putPage(
+        2,
+        /* tag */ 0,
+        std::make_shared<ReadBufferFromMemory>(data.data(), buff_size),
+        buff_size,
+        PageFieldSizes{100, 200, buff_size - 300});
+    PageEntriesEdit edit = blob_store.write(std::move(wb));
+    ASSERT_EQ(edit.size(), 2);
+    const auto & records = edit.getRecords();
+    const auto page_id1 = buildV3Id(TEST_NAMESPACE_ID, 1);
+    const auto page_id2 = buildV3Id(TEST_NAMESPACE_ID, 2);
+
+    auto check_stats = [&](size_t expected_hits, size_t expected_misses) {
+        const auto usage = blob_store.getFileUsageStatistics();
+        ASSERT_EQ(usage.page_cache_hits, expected_hits);
+        ASSERT_EQ(usage.page_cache_misses, expected_misses);
+    };
+
+    // Read from BlobFile and put into the cache
+    auto page = blob_store.read(std::make_pair(page_id1, records[0].entry));
+    ASSERT_EQ(page.data, data);
+    check_stats(0, 1);
+    // Read from the cache
+    page = blob_store.read(std::make_pair(page_id1, records[0].entry));
+    ASSERT_EQ(page.data, data);
+    check_stats(1, 1);
+
+    // Reading some fields reads the whole page through the cache
+    BlobStore::FieldReadInfos read_infos = {BlobStore::FieldReadInfo(page_id2, records[1].entry, {2, 0})};
+    auto page_map = blob_store.read(read_infos);
+    ASSERT_EQ(page_map.size(), 1);
+    ASSERT_EQ(page_map[2].fieldSize(), 2);
+    ASSERT_EQ(page_map[2].getFieldData(0), std::string_view(data).substr(0, 100));
+    ASSERT_EQ(page_map[2].getFieldData(2), std::string_view(data).substr(300));
+    check_stats(1, 2);
+
+    PageIDAndEntriesV3 entries{{page_id1, records[0].entry}, {page_id2, records[1].entry}};
+    page_map = blob_store.read(entries);
+    ASSERT_EQ(page_map.size(), 2);
+    ASSERT_EQ(page_map[1].data, data);
+    ASSERT_EQ(page_map[2].data, data);
+    ASSERT_EQ(page_map[2].getFieldData(1), std::string_view(data).substr(100, 200));
+    check_stats(3, 2);
+
+    // The cached data is removed with the entries
+    ASSERT_GT(blob_store.getFileUsageStatistics().page_cache_bytes, 0);
+    blob_store.remove({records[0].entry, records[1].entry});
+    ASSERT_EQ(blob_store.getFileUsageStatistics().page_cache_bytes, 0);
+}
+CATCH
+
+TEST(PageCacheTest, ScanResistance)
+{
+    const size_t page_size = 1000;
+    PageCache page_cache(100 * page_size);
+    auto make_value = [&]() {
+        auto value = std::make_shared<PageCacheValue>();
+        value->data = String(page_size, 'a');
+        return value;
+    };
+
+    // Read the hot pages twice to promote them to the protected segment
+    const size_t num_hot_pages = 10;
+    for (size_t i = 0; i < num_hot_pages; ++i)
+    {
+        PageCacheKey key{.file_id = 1, .offset = i * page_size};
+        ASSERT_EQ(page_cache.get(key), nullptr);
+        page_cache.set(key, make_value());
+        ASSERT_NE(page_cache.get(key), nullptr);
+    }
+
+    // A scan reads many pages only once
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        PageCacheKey key{.file_id = 2, .offset = i * page_size};
+        ASSERT_EQ(page_cache.get(key), nullptr);
+        page_cache.set(key, make_value());
+    }
+
+    // The hot pages are still cached
+    for (size_t i = 0; i < num_hot_pages; ++i)
+        ASSERT_NE(page_cache.get(PageCacheKey{.file_id = 1, .offset = i * page_size}), nullptr);
+    // Only the last pages of the scan are cached
+    ASSERT_EQ(page_cache.get(PageCacheKey{.file_id = 2, .offset = 0}), nullptr);
+    ASSERT_NE(page_cache.get(PageCacheKey{.file_id = 2, .offset = 999 * page_size}), nullptr);
+    ASSERT_LE(page_cache.weight(), 100 * page_size);
+
+    // The pages larger than the max entry size are not cached
+    auto large_value = std::make_shared<PageCacheValue>();
+    large_value->data = String(page_cache.maxEntrySize() + 1, 'a');
+    page_cache.set(PageCacheKey{.file_id = 3, .offset = 0}, large_value);
+    ASSERT_EQ(page_cache.get(PageCacheKey{.file_id = 3, .offset = 0}), nullptr);
+}
+
 TEST_F(BlobStoreTest, testWriteReadWithIOLimiter)
 {
     const auto file_provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
@@ -1132,6 +1358,51 @@ TEST_F(BlobStoreTest, GC)
 }
 
 
+TEST_F(BlobStoreTest, GCOutputSeparatedFromWrites)
+try
+{
+    const auto file_provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
+    size_t buff_size = 123;
+    auto blob_store = BlobStore(getCurrentTestName(), file_provider, delegator, config, page_type_and_config);
+    char c_buff[buff_size];
+    memset(c_buff, 0x1, buff_size);
+
+    auto write_page = [&](PageIdU64 page_id) {
+        WriteBatch wb;
+        ReadBufferPtr buff = std::make_shared<ReadBufferFromMemory>(const_cast<char *>(c_buff), buff_size);
+        wb.putPage(page_id, /* tag */ 0, buff, buff_size);
+        PageEntriesEdit edit = blob_store.write(std::move(wb));
+        RUNTIME_CHECK(edit.size() == 1);
+        return edit.getRecords()[0].entry;
+    };
+    auto gc_page = [&](PageIdU64 page_id, const PageEntryV3 & entry) {
+        PageDirectory<u128::PageDirectoryTrait>::GcEntriesMap gc_context;
+        gc_context[entry.file_id].emplace_back(buildV3Id(TEST_NAMESPACE_ID, page_id), 1, entry);
+        using PageTypeAndGcInfo = typename u128::PageDirectoryType::PageTypeAndGcInfo;
+        PageTypeAndGcInfo page_type_and_gc_info;
+        page_type_and_gc_info.emplace_back(PageType::Normal, gc_context, static_cast<PageSize>(entry.size));
+        auto gc_edit = blob_store.gc(page_type_and_gc_info);
+        RUNTIME_CHECK(gc_edit.size() == 1);
+        return gc_edit.getRecords()[0].entry;
+    };
+
+    auto entry1 = write_page(50);
+    ASSERT_EQ(entry1.file_id, 10);
+    // The migrated page is written into a new BlobFile though BlobFile 10 still has space
+    auto gc_entry1 = gc_page(50, entry1);
+    ASSERT_EQ(gc_entry1.file_id, 20);
+    ASSERT_TRUE(blob_store.blob_stats.blobIdToStat(20)->is_gc_output);
+    ASSERT_FALSE(blob_store.blob_stats.blobIdToStat(10)->is_gc_output);
+
+    // The newly written pages are not mixed with the migrated pages
+    auto entry2 = write_page(51);
+    ASSERT_EQ(entry2.file_id, 10);
+    // But the migrated pages are put together
+    auto gc_entry2 = gc_page(51, entry2);
+    ASSERT_EQ(gc_entry2.file_id, 20);
+}
+CATCH
+
 TEST_F(BlobStoreTest, GCMigirateBigData)
 try
 {
@@ -351,6 +351,52 @@ TEST_P(SpaceMapTest, TestGetSizes)
 }
 
 
+TEST_P(SpaceMapTest, TestGetSizesAfterFree)
+{
+    auto smap = SpaceMap::createSpaceMap(test_type, 0, 100);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        auto [offset, max_cap, is_expansion] = smap->searchInsertOffset(10);
+        ASSERT_EQ(offset, i * 10);
+        UNUSED(max_cap, is_expansion);
+    }
+    {
+        const auto & [total_size, valid_data_size] = smap->getSizes();
+        ASSERT_EQ(total_size, 100);
+        ASSERT_EQ(valid_data_size, 100);
+    }
+
+    // Free some spans in the middle and merged with each other
+    ASSERT_TRUE(smap->markFree(20, 10));
+    ASSERT_TRUE(smap->markFree(30, 10));
+    ASSERT_TRUE(smap->markFree(60, 10));
+    {
+        const auto & [total_size, valid_data_size] = smap->getSizes();
+        ASSERT_EQ(total_size, 100);
+        ASSERT_EQ(valid_data_size, 70);
+    }
+
+    // Free the tail, which is not counted as the size of file
+    ASSERT_TRUE(smap->markFree(90, 10));
+    ASSERT_TRUE(smap->markFree(80, 10));
+    {
+        const auto & [total_size, valid_data_size] = smap->getSizes();
+        ASSERT_EQ(total_size, 80);
+        ASSERT_EQ(valid_data_size, 50);
+    }
+
+    // Reuse the freed space
+    {
+        auto [offset, max_cap, is_expansion] = smap->searchInsertOffset(15);
+        ASSERT_EQ(offset, 20);
+        UNUSED(max_cap, is_expansion);
+        ASSERT_TRUE(smap->markUsed(60, 5));
+        const auto & [total_size, valid_data_size] = smap->getSizes();
+        ASSERT_EQ(total_size, 80);
+        ASSERT_EQ(valid_data_size, 70);
+    }
+}
+
 TEST_P(SpaceMapTest, TestGetMaxCap)
 {
     {
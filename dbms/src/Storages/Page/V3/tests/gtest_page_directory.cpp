@@ -116,13 +116,15 @@ public:
         dir = restoreFromDisk();
     }
 
-    static u128::PageDirectoryPtr restoreFromDisk()
+    static u128::PageDirectoryPtr restoreFromDisk(size_t decode_concurrency = 1)
     {
         auto path = getTemporaryPath();
         auto provider = DB::tests::TiFlashTestEnv::getDefaultFileProvider();
         PSDiskDelegatorPtr delegator = std::make_shared<DB::tests::MockDiskDelegatorSingle>(path);
         PageDirectoryFactory<u128::FactoryTrait> factory;
-        return factory.create("PageDirectoryTest", provider, delegator, WALConfig());
+        WALConfig config;
+        config.restore_decode_concurrency = decode_concurrency;
+        return factory.create("PageDirectoryTest", provider, delegator, config);
     }
 
 protected:
@@ -1203,6 +1205,47 @@ TEST_F(PageDirectoryGCTest, ManyEditsAndDumpSnapshot)
     }
 }
 
+TEST_F(PageDirectoryGCTest, RestoreWithConcurrentDecode)
+{
+    PageIdU64 page_id0 = 50;
+    PageIdU64 page_id1 = 51;
+    PageIdU64 page_id2 = 52;
+
+    PageEntryV3 last_entry_for_0;
+    PageEntryV3 last_entry_for_2;
+    constexpr size_t num_edits_test = 10000;
+    for (size_t i = 0; i < num_edits_test; ++i)
+    {
+        {
+            INSERT_ENTRY(page_id0, i);
+            last_entry_for_0 = entry_vi;
+        }
+        {
+            INSERT_ENTRY(page_id1, i);
+        }
+        if (i % 3 == 0)
+        {
+            INSERT_ENTRY(page_id2, i);
+            last_entry_for_2 = entry_vi;
+        }
+    }
+    INSERT_DELETE(page_id1);
+    const auto max_sequence = dir->createSnapshot()->sequence;
+    dir.reset();
+
+    // The edits must be applied in the same order no matter how many threads decode them
+    for (size_t decode_concurrency : {1, 4})
+    {
+        dir = restoreFromDisk(decode_concurrency);
+        auto snap = dir->createSnapshot();
+        ASSERT_EQ(snap->sequence, max_sequence);
+        ASSERT_SAME_ENTRY(getEntry(dir, page_id0, snap), last_entry_for_0);
+        EXPECT_ENTRY_NOT_EXIST(dir, page_id1, snap);
+        ASSERT_SAME_ENTRY(getEntry(dir, page_id2, snap), last_entry_for_2);
+        dir.reset();
+    }
+}
+
 TEST_F(PageDirectoryGCTest, DumpSnapshotDuringWrite)
 {
     // write some data and roll the log file
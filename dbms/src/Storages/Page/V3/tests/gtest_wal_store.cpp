@@ -60,6 +60,36 @@ TEST(WALSeriTest, AllPuts)
     EXPECT_SAME_ENTRY(iter->entry, entry_p1);
 }
 
+TEST(WALSeriTest, CompressedPuts)
+{
+    PageEntryV3 entry_p1{.file_id = 1, .size = 1, .padded_size = 0, .tag = 0, .offset = 0x123, .checksum = 0x4567};
+    PageEntryV3 entry_p2{
+        .file_id = 1,
+        .size = 2,
+        .padded_size = 0,
+        .uncompressed_size = 200,
+        .tag = 0,
+        .offset = 0x124,
+        .checksum = 0x4567};
+    PageVersion ver20(/*seq=*/20);
+    PageEntriesEdit edit;
+    edit.put(buildV3Id(TEST_NAMESPACE_ID, 1), entry_p1);
+    edit.put(buildV3Id(TEST_NAMESPACE_ID, 2), entry_p2);
+
+    for (auto & rec : edit.getMutRecords())
+        rec.version = ver20;
+
+    auto deseri_edit = u128::Serializer::deserializeFrom(u128::Serializer::serializeTo(edit), nullptr);
+    ASSERT_EQ(deseri_edit.size(), 2);
+    auto iter = deseri_edit.getRecords().begin();
+    EXPECT_SAME_ENTRY(iter->entry, entry_p1);
+    EXPECT_FALSE(iter->entry.isCompressed());
+    iter++;
+    EXPECT_SAME_ENTRY(iter->entry, entry_p2);
+    EXPECT_TRUE(iter->entry.isCompressed());
+    EXPECT_EQ(iter->entry.getDataSize(), 200);
+}
+
 TEST(WALSeriTest, PutsAndRefsAndDels)
 try
 {
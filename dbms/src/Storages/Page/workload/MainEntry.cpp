@@ -22,6 +22,7 @@
 #include <Storages/Page/workload/PSWorkload.h>
 #include <Storages/Page/workload/PageStorageInMemoryCapacity.h>
 #include <Storages/Page/workload/ThousandsOfOffset.h>
+#include <Storages/Page/workload/UniversalMixed.h>
 
 using namespace DB::PS::tests;
 
@@ -37,6 +38,7 @@ int StressWorkload::mainEntry(int argc, char ** argv)
         work_load_register<PageStorageInMemoryCapacity>();
         work_load_register<NormalWorkload>();
         work_load_register<ThousandsOfOffset>();
+        work_load_register<UniversalMixed>();
     }
     try
     {
@@ -64,6 +64,9 @@ StressEnv StressEnv::parse(int argc, char ** argv)
         ("paths,P", value<std::vector<std::string>>(), "store path(s)") //
         ("failpoints", value<std::vector<std::string>>(), "failpoint(s) to enable") //
         ("gc_interval", value<UInt32>()->default_value(30), "GC interval(seconds). 0 means no gc") //
+        ("checkpoint_interval",
+         value<UInt32>()->default_value(30),
+         "Checkpoint interval(seconds) for the universal workloads. 0 means no checkpoint") //
         ("status_interval",
          value<UInt32>()->default_value(5),
          "Status statistics interval(seconds). 0 means no statistics") //
@@ -72,6 +75,7 @@ StressEnv StressEnv::parse(int argc, char ** argv)
         ("running_ps_version,V",
          value<UInt16>()->default_value(3),
          "Select a version of PageStorage. 2 or 3 can used") //
+        ("summary_file", value<std::string>()->default_value(""), "also write the json summary to this file") //
         ("color", value<bool>()->default_value(true), "enable color output");
 
     po::variables_map options;
@@ -95,10 +99,12 @@ StressEnv StressEnv::parse(int argc, char ** argv)
     opt.num_writer_slots = options["writer_slots"].as<UInt32>();
     opt.avg_page_size = options["avg_page_size"].as<UInt32>();
     opt.gc_interval_s = options["gc_interval"].as<UInt32>();
+    opt.checkpoint_interval_s = options["checkpoint_interval"].as<UInt32>();
     opt.status_interval = options["status_interval"].as<UInt32>();
     opt.situation_mask = options["situation_mask"].as<UInt64>();
     opt.verify = options["verify"].as<bool>();
     opt.running_ps_version = options["running_ps_version"].as<UInt16>();
+    opt.summary_file = options["summary_file"].as<std::string>();
     opt.logger = buildLogger(options["color"].as<bool>());
 
     if (opt.running_ps_version != 2 && opt.running_ps_version != 3)
@@ -67,6 +67,7 @@ struct StressEnv
     bool init_pages = false;
     bool dropdata = false;
     size_t gc_interval_s = 30;
+    size_t checkpoint_interval_s = 30;
     size_t timeout_s = 0;
     size_t read_delay_ms = 0;
     size_t num_writer_slots = 1;
@@ -75,6 +76,8 @@ struct StressEnv
     size_t situation_mask = 0;
     bool verify = true;
     size_t running_ps_version = 3;
+    // Also write the json summary to this file if it is not empty
+    String summary_file;
 
     std::vector<std::string> paths;
     std::vector<std::string> failpoints;
@@ -86,10 +89,11 @@ struct StressEnv
             "num_writers: {}, num_readers: {}, init_pages: {}"
             ", dropdata: {}, timeout_s: {}, read_delay_ms: {}, num_writer_slots: {}"
             ", avg_page_size: {}, paths: [{}], failpoints: [{}]"
-            ", gc_interval_s: {}"
+            ", gc_interval_s: {}, checkpoint_interval_s: {}"
             ", status_interval: {}, verify: {}"
             ", situation_mask: {}"
             ", running_pagestorage_version: {}"
+            ", summary_file: {}"
             "}}",
             num_writers,
             num_readers,
@@ -102,10 +106,12 @@ struct StressEnv
             fmt::join(paths.begin(), paths.end(), ","),
             fmt::join(failpoints.begin(), failpoints.end(), ","),
             gc_interval_s,
+            checkpoint_interval_s,
             status_interval,
             verify,
             situation_mask,
-            running_ps_version //
+            running_ps_version,
+            summary_file //
         );
     }
 
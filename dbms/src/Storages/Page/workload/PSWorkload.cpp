@@ -23,6 +23,7 @@
 #include <fmt/core.h>
 
 #include <ext/scope_guard.h>
+#include <fstream>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -93,11 +94,21 @@ void StressWorkload::onDumpResult()
         if (options.status_interval != 0)
             metrics_dumper->addJSONSummaryTo(summary);
 
-        fmt::print(stdout, "Workload summary: {}\n", [&]() {
-            std::stringstream ss;
-            summary->stringify(ss);
-            return ss.str();
-        }());
+        dumpSummary(summary);
+    }
+}
+
+void StressWorkload::dumpSummary(const Poco::JSON::Object::Ptr & summary) const
+{
+    std::stringstream ss;
+    summary->stringify(ss);
+    fmt::print(stdout, "Workload summary: {}\n", ss.str());
+
+    if (!options.summary_file.empty())
+    {
+        std::ofstream out(options.summary_file, std::ios::app);
+        RUNTIME_CHECK_MSG(out.good(), "Can not open summary file, path={}", options.summary_file);
+        out << ss.str() << std::endl;
     }
 }
 
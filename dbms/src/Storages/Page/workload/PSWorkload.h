@@ -73,6 +73,10 @@ public:
 protected:
     void initPageStorage(DB::PageStorageConfig & config, String path_prefix = "");
 
+    // Print the summary and write it to `options.summary_file` if it is set,
+    // so that the results of different versions can be compared by scripts.
+    void dumpSummary(const Poco::JSON::Object::Ptr & summary) const;
+
     void startBackgroundTimer();
 
     void initPages(const DB::PageIdU64 & max_page_id);
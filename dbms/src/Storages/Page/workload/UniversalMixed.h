@@ -0,0 +1,611 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Common/Stopwatch.h>
+#include <Encryption/FileProvider.h>
+#include <Encryption/MockKeyManager.h>
+#include <Poco/File.h>
+#include <Poco/Timer.h>
+#include <Storages/KVStore/Types.h>
+#include <Storages/Page/V3/Universal/UniversalPageIdFormatImpl.h>
+#include <Storages/Page/V3/Universal/UniversalPageStorage.h>
+#include <Storages/Page/V3/Universal/UniversalWriteBatchImpl.h>
+#include <Storages/Page/workload/PSWorkload.h>
+#include <TestUtils/MockDiskDelegator.h>
+
+#include <array>
+#include <random>
+
+namespace DB::PS::tests
+{
+// A log-linear histogram of latencies in nanoseconds. The relative error of
+// the percentiles is less than 1/16, and the memory cost does not grow with
+// the number of samples.
+class LatencyHistogram
+{
+public:
+    void add(UInt64 ns)
+    {
+        ++buckets[bucketOf(ns)];
+        ++num_samples;
+        sum_ns += ns;
+        max_ns = std::max(max_ns, ns);
+    }
+
+    void merge(const LatencyHistogram & other)
+    {
+        for (size_t i = 0; i < NUM_BUCKETS; ++i)
+            buckets[i] += other.buckets[i];
+        num_samples += other.num_samples;
+        sum_ns += other.sum_ns;
+        max_ns = std::max(max_ns, other.max_ns);
+    }
+
+    size_t count() const { return num_samples; }
+
+    Poco::JSON::Object::Ptr toJSON() const
+    {
+        Poco::JSON::Object::Ptr json = new Poco::JSON::Object();
+        json->set("count", num_samples);
+        if (num_samples == 0)
+            return json;
+        json->set("avg_us", fmt::format("{:.3f}", 1.0 * sum_ns / num_samples / 1000));
+        json->set("p50_us", fmt::format("{:.3f}", percentile(0.50) / 1000.0));
+        json->set("p90_us", fmt::format("{:.3f}", percentile(0.90) / 1000.0));
+        json->set("p99_us", fmt::format("{:.3f}", percentile(0.99) / 1000.0));
+        json->set("p999_us", fmt::format("{:.3f}", percentile(0.999) / 1000.0));
+        json->set("max_us", fmt::format("{:.3f}", max_ns / 1000.0));
+        return json;
+    }
+
+private:
+    static constexpr size_t SUB_BUCKET_BITS = 4;
+    static constexpr size_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr size_t NUM_BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    static size_t bucketOf(UInt64 ns)
+    {
+        if (ns < SUB_BUCKETS)
+            return ns;
+        const size_t shift = 63 - __builtin_clzll(ns) - SUB_BUCKET_BITS;
+        return (shift + 1) * SUB_BUCKETS + ((ns >> shift) & (SUB_BUCKETS - 1));
+    }
+
+    static UInt64 lowerBoundOf(size_t bucket)
+    {
+        if (bucket < SUB_BUCKETS)
+            return bucket;
+        const size_t shift = bucket / SUB_BUCKETS - 1;
+        return (SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+    }
+
+    UInt64 percentile(double p) const
+    {
+        const auto rank = static_cast<size_t>(p * (num_samples - 1));
+        size_t seen = 0;
+        for (size_t i = 0; i < NUM_BUCKETS; ++i)
+        {
+            seen += buckets[i];
+            if (seen > rank)
+                return std::min(lowerBoundOf(i), max_ns);
+        }
+        return max_ns;
+    }
+
+    std::array<size_t, NUM_BUCKETS> buckets{};
+    size_t num_samples = 0;
+    UInt64 sum_ns = 0;
+    UInt64 max_ns = 0;
+};
+
+// The shared status between the writers and the readers of `UniversalMixed`
+struct UniversalMixedStat
+{
+    // The readable raft logs of a region are in [first_index, last_index)
+    struct RegionLogRange
+    {
+        std::atomic<UInt64> first_index = 1;
+        std::atomic<UInt64> last_index = 1;
+    };
+
+    explicit UniversalMixedStat(size_t num_regions_)
+        : num_regions(num_regions_)
+        , regions(num_regions_ + 1)
+    {}
+
+    const size_t num_regions;
+    // Indexed by region id, region id 0 is not used
+    std::vector<RegionLogRange> regions;
+
+    // The tiny pages in [next_tiny_page_id - tiny_page_window, next_tiny_page_id) are alive
+    static constexpr PageIdU64 tiny_page_window = 10000;
+    std::atomic<PageIdU64> next_tiny_page_id = 1;
+};
+
+class UniPSRunnable : public PSRunnable
+{
+public:
+    UniPSRunnable(
+        const UniversalPageStoragePtr & uni_ps_,
+        UniversalMixedStat & stat_,
+        DB::UInt32 index_,
+        const LoggerPtr & log)
+        : PSRunnable(log)
+        , uni_ps(uni_ps_)
+        , stat(stat_)
+        , index(index_)
+    {
+        gen.seed(time(nullptr) + index);
+    }
+
+    // The operations of the same type are summarized together
+    virtual String operation() const = 0;
+
+    String description() override { return fmt::format("(Stress Test {} {})", operation(), index); }
+
+    LatencyHistogram latency;
+    size_t pages_not_found = 0;
+
+protected:
+    std::string_view randomData(size_t size)
+    {
+        if (data.size() < size)
+        {
+            data.resize(size);
+            for (auto & c : data)
+                c = static_cast<char>(gen());
+        }
+        return std::string_view(data.data(), size);
+    }
+
+    UniversalPageStoragePtr uni_ps;
+    UniversalMixedStat & stat;
+    DB::UInt32 index;
+    std::mt19937 gen;
+    String data;
+};
+
+// Append raft logs to the regions owned by this writer, and truncate the applied
+// logs periodically like the raft log gc of raftstore does.
+class UniPSRaftLogWriter : public UniPSRunnable
+{
+public:
+    UniPSRaftLogWriter(
+        const UniversalPageStoragePtr & uni_ps_,
+        UniversalMixedStat & stat_,
+        DB::UInt32 index_,
+        size_t num_writers_,
+        const LoggerPtr & log)
+        : UniPSRunnable(uni_ps_, stat_, index_, log)
+        , num_writers(num_writers_)
+    {}
+
+    String operation() const override { return "raft_log_write"; }
+
+    bool runImpl() override
+    {
+        // The regions owned by this writer are `index + 1 + k * num_writers`
+        std::uniform_int_distribution<size_t> region_dist(0, stat.num_regions / num_writers - 1);
+        const UInt64 region_id = index + 1 + region_dist(gen) * num_writers;
+        auto & range = stat.regions[region_id];
+
+        std::uniform_int_distribution<size_t> size_dist(128, 4 * 1024);
+        UniversalWriteBatch wb;
+        UInt64 last_index = range.last_index;
+        for (size_t i = 0; i < logs_per_batch; ++i)
+        {
+            const auto size = size_dist(gen);
+            wb.putPage(UniversalPageIdFormat::toRaftLogKey(region_id, last_index++), 0, randomData(size));
+            bytes_used += size;
+        }
+        pages_used += logs_per_batch;
+
+        const UInt64 first_index = range.first_index;
+        if (last_index - first_index > max_logs_per_region)
+        {
+            const UInt64 truncate_to = last_index - max_logs_per_region / 2;
+            // Make the readers skip the logs before deleting them
+            range.first_index = truncate_to;
+            for (auto log_index = first_index; log_index < truncate_to; ++log_index)
+                wb.delPage(UniversalPageIdFormat::toRaftLogKey(region_id, log_index));
+        }
+
+        Stopwatch watch;
+        uni_ps->write(std::move(wb), PageType::RaftData);
+        latency.add(watch.elapsed());
+        range.last_index = last_index;
+        return true;
+    }
+
+private:
+    static constexpr size_t logs_per_batch = 4;
+    static constexpr size_t max_logs_per_region = 1024;
+    const size_t num_writers;
+};
+
+// Persist the region meta and the apply state in KVStore
+class UniPSKVStoreWriter : public UniPSRunnable
+{
+public:
+    using UniPSRunnable::UniPSRunnable;
+
+    String operation() const override { return "kvstore_write"; }
+
+    bool runImpl() override
+    {
+        std::uniform_int_distribution<UInt64> region_dist(1, stat.num_regions);
+        std::uniform_int_distribution<size_t> size_dist(512, 4 * 1024);
+        const auto region_id = region_dist(gen);
+        const auto size = size_dist(gen);
+
+        UniversalWriteBatch wb;
+        wb.putPage(UniversalPageIdFormat::toKVStoreKey(region_id), 0, randomData(size));
+        wb.putPage(UniversalPageIdFormat::toRaftApplyStateKeyInKVEngine(region_id), 0, randomData(64));
+        bytes_used += size + 64;
+        pages_used += 2;
+
+        Stopwatch watch;
+        uni_ps->write(std::move(wb), PageType::Normal);
+        latency.add(watch.elapsed());
+        return true;
+    }
+};
+
+// Write the small pages with fields like the ColumnFileTiny of DeltaMerge,
+// and remove the pages which slide out of the window.
+class UniPSTinyPageWriter : public UniPSRunnable
+{
+public:
+    UniPSTinyPageWriter(
+        const UniversalPageStoragePtr & uni_ps_,
+        UniversalMixedStat & stat_,
+        DB::UInt32 index_,
+        const LoggerPtr & log)
+        : UniPSRunnable(uni_ps_, stat_, index_, log)
+        , prefix(UniversalPageIdFormat::toFullPrefix(NullspaceID, StorageType::Log, 1))
+    {}
+
+    String operation() const override { return "tiny_page_write"; }
+
+    bool runImpl() override
+    {
+        std::uniform_int_distribution<size_t> fields_dist(1, 4);
+        std::uniform_int_distribution<size_t> field_size_dist(64, 4 * 1024);
+        PageFieldSizes field_sizes(fields_dist(gen));
+        size_t size = 0;
+        for (auto & field_size : field_sizes)
+        {
+            field_size = field_size_dist(gen);
+            size += field_size;
+        }
+
+        const auto page_id = stat.next_tiny_page_id.fetch_add(1);
+        UniversalWriteBatch wb;
+        wb.putPage(UniversalPageIdFormat::toFullPageId(prefix, page_id), 0, randomData(size), field_sizes);
+        if (page_id > UniversalMixedStat::tiny_page_window)
+            wb.delPage(UniversalPageIdFormat::toFullPageId(prefix, page_id - UniversalMixedStat::tiny_page_window));
+        bytes_used += size;
+        pages_used += 1;
+
+        Stopwatch watch;
+        uni_ps->write(std::move(wb), PageType::Normal);
+        latency.add(watch.elapsed());
+        return true;
+    }
+
+private:
+    const String prefix;
+};
+
+// Read a range of raft logs, or the first field of some tiny pages.
+// The pages may be removed by the writers concurrently, so the not found pages are
+// counted instead of being treated as errors.
+class UniPSReader : public UniPSRunnable
+{
+public:
+    UniPSReader(
+        const UniversalPageStoragePtr & uni_ps_,
+        UniversalMixedStat & stat_,
+        DB::UInt32 index_,
+        const LoggerPtr & log)
+        : UniPSRunnable(uni_ps_, stat_, index_, log)
+        , prefix(UniversalPageIdFormat::toFullPrefix(NullspaceID, StorageType::Log, 1))
+    {}
+
+    String operation() const override { return "read"; }
+
+    bool runImpl() override
+    {
+        UniversalPageMap pages;
+        if (gen() % 2 == 0)
+        {
+            std::uniform_int_distribution<UInt64> region_dist(1, stat.num_regions);
+            const auto region_id = region_dist(gen);
+            const auto & range = stat.regions[region_id];
+            const UInt64 first_index = range.first_index;
+            const UInt64 last_index = range.last_index;
+            if (first_index >= last_index)
+                return true;
+            UniversalPageIds page_ids;
+            for (auto log_index = std::max(first_index, last_index - logs_per_read); log_index < last_index;
+                 ++log_index)
+                page_ids.emplace_back(UniversalPageIdFormat::toRaftLogKey(region_id, log_index));
+
+            Stopwatch watch;
+            pages = uni_ps->read(page_ids, nullptr, {}, /*throw_on_not_exist*/ false);
+            latency.add(watch.elapsed());
+        }
+        else
+        {
+            const PageIdU64 end_id = stat.next_tiny_page_id;
+            const PageIdU64 begin_id = end_id > UniversalMixedStat::tiny_page_window
+                ? end_id - UniversalMixedStat::tiny_page_window
+                : 1;
+            if (begin_id >= end_id)
+                return true;
+            std::uniform_int_distribution<PageIdU64> id_dist(begin_id, end_id - 1);
+            std::vector<UniversalPageStorage::PageReadFields> page_fields;
+            for (size_t i = 0; i < pages_per_read; ++i)
+            {
+                page_fields.emplace_back(
+                    UniversalPageIdFormat::toFullPageId(prefix, id_dist(gen)),
+                    UniversalPageStorage::FieldIndices{0});
+            }
+
+            Stopwatch watch;
+            pages = uni_ps->read(page_fields, nullptr, {}, /*throw_on_not_exist*/ false);
+            latency.add(watch.elapsed());
+        }
+
+        for (const auto & [page_id, page] : pages)
+        {
+            if (!page.isValid())
+            {
+                ++pages_not_found;
+                continue;
+            }
+            bytes_used += page.data.size();
+            pages_used += 1;
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t logs_per_read = 8;
+    static constexpr size_t pages_per_read = 8;
+    const String prefix;
+};
+
+// Run a task periodically in background, and record how long it takes
+class UniPSBackgroundTask
+{
+public:
+    UniPSBackgroundTask(String name_, size_t interval_s, std::function<void()> task_)
+        : name(std::move(name_))
+        , task(std::move(task_))
+    {
+        timer.setStartInterval(interval_s * 1000);
+        timer.setPeriodicInterval(interval_s * 1000);
+    }
+
+    void onTime(Poco::Timer & /* t */)
+    {
+        try
+        {
+            Stopwatch watch;
+            task();
+            latency.add(watch.elapsed());
+        }
+        catch (...)
+        {
+            StressEnvStatus::getInstance().setStat(STATUS_EXCEPTION);
+            DB::tryLogCurrentException(__PRETTY_FUNCTION__);
+        }
+    }
+
+    void start() { timer.start(Poco::TimerCallback<UniPSBackgroundTask>(*this, &UniPSBackgroundTask::onTime)); }
+
+    void stop() { timer.stop(); }
+
+    const String name;
+    LatencyHistogram latency;
+
+private:
+    std::function<void()> task;
+    Poco::Timer timer;
+};
+using UniPSBackgroundTaskPtr = std::unique_ptr<UniPSBackgroundTask>;
+
+// Mix the raft log append/truncate, the KVStore meta writes and the DeltaMerge
+// tiny page writes on one UniversalPageStorage, with GC and checkpoint running
+// concurrently. The throughput and the latency percentiles of each kind of
+// operation are reported.
+class UniversalMixed
+    : public StressWorkload
+    , public StressWorkloadFunc<UniversalMixed>
+{
+public:
+    explicit UniversalMixed(const StressEnv & options_)
+        : StressWorkload(options_)
+    {}
+
+    static String name() { return "UniversalMixed"; }
+
+    static UInt64 mask() { return 1 << 8; }
+
+private:
+    String desc() override
+    {
+        return fmt::format(
+            "Some of options will be ignored"
+            "`paths` will only used first one. which is {}. Data will store in {}. "
+            "There are {} raft log writers, {} tiny page writers, 1 KVStore writer and {} readers. "
+            "GC interval is {}s, checkpoint interval is {}s",
+            options.paths[0],
+            options.paths[0] + "/" + name(),
+            options.num_writers,
+            options.num_writers,
+            options.num_readers,
+            options.gc_interval_s,
+            options.checkpoint_interval_s);
+    }
+
+    void run() override
+    {
+        RUNTIME_CHECK(options.num_writers > 0);
+        pool.addCapacity(1 + 2 * options.num_writers + options.num_readers);
+
+        const String path = options.paths[0] + "/" + name();
+        auto file_provider = std::make_shared<DB::FileProvider>(std::make_shared<DB::MockKeyManager>(false), false);
+        delegator = std::make_shared<DB::tests::MockDiskDelegatorSingle>(path);
+        uni_ps = UniversalPageStorage::create("stress_test", delegator, DB::PageStorageConfig{}, file_provider);
+        uni_ps->restore();
+        mixed_stat = std::make_unique<UniversalMixedStat>(options.num_writers * regions_per_writer);
+
+        stop_watch.start();
+        for (size_t i = 0; i < options.num_writers; ++i)
+        {
+            startRunnable(
+                std::make_shared<UniPSRaftLogWriter>(uni_ps, *mixed_stat, i, options.num_writers, options.logger));
+            startRunnable(std::make_shared<UniPSTinyPageWriter>(uni_ps, *mixed_stat, i, options.logger));
+        }
+        startRunnable(std::make_shared<UniPSKVStoreWriter>(uni_ps, *mixed_stat, 0, options.logger));
+        for (size_t i = 0; i < options.num_readers; ++i)
+            startRunnable(std::make_shared<UniPSReader>(uni_ps, *mixed_stat, i, options.logger));
+
+        if (options.gc_interval_s > 0)
+        {
+            background_tasks.emplace_back(std::make_unique<UniPSBackgroundTask>("gc", options.gc_interval_s, [this] {
+                uni_ps->gc(/*not_skip*/ true);
+            }));
+        }
+        if (options.checkpoint_interval_s > 0)
+        {
+            background_tasks.emplace_back(std::make_unique<UniPSBackgroundTask>(
+                "checkpoint",
+                options.checkpoint_interval_s,
+                [this, path] { dumpCheckpoint(path + "/checkpoint/"); }));
+        }
+        for (auto & task : background_tasks)
+            task->start();
+        if (options.status_interval > 0)
+        {
+            metrics_dumper = std::make_shared<PSMetricsDumper>(options.status_interval, options.logger);
+            metrics_dumper->start();
+        }
+        if (options.timeout_s > 0)
+        {
+            stress_time = std::make_shared<StressTimeout>(options.timeout_s, options.logger);
+            stress_time->start();
+        }
+
+        pool.joinAll();
+        stop_watch.stop();
+        for (auto & task : background_tasks)
+            task->stop();
+    }
+
+    void startRunnable(std::shared_ptr<UniPSRunnable> runnable)
+    {
+        runnables.emplace_back(runnable);
+        pool.start(*runnable, fmt::format("{}{}", runnable->operation(), runnables.size()));
+    }
+
+    void dumpCheckpoint(const String & dir)
+    {
+        Poco::File(dir).createDirectories();
+        const String data_file_path_pattern = dir + "{seq}_{index}.data";
+        const String manifest_file_path_pattern = dir + "{seq}.manifest";
+        const auto stats = uni_ps->dumpIncrementalCheckpoint(UniversalPageStorage::DumpCheckpointOptions{
+            .data_file_id_pattern = "{seq}_{index}.data",
+            .data_file_path_pattern = data_file_path_pattern,
+            .manifest_file_id_pattern = "{seq}.manifest",
+            .manifest_file_path_pattern = manifest_file_path_pattern,
+            .writer_info = writer_info,
+            .must_locked_files = {},
+            .persist_checkpoint =
+                [](const PS::V3::LocalCheckpointFiles & files) {
+                    // There is no remote store, drop the local files after they are dumped
+                    for (const auto & data_file : files.data_files)
+                        Poco::File(data_file).remove();
+                    Poco::File(files.manifest_file).remove();
+                    return true;
+                },
+        });
+        checkpoint_bytes += stats.incremental_data_bytes + stats.compact_data_bytes;
+    }
+
+    void onDumpResult() override
+    {
+        const double seconds_run = stop_watch.elapsedSeconds();
+        LOG_INFO(options.logger, "workload result dumped after {:.3f}s", seconds_run);
+
+        struct OperationSummary
+        {
+            size_t threads = 0;
+            size_t pages = 0;
+            size_t bytes = 0;
+            size_t pages_not_found = 0;
+            LatencyHistogram latency;
+        };
+        std::map<String, OperationSummary> operations;
+        for (const auto & runnable : runnables)
+        {
+            auto & op = operations[runnable->operation()];
+            op.threads += 1;
+            op.pages += runnable->pages_used;
+            op.bytes += runnable->bytes_used;
+            op.pages_not_found += runnable->pages_not_found;
+            op.latency.merge(runnable->latency);
+        }
+
+        Poco::JSON::Object::Ptr summary = new Poco::JSON::Object();
+        summary->set("workload", name());
+        summary->set("seconds", fmt::format("{:.3f}", seconds_run));
+        for (const auto & [op_name, op] : operations)
+        {
+            Poco::JSON::Object::Ptr json_op = new Poco::JSON::Object();
+            json_op->set("threads", op.threads);
+            json_op->set("pages", op.pages);
+            json_op->set("bytes", op.bytes);
+            json_op->set("ops_per_second", fmt::format("{:.3f}", op.latency.count() / seconds_run));
+            json_op->set("mib_per_second", fmt::format("{:.3f}", 1.0 * op.bytes / DB::MB / seconds_run));
+            if (op.pages_not_found > 0)
+                json_op->set("pages_not_found", op.pages_not_found);
+            json_op->set("latency", op.latency.toJSON());
+            summary->set(op_name, json_op);
+        }
+        for (const auto & task : background_tasks)
+            summary->set(task->name, task->latency.toJSON());
+        summary->set("checkpoint_bytes", checkpoint_bytes);
+        if (options.status_interval != 0)
+            metrics_dumper->addJSONSummaryTo(summary);
+
+        dumpSummary(summary);
+    }
+
+private:
+    static constexpr size_t regions_per_writer = 64;
+
+    UniversalPageStoragePtr uni_ps;
+    std::unique_ptr<UniversalMixedStat> mixed_stat;
+    std::vector<std::shared_ptr<UniPSRunnable>> runnables;
+    PS::V3::CheckpointProto::WriterInfo writer_info;
+    size_t checkpoint_bytes = 0;
+    // Declared after `uni_ps` so that the timers are stopped before `uni_ps` is released
+    std::vector<UniPSBackgroundTaskPtr> background_tasks;
+};
+} // namespace DB::PS::tests
@@ -28,6 +28,7 @@
 #include <Storages/S3/S3Common.h>
 #include <aws/s3/model/GetObjectRequest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -138,6 +139,21 @@ FileSegmentPtr FileCache::get(const S3::S3FilenameView & s3_fname, const std::op
         return nullptr;
     }
 
+    // Downloading a large file for a few ranged reads wastes the bandwidth and evicts the other files,
+    // read it from S3 by range instead.
+    if (auto limit = max_file_size.load(std::memory_order_relaxed); filesize && limit > 0 && *filesize > limit)
+    {
+        GET_METRIC(tiflash_storage_remote_cache, type_dtfile_too_large).Increment();
+        return nullptr;
+    }
+
+    // A large scan reads each data file only once, don't let it flush the files that are read repeatedly.
+    if (!admitOnMiss(s3_key, file_type))
+    {
+        GET_METRIC(tiflash_storage_remote_cache, type_dtfile_not_admitted).Increment();
+        return nullptr;
+    }
+
     // File not exists, try to download and cache it in backgroud.
 
     // We don't know the exact size of a object/file, but we need reserve space to save the object/file.
@@ -359,6 +375,29 @@ void FileCache::releaseSpace(UInt64 size)
     releaseSpaceImpl(size);
 }
 
+bool FileCache::admitOnMiss(const String & s3_key, FileType file_type)
+{
+    // Meta, index and mark files are small and read by every query, always admit them.
+    if (!admit_data_on_second_miss.load(std::memory_order_relaxed) || file_type < FileType::HandleColData)
+        return true;
+
+    if (auto itr = missed_keys_index.find(s3_key); itr != missed_keys_index.end())
+    {
+        missed_keys.erase(itr->second);
+        missed_keys_index.erase(itr);
+        return true;
+    }
+
+    // Only remember the file missed for the first time, the oldest one is forgotten when there are too many.
+    missed_keys_index.emplace(s3_key, missed_keys.insert(missed_keys.end(), s3_key));
+    if (missed_keys.size() > max_missed_keys)
+    {
+        missed_keys_index.erase(missed_keys.front());
+        missed_keys.pop_front();
+    }
+    return false;
+}
+
 bool FileCache::canCache(FileType file_type) const
 {
     return file_type != FileType::Unknow && static_cast<UInt64>(file_type) <= cache_level
@@ -602,10 +641,36 @@ void FileCache::prepareParentDir(const String & local_fname)
 void FileCache::restore()
 {
     Stopwatch sw;
+    std::vector<RestoredFile> restored_files;
     for (const auto & wn_entry : std::filesystem::directory_iterator(cache_dir))
     {
-        restoreWriteNode(wn_entry);
+        restoreWriteNode(wn_entry, restored_files);
+    }
+
+    // The files are restored in the order of directories, sort them by the time they are downloaded so that the LRU
+    // order of the files before restart is roughly kept. If the capacity is not enough, the newest files are kept.
+    std::sort(restored_files.begin(), restored_files.end(), [](const auto & lhs, const auto & rhs) {
+        return lhs.mtime > rhs.mtime;
+    });
+    auto keep_end = restored_files.begin();
+    for (; keep_end != restored_files.end(); ++keep_end)
+    {
+        if (cache_capacity - cache_used < keep_end->size)
+            break;
+        cache_used += keep_end->size;
+    }
+    for (auto itr = keep_end; itr != restored_files.end(); ++itr)
+    {
+        removeDiskFile(itr->fname);
+    }
+    for (auto itr = std::make_reverse_iterator(keep_end); itr != restored_files.rend(); ++itr)
+    {
+        tables[static_cast<UInt64>(itr->file_type)].set(
+            toS3Key(itr->fname),
+            std::make_shared<FileSegment>(itr->fname, FileSegment::Status::Complete, itr->size, itr->file_type));
+        capacity_metrics->addUsedSize(itr->fname, itr->size);
     }
+    CurrentMetrics::set(CurrentMetrics::DTFileCacheUsed, cache_used);
 
     size_t total_count = 0;
     for (const auto & t : tables)
@@ -621,7 +686,9 @@ void FileCache::restore()
         total_count);
 }
 
-void FileCache::restoreWriteNode(const std::filesystem::directory_entry & write_node_entry)
+void FileCache::restoreWriteNode(
+    const std::filesystem::directory_entry & write_node_entry,
+    std::vector<RestoredFile> & restored_files)
 {
     RUNTIME_CHECK_MSG(write_node_entry.is_directory(), "{} is not a directory", write_node_entry.path());
     auto write_node_data_path = write_node_entry.path() / "data";
@@ -629,20 +696,24 @@ void FileCache::restoreWriteNode(const std::filesystem::directory_entry & write_
         return;
     for (const auto & table_entry : std::filesystem::directory_iterator(write_node_data_path))
     {
-        restoreTable(table_entry);
+        restoreTable(table_entry, restored_files);
     }
 }
 
-void FileCache::restoreTable(const std::filesystem::directory_entry & table_entry)
+void FileCache::restoreTable(
+    const std::filesystem::directory_entry & table_entry,
+    std::vector<RestoredFile> & restored_files)
 {
     RUNTIME_CHECK_MSG(table_entry.is_directory(), "{} is not a directory", table_entry.path());
     for (const auto & dmfile_entry : std::filesystem::directory_iterator(table_entry.path()))
     {
-        restoreDMFile(dmfile_entry);
+        restoreDMFile(dmfile_entry, restored_files);
     }
 }
 
-void FileCache::restoreDMFile(const std::filesystem::directory_entry & dmfile_entry)
+void FileCache::restoreDMFile(
+    const std::filesystem::directory_entry & dmfile_entry,
+    std::vector<RestoredFile> & restored_files)
 {
     RUNTIME_CHECK_MSG(dmfile_entry.is_directory(), "{} is not a directory", dmfile_entry.path());
     for (const auto & file_entry : std::filesystem::directory_iterator(dmfile_entry.path()))
@@ -656,16 +727,14 @@ void FileCache::restoreDMFile(const std::filesystem::directory_entry & dmfile_en
         else
         {
             auto file_type = getFileType(fname);
-            auto & table = tables[static_cast<UInt64>(file_type)];
-            auto size = file_entry.file_size();
-            if (canCache(file_type) && cache_capacity - cache_used >= size)
+            if (canCache(file_type))
             {
-                table.set(
-                    toS3Key(fname),
-                    std::make_shared<FileSegment>(fname, FileSegment::Status::Complete, size, file_type));
-                capacity_metrics->addUsedSize(fname, size);
-                cache_used += size;
-                CurrentMetrics::set(CurrentMetrics::DTFileCacheUsed, cache_used);
+                restored_files.push_back(RestoredFile{
+                    .fname = fname,
+                    .size = file_entry.file_size(),
+                    .file_type = file_type,
+                    .mtime = file_entry.last_write_time(),
+                });
             }
             else
             {
@@ -710,6 +779,24 @@ void FileCache::updateConfig(const Settings & settings)
             cache_min_age);
         cache_min_age_seconds.store(cache_min_age, std::memory_order_relaxed);
     }
+
+    UInt64 max_file_size_limit = settings.dt_filecache_max_file_size;
+    if (max_file_size_limit != max_file_size.load(std::memory_order_relaxed))
+    {
+        LOG_INFO(log, "max_file_size {} => {}", max_file_size.load(std::memory_order_relaxed), max_file_size_limit);
+        max_file_size.store(max_file_size_limit, std::memory_order_relaxed);
+    }
+
+    bool admit_on_second_miss = settings.dt_filecache_admit_data_on_second_miss;
+    if (admit_on_second_miss != admit_data_on_second_miss.load(std::memory_order_relaxed))
+    {
+        LOG_INFO(
+            log,
+            "admit_data_on_second_miss {} => {}",
+            admit_data_on_second_miss.load(std::memory_order_relaxed),
+            admit_on_second_miss);
+        admit_data_on_second_miss.store(admit_on_second_miss, std::memory_order_relaxed);
+    }
 }
 
 } // namespace DB
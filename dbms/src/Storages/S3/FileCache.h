@@ -27,6 +27,7 @@
 #include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <list>
 #include <magic_enum.hpp>
 #include <mutex>
 #include <unordered_map>
@@ -245,10 +246,21 @@ public:
     String toLocalFilename(const String & s3_key);
     String toS3Key(const String & local_fname);
 
+    struct RestoredFile
+    {
+        String fname;
+        UInt64 size;
+        FileSegment::FileType file_type;
+        std::filesystem::file_time_type mtime;
+    };
     void restore();
-    void restoreWriteNode(const std::filesystem::directory_entry & write_node_entry);
-    void restoreTable(const std::filesystem::directory_entry & table_entry);
-    void restoreDMFile(const std::filesystem::directory_entry & dmfile_entry);
+    void restoreWriteNode(
+        const std::filesystem::directory_entry & write_node_entry,
+        std::vector<RestoredFile> & restored_files);
+    void restoreTable(const std::filesystem::directory_entry & table_entry, std::vector<RestoredFile> & restored_files);
+    void restoreDMFile(
+        const std::filesystem::directory_entry & dmfile_entry,
+        std::vector<RestoredFile> & restored_files);
 
     void remove(const String & s3_key, bool force = false);
     std::pair<Int64, std::list<String>::iterator> removeImpl(
@@ -283,6 +295,8 @@ public:
     static FileSegment::FileType getFileType(const String & fname);
     static FileSegment::FileType getFileTypeOfColData(const std::filesystem::path & p);
     bool canCache(FileSegment::FileType file_type) const;
+    // Return false if the data file should not be downloaded on this miss. Must be called with `mtx` locked.
+    bool admitOnMiss(const String & s3_key, FileSegment::FileType file_type);
     bool reserveSpaceImpl(FileSegment::FileType reserve_for, UInt64 size, bool try_evict);
     void releaseSpaceImpl(UInt64 size);
     void releaseSpace(UInt64 size);
@@ -302,7 +316,15 @@ public:
     UInt64 cache_level;
     UInt64 cache_used;
     std::atomic<UInt64> cache_min_age_seconds = 1800;
+    // The files larger than this are not cached, 0 means no limit.
+    std::atomic<UInt64> max_file_size = 0;
     std::atomic<double> max_downloading_count_scale = 1.0;
+    // If true, the data files are downloaded only when they are missed again after the first miss.
+    std::atomic<bool> admit_data_on_second_miss = false;
+    // The data files missed once recently, in the order of the first miss. Protected by `mtx`.
+    static constexpr size_t max_missed_keys = 100000;
+    std::list<String> missed_keys;
+    std::unordered_map<String, std::list<String>::iterator> missed_keys_index;
     std::array<LRUFileTable, magic_enum::enum_count<FileSegment::FileType>()> tables;
 
     // Currently, these variables are just use for testing.
@@ -87,6 +87,8 @@ bool S3GCManager::runOnAllStores()
     // Only the GC Manager node run the GC logic
     if (bool is_gc_owner = gc_owner_manager->isOwner(); !is_gc_owner)
     {
+        // The locks may be changed by another GC owner, list all the lock files after becoming the owner again.
+        last_round_locks.clear();
         return false;
     }
 
@@ -196,11 +198,30 @@ void S3GCManager::runForStore(UInt64 gc_store_id)
     GET_METRIC(tiflash_storage_s3_gc_seconds, type_read_locks)
         .Observe(watch.elapsedMillisecondsFromLastTime() / 1000.0);
 
-    // Scan and remove the expired locks
-    const auto lock_prefix = S3Filename::getLockPrefix();
-    cleanUnusedLocks(gc_store_id, lock_prefix, manifests.latestUploadSequence(), valid_lock_files, gc_timepoint);
+    // Scan and remove the expired locks. All the locks not in the manifests with sequence not larger than the
+    // latest upload sequence are removed by the full scan, so after a full scan, the locks that can be removed are
+    // those removed from the manifests since the last round. Clean them without listing all the lock files, and
+    // only list them once every `lock_full_scan_rounds` rounds.
+    auto last_round = last_round_locks.find(gc_store_id);
+    const bool full_scan = config.lock_full_scan_rounds <= 1 || last_round == last_round_locks.end()
+        || last_round->second.rounds_since_full_scan + 1 >= config.lock_full_scan_rounds;
+    if (full_scan)
+    {
+        const auto lock_prefix = S3Filename::getLockPrefix();
+        cleanUnusedLocks(gc_store_id, lock_prefix, manifests.latestUploadSequence(), valid_lock_files, gc_timepoint);
+    }
+    else
+    {
+        cleanLocksRemovedFromManifest(last_round->second.valid_lock_files, valid_lock_files, gc_timepoint);
+    }
     GET_METRIC(tiflash_storage_s3_gc_seconds, type_clean_locks)
         .Observe(watch.elapsedMillisecondsFromLastTime() / 1000.0);
+    if (config.lock_full_scan_rounds > 1 && !shutdown_called)
+    {
+        auto & this_round = last_round_locks[gc_store_id];
+        this_round.rounds_since_full_scan = full_scan ? 0 : this_round.rounds_since_full_scan + 1;
+        this_round.valid_lock_files = valid_lock_files;
+    }
 
     // clean the outdated manifest objects
     removeOutdatedManifest(manifests, &gc_timepoint);
@@ -244,6 +265,8 @@ void S3GCManager::runForTombstoneStore(UInt64 gc_store_id)
         gc_store_id,
         gc_timepoint.ToGmtString(Aws::Utils::DateFormat::ISO_8601));
 
+    last_round_locks.erase(gc_store_id);
+
     Stopwatch watch;
     // If the store id is tombstone, then run gc on the store as if no locks.
     // Scan and remove all expired locks
@@ -328,6 +351,31 @@ void S3GCManager::cleanUnusedLocks(
     });
 }
 
+void S3GCManager::cleanLocksRemovedFromManifest(
+    const std::unordered_set<String> & prev_valid_lock_files,
+    const std::unordered_set<String> & valid_lock_files,
+    const Aws::Utils::DateTime & timepoint)
+{
+    size_t n_removed = 0;
+    for (const auto & lock_key : prev_valid_lock_files)
+    {
+        if (shutdown_called)
+        {
+            LOG_INFO(log, "shutting down, break");
+            break;
+        }
+        if (valid_lock_files.count(lock_key) > 0)
+            continue;
+
+        // The data file is not used by the store anymore, remove the lock file
+        const auto lock_filename_view = S3FilenameView::fromKey(lock_key);
+        RUNTIME_CHECK(lock_filename_view.isLockFile(), lock_key);
+        cleanOneLock(lock_key, lock_filename_view, timepoint);
+        ++n_removed;
+    }
+    LOG_INFO(log, "clean locks removed from manifest, n_locks={} n_removed={}", valid_lock_files.size(), n_removed);
+}
+
 void S3GCManager::cleanOneLock(
     const String & lock_key,
     const S3FilenameView & lock_filename_view,
@@ -81,6 +81,11 @@ struct S3GCConfig
 
     // The RPC timeout for sending mark delete to S3LockService
     Int64 mark_delete_timeout_seconds = 10;
+
+    // List all the lock files to clean the unused locks of a store once every `lock_full_scan_rounds` GC rounds.
+    // In the other rounds, only the locks removed from the manifests since the last round are cleaned.
+    // 1 means listing the lock files every round.
+    UInt64 lock_full_scan_rounds = 1;
 };
 
 class S3GCManager
@@ -111,6 +116,11 @@ public:
         const std::unordered_set<String> & valid_lock_files,
         const Aws::Utils::DateTime &);
 
+    void cleanLocksRemovedFromManifest(
+        const std::unordered_set<String> & prev_valid_lock_files,
+        const std::unordered_set<String> & valid_lock_files,
+        const Aws::Utils::DateTime &);
+
     void cleanOneLock(const String & lock_key, const S3FilenameView & lock_filename_view, const Aws::Utils::DateTime &);
 
     void tryCleanExpiredDataFiles(UInt64 gc_store_id, const Aws::Utils::DateTime &);
@@ -148,6 +158,14 @@ private:
     bool lifecycle_has_been_set = false;
     S3GCConfig config;
 
+    // The valid locks of each store in the last GC round, only kept when `config.lock_full_scan_rounds` > 1.
+    struct LastRoundLocks
+    {
+        std::unordered_set<String> valid_lock_files;
+        UInt64 rounds_since_full_scan = 0;
+    };
+    std::unordered_map<UInt64, LastRoundLocks> last_round_locks;
+
     LoggerPtr log;
 };
 
@@ -78,6 +78,9 @@ ssize_t S3RandomAccessFile::read(char * buf, size_t size)
 
 ssize_t S3RandomAccessFile::readImpl(char * buf, size_t size)
 {
+    // The body is not reopened when seeking to the end of the object, see `seekImpl`.
+    if (cur_offset >= content_length)
+        return 0;
     Stopwatch sw;
     auto & istr = read_result.GetBody();
     istr.read(buf, size);
@@ -147,6 +150,23 @@ off_t S3RandomAccessFile::seekImpl(off_t offset_, int whence)
     {
         return cur_offset;
     }
+    if (offset_ - cur_offset > max_skip_bytes_by_reading)
+    {
+        // Reading and dropping a large gap costs more than a new GetObject from the target offset.
+        // It is a new request rather than a retry, so it has its own retry times.
+        cur_offset = offset_;
+        // A GetObject from the end of the object is answered with 416, and there is nothing left to read anyway.
+        if (cur_offset == content_length)
+            return cur_offset;
+        cur_retry = 0;
+        if (!initialize())
+        {
+            LOG_ERROR(log, "Cannot reopen at offset={} content_length={}", cur_offset, content_length);
+            return -1;
+        }
+        return cur_offset;
+    }
+
     Stopwatch sw;
     auto & istr = read_result.GetBody();
     if (!istr.ignore(offset_ - cur_offset))
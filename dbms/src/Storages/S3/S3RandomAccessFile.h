@@ -101,6 +101,9 @@ private:
 
     Int32 cur_retry = 0;
     static constexpr Int32 max_retry = 3;
+    // Seek forward by reading from the current stream if the gap is not larger than this, otherwise send a new
+    // GetObject from the target offset.
+    static constexpr off_t max_skip_bytes_by_reading = 1024 * 1024;
 };
 
 } // namespace DB::S3
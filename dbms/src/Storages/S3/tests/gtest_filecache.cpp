@@ -871,4 +871,106 @@ try
 }
 CATCH
 
+
+TEST_F(FileCacheTest, SkipLargeFile)
+try
+{
+    auto objects = genObjects(/*store_count*/ 1, /*table_count*/ 1, /*file_count*/ 2, {"meta"});
+    auto total_size = objectsTotalSize(objects);
+    auto cache_dir = fmt::format("{}/skip_large_file", tmp_dir);
+    StorageRemoteCacheConfig cache_config{.dir = cache_dir, .dtfile_level = 100};
+    calculateCacheCapacity(cache_config, total_size);
+    FileCache file_cache(capacity_metrics, cache_config);
+
+    Settings settings;
+    settings.set("dt_filecache_max_file_size", "1");
+    file_cache.updateConfig(settings);
+    ASSERT_EQ(file_cache.max_file_size, 1);
+
+    // The files with known size larger than the limit are not downloaded
+    for (const auto & obj : objects)
+    {
+        ASSERT_GT(obj.size, 1);
+        ASSERT_EQ(file_cache.get(S3FilenameView::fromKey(obj.key), obj.size), nullptr) << obj.key;
+    }
+    waitForBgDownload(file_cache);
+    ASSERT_EQ(file_cache.bg_download_succ_count.load(std::memory_order_relaxed), 0);
+    ASSERT_EQ(file_cache.cache_used, 0);
+
+    // No limit
+    settings.set("dt_filecache_max_file_size", "0");
+    file_cache.updateConfig(settings);
+    for (const auto & obj : objects)
+        ASSERT_EQ(file_cache.get(S3FilenameView::fromKey(obj.key), obj.size), nullptr) << obj.key;
+    waitForBgDownload(file_cache);
+    ASSERT_EQ(file_cache.bg_download_succ_count.load(std::memory_order_relaxed), objects.size());
+}
+CATCH
+
+TEST_F(FileCacheTest, RestoreNewestFiles)
+try
+{
+    auto objects = genObjects(/*store_count*/ 1, /*table_count*/ 1, /*file_count*/ 3, {"meta"});
+    auto total_size = objectsTotalSize(objects);
+    auto cache_dir = fmt::format("{}/restore_newest_files", tmp_dir);
+    StorageRemoteCacheConfig cache_config{.dir = cache_dir, .dtfile_level = 100};
+    calculateCacheCapacity(cache_config, total_size);
+    {
+        FileCache file_cache(capacity_metrics, cache_config);
+        for (const auto & obj : objects)
+        {
+            ASSERT_EQ(file_cache.get(S3FilenameView::fromKey(obj.key), obj.size), nullptr) << obj.key;
+            waitForBgDownload(file_cache);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_EQ(file_cache.cache_used, total_size);
+    }
+
+    // Restart with the capacity of the last two downloaded files, the first one is removed.
+    calculateCacheCapacity(cache_config, objects[1].size + objects[2].size);
+    FileCache file_cache(capacity_metrics, cache_config);
+    ASSERT_EQ(file_cache.cache_used, objects[1].size + objects[2].size);
+    ASSERT_EQ(file_cache.get(S3FilenameView::fromKey(objects[1].key), objects[1].size), nullptr);
+    for (size_t i = 1; i < objects.size(); ++i)
+    {
+        auto file_seg = file_cache.get(S3FilenameView::fromKey(objects[i].key), objects[i].size);
+        ASSERT_NE(file_seg, nullptr) << objects[i].key;
+        ASSERT_TRUE(file_seg->isReadyToRead());
+    }
+    ASSERT_FALSE(std::filesystem::exists(file_cache.toLocalFilename(objects[0].key)));
+}
+CATCH
+
+TEST_F(FileCacheTest, AdmitDataOnSecondMiss)
+try
+{
+    auto objects = genObjects(/*store_count*/ 1, /*table_count*/ 1, /*file_count*/ 2, {"meta", "1.dat"});
+    auto total_size = objectsTotalSize(objects);
+    auto cache_dir = fmt::format("{}/admit_data_on_second_miss", tmp_dir);
+    StorageRemoteCacheConfig cache_config{.dir = cache_dir, .dtfile_level = 100};
+    calculateCacheCapacity(cache_config, total_size);
+    FileCache file_cache(capacity_metrics, cache_config);
+
+    Settings settings;
+    settings.set("dt_filecache_admit_data_on_second_miss", "true");
+    file_cache.updateConfig(settings);
+    ASSERT_TRUE(file_cache.admit_data_on_second_miss);
+
+    // Only the meta files are downloaded on the first miss
+    for (const auto & obj : objects)
+        ASSERT_EQ(file_cache.get(S3FilenameView::fromKey(obj.key), obj.size), nullptr) << obj.key;
+    waitForBgDownload(file_cache);
+    ASSERT_EQ(file_cache.bg_download_succ_count.load(std::memory_order_relaxed), 2);
+    ASSERT_EQ(file_cache.missed_keys.size(), 2);
+
+    // The data files are downloaded on the second miss
+    for (const auto & obj : objects)
+        file_cache.get(S3FilenameView::fromKey(obj.key), obj.size);
+    waitForBgDownload(file_cache);
+    ASSERT_EQ(file_cache.bg_download_succ_count.load(std::memory_order_relaxed), objects.size());
+    ASSERT_TRUE(file_cache.missed_keys.empty());
+    ASSERT_TRUE(file_cache.missed_keys_index.empty());
+}
+CATCH
+
 } // namespace DB::tests::S3
@@ -253,6 +253,26 @@ try
         std::iota(expected.begin(), expected.end(), 1);
         ASSERT_EQ(tmp_buf, expected);
     }
+    {
+        // A large gap is skipped by a new GetObject
+        auto offset = file.seek(1024 * 1024 * 5 + 2, SEEK_SET);
+        ASSERT_EQ(offset, 1024 * 1024 * 5 + 2);
+        std::vector<char> tmp_buf(256);
+        auto n = file.read(tmp_buf.data(), tmp_buf.size());
+        ASSERT_EQ(n, tmp_buf.size());
+
+        std::vector<char> expected(256);
+        std::iota(expected.begin(), expected.end(), 2);
+        ASSERT_EQ(tmp_buf, expected);
+    }
+    {
+        // Seek to the end of the object over a large gap
+        auto offset = file.seek(size, SEEK_SET);
+        ASSERT_EQ(offset, size);
+        std::vector<char> tmp_buf(256);
+        auto n = file.read(tmp_buf.data(), tmp_buf.size());
+        ASSERT_EQ(n, 0);
+    }
 }
 CATCH
 
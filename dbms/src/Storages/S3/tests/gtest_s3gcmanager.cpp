@@ -602,6 +602,32 @@ try
 }
 CATCH
 
+TEST_F(S3GCManagerTest, CleanLocksRemovedFromManifest)
+try
+{
+    StoreID store_id = 20;
+    StoreID lock_store_id = 21;
+    UInt64 sequence = 100;
+
+    auto df_valid = S3Filename::newCheckpointData(store_id, 300, 1);
+    auto lock_valid = df_valid.toView().getLockKey(lock_store_id, sequence);
+    auto df_removed = S3Filename::newCheckpointData(store_id, 300, 2);
+    auto lock_removed = df_removed.toView().getLockKey(lock_store_id, sequence);
+    for (const auto & k : {df_valid.toFullKey(), lock_valid, df_removed.toFullKey(), lock_removed})
+        uploadEmptyFile(*mock_s3_client, k);
+
+    std::unordered_set<String> prev_valid_lock_files{lock_valid, lock_removed};
+    std::unordered_set<String> valid_lock_files{lock_valid};
+    auto timepoint = Aws::Utils::DateTime("2023-02-01T08:00:00Z", Aws::Utils::DateFormat::ISO_8601);
+    gc_mgr->cleanLocksRemovedFromManifest(prev_valid_lock_files, valid_lock_files, timepoint);
+
+    // Only the lock removed from the manifest is deleted, and the delmark of its data file is created
+    ASSERT_TRUE(S3::objectExists(*mock_s3_client, lock_valid));
+    ASSERT_FALSE(S3::objectExists(*mock_s3_client, df_valid.toView().getDelMarkKey()));
+    ASSERT_FALSE(S3::objectExists(*mock_s3_client, lock_removed));
+    ASSERT_TRUE(S3::objectExists(*mock_s3_client, df_removed.toView().getDelMarkKey()));
+}
+CATCH
 
 TEST_F(S3GCManagerTest, ReadManifestFromS3)
 try
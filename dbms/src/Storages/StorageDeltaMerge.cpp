@@ -906,13 +906,14 @@ DM::PushDownFilterPtr StorageDeltaMerge::parsePushDownFilter(
     // build push down filter
     const auto & columns_to_read_info = dag_query->source_columns;
     const auto & pushed_down_filters = dag_query->pushed_down_filters;
+    DM::PushDownFilterPtr filter;
     if (unlikely(context.getSettingsRef().force_push_down_all_filters_to_scan) && !dag_query->filters.empty())
     {
         google::protobuf::RepeatedPtrField<tipb::Expr> merged_filters{
             pushed_down_filters.begin(),
             pushed_down_filters.end()};
         merged_filters.MergeFrom(dag_query->filters);
-        return buildPushDownFilter(
+        filter = buildPushDownFilter(
             rs_operator,
             columns_to_read_info,
             merged_filters,
@@ -920,13 +921,45 @@ DM::PushDownFilterPtr StorageDeltaMerge::parsePushDownFilter(
             context,
             tracing_logger);
     }
-    return buildPushDownFilter(
-        rs_operator,
-        columns_to_read_info,
-        pushed_down_filters,
-        columns_to_read,
-        context,
-        tracing_logger);
+    else
+    {
+        filter = buildPushDownFilter(
+            rs_operator,
+            columns_to_read_info,
+            pushed_down_filters,
+            columns_to_read,
+            context,
+            tracing_logger);
+    }
+    return attachTopNThreshold(filter, dag_query, columns_to_read, context, tracing_logger);
+}
+
+DM::PushDownFilterPtr StorageDeltaMerge::attachTopNThreshold(
+    DM::PushDownFilterPtr filter,
+    const std::unique_ptr<DAGQueryInfo> & dag_query,
+    const ColumnDefines & columns_to_read,
+    const Context & context,
+    const LoggerPtr & tracing_logger)
+{
+    const auto & topn_threshold = dag_query->topn_threshold;
+    if (topn_threshold == nullptr || !context.getSettingsRef().dt_enable_rough_set_filter)
+        return filter;
+
+    auto iter = std::find_if(columns_to_read.begin(), columns_to_read.end(), [&](const ColumnDefine & d) {
+        return d.id == topn_threshold->column_id;
+    });
+    if (iter == columns_to_read.end())
+        return filter;
+
+    if (filter == EMPTY_FILTER)
+        filter = std::make_shared<PushDownFilter>(EMPTY_RS_OPERATOR);
+    filter->setTopNThreshold(topn_threshold, Attr{.col_name = iter->name, .col_id = iter->id, .type = iter->type});
+    LOG_DEBUG(
+        tracing_logger,
+        "TopN threshold: column_id={} is_desc={}",
+        topn_threshold->column_id,
+        topn_threshold->is_desc);
+    return filter;
 }
 
 BlockInputStreams StorageDeltaMerge::read(
@@ -989,7 +1022,8 @@ BlockInputStreams StorageDeltaMerge::read(
         max_block_size,
         parseSegmentSet(select_query.segment_expression_list),
         extra_table_id_index,
-        scan_context);
+        scan_context,
+        /* count_only */ query_info.dag_query != nullptr && query_info.dag_query->count_only);
 
     auto keyspace_id = getTableInfo().getKeyspaceID();
     /// Ensure read_tso info after read.
@@ -1080,7 +1114,8 @@ void StorageDeltaMerge::read(
         max_block_size,
         parseSegmentSet(select_query.segment_expression_list),
         extra_table_id_index,
-        scan_context);
+        scan_context,
+        /* count_only */ query_info.dag_query != nullptr && query_info.dag_query->count_only);
 
     auto keyspace_id = getTableInfo().getKeyspaceID();
     /// Ensure read_tso info after read.
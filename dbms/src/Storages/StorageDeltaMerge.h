@@ -265,6 +265,14 @@ private:
         const Context & context,
         const LoggerPtr & tracing_logger);
 
+    /// Attach the threshold of the TopN above the table scan to `filter`, if any.
+    static DM::PushDownFilterPtr attachTopNThreshold(
+        DM::PushDownFilterPtr filter,
+        const std::unique_ptr<DAGQueryInfo> & dag_query,
+        const DM::ColumnDefines & columns_to_read,
+        const Context & context,
+        const LoggerPtr & tracing_logger);
+
     DM::RowKeyRanges parseMvccQueryInfo(
         const DB::MvccQueryInfo & mvcc_query_info,
         unsigned num_streams,
@@ -68,6 +68,11 @@ StorageSystemDTSegments::StorageSystemDTSegments(const std::string & name_)
         {"stable_dmfiles_size", std::make_shared<DataTypeUInt64>()},
         {"stable_dmfiles_size_on_disk", std::make_shared<DataTypeUInt64>()},
         {"stable_dmfiles_packs", std::make_shared<DataTypeUInt64>()},
+
+        {"read_full_scans", std::make_shared<DataTypeUInt64>()},
+        {"read_range_reads", std::make_shared<DataTypeUInt64>()},
+        {"read_pattern", std::make_shared<DataTypeString>()},
+        {"adaptive_stable_pack_rows", std::make_shared<DataTypeUInt64>()},
     }));
 }
 
@@ -151,6 +156,11 @@ BlockInputStreams StorageSystemDTSegments::read(
                 res_columns[j++]->insert(stat.stable_dmfiles_size);
                 res_columns[j++]->insert(stat.stable_dmfiles_size_on_disk);
                 res_columns[j++]->insert(stat.stable_dmfiles_packs);
+
+                res_columns[j++]->insert(stat.read_full_scans);
+                res_columns[j++]->insert(stat.read_range_reads);
+                res_columns[j++]->insert(stat.read_pattern);
+                res_columns[j++]->insert(stat.adaptive_stable_pack_rows);
             }
         }
     }
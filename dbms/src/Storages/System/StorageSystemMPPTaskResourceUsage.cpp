@@ -0,0 +1,87 @@
+// Copyright 2023 PingCAP, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnsNumber.h>
+#include <DataStreams/OneBlockInputStream.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Flash/Mpp/MPPTaskResourceUsageHistory.h>
+#include <Storages/System/StorageSystemMPPTaskResourceUsage.h>
+
+
+namespace DB
+{
+StorageSystemMPPTaskResourceUsage::StorageSystemMPPTaskResourceUsage(const std::string & name_)
+    : name(name_)
+{
+    setColumns(ColumnsDescription({
+        {"query_tso", std::make_shared<DataTypeUInt64>()},
+        {"task_id", std::make_shared<DataTypeInt64>()},
+        {"status", std::make_shared<DataTypeString>()},
+        {"task_start_timestamp", std::make_shared<DataTypeInt64>()},
+        {"task_end_timestamp", std::make_shared<DataTypeInt64>()},
+        {"cpu_ru", std::make_shared<DataTypeFloat64>()},
+        {"read_ru", std::make_shared<DataTypeFloat64>()},
+        {"memory_peak", std::make_shared<DataTypeInt64>()},
+        {"local_input_bytes", std::make_shared<DataTypeInt64>()},
+        {"remote_input_bytes", std::make_shared<DataTypeInt64>()},
+        {"output_bytes", std::make_shared<DataTypeInt64>()},
+        {"user_read_bytes", std::make_shared<DataTypeUInt64>()},
+        {"dmfile_read_time_ns", std::make_shared<DataTypeUInt64>()},
+        {"disagg_read_cache_hit_bytes", std::make_shared<DataTypeUInt64>()},
+        {"disagg_read_cache_miss_bytes", std::make_shared<DataTypeUInt64>()},
+    }));
+}
+
+
+BlockInputStreams StorageSystemMPPTaskResourceUsage::read(
+    const Names & column_names,
+    const SelectQueryInfo &,
+    const Context &,
+    QueryProcessingStage::Enum & processed_stage,
+    const size_t /*max_block_size*/,
+    const unsigned /*num_streams*/)
+{
+    check(column_names);
+    processed_stage = QueryProcessingStage::FetchColumns;
+
+    MutableColumns res_columns = getSampleBlock().cloneEmptyColumns();
+
+    for (const auto & usage : MPPTaskResourceUsageHistory::instance().getAll())
+    {
+        size_t i = 0;
+        res_columns[i++]->insert(usage.query_tso);
+        res_columns[i++]->insert(usage.task_id);
+        res_columns[i++]->insert(usage.status);
+        res_columns[i++]->insert(usage.task_start_timestamp);
+        res_columns[i++]->insert(usage.task_end_timestamp);
+        res_columns[i++]->insert(static_cast<Float64>(usage.cpu_ru));
+        res_columns[i++]->insert(static_cast<Float64>(usage.read_ru));
+        res_columns[i++]->insert(usage.memory_peak);
+        res_columns[i++]->insert(usage.local_input_bytes);
+        res_columns[i++]->insert(usage.remote_input_bytes);
+        res_columns[i++]->insert(usage.output_bytes);
+        res_columns[i++]->insert(usage.user_read_bytes);
+        res_columns[i++]->insert(usage.dmfile_read_time_ns);
+        res_columns[i++]->insert(usage.disagg_read_cache_hit_bytes);
+        res_columns[i++]->insert(usage.disagg_read_cache_miss_bytes);
+    }
+
+    return BlockInputStreams(
+        1,
+        std::make_shared<OneBlockInputStream>(getSampleBlock().cloneWithColumns(std::move(res_columns))));
+}
+
+} // namespace DB
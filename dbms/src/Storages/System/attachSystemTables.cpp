@@ -22,6 +22,7 @@
 #include <Storages/System/StorageSystemEvents.h>
 #include <Storages/System/StorageSystemFunctions.h>
 #include <Storages/System/StorageSystemGraphite.h>
+#include <Storages/System/StorageSystemMPPTaskResourceUsage.h>
 #include <Storages/System/StorageSystemMacros.h>
 #include <Storages/System/StorageSystemMetrics.h>
 #include <Storages/System/StorageSystemNumbers.h>
@@ -57,6 +58,9 @@ void attachSystemTablesServer(IDatabase & system_database)
     system_database.attachTable("metrics", StorageSystemMetrics::create("metrics"));
     system_database.attachTable("graphite_retentions", StorageSystemGraphite::create("graphite_retentions"));
     system_database.attachTable("macros", StorageSystemMacros::create("macros"));
+    system_database.attachTable(
+        "mpp_task_resource_usage",
+        StorageSystemMPPTaskResourceUsage::create("mpp_task_resource_usage"));
 }
 
 void attachSystemTablesAsync(IDatabase & system_database, AsynchronousMetrics & async_metrics)
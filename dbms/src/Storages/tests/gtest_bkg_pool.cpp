@@ -17,6 +17,7 @@
 #include <common/logger_useful.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <limits>
 #include <thread>
@@ -77,4 +78,43 @@ TEST(BackgroundProcessingPoolTest, FixedInterval)
         << fmt::format("actual_called={} min_diff_ms={}", num_actual_called, min_diff_ms);
 }
 
+TEST(BackgroundProcessingPoolTest, WakeWhileWaitingForOtherTask)
+{
+    BackgroundProcessingPool pool(1, "test");
+
+    using namespace std::chrono_literals;
+    std::atomic<Int64> num_slow_called = 0;
+    std::atomic<Int64> num_urgent_called = 0;
+    // After the first run, the only thread waits for this task to be ready in 1 hour
+    auto slow_task = pool.addTask(
+        [&]() {
+            num_slow_called += 1;
+            return false;
+        },
+        /*multi*/ false,
+        /*interval_ms*/ 3600 * 1000);
+    // the thread sleeps for a random time less than 1 second before running tasks
+    std::this_thread::sleep_for(1500ms);
+    ASSERT_EQ(num_slow_called, 1);
+
+    auto urgent_task = pool.addTask(
+        [&]() {
+            num_urgent_called += 1;
+            return false;
+        },
+        /*multi*/ false,
+        /*interval_ms*/ 3600 * 1000);
+    std::this_thread::sleep_for(500ms);
+    ASSERT_EQ(num_urgent_called, 1);
+
+    // wake up the urgent task, the slow task should not be run ahead of its time
+    urgent_task->wake();
+    std::this_thread::sleep_for(500ms);
+    ASSERT_EQ(num_urgent_called, 2);
+    ASSERT_EQ(num_slow_called, 1);
+
+    pool.removeTask(urgent_task);
+    pool.removeTask(slow_task);
+}
+
 } // namespace DB::tests
@@ -988,4 +988,25 @@ try
 }
 CATCH
 
+TEST_F(ParsePushDownFilterTest, Selectivity)
+try
+{
+    DM::PushDownFilterSelectivity selectivity;
+    // Not enough rows are sampled
+    selectivity.record(100, 100);
+    ASSERT_FALSE(selectivity.isUnselective(1000, 0.8));
+    // 0 means never fall back
+    ASSERT_FALSE(selectivity.isUnselective(0, 0.8));
+
+    selectivity.record(900, 800);
+    // 900 rows of 1000 rows passed
+    ASSERT_TRUE(selectivity.isUnselective(1000, 0.8));
+    ASSERT_TRUE(selectivity.isUnselective(1000, 0.9));
+    ASSERT_FALSE(selectivity.isUnselective(1000, 0.95));
+
+    selectivity.record(1000, 0);
+    ASSERT_FALSE(selectivity.isUnselective(1000, 0.8));
+}
+CATCH
+
 } // namespace DB::tests
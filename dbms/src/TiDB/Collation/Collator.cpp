@@ -16,6 +16,7 @@
 #include <Poco/String.h>
 #include <TiDB/Collation/Collator.h>
 #include <TiDB/Collation/CollatorUtils.h>
+#include <common/unaligned.h>
 
 #include <cassert>
 #include <unordered_map>
@@ -71,6 +72,26 @@ inline Rune decodeUtf8Char(const char * s, size_t & offset)
     return c;
 }
 
+/// Return the length of the common prefix of two strings, moved back to the start of a utf8 character.
+/// The ci collations weigh every character on its own, so the weights of the common prefix are the same and the
+/// comparison can start after it. Mostly-ASCII strings that share a long prefix are compared 8 bytes at a time.
+inline size_t commonCharPrefixLength(const char * s1, size_t length1, const char * s2, size_t length2)
+{
+    const size_t length = std::min(length1, length2);
+    size_t i = 0;
+    while (i + sizeof(uint64_t) <= length && unalignedLoad<uint64_t>(s1 + i) == unalignedLoad<uint64_t>(s2 + i))
+        i += sizeof(uint64_t);
+    while (i < length && s1[i] == s2[i])
+        ++i;
+
+    auto is_continuation_byte = [](const char * s, size_t s_length, size_t pos) {
+        return pos < s_length && (static_cast<uint8_t>(s[pos]) & 0xC0) == 0x80;
+    };
+    while (i > 0 && (is_continuation_byte(s1, length1, i) || is_continuation_byte(s2, length2, i)))
+        --i;
+    return i;
+}
+
 template <typename Collator>
 class Pattern : public ITiDBCollator::IPattern
 {
@@ -239,7 +260,8 @@ public:
         auto v1 = rtrim(s1, length1);
         auto v2 = rtrim(s2, length2);
 
-        size_t offset1 = 0, offset2 = 0;
+        size_t offset1 = commonCharPrefixLength(s1, v1.length(), s2, v2.length());
+        size_t offset2 = offset1;
         while (offset1 < v1.length() && offset2 < v2.length())
         {
             auto c1 = decodeChar(s1, offset1);
@@ -378,8 +400,9 @@ public:
     {
         std::string_view v1 = preprocess(s1, length1), v2 = preprocess(s2, length2);
 
-        size_t offset1 = 0, offset2 = 0;
         size_t v1_length = v1.length(), v2_length = v2.length();
+        size_t offset1 = commonCharPrefixLength(s1, v1_length, s2, v2_length);
+        size_t offset2 = offset1;
 
         // since the longest weight of character in unicode ci has 128bit, we divide it to 2 uint64.
         // The xx_first stand for the first 64bit, and the xx_second stand for the second 64bit.
@@ -800,8 +800,12 @@ std::vector<JsonBinary> JsonBinary::extract(const std::vector<JsonPathExprRefCon
     std::vector<JsonBinary> extracted_json_binary_vec;
     for (const auto & path_expr_container : path_expr_container_vec)
     {
-        DupCheckSet dup_check_set = std::make_unique<std::unordered_set<const char *>>();
         const auto * first_path_ref = path_expr_container->firstRef();
+        // Only '**' can reach the same value twice, skip the allocation of the set for the other paths.
+        DupCheckSet dup_check_set;
+        if (first_path_ref
+            && (first_path_ref->getFlag() & JsonPathExpr::JsonPathExpressionContainsDoubleAsterisk) != 0)
+            dup_check_set = std::make_unique<std::unordered_set<const char *>>();
         extractTo(extracted_json_binary_vec, first_path_ref, dup_check_set, false);
     }
     return extracted_json_binary_vec;
@@ -37,13 +37,26 @@ static void encodeUInt(T u, WriteBuffer & ss)
     ss.write(reinterpret_cast<const char *>(&u), sizeof(u));
 }
 
+/// A view of the little-endian integers array in the encoded row, which reads the elements in place.
 template <typename Target, typename Source>
-static void decodeUInts(size_t & cursor, const TiKVValue::Base & raw_value, size_t n, std::vector<Target> & target)
+struct LittleEndianArrayView
 {
-    target.reserve(n);
-    for (size_t i = 0; i < n; i++)
-        target.emplace_back(decodeUInt<Source>(cursor, raw_value));
-}
+    LittleEndianArrayView(size_t & cursor, const TiKVValue::Base & raw_value, size_t n)
+        : data(raw_value.data() + cursor)
+        , num(n)
+    {
+        cursor += n * sizeof(Source);
+    }
+
+    size_t size() const { return num; }
+    Target operator[](size_t i) const
+    {
+        return static_cast<Target>(readLittleEndian<Source>(data + i * sizeof(Source)));
+    }
+
+    const char * data;
+    size_t num;
+};
 
 template <typename Target, typename Sign, typename = std::enable_if_t<std::is_signed_v<Sign>>>
 static std::make_signed_t<Target> castIntWithLength(Sign i)
@@ -437,24 +450,13 @@ bool appendRowV2ToBlockImpl(
     size_t cursor = 2; // Skip the initial codec ver and row flag.
     size_t num_not_null_columns = decodeUInt<UInt16>(cursor, raw_value);
     size_t num_null_columns = decodeUInt<UInt16>(cursor, raw_value);
-    std::vector<ColumnID> not_null_column_ids;
-    std::vector<ColumnID> null_column_ids;
-    std::vector<size_t> value_offsets;
-    decodeUInts<ColumnID, typename RowV2::Types<is_big>::ColumnIDType>(
-        cursor,
-        raw_value,
-        num_not_null_columns,
-        not_null_column_ids);
-    decodeUInts<ColumnID, typename RowV2::Types<is_big>::ColumnIDType>(
-        cursor,
-        raw_value,
-        num_null_columns,
-        null_column_ids);
-    decodeUInts<size_t, typename RowV2::Types<is_big>::ValueOffsetType>(
-        cursor,
-        raw_value,
-        num_not_null_columns,
-        value_offsets);
+    // Read the column ids and value offsets in place instead of decoding them into vectors,
+    // which costs 3 allocations for every row.
+    using ColumnIDType = typename RowV2::Types<is_big>::ColumnIDType;
+    using ValueOffsetType = typename RowV2::Types<is_big>::ValueOffsetType;
+    const LittleEndianArrayView<ColumnID, ColumnIDType> not_null_column_ids(cursor, raw_value, num_not_null_columns);
+    const LittleEndianArrayView<ColumnID, ColumnIDType> null_column_ids(cursor, raw_value, num_null_columns);
+    const LittleEndianArrayView<size_t, ValueOffsetType> value_offsets(cursor, raw_value, num_not_null_columns);
     size_t values_start_pos = cursor;
     size_t idx_not_null = 0;
     size_t idx_null = 0;
@@ -98,17 +98,18 @@ void SchemaBuilder<Getter, NameMapper>::applyCreateTable(DatabaseID database_id,
     applyCreateStorageInstance(database_id, table_info, get_by_mvcc);
 
     // Register the partition_id -> logical_table_id mapping
+    std::vector<TableID> partition_ids;
+    partition_ids.reserve(table_info->partition.definitions.size());
     for (const auto & part_def : table_info->partition.definitions)
-    {
-        LOG_DEBUG(
-            log,
-            "register table to table_id_map for partition table, database_id={} logical_table_id={} "
-            "physical_table_id={}",
-            database_id,
-            table_id,
-            part_def.id);
-        table_id_map.emplacePartitionTableID(part_def.id, table_id);
-    }
+        partition_ids.emplace_back(part_def.id);
+    table_id_map.emplacePartitionTableIDs(partition_ids, table_id);
+    LOG_DEBUG(
+        log,
+        "register table to table_id_map for partition table, database_id={} logical_table_id={} "
+        "physical_table_ids={}",
+        database_id,
+        table_id,
+        partition_ids);
 }
 
 template <typename Getter, typename NameMapper>
@@ -585,13 +586,14 @@ void SchemaBuilder<Getter, NameMapper>::applyPartitionDiffOnLogicalTable(
         }
     }
 
+    std::vector<TableID> added_part_ids;
     for (const auto & new_def : new_defs)
     {
         if (!local_part_id_set.contains(new_def.id))
-        {
-            table_id_map.emplacePartitionTableID(new_def.id, updated_table_info.id);
-        }
+            added_part_ids.emplace_back(new_def.id);
     }
+    // Register the new partitions under one lock, a DDL may add thousands of partitions
+    table_id_map.emplacePartitionTableIDs(added_part_ids, updated_table_info.id);
 
     auto alter_lock = storage->lockForAlter(getThreadNameAndID());
     storage->alterSchemaChange(
@@ -1326,16 +1328,17 @@ void SchemaBuilder<Getter, NameMapper>::syncAllSchema()
                 applyCreateStorageInstance(db_info->id, table_info, false);
                 if (table_info->isLogicalPartitionTable())
                 {
+                    std::vector<TableID> partition_ids;
+                    partition_ids.reserve(table_info->partition.definitions.size());
                     for (const auto & part_def : table_info->partition.definitions)
-                    {
-                        LOG_DEBUG(
-                            log,
-                            "register table to table_id_map for partition table, logical_table_id={} "
-                            "physical_table_id={}",
-                            table_info->id,
-                            part_def.id);
-                        table_id_map.emplacePartitionTableID(part_def.id, table_info->id);
-                    }
+                        partition_ids.emplace_back(part_def.id);
+                    table_id_map.emplacePartitionTableIDs(partition_ids, table_info->id);
+                    LOG_DEBUG(
+                        log,
+                        "register table to table_id_map for partition table, logical_table_id={} "
+                        "physical_table_ids={}",
+                        table_info->id,
+                        partition_ids);
                 }
             }
         };
@@ -54,6 +54,17 @@ struct TableIDMap
         doEmplacePartitionTableID(partition_id, table_id, "", lock);
     }
 
+    /// Register a batch of partitions of the same logical table with one lock, so that the readers
+    /// are not blocked again and again when a DDL creates or adds thousands of partitions.
+    void emplacePartitionTableIDs(const std::vector<TableID> & partition_ids, TableID table_id)
+    {
+        if (partition_ids.empty())
+            return;
+        std::unique_lock lock(mtx_id_mapping);
+        for (const auto partition_id : partition_ids)
+            doEmplacePartitionTableID(partition_id, table_id, "", lock);
+    }
+
     void exchangeTablePartition(
         DatabaseID non_partition_database_id,
         TableID non_partition_table_id,
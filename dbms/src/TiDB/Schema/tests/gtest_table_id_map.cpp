@@ -83,6 +83,26 @@ TEST_F(TableIDMapTest, Basic)
     ASSERT_MAPPING_EQ(std::make_tuple(false, 0, 0), mapping.findDatabaseIDAndLogicalTableID(901));
 }
 
+TEST_F(TableIDMapTest, EmplacePartitionsInBatch)
+{
+    TableIDMap mapping(log);
+
+    mapping.emplaceTableID(100, 2);
+    mapping.emplacePartitionTableIDs({}, 100);
+    mapping.emplacePartitionTableIDs({101, 102, 103}, 100);
+    ASSERT_EQ(mapping.findTableIDInPartitionMap(101), 100);
+    ASSERT_EQ(mapping.findTableIDInPartitionMap(102), 100);
+    ASSERT_EQ(mapping.findTableIDInPartitionMap(103), 100);
+    ASSERT_MAPPING_EQ(std::make_tuple(true, 2, 100), mapping.findDatabaseIDAndLogicalTableID(103));
+
+    // the existing mapping is overwritten
+    mapping.emplaceTableID(200, 2);
+    mapping.emplacePartitionTableIDs({103, 201}, 200);
+    ASSERT_EQ(mapping.findTableIDInPartitionMap(102), 100);
+    ASSERT_EQ(mapping.findTableIDInPartitionMap(103), 200);
+    ASSERT_EQ(mapping.findTableIDInPartitionMap(201), 200);
+}
+
 TEST_F(TableIDMapTest, ExchangePartition)
 {
     TableIDMap mapping(log);
@@ -62,6 +62,10 @@ const typename CollatorCases::CompareCase CollatorCases::cmp_cases[] = {
     {"𐐭", "𐐨", {1, 1, 0, 1, 0, 1, 1}},
     // Issue https://github.com/pingcap/tics/issues/1660
     {"謺", "譂", {-1, -1, -1, -1, -1, -1, -1}},
+    // Long common prefixes, the strings differ in a continuation byte or in a lead byte.
+    {"abcdefghijklmnopÀ", "abcdefghijklmnopÁ", {-1, -1, 0, -1, 0, 0, -1}},
+    {"abcdefghijklmnopA", "abcdefghijklmnopa", {-1, -1, 0, -1, 0, 0, -1}},
+    {"hello world, 你好", "hello world, 你们", {1, 1, 1, 1, 1, 1, 1}},
 };
 #define PREVENT_TRUNC(s) \
     {                    \